@@ -19,9 +19,12 @@
 **/
 
 #include "DiagnosticsService.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/cache_db/RocksTuning.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/handlers/DiagnosticHandlers.h"
+#include "catapult/io/BlockStorageCache.h"
 #include "catapult/plugins/PluginManager.h"
 
 namespace catapult { namespace diagnostics {
@@ -41,6 +44,59 @@ namespace catapult { namespace diagnostics {
 			});
 		}
 
+		template<typename TSource>
+		using StatisticsAccessor = uint64_t (*)(const std::decay_t<decltype(std::declval<const TSource&>().statistics())>&);
+
+		template<typename TSource>
+		void AddStatisticsCounters(
+				std::vector<utils::DiagnosticCounter>& counters,
+				const TSource& source,
+				std::initializer_list<std::pair<const char*, StatisticsAccessor<TSource>>> namedAccessors) {
+			for (const auto& pair : namedAccessors) {
+				auto accessor = pair.second;
+				counters.emplace_back(utils::DiagnosticCounterId(pair.first), [&source, accessor]() {
+					return accessor(source.statistics());
+				});
+			}
+		}
+
+		void AddBlockStorageCacheCounters(std::vector<utils::DiagnosticCounter>& counters, const io::BlockStorageCache& storage) {
+			AddStatisticsCounters(counters, storage, {
+				{ "STOR BLK HIT", [](const auto& statistics) { return statistics.BlockHits; } },
+				{ "STOR BLK MISS", [](const auto& statistics) { return statistics.BlockMisses; } },
+				{ "STOR HSH HIT", [](const auto& statistics) { return statistics.HashHits; } },
+				{ "STOR HSH MISS", [](const auto& statistics) { return statistics.HashMisses; } }
+			});
+		}
+
+		void AddPatriciaTreeNodeCacheCounters(
+				std::vector<utils::DiagnosticCounter>& counters,
+				const cache::PatriciaTreeNodeCache& nodeCache) {
+			AddStatisticsCounters(counters, nodeCache, {
+				{ "PT CACHE SIZE", [](const auto& statistics) { return statistics.Size; } },
+				{ "PT CACHE HIT", [](const auto& statistics) { return statistics.Hits; } },
+				{ "PT CACHE MISS", [](const auto& statistics) { return statistics.Misses; } }
+			});
+		}
+
+		void AddCacheDatabaseCounters(std::vector<utils::DiagnosticCounter>& counters, const cache::RocksTuning& tuning) {
+			if (tuning.hasSharedBlockCache())
+				counters.emplace_back(utils::DiagnosticCounterId("RDB BC USAGE"), [&tuning]() { return tuning.blockCacheUsage(); });
+
+			if (!tuning.hasStatistics())
+				return;
+
+			AddStatisticsCounters(counters, tuning, {
+				{ "RDB BC HIT", [](const auto& statistics) { return statistics.BlockCacheHits; } },
+				{ "RDB BC MISS", [](const auto& statistics) { return statistics.BlockCacheMisses; } },
+				{ "RDB BLOOM USE", [](const auto& statistics) { return statistics.BloomFilterUseful; } },
+				{ "RDB MEM HIT", [](const auto& statistics) { return statistics.MemtableHits; } },
+				{ "RDB BYTES RD", [](const auto& statistics) { return statistics.BytesRead; } },
+				{ "RDB BYTES WR", [](const auto& statistics) { return statistics.BytesWritten; } },
+				{ "RDB WAL SYNC", [](const auto& statistics) { return statistics.WalSyncs; } }
+			});
+		}
+
 		void AddDiagnosticHandlers(const std::vector<utils::DiagnosticCounter>& counters, extensions::ServiceState& state) {
 			auto& handlers = state.packetHandlers();
 			handlers::RegisterDiagnosticCountersHandler(handlers, counters);
@@ -62,6 +118,15 @@ namespace catapult { namespace diagnostics {
 				// merge all counters
 				auto counters = state.counters();
 				counters.insert(counters.end(), locator.counters().cbegin(), locator.counters().cend());
+				AddBlockStorageCacheCounters(counters, state.storage());
+
+				const auto* pPatriciaTreeNodeCache = state.pluginManager().patriciaTreeNodeCache();
+				if (pPatriciaTreeNodeCache)
+					AddPatriciaTreeNodeCacheCounters(counters, *pPatriciaTreeNodeCache);
+
+				const auto* pCacheDatabaseTuning = state.pluginManager().cacheDatabaseTuning();
+				if (pCacheDatabaseTuning)
+					AddCacheDatabaseCounters(counters, *pCacheDatabaseTuning);
 
 				// add task
 				state.tasks().push_back(CreateLoggingTask(counters));
@@ -80,9 +80,9 @@ namespace catapult { namespace diagnostics {
 		EXPECT_EQ(&context.testState().state().cache(), capture.pCache);
 	}
 
-	TEST(TEST_CLASS, CountersAreSourcedFromLocatorAndState) {
+	TEST(TEST_CLASS, CountersAreSourcedFromLocatorStateAndStorage) {
 		// Arrange: add counters to different sources
-		constexpr auto Num_Counters = 2u;
+		constexpr auto Num_Counters = 6u;
 		TestContext context;
 		context.locator().registerServiceCounter<uint32_t>("A SERVICE", "ALPHA", [](const auto&) { return 0u; });
 		context.testState().counters().push_back(utils::DiagnosticCounter(utils::DiagnosticCounterId("BETA"), []() { return 1u; }));
@@ -110,6 +110,9 @@ namespace catapult { namespace diagnostics {
 		}
 
 		EXPECT_EQ(Num_Counters, actualCounterNames.size());
-		EXPECT_EQ(std::set<std::string>({ "ALPHA", "BETA" }), actualCounterNames);
+		std::set<std::string> expectedCounterNames{
+			"ALPHA", "BETA", "STOR BLK HIT", "STOR BLK MISS", "STOR HSH HIT", "STOR HSH MISS"
+		};
+		EXPECT_EQ(expectedCounterNames, actualCounterNames);
 	}
 }}
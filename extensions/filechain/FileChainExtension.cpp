@@ -19,14 +19,35 @@
 **/
 
 #include "src/FileBlockChainStorage.h"
+#include "src/StateJournal.h"
 #include "catapult/extensions/LocalNodeBootstrapper.h"
+#include "catapult/utils/Logging.h"
 
 namespace catapult { namespace filechain {
 
 	namespace {
 		void RegisterExtension(extensions::LocalNodeBootstrapper& bootstrapper) {
-			// register storage
-			bootstrapper.extensionManager().setBlockChainStorage(CreateFileBlockChainStorage());
+			const auto& config = bootstrapper.config();
+			if (0 != config.Node.StateCheckpointInterval && config.Node.ShouldUseCacheDatabaseStorage)
+				CATAPULT_LOG(warning) << "state checkpoints are disabled because cache database storage is enabled";
+
+			if (0 == config.Node.StateCheckpointInterval || config.Node.ShouldUseCacheDatabaseStorage) {
+				// register storage
+				bootstrapper.extensionManager().setBlockChainStorage(CreateFileBlockChainStorage());
+				return;
+			}
+
+			// create state journal
+			auto pCheckpointPool = bootstrapper.pool().pushIsolatedPool("state checkpoint", 1);
+			auto pJournal = std::make_shared<StateJournal>(
+					config.User.DataDirectory,
+					config.Node.StateCheckpointInterval,
+					// pass in a non-owning shared_ptr so that the journal does not keep the checkpoint pool alive during shutdown
+					std::shared_ptr<thread::IoServiceThreadPool>(pCheckpointPool.get(), [](const auto*) {}));
+
+			// register storage and journal subscription
+			bootstrapper.extensionManager().setBlockChainStorage(CreateFileBlockChainStorage(pJournal));
+			bootstrapper.subscriptionManager().addStateChangeSubscriber(CreateStateJournalSubscriber(pJournal));
 		}
 	}
 }}
@@ -21,6 +21,7 @@
 #include "FileBlockChainStorage.h"
 #include "LocalNodeStateStorage.h"
 #include "MultiBlockLoader.h"
+#include "StateJournal.h"
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
@@ -29,6 +30,8 @@
 #include "catapult/extensions/PluginUtils.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include <algorithm>
 
 namespace catapult { namespace filechain {
 
@@ -37,13 +40,46 @@ namespace catapult { namespace filechain {
 			CATAPULT_LOG(info) << "loaded block chain from " << source << " (height = " << height << ", score = " << score << ")";
 		}
 
+		bool HasIncompleteStateJournalRecords(const std::string& dataDirectory) {
+			auto segments = FindStateJournalSegments(dataDirectory);
+			return std::any_of(segments.cbegin(), segments.cend(), [](const auto& segment) { return segment.HasIncompleteRecords; });
+		}
+
 		class FileBlockChainStorage : public extensions::BlockChainStorage {
+		public:
+			explicit FileBlockChainStorage(const std::shared_ptr<StateJournal>& pJournal) : m_pJournal(pJournal)
+			{}
+
 		public:
 			void loadFromStorage(const extensions::LocalNodeStateRef& stateRef, const plugins::PluginManager& pluginManager) override {
+				auto isStateConsistent = loadStateAndBlocksFromStorage(stateRef, pluginManager);
+				if (!m_pJournal || !m_pJournal->attach(stateRef.Cache))
+					return;
+
+				// journaled changes can only be applied on top of a saved state that matches the loaded state
+				// and new records must not be appended after partially written ones
+				const auto& dataDirectory = stateRef.Config.User.DataDirectory;
+				if (!isStateConsistent || HasIncompleteStateJournalRecords(dataDirectory)) {
+					CATAPULT_LOG(info) << "saving state to be used as the base of the state journal";
+					SaveState(dataDirectory, stateRef.Cache, { stateRef.State, stateRef.Score.get() });
+				}
+			}
+
+		private:
+			bool loadStateAndBlocksFromStorage(const extensions::LocalNodeStateRef& stateRef, const plugins::PluginManager& pluginManager) {
 				cache::SupplementalData supplementalData;
 				bool isStateLoaded = false;
 				try {
-					isStateLoaded = LoadState(stateRef.Config.User.DataDirectory, stateRef.Cache, supplementalData);
+					// load state on the node pool when available so that no additional loader threads are created
+					auto pPool = pluginManager.computationPool();
+					std::unique_ptr<thread::IoServiceThreadPool> pFallbackPool;
+					if (!pPool) {
+						pFallbackPool = thread::CreateIoServiceThreadPool(1, "state loader");
+						pFallbackPool->start();
+					}
+
+					auto& pool = pPool ? *pPool : *pFallbackPool;
+					isStateLoaded = LoadState(stateRef.Config.User.DataDirectory, stateRef.Cache, supplementalData, pool);
 				} catch (...) {
 					CATAPULT_LOG(error) << "error when loading state, remove state directories and start again";
 					throw;
@@ -54,7 +90,7 @@ namespace catapult { namespace filechain {
 				if (!isStateLoaded) {
 					loadCompleteBlockChainFromStorage(stateRef, pluginManager);
 					LogChainStats("block storage", storageHeight, stateRef.Score.get());
-					return;
+					return false;
 				}
 
 				// otherwise, use loaded state
@@ -66,13 +102,13 @@ namespace catapult { namespace filechain {
 
 				// if there are any additional storage blocks, load them too
 				if (storageHeight <= cacheHeight)
-					return;
+					return true;
 
 				loadPartialBlockChainFromStorage(stateRef, pluginManager, cacheHeight + Height(1));
 				LogChainStats("state and block storage", storageHeight, stateRef.Score.get());
+				return false;
 			}
 
-		private:
 			void loadCompleteBlockChainFromStorage(
 					const extensions::LocalNodeStateRef& stateRef,
 					const plugins::PluginManager& pluginManager) {
@@ -156,12 +192,26 @@ namespace catapult { namespace filechain {
 
 		public:
 			void saveToStorage(const extensions::LocalNodeStateConstRef& stateRef) override {
+				// the saved state and the journal already contain all changes, so only close the open segment
+				// and leave merging it into the saved state to compaction after the next load
+				if (m_pJournal && m_pJournal->isAttached()) {
+					m_pJournal->detach();
+					return;
+				}
+
 				SaveState(stateRef.Config.User.DataDirectory, stateRef.Cache, { stateRef.State, stateRef.Score.get() });
 			}
+
+		private:
+			std::shared_ptr<StateJournal> m_pJournal;
 		};
 	}
 
 	std::unique_ptr<extensions::BlockChainStorage> CreateFileBlockChainStorage() {
-		return std::make_unique<FileBlockChainStorage>();
+		return CreateFileBlockChainStorage(nullptr);
+	}
+
+	std::unique_ptr<extensions::BlockChainStorage> CreateFileBlockChainStorage(const std::shared_ptr<StateJournal>& pJournal) {
+		return std::make_unique<FileBlockChainStorage>(pJournal);
 	}
 }}
@@ -22,8 +22,13 @@
 #include "catapult/extensions/BlockChainStorage.h"
 #include <memory>
 
+namespace catapult { namespace filechain { class StateJournal; } }
+
 namespace catapult { namespace filechain {
 
 	/// Creates a block chain storage for saving and loading state to and from files.
 	std::unique_ptr<extensions::BlockChainStorage> CreateFileBlockChainStorage();
+
+	/// Creates a block chain storage for saving and loading state to and from files that journals state changes into \a pJournal.
+	std::unique_ptr<extensions::BlockChainStorage> CreateFileBlockChainStorage(const std::shared_ptr<StateJournal>& pJournal);
 }}
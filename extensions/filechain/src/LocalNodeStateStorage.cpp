@@ -19,43 +19,59 @@
 **/
 
 #include "LocalNodeStateStorage.h"
+#include "StateJournal.h"
+#include "catapult/cache/CacheDeltaStorage.h"
 #include "catapult/cache/CacheStorageAdapter.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/cache/SupplementalDataStorage.h"
 #include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/FileLock.h"
+#include "catapult/thread/BlockingParallelFor.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/utils/StackLogger.h"
+#include "catapult/exceptions.h"
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
+#include <limits>
 
 namespace catapult { namespace filechain {
 
 	namespace {
-		constexpr size_t Default_Loader_Batch_Size = 100'000;
+		constexpr size_t Loader_Stream_Buffer_Size = 1 << 20;
 		constexpr auto Supplemental_Data_Filename = "supplemental.dat";
 		constexpr auto State_Lock_Filename = "state.lock";
 
-		std::string GetStatePath(const std::string& baseDirectory, const std::string& filename) {
+		std::string GetStateDirectory(const std::string& baseDirectory) {
 			boost::filesystem::path path = baseDirectory;
 			path /= "state";
 			if (!boost::filesystem::exists(path))
 				boost::filesystem::create_directory(path);
 
+			return path.generic_string();
+		}
+
+		std::string GetStatePath(const std::string& baseDirectory, const std::string& filename) {
+			boost::filesystem::path path = GetStateDirectory(baseDirectory);
 			path /= filename;
 			return path.generic_string();
 		}
 
-		void LoadCache(const std::string& baseDirectory, const std::string& filename, cache::CacheStorage& cacheStorage) {
+		void LoadCache(
+				const std::string& baseDirectory,
+				const std::string& filename,
+				cache::CacheStorage& cacheStorage,
+				thread::IoServiceThreadPool& pool) {
 			auto path = GetStatePath(baseDirectory, filename);
-			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only));
-			cacheStorage.loadAll(file, Default_Loader_Batch_Size);
+			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only), Loader_Stream_Buffer_Size);
+			cacheStorage.loadAllParallel(file, pool);
 		}
 
 		void SaveCache(const std::string& baseDirectory, const std::string& filename, const cache::CacheStorage& cacheStorage) {
 			auto path = GetStatePath(baseDirectory, filename);
 			io::BufferedOutputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Write));
 			cacheStorage.saveAll(file);
+			file.sync();
 		}
 
 		bool HasSupplementalData(const std::string& baseDirectory) {
@@ -63,12 +79,108 @@ namespace catapult { namespace filechain {
 			return boost::filesystem::exists(path);
 		}
 
-		std::string GetStorageFilename(const cache::CacheStorage& storage) {
+		template<typename TStorage>
+		std::string GetStorageFilename(const TStorage& storage) {
 			return storage.name() + ".dat";
 		}
+
+		template<typename TStorages, typename TLoader>
+		void LoadAllInParallel(const TStorages& storages, thread::IoServiceThreadPool& pool, TLoader loader) {
+			// sub caches are independent of each other, so they are loaded concurrently on the same pool used for decoding chunks
+			thread::BlockingParallelFor(pool.service(), pool.numWorkerThreads(), storages.size(), [&storages, &loader](auto index) {
+				loader(*storages[index]);
+			});
+		}
+
+		class JournaledDeltas {
+		public:
+			JournaledDeltas(const std::vector<StateJournalSegment>& segments, const std::string& cacheName) {
+				for (const auto& segment : segments) {
+					if (0 == segment.NumRecords)
+						continue;
+
+					auto path = GetStateJournalFilePath(segment, cacheName);
+					m_files.push_back(std::make_unique<io::BufferedInputFileStream>(io::RawFile(path, io::OpenMode::Read_Only)));
+					m_deltas.push_back({ *m_files.back(), segment.NumRecords });
+				}
+			}
+
+		public:
+			const std::vector<cache::SerializedCacheDeltas>& deltas() const {
+				return m_deltas;
+			}
+
+		private:
+			std::vector<std::unique_ptr<io::BufferedInputFileStream>> m_files;
+			std::vector<cache::SerializedCacheDeltas> m_deltas;
+		};
+
+		bool IsStateJournalConsistent(const std::string& dataDirectory, const cache::CatapultCache& cache) {
+			// records can only be applied when all preceding records are complete and contain deltas of all caches
+			auto hasIncompleteRecords = false;
+			auto areAllCachesJournaled = cache.deltaStorages().size() == cache.storages().size();
+			for (const auto& segment : FindStateJournalSegments(dataDirectory)) {
+				if (0 != segment.NumRecords) {
+					if (hasIncompleteRecords || !areAllCachesJournaled)
+						return false;
+
+					for (const auto& pStorage : cache.storages()) {
+						if (!boost::filesystem::exists(GetStateJournalFilePath(segment, pStorage->name())))
+							return false;
+					}
+				}
+
+				hasIncompleteRecords = hasIncompleteRecords || segment.HasIncompleteRecords;
+			}
+
+			return true;
+		}
+
+		std::vector<StateJournalSegment> FindNonEmptyStateJournalSegments(const std::string& dataDirectory, uint64_t lastSegmentId) {
+			std::vector<StateJournalSegment> segments;
+			for (const auto& segment : FindStateJournalSegments(dataDirectory)) {
+				if (segment.Id <= lastSegmentId && 0 != segment.NumRecords)
+					segments.push_back(segment);
+			}
+
+			return segments;
+		}
+
+		void LoadJournaledCache(
+				const std::string& baseDirectory,
+				const std::vector<StateJournalSegment>& segments,
+				cache::CacheDeltaStorage& deltaStorage,
+				thread::IoServiceThreadPool& pool) {
+			auto path = GetStatePath(baseDirectory, GetStorageFilename(deltaStorage));
+			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only), Loader_Stream_Buffer_Size);
+			JournaledDeltas journaledDeltas(segments, deltaStorage.name());
+			deltaStorage.loadAllParallel(file, journaledDeltas.deltas(), pool);
+		}
+
+		void LoadJournaledState(
+				const std::string& baseDirectory,
+				const std::vector<StateJournalSegment>& segments,
+				cache::CatapultCache& cache,
+				cache::SupplementalData& supplementalData,
+				Height& chainHeight,
+				thread::IoServiceThreadPool& pool) {
+			auto deltaStorages = cache.deltaStorages();
+			if (deltaStorages.size() != cache.storages().size())
+				CATAPULT_THROW_RUNTIME_ERROR("state journal cannot be loaded because not all caches support loading deltas");
+
+			LoadAllInParallel(deltaStorages, pool, [&baseDirectory, &segments, &pool](auto& deltaStorage) {
+				LoadJournaledCache(baseDirectory, segments, deltaStorage, pool);
+			});
+
+			LoadLastStateJournalRecord(segments.back(), supplementalData, chainHeight);
+		}
 	}
 
-	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData) {
+	bool LoadState(
+			const std::string& dataDirectory,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData,
+			thread::IoServiceThreadPool& pool) {
 		auto lockFilePath = GetStatePath(dataDirectory, State_Lock_Filename);
 		io::FileLock stateLock(lockFilePath);
 		if (!stateLock.try_lock()) {
@@ -79,13 +191,24 @@ namespace catapult { namespace filechain {
 		if (!HasSupplementalData(dataDirectory))
 			return false;
 
-		utils::StackLogger stopwatch("load state", utils::LogLevel::Warning);
+		if (!IsStateJournalConsistent(dataDirectory, cache)) {
+			CATAPULT_LOG(warning) << "state journal cannot be applied, aborting load of state";
+			return false;
+		}
 
-		for (const auto& pStorage : cache.storages())
-			LoadCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		utils::StackLogger stopwatch("load state", utils::LogLevel::Warning);
 
 		Height chainHeight;
-		{
+		auto segments = FindNonEmptyStateJournalSegments(dataDirectory, std::numeric_limits<uint64_t>::max());
+		if (!segments.empty()) {
+			CATAPULT_LOG(info) << "loading state with " << segments.size() << " journal segment(s)";
+			LoadJournaledState(dataDirectory, segments, cache, supplementalData, chainHeight, pool);
+		} else {
+			// all sub caches and their chunks share a single pool so that the number of loader threads is bounded
+			LoadAllInParallel(cache.storages(), pool, [&dataDirectory, &pool](auto& storage) {
+				LoadCache(dataDirectory, GetStorageFilename(storage), storage, pool);
+			});
+
 			auto path = GetStatePath(dataDirectory, Supplemental_Data_Filename);
 			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only));
 			cache::LoadSupplementalData(file, supplementalData, chainHeight);
@@ -131,6 +254,109 @@ namespace catapult { namespace filechain {
 			data.State = supplementalData.State;
 			data.ChainScore = supplementalData.ChainScore;
 			cache::SaveSupplementalData(data, cache.createView().height(), file);
+			file.sync();
+		}
+
+		// journaled changes are only removed after the saved state is durable
+		io::SyncDirectory(GetStateDirectory(dataDirectory));
+		RemoveStateJournalSegments(dataDirectory, std::numeric_limits<uint64_t>::max());
+	}
+
+	namespace {
+		cache::ChunkedDataHeader MergeCacheValues(
+				const std::string& baseDirectory,
+				const std::vector<StateJournalSegment>& segments,
+				const cache::CacheDeltaStorage& deltaStorage,
+				const std::string& valuesPath) {
+			auto path = GetStatePath(baseDirectory, GetStorageFilename(deltaStorage));
+			io::BufferedInputFileStream input(io::RawFile(path.c_str(), io::OpenMode::Read_Only));
+			JournaledDeltas journaledDeltas(segments, deltaStorage.name());
+
+			io::BufferedOutputFileStream output(io::RawFile(valuesPath.c_str(), io::OpenMode::Read_Write));
+			return deltaStorage.mergeAll(input, journaledDeltas.deltas(), output);
+		}
+
+		void MergeCache(
+				const std::string& baseDirectory,
+				const std::vector<StateJournalSegment>& segments,
+				const cache::CacheDeltaStorage& deltaStorage,
+				const std::string& outputPath) {
+			// the number of entries and chunks is not known until all values have been merged, so merge the values into a separate file
+			// and copy them after the header
+			auto valuesPath = outputPath + ".values";
+			auto header = MergeCacheValues(baseDirectory, segments, deltaStorage, valuesPath);
+
+			{
+				io::RawFile valuesFile(valuesPath.c_str(), io::OpenMode::Read_Only);
+				io::BufferedOutputFileStream output(io::RawFile(outputPath.c_str(), io::OpenMode::Read_Write));
+				cache::WriteChunkedDataHeader(output, header);
+
+				std::vector<uint8_t> buffer;
+				auto numRemainingBytes = valuesFile.size();
+				while (0 != numRemainingBytes) {
+					buffer.resize(std::min<uint64_t>(Loader_Stream_Buffer_Size, numRemainingBytes));
+					valuesFile.read(buffer);
+					output.write(buffer);
+					numRemainingBytes -= buffer.size();
+				}
+
+				output.sync();
+			}
+
+			boost::filesystem::remove(valuesPath);
+		}
+	}
+
+	bool CompactState(
+			const std::string& dataDirectory,
+			const std::vector<std::unique_ptr<const cache::CacheDeltaStorage>>& deltaStorages,
+			uint64_t lastSegmentId) {
+		auto lockFilePath = GetStatePath(dataDirectory, State_Lock_Filename);
+		io::FileLock stateLock(lockFilePath);
+		if (!stateLock.try_lock()) {
+			CATAPULT_LOG(warning) << "could not acquire state lock (" << lockFilePath << ") aborting compaction of state";
+			return false;
 		}
+
+		auto segments = FindNonEmptyStateJournalSegments(dataDirectory, lastSegmentId);
+		if (!segments.empty()) {
+			utils::StackLogger stopwatch("compact state", utils::LogLevel::Info);
+
+			// 1. merge each cache into a temporary file
+			std::vector<std::pair<std::string, std::string>> pathPairs;
+			for (const auto& pDeltaStorage : deltaStorages) {
+				auto path = GetStatePath(dataDirectory, GetStorageFilename(*pDeltaStorage));
+				auto tempPath = path + ".tmp";
+				MergeCache(dataDirectory, segments, *pDeltaStorage, tempPath);
+				pathPairs.emplace_back(tempPath, path);
+			}
+
+			// 2. save the supplemental data of the last merged record into a temporary file
+			{
+				cache::SupplementalData supplementalData;
+				Height chainHeight;
+				LoadLastStateJournalRecord(segments.back(), supplementalData, chainHeight);
+
+				auto path = GetStatePath(dataDirectory, Supplemental_Data_Filename);
+				auto tempPath = path + ".tmp";
+				io::BufferedOutputFileStream file(io::RawFile(tempPath.c_str(), io::OpenMode::Read_Write));
+				cache::SaveSupplementalData(supplementalData, chainHeight, file);
+				file.sync();
+				pathPairs.emplace_back(tempPath, path);
+			}
+
+			// 3. replace the saved state once all temporary files are durable
+			//    (the held lock causes the state to be rebuilt if compaction is interrupted)
+			auto stateDirectory = GetStateDirectory(dataDirectory);
+			io::SyncDirectory(stateDirectory);
+			for (const auto& pathPair : pathPairs)
+				boost::filesystem::rename(pathPair.first, pathPair.second);
+
+			io::SyncDirectory(stateDirectory);
+		}
+
+		// 4. remove all merged segments, which are only redundant after the replaced state is durable
+		RemoveStateJournalSegments(dataDirectory, lastSegmentId);
+		return true;
 	}
 }}
@@ -19,21 +19,42 @@
 **/
 
 #pragma once
+#include <memory>
 #include <string>
+#include <vector>
+#include <stdint.h>
 
 namespace catapult {
 	namespace cache {
+		class CacheDeltaStorage;
 		class CatapultCache;
 		struct SupplementalData;
 	}
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace filechain {
 
 	/// Save catapult \a cache state along with \a supplementalData into state directory inside \a dataDirectory.
+	/// \note Any state journal segments are removed because they are included in the saved state.
 	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData);
 
-	/// Load catapult \a cache state and \a supplementalData from state directory inside \a dataDirectory.
-	/// Returns \c true if data has been loaded, \c false if there was nothing to load.
-	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData);
+	/// Load catapult \a cache state and \a supplementalData from state directory inside \a dataDirectory using \a pool
+	/// to load sub caches and decode their chunks.
+	/// Returns \c true if data has been loaded, \c false if there was nothing to load or the state journal cannot be applied.
+	/// \note All complete state journal records are applied on top of the saved state and partially written trailing records
+	///       are ignored.
+	bool LoadState(
+			const std::string& dataDirectory,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData,
+			thread::IoServiceThreadPool& pool);
+
+	/// Merges all state journal segments with ids no greater than \a lastSegmentId into the saved state inside \a dataDirectory
+	/// using \a deltaStorages.
+	/// Returns \c true if the segments have been merged, \c false if the saved state is locked.
+	bool CompactState(
+			const std::string& dataDirectory,
+			const std::vector<std::unique_ptr<const cache::CacheDeltaStorage>>& deltaStorages,
+			uint64_t lastSegmentId);
 }}
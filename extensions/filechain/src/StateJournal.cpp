@@ -0,0 +1,410 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StateJournal.h"
+#include "LocalNodeStateStorage.h"
+#include "catapult/cache/CacheDeltaStorage.h"
+#include "catapult/cache/CacheStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/cache/SupplementalDataStorage.h"
+#include "catapult/consumers/StateChangeInfo.h"
+#include "catapult/io/BufferedFileStream.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/subscribers/StateChangeSubscriber.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/exceptions.h"
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+#include <algorithm>
+
+namespace catapult { namespace filechain {
+
+	namespace {
+		constexpr auto Supplemental_Data_Filename = "supplemental.dat";
+		constexpr uint64_t Supplemental_Record_Size = sizeof(model::ImportanceHeight) + 2 * sizeof(uint64_t) + sizeof(Height);
+
+		boost::filesystem::path GetJournalDirectory(const std::string& dataDirectory) {
+			return boost::filesystem::path(dataDirectory) / "state" / "journal";
+		}
+
+		bool TryParseSegmentId(const std::string& str, uint64_t& segmentId) {
+			if (str.empty() || !std::all_of(str.cbegin(), str.cend(), [](auto ch) { return '0' <= ch && ch <= '9'; }))
+				return false;
+
+			segmentId = std::stoull(str);
+			return true;
+		}
+
+		// each segment's supplemental data file starts with the names of all journaled caches and is followed by one record per block
+		// composed of the end offsets of all cache delta files and the supplemental data
+		struct SegmentHeader {
+			std::vector<std::string> CacheNames;
+			uint64_t Size;
+			uint64_t FileSize;
+		};
+
+		constexpr uint64_t Max_Cache_Name_Size = 1024;
+
+		bool TryReadSegmentHeader(const boost::filesystem::path& path, SegmentHeader& header) {
+			// the open segment is being appended concurrently, so it is read without locking
+			io::RawFile file(path.generic_string(), io::OpenMode::Read_Only, io::LockMode::None);
+			header.FileSize = file.size();
+			header.Size = sizeof(uint64_t);
+			if (header.FileSize < header.Size)
+				return false;
+
+			io::BufferedInputFileStream input(std::move(file));
+			auto numCaches = io::Read64(input);
+			for (uint64_t i = 0; i < numCaches; ++i) {
+				if (header.FileSize < header.Size + sizeof(uint64_t))
+					return false;
+
+				auto nameSize = io::Read64(input);
+				header.Size += sizeof(uint64_t);
+				if (nameSize > Max_Cache_Name_Size || header.FileSize < header.Size + nameSize)
+					return false;
+
+				std::string name(nameSize, '\0');
+				input.read({ reinterpret_cast<uint8_t*>(&name[0]), nameSize });
+				header.CacheNames.push_back(name);
+				header.Size += nameSize;
+			}
+
+			return true;
+		}
+
+		uint64_t GetRecordSize(const SegmentHeader& header) {
+			return header.CacheNames.size() * sizeof(uint64_t) + Supplemental_Record_Size;
+		}
+
+		void CountRecords(const boost::filesystem::path& segmentDirectory, StateJournalSegment& segment) {
+			segment.NumRecords = 0;
+			segment.HasIncompleteRecords = false;
+
+			auto path = segmentDirectory / Supplemental_Data_Filename;
+			if (!boost::filesystem::exists(path))
+				return;
+
+			SegmentHeader header;
+			if (!TryReadSegmentHeader(path, header)) {
+				segment.HasIncompleteRecords = 0 != header.FileSize;
+				return;
+			}
+
+			std::vector<uint64_t> cacheFileSizes;
+			for (const auto& cacheName : header.CacheNames) {
+				auto cacheFilePath = segmentDirectory / (cacheName + ".dat");
+				cacheFileSizes.push_back(boost::filesystem::exists(cacheFilePath) ? boost::filesystem::file_size(cacheFilePath) : 0);
+			}
+
+			// a record is only complete when its supplemental data has been fully written and all cache deltas it references
+			// are present, so ignore any trailing records that were only partially written
+			auto recordSize = GetRecordSize(header);
+			auto numWrittenRecords = (header.FileSize - header.Size) / recordSize;
+			io::RawFile recordsFile(path.generic_string(), io::OpenMode::Read_Only, io::LockMode::None);
+			for (auto numRecords = numWrittenRecords; numRecords > 0; --numRecords) {
+				std::vector<uint64_t> endOffsets(header.CacheNames.size());
+				recordsFile.seek(header.Size + (numRecords - 1) * recordSize);
+				recordsFile.read({ reinterpret_cast<uint8_t*>(endOffsets.data()), endOffsets.size() * sizeof(uint64_t) });
+
+				auto isComplete = true;
+				for (auto i = 0u; i < endOffsets.size(); ++i)
+					isComplete = isComplete && endOffsets[i] <= cacheFileSizes[i];
+
+				if (isComplete) {
+					segment.NumRecords = numRecords;
+					break;
+				}
+			}
+
+			segment.HasIncompleteRecords = header.Size + segment.NumRecords * recordSize != header.FileSize;
+		}
+
+		std::unique_ptr<io::BufferedOutputFileStream> CreateSegmentFile(const boost::filesystem::path& path) {
+			// segment files are not locked so that the open segment can be inspected while it is being appended
+			io::RawFile rawFile(path.generic_string(), io::OpenMode::Read_Write, io::LockMode::None);
+			return std::make_unique<io::BufferedOutputFileStream>(std::move(rawFile));
+		}
+
+		class SegmentCacheFile : public io::OutputStream {
+		public:
+			explicit SegmentCacheFile(const boost::filesystem::path& path)
+					: m_pFile(CreateSegmentFile(path))
+					, m_position(0)
+			{}
+
+		public:
+			uint64_t position() const {
+				return m_position;
+			}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_pFile->write(buffer);
+				m_position += buffer.Size;
+			}
+
+			void flush() override {
+				m_pFile->flush();
+			}
+
+			void sync() {
+				m_pFile->sync();
+			}
+
+		private:
+			std::unique_ptr<io::BufferedOutputFileStream> m_pFile;
+			uint64_t m_position;
+		};
+	}
+
+	std::vector<StateJournalSegment> FindStateJournalSegments(const std::string& dataDirectory) {
+		std::vector<StateJournalSegment> segments;
+		auto journalDirectory = GetJournalDirectory(dataDirectory);
+		if (!boost::filesystem::is_directory(journalDirectory))
+			return segments;
+
+		for (const auto& entry : boost::filesystem::directory_iterator(journalDirectory)) {
+			uint64_t segmentId;
+			if (!boost::filesystem::is_directory(entry.path()) || !TryParseSegmentId(entry.path().filename().generic_string(), segmentId))
+				continue;
+
+			StateJournalSegment segment;
+			segment.Id = segmentId;
+			segment.Directory = entry.path().generic_string();
+			CountRecords(entry.path(), segment);
+			segments.push_back(segment);
+		}
+
+		std::sort(segments.begin(), segments.end(), [](const auto& lhs, const auto& rhs) { return lhs.Id < rhs.Id; });
+		return segments;
+	}
+
+	std::string GetStateJournalFilePath(const StateJournalSegment& segment, const std::string& cacheName) {
+		return (boost::filesystem::path(segment.Directory) / (cacheName + ".dat")).generic_string();
+	}
+
+	void LoadLastStateJournalRecord(const StateJournalSegment& segment, cache::SupplementalData& supplementalData, Height& chainHeight) {
+		if (0 == segment.NumRecords)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("state journal segment does not contain any records", segment.Id);
+
+		auto path = boost::filesystem::path(segment.Directory) / Supplemental_Data_Filename;
+		SegmentHeader header;
+		if (!TryReadSegmentHeader(path, header))
+			CATAPULT_THROW_RUNTIME_ERROR_1("state journal segment has malformed header", segment.Id);
+
+		io::RawFile rawFile(path.generic_string(), io::OpenMode::Read_Only, io::LockMode::None);
+		rawFile.seek(header.Size + (segment.NumRecords - 1) * GetRecordSize(header) + header.CacheNames.size() * sizeof(uint64_t));
+
+		io::BufferedInputFileStream file(std::move(rawFile));
+		cache::LoadSupplementalData(file, supplementalData, chainHeight);
+	}
+
+	void RemoveStateJournalSegments(const std::string& dataDirectory, uint64_t lastSegmentId) {
+		for (const auto& segment : FindStateJournalSegments(dataDirectory)) {
+			if (segment.Id <= lastSegmentId)
+				boost::filesystem::remove_all(segment.Directory);
+		}
+	}
+
+	// region StateJournal
+
+	struct StateJournal::Segment {
+		uint64_t Id;
+		std::vector<std::unique_ptr<SegmentCacheFile>> CacheFiles;
+		std::unique_ptr<io::BufferedOutputFileStream> pSupplementalDataFile;
+		uint32_t NumRecords;
+	};
+
+	StateJournal::StateJournal(
+			const std::string& dataDirectory,
+			uint32_t checkpointInterval,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
+			: m_dataDirectory(dataDirectory)
+			, m_checkpointInterval(checkpointInterval)
+			, m_pPool(pPool)
+			, m_isAttached(false)
+			, m_nextSegmentId(1)
+			, m_lastClosedSegmentId(0)
+			, m_lastCompactedSegmentId(0)
+	{}
+
+	StateJournal::~StateJournal() = default;
+
+	bool StateJournal::isAttached() const {
+		return m_isAttached;
+	}
+
+	uint64_t StateJournal::lastClosedSegmentId() const {
+		return m_lastClosedSegmentId;
+	}
+
+	bool StateJournal::attach(const cache::CatapultCache& cache) {
+		std::lock_guard<std::mutex> guard(m_appendMutex);
+		if (m_isAttached)
+			CATAPULT_THROW_RUNTIME_ERROR("state journal is already attached");
+
+		// all caches must be journaled in order for the journal to be replayable
+		auto deltaStorages = cache.deltaStorages();
+		if (deltaStorages.size() != cache.storages().size()) {
+			CATAPULT_LOG(warning) << "state journal is disabled because not all caches support saving deltas";
+			return false;
+		}
+
+		// segments left over from a previous run have already been replayed and only need to be merged
+		auto segments = FindStateJournalSegments(m_dataDirectory);
+		if (!segments.empty()) {
+			m_nextSegmentId = segments.back().Id + 1;
+			m_lastClosedSegmentId = segments.back().Id;
+		}
+
+		m_deltaStorages = std::move(deltaStorages);
+		m_isAttached = true;
+		CATAPULT_LOG(info) << "attached state journal (next segment = " << m_nextSegmentId << ")";
+		return true;
+	}
+
+	void StateJournal::detach() {
+		{
+			std::lock_guard<std::mutex> guard(m_appendMutex);
+			m_isAttached = false;
+			if (m_pSegment)
+				closeSegment();
+		}
+
+		// wait for any pending compaction to complete
+		std::lock_guard<std::mutex> guard(m_compactionMutex);
+	}
+
+	void StateJournal::append(const consumers::StateChangeInfo& changeInfo, const model::ChainScore& chainScore) {
+		std::lock_guard<std::mutex> guard(m_appendMutex);
+		if (!m_isAttached)
+			return;
+
+		if (!m_pSegment)
+			openSegment();
+
+		// 1. append all cache deltas
+		for (auto i = 0u; i < m_deltaStorages.size(); ++i)
+			m_deltaStorages[i]->saveDelta(changeInfo.CacheDelta, *m_pSegment->CacheFiles[i]);
+
+		// 2. append the end offsets of all cache deltas and the supplemental data, which marks the record as complete
+		//    (cache deltas are flushed first so that they always reach the files before the record referencing them)
+		for (const auto& pCacheFile : m_pSegment->CacheFiles) {
+			pCacheFile->flush();
+			io::Write64(*m_pSegment->pSupplementalDataFile, pCacheFile->position());
+		}
+
+		cache::SupplementalData supplementalData;
+		supplementalData.State = changeInfo.State;
+		supplementalData.ChainScore = chainScore;
+		cache::SaveSupplementalData(supplementalData, changeInfo.Height, *m_pSegment->pSupplementalDataFile);
+
+		if (++m_pSegment->NumRecords < m_checkpointInterval)
+			return;
+
+		closeSegment();
+
+		auto pThis = shared_from_this();
+		m_pPool->service().post([pThis]() {
+			pThis->compact();
+		});
+	}
+
+	bool StateJournal::compact() {
+		std::lock_guard<std::mutex> guard(m_compactionMutex);
+		uint64_t lastSegmentId = m_lastClosedSegmentId;
+		if (!m_isAttached || lastSegmentId <= m_lastCompactedSegmentId)
+			return false;
+
+		if (!CompactState(m_dataDirectory, m_deltaStorages, lastSegmentId))
+			return false;
+
+		m_lastCompactedSegmentId = lastSegmentId;
+		return true;
+	}
+
+	void StateJournal::openSegment() {
+		auto segmentDirectory = GetJournalDirectory(m_dataDirectory) / std::to_string(m_nextSegmentId);
+		boost::filesystem::create_directories(segmentDirectory);
+
+		auto pSegment = std::make_unique<Segment>();
+		pSegment->Id = m_nextSegmentId++;
+		for (const auto& pDeltaStorage : m_deltaStorages)
+			pSegment->CacheFiles.push_back(std::make_unique<SegmentCacheFile>(segmentDirectory / (pDeltaStorage->name() + ".dat")));
+
+		pSegment->pSupplementalDataFile = CreateSegmentFile(segmentDirectory / Supplemental_Data_Filename);
+		auto& supplementalDataFile = *pSegment->pSupplementalDataFile;
+		io::Write64(supplementalDataFile, m_deltaStorages.size());
+		for (const auto& pDeltaStorage : m_deltaStorages) {
+			const auto& name = pDeltaStorage->name();
+			io::Write64(supplementalDataFile, name.size());
+			supplementalDataFile.write({ reinterpret_cast<const uint8_t*>(name.data()), name.size() });
+		}
+
+		supplementalDataFile.flush();
+		pSegment->NumRecords = 0;
+		m_pSegment = std::move(pSegment);
+	}
+
+	void StateJournal::closeSegment() {
+		CATAPULT_LOG(debug) << "closing state journal segment " << m_pSegment->Id << " with " << m_pSegment->NumRecords << " records";
+		// make all records durable before the segment is considered closed (and can be merged or loaded after shutdown)
+		for (const auto& pCacheFile : m_pSegment->CacheFiles)
+			pCacheFile->sync();
+
+		m_pSegment->pSupplementalDataFile->sync();
+		m_lastClosedSegmentId = m_pSegment->Id;
+		m_pSegment.reset();
+	}
+
+	// endregion
+
+	// region CreateStateJournalSubscriber
+
+	namespace {
+		class StateJournalSubscriber : public subscribers::StateChangeSubscriber {
+		public:
+			explicit StateJournalSubscriber(const std::shared_ptr<StateJournal>& pJournal) : m_pJournal(pJournal)
+			{}
+
+		public:
+			void notifyScoreChange(const model::ChainScore& chainScore) override {
+				m_chainScore = chainScore;
+			}
+
+			void notifyStateChange(const consumers::StateChangeInfo& stateChangeInfo) override {
+				m_pJournal->append(stateChangeInfo, m_chainScore);
+			}
+
+		private:
+			std::shared_ptr<StateJournal> m_pJournal;
+			model::ChainScore m_chainScore;
+		};
+	}
+
+	std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateJournalSubscriber(const std::shared_ptr<StateJournal>& pJournal) {
+		return std::make_unique<StateJournalSubscriber>(pJournal);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,132 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace catapult {
+	namespace cache {
+		class CacheDeltaStorage;
+		class CatapultCache;
+		struct SupplementalData;
+	}
+	namespace consumers { struct StateChangeInfo; }
+	namespace model { class ChainScore; }
+	namespace subscribers { class StateChangeSubscriber; }
+	namespace thread { class IoServiceThreadPool; }
+}
+
+namespace catapult { namespace filechain {
+
+	/// State journal segment.
+	struct StateJournalSegment {
+		/// Segment id.
+		uint64_t Id;
+
+		/// Segment directory.
+		std::string Directory;
+
+		/// Number of complete records in the segment.
+		uint64_t NumRecords;
+
+		/// \c true if the segment contains trailing records that were only partially written.
+		bool HasIncompleteRecords;
+	};
+
+	/// Finds all state journal segments inside \a dataDirectory ordered by id.
+	/// \note Segments without any complete records are included.
+	std::vector<StateJournalSegment> FindStateJournalSegments(const std::string& dataDirectory);
+
+	/// Gets the path of the file containing all journaled deltas of the cache with name \a cacheName in \a segment.
+	std::string GetStateJournalFilePath(const StateJournalSegment& segment, const std::string& cacheName);
+
+	/// Loads \a supplementalData and \a chainHeight from the last complete record in \a segment.
+	void LoadLastStateJournalRecord(const StateJournalSegment& segment, cache::SupplementalData& supplementalData, Height& chainHeight);
+
+	/// Removes all state journal segments inside \a dataDirectory with ids no greater than \a lastSegmentId.
+	void RemoveStateJournalSegments(const std::string& dataDirectory, uint64_t lastSegmentId);
+
+	/// Journal of state changes that is periodically merged into the saved state.
+	class StateJournal : public std::enable_shared_from_this<StateJournal> {
+	public:
+		/// Creates a journal inside \a dataDirectory that closes a segment every \a checkpointInterval records
+		/// and merges all closed segments into the saved state using \a pPool.
+		StateJournal(
+				const std::string& dataDirectory,
+				uint32_t checkpointInterval,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pPool);
+
+		/// Destroys the journal.
+		~StateJournal();
+
+	public:
+		/// Returns \c true if the journal is attached.
+		bool isAttached() const;
+
+		/// Gets the id of the last closed segment.
+		uint64_t lastClosedSegmentId() const;
+
+	public:
+		/// Attaches the journal to \a cache.
+		/// \note Returns \c false if changes to \a cache cannot be journaled.
+		bool attach(const cache::CatapultCache& cache);
+
+		/// Detaches the journal after closing the open segment and waiting for any pending compaction to complete.
+		/// \note All subsequent appends and compactions are ignored, so closed segments are merged after the next attach.
+		void detach();
+
+		/// Appends a record composed of the changes in \a changeInfo and the (absolute) \a chainScore.
+		void append(const consumers::StateChangeInfo& changeInfo, const model::ChainScore& chainScore);
+
+		/// Merges all closed segments into the saved state.
+		/// \note Returns \c true if any segments were merged.
+		bool compact();
+
+	private:
+		struct Segment;
+
+		void openSegment();
+		void closeSegment();
+
+	private:
+		std::string m_dataDirectory;
+		uint32_t m_checkpointInterval;
+		std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
+
+		std::vector<std::unique_ptr<const cache::CacheDeltaStorage>> m_deltaStorages;
+		std::atomic_bool m_isAttached;
+		uint64_t m_nextSegmentId;
+		std::unique_ptr<Segment> m_pSegment;
+		std::atomic<uint64_t> m_lastClosedSegmentId;
+		uint64_t m_lastCompactedSegmentId;
+
+		std::mutex m_appendMutex;
+		std::mutex m_compactionMutex;
+	};
+
+	/// Creates a state change subscriber that appends all state changes to \a pJournal.
+	std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateJournalSubscriber(const std::shared_ptr<StateJournal>& pJournal);
+}}
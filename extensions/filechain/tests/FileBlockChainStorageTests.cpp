@@ -19,11 +19,13 @@
 **/
 
 #include "filechain/src/FileBlockChainStorage.h"
+#include "filechain/src/StateJournal.h"
 #include "plugins/services/hashcache/src/cache/HashCache.h"
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/BlockDifficultyCache.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "filechain/tests/test/FilechainTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/local/BlockStateHash.h"
@@ -34,6 +36,7 @@
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/nodeps/MijinConstants.h"
 #include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
 #include <random>
 
 namespace catapult { namespace filechain {
@@ -49,14 +52,20 @@ namespace catapult { namespace filechain {
 
 		class TestContext {
 		public:
-			explicit TestContext(const std::shared_ptr<plugins::PluginManager>& pPluginManager, const std::string& dataDirectory)
+			explicit TestContext(
+					const std::shared_ptr<plugins::PluginManager>& pPluginManager,
+					const std::string& dataDirectory,
+					const std::shared_ptr<StateJournal>& pJournal = nullptr)
 					: m_pPluginManager(pPluginManager)
 					, m_localNodeState(m_pPluginManager->config(), dataDirectory, m_pPluginManager->createCache())
-					, m_pBlockChainStorage(CreateFileBlockChainStorage())
+					, m_pBlockChainStorage(CreateFileBlockChainStorage(pJournal))
 			{}
 
-			explicit TestContext(const model::BlockChainConfiguration& config, const std::string& dataDirectory)
-					: TestContext(test::CreatePluginManager(config), dataDirectory)
+			explicit TestContext(
+					const model::BlockChainConfiguration& config,
+					const std::string& dataDirectory,
+					const std::shared_ptr<StateJournal>& pJournal = nullptr)
+					: TestContext(test::CreatePluginManager(config), dataDirectory, pJournal)
 			{}
 
 			explicit TestContext(uint32_t maxDifficultyBlocks = 0, const std::string& dataDirectory = "")
@@ -711,6 +720,48 @@ namespace catapult { namespace filechain {
 		});
 	}
 
+	namespace {
+		std::vector<boost::filesystem::path> GetStateFiles(const std::string& dataDirectory) {
+			std::vector<boost::filesystem::path> stateFiles;
+			for (const auto& entry : boost::filesystem::directory_iterator(boost::filesystem::path(dataDirectory) / "state")) {
+				if (boost::filesystem::is_regular_file(entry.path()))
+					stateFiles.push_back(entry.path());
+			}
+
+			return stateFiles;
+		}
+	}
+
+	TEST(TEST_CLASS, SaveToStorageOnlyClosesJournalSegmentWhenJournalIsAttached) {
+		// Arrange:
+		test::TempDirectoryGuard tempDataDirectory;
+		auto pJournal = std::make_shared<StateJournal>(tempDataDirectory.name(), 10, thread::CreateIoServiceThreadPool(1));
+		TestContext context(CreateBlockChainConfiguration(0, tempDataDirectory.name()), tempDataDirectory.name(), pJournal);
+		PrepareRandomBlocks(context.storageModifier(), utils::TimeSpan::FromMinutes(1));
+
+		// - load the block chain, which saves the state used as the base of the journal
+		context.load();
+
+		// - backdate all saved state files
+		auto stateFiles = GetStateFiles(tempDataDirectory.name());
+		for (const auto& stateFile : stateFiles)
+			boost::filesystem::last_write_time(stateFile, 0);
+
+		// Sanity:
+		EXPECT_TRUE(pJournal->isAttached());
+		EXPECT_LE(3u, stateFiles.size());
+
+		// Act:
+		context.save();
+
+		// Assert: the journal was detached without rewriting any saved state file
+		EXPECT_FALSE(pJournal->isAttached());
+		for (const auto& stateFile : stateFiles)
+			EXPECT_EQ(0, boost::filesystem::last_write_time(stateFile)) << stateFile;
+
+		EXPECT_EQ(stateFiles.size(), GetStateFiles(tempDataDirectory.name()).size());
+	}
+
 	TEST(TEST_CLASS, CannotLoadCorruptedCacheStateFromDisk) {
 		// Arrange:
 		test::TempDirectoryGuard tempDataDirectory;
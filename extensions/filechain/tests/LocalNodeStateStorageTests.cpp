@@ -28,6 +28,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
@@ -106,7 +107,8 @@ namespace catapult { namespace filechain {
 		// Act: load the cache
 		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
 		cache::SupplementalData supplementalData;
-		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData);
+		auto pPool = test::CreateStartedIoServiceThreadPool(2);
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, *pPool);
 
 		// Assert:
 		EXPECT_TRUE(isStateLoaded);
@@ -129,7 +131,8 @@ namespace catapult { namespace filechain {
 			// Act: load the cache
 			auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
 			cache::SupplementalData supplementalData;
-			auto isStateLoaded = LoadState(dataDirectory, cache, supplementalData);
+			auto pPool = test::CreateStartedIoServiceThreadPool(2);
+			auto isStateLoaded = LoadState(dataDirectory, cache, supplementalData, *pPool);
 
 			// Assert:
 			EXPECT_FALSE(isStateLoaded);
@@ -182,7 +185,8 @@ namespace catapult { namespace filechain {
 		// Act: load the cache
 		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
 		cache::SupplementalData supplementalData;
-		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData);
+		auto pPool = test::CreateStartedIoServiceThreadPool(2);
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, *pPool);
 
 		// Assert:
 		EXPECT_TRUE(isStateLoaded);
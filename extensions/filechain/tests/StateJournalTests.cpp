@@ -0,0 +1,651 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "filechain/src/StateJournal.h"
+#include "filechain/src/LocalNodeStateStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/ChunkedDataHeader.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/consumers/StateChangeInfo.h"
+#include "catapult/io/BufferedFileStream.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/subscribers/StateChangeSubscriber.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/constants.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+namespace catapult { namespace filechain {
+
+#define TEST_CLASS StateJournalTests
+
+	namespace {
+		constexpr size_t Num_Seed_Accounts = 10;
+		constexpr size_t Num_Seed_Difficulties = 10;
+
+		cache::CatapultCache CreateCache() {
+			return test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		}
+
+		Address GetSeedAddress(size_t index) {
+			Address address{};
+			address[0] = static_cast<uint8_t>(index + 1);
+			return address;
+		}
+
+		Address GetJournaledAddress(Height height) {
+			Address address{};
+			address[1] = static_cast<uint8_t>(height.unwrap());
+			return address;
+		}
+
+		model::ChainScore GetChainScore(Height height) {
+			return model::ChainScore(height.unwrap() * 1000);
+		}
+
+		void SeedAndSaveState(const std::string& dataDirectory, cache::CatapultCache& cache) {
+			{
+				auto delta = cache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				for (auto i = 0u; i < Num_Seed_Accounts; ++i)
+					accountStateCacheDelta.addAccount(GetSeedAddress(i), Height(1));
+
+				auto& blockDifficultyCacheDelta = delta.sub<cache::BlockDifficultyCache>();
+				for (auto i = 1u; i <= Num_Seed_Difficulties; ++i)
+					blockDifficultyCacheDelta.insert(Height(i), Timestamp(i), Difficulty(i));
+
+				cache.commit(Height(Num_Seed_Difficulties));
+			}
+
+			cache::SupplementalData supplementalData;
+			supplementalData.ChainScore = GetChainScore(Height(Num_Seed_Difficulties));
+			supplementalData.State.LastRecalculationHeight = model::ImportanceHeight(Num_Seed_Difficulties);
+			SaveState(dataDirectory, cache, supplementalData);
+		}
+
+		// appends a record for the block at \a height that adds an account and a difficulty, credits the first seed account
+		// and removes the seed account with the same index as the block
+		void AppendBlockChange(StateJournal& journal, cache::CatapultCache& cache, Height height) {
+			auto delta = cache.createDelta();
+			auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+			accountStateCacheDelta.addAccount(GetJournaledAddress(height), height);
+			accountStateCacheDelta.find(GetSeedAddress(0)).get().Balances.credit(Xem_Id, Amount(height.unwrap()));
+			accountStateCacheDelta.queueRemove(GetSeedAddress(height.unwrap() - Num_Seed_Difficulties), Height(1));
+			accountStateCacheDelta.commitRemovals();
+
+			delta.sub<cache::BlockDifficultyCache>().insert(height, Timestamp(height.unwrap()), Difficulty(height.unwrap()));
+
+			state::CatapultState state;
+			state.LastRecalculationHeight = model::ImportanceHeight(height.unwrap());
+			model::ChainScore scoreDelta(1000);
+			journal.append(consumers::StateChangeInfo(delta, scoreDelta, state, height), GetChainScore(height));
+			cache.commit(height);
+		}
+
+		std::shared_ptr<thread::IoServiceThreadPool> CreateUnstartedPool() {
+			// posted compactions never run, so tests can trigger compaction explicitly
+			return thread::CreateIoServiceThreadPool(1);
+		}
+
+		void AssertLoadedState(const std::string& dataDirectory, Height expectedHeight) {
+			// Act:
+			auto cache = CreateCache();
+			cache::SupplementalData supplementalData;
+			auto pPool = test::CreateStartedIoServiceThreadPool(2);
+			auto isStateLoaded = LoadState(dataDirectory, cache, supplementalData, *pPool);
+
+			// Assert:
+			ASSERT_TRUE(isStateLoaded);
+			auto numBlocks = (expectedHeight - Height(Num_Seed_Difficulties)).unwrap();
+			auto view = cache.createView();
+			EXPECT_EQ(expectedHeight, view.height());
+			EXPECT_EQ(GetChainScore(expectedHeight), supplementalData.ChainScore);
+			EXPECT_EQ(model::ImportanceHeight(expectedHeight.unwrap()), supplementalData.State.LastRecalculationHeight);
+
+			const auto& accountStateCacheView = view.sub<cache::AccountStateCache>();
+			EXPECT_EQ(Num_Seed_Accounts, accountStateCacheView.size());
+			for (auto i = 1u; i <= numBlocks; ++i) {
+				EXPECT_FALSE(accountStateCacheView.contains(GetSeedAddress(i))) << "seed " << i;
+				EXPECT_TRUE(accountStateCacheView.contains(GetJournaledAddress(Height(Num_Seed_Difficulties + i)))) << "block " << i;
+			}
+
+			// - credits of heights 11 + 12 + ... are accumulated in the first seed account
+			auto expectedBalance = numBlocks * Num_Seed_Difficulties + numBlocks * (numBlocks + 1) / 2;
+			EXPECT_EQ(Amount(expectedBalance), accountStateCacheView.find(GetSeedAddress(0)).get().Balances.get(Xem_Id));
+
+			const auto& blockDifficultyCacheView = view.sub<cache::BlockDifficultyCache>();
+			EXPECT_EQ(Num_Seed_Difficulties + numBlocks, blockDifficultyCacheView.size());
+		}
+	}
+
+	// region attach / detach
+
+	TEST(TEST_CLASS, JournalIsInitiallyDetached) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		StateJournal journal(tempDir.name(), 10, CreateUnstartedPool());
+
+		// Assert:
+		EXPECT_FALSE(journal.isAttached());
+		EXPECT_EQ(0u, journal.lastClosedSegmentId());
+	}
+
+	TEST(TEST_CLASS, CanAttachJournalToCacheWithDeltaStorageSupport) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		StateJournal journal(tempDir.name(), 10, CreateUnstartedPool());
+
+		// Act:
+		auto isAttached = journal.attach(cache);
+
+		// Assert:
+		EXPECT_TRUE(isAttached);
+		EXPECT_TRUE(journal.isAttached());
+	}
+
+	TEST(TEST_CLASS, CannotAttachJournalMoreThanOnce) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		StateJournal journal(tempDir.name(), 10, CreateUnstartedPool());
+		journal.attach(cache);
+
+		// Act + Assert:
+		EXPECT_THROW(journal.attach(cache), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, AppendIsIgnoredWhenJournalIsDetached) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+		pJournal->attach(cache);
+		pJournal->detach();
+
+		// Act:
+		AppendBlockChange(*pJournal, cache, Height(11));
+
+		// Assert:
+		EXPECT_FALSE(pJournal->isAttached());
+		EXPECT_TRUE(FindStateJournalSegments(tempDir.name()).empty());
+	}
+
+	// endregion
+
+	// region append + load
+
+	TEST(TEST_CLASS, AppendWritesRecordsToOpenSegment) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+		pJournal->attach(cache);
+
+		// Act:
+		for (auto height = Height(11); height <= Height(13); height = height + Height(1))
+			AppendBlockChange(*pJournal, cache, height);
+
+		// Assert:
+		auto segments = FindStateJournalSegments(tempDir.name());
+		ASSERT_EQ(1u, segments.size());
+		EXPECT_EQ(1u, segments[0].Id);
+		EXPECT_EQ(3u, segments[0].NumRecords);
+		EXPECT_EQ(0u, pJournal->lastClosedSegmentId());
+	}
+
+	TEST(TEST_CLASS, DetachClosesOpenSegment) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+		pJournal->attach(cache);
+
+		for (auto height = Height(11); height <= Height(13); height = height + Height(1))
+			AppendBlockChange(*pJournal, cache, height);
+
+		// Act:
+		pJournal->detach();
+
+		// Assert: the segment is closed but not merged
+		auto segments = FindStateJournalSegments(tempDir.name());
+		ASSERT_EQ(1u, segments.size());
+		EXPECT_EQ(3u, segments[0].NumRecords);
+		EXPECT_EQ(1u, pJournal->lastClosedSegmentId());
+
+		// - the saved state and the closed segment can be loaded
+		AssertLoadedState(tempDir.name(), Height(13));
+	}
+
+	TEST(TEST_CLASS, CanLoadStateWithJournaledChanges) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			auto cache = CreateCache();
+			SeedAndSaveState(tempDir.name(), cache);
+			auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+			pJournal->attach(cache);
+
+			for (auto height = Height(11); height <= Height(13); height = height + Height(1))
+				AppendBlockChange(*pJournal, cache, height);
+		}
+
+		// Act + Assert:
+		AssertLoadedState(tempDir.name(), Height(13));
+	}
+
+	TEST(TEST_CLASS, LoadStateIgnoresIncompleteTrailingRecord) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			auto cache = CreateCache();
+			SeedAndSaveState(tempDir.name(), cache);
+			auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+			pJournal->attach(cache);
+
+			for (auto height = Height(11); height <= Height(12); height = height + Height(1))
+				AppendBlockChange(*pJournal, cache, height);
+		}
+
+		// - simulate a record that was interrupted while writing its supplemental data
+		auto segments = FindStateJournalSegments(tempDir.name());
+		ASSERT_EQ(1u, segments.size());
+		{
+			auto supplementalDataPath = boost::filesystem::path(segments[0].Directory) / "supplemental.dat";
+			std::ofstream supplementalDataStream(supplementalDataPath.generic_string(), std::ios::binary | std::ios::app);
+			supplementalDataStream << "partial";
+		}
+
+		segments = FindStateJournalSegments(tempDir.name());
+		ASSERT_EQ(1u, segments.size());
+		EXPECT_EQ(2u, segments[0].NumRecords);
+		EXPECT_TRUE(segments[0].HasIncompleteRecords);
+
+		// Act + Assert:
+		AssertLoadedState(tempDir.name(), Height(12));
+	}
+
+	TEST(TEST_CLASS, LoadStateIgnoresRecordsReferencingTruncatedCacheDeltas) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		std::string cacheFilePath;
+		uint64_t cacheFileSize;
+		{
+			auto cache = CreateCache();
+			SeedAndSaveState(tempDir.name(), cache);
+			auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+			pJournal->attach(cache);
+
+			AppendBlockChange(*pJournal, cache, Height(11));
+
+			auto segments = FindStateJournalSegments(tempDir.name());
+			ASSERT_EQ(1u, segments.size());
+			cacheFilePath = GetStateJournalFilePath(segments[0], cache.storages()[0]->name());
+			cacheFileSize = boost::filesystem::file_size(cacheFilePath);
+
+			for (auto height = Height(12); height <= Height(13); height = height + Height(1))
+				AppendBlockChange(*pJournal, cache, height);
+		}
+
+		// - simulate a crash that lost the tail of a cache delta file after the supplemental data of later records was written
+		boost::filesystem::resize_file(cacheFilePath, cacheFileSize + 1);
+
+		// Sanity:
+		auto segments = FindStateJournalSegments(tempDir.name());
+		ASSERT_EQ(1u, segments.size());
+		EXPECT_EQ(1u, segments[0].NumRecords);
+		EXPECT_TRUE(segments[0].HasIncompleteRecords);
+
+		// Act + Assert:
+		AssertLoadedState(tempDir.name(), Height(11));
+	}
+
+	TEST(TEST_CLASS, LoadStateFailsWhenIncompleteRecordsAreFollowedByOtherRecords) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			auto cache = CreateCache();
+			SeedAndSaveState(tempDir.name(), cache);
+			auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+			pJournal->attach(cache);
+
+			for (auto height = Height(11); height <= Height(12); height = height + Height(1))
+				AppendBlockChange(*pJournal, cache, height);
+
+			pJournal->detach();
+
+			// - simulate a record that was interrupted while writing its supplemental data
+			auto segments = FindStateJournalSegments(tempDir.name());
+			ASSERT_EQ(1u, segments.size());
+			{
+				auto supplementalDataPath = boost::filesystem::path(segments[0].Directory) / "supplemental.dat";
+				std::ofstream supplementalDataStream(supplementalDataPath.generic_string(), std::ios::binary | std::ios::app);
+				supplementalDataStream << "partial";
+			}
+
+			// - append a record to a new segment
+			auto pNextJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+			pNextJournal->attach(cache);
+			AppendBlockChange(*pNextJournal, cache, Height(13));
+		}
+
+		// Act:
+		auto cache = CreateCache();
+		cache::SupplementalData supplementalData;
+		auto pPool = test::CreateStartedIoServiceThreadPool(2);
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, *pPool);
+
+		// Assert: the journal cannot be applied, so the state must be reloaded from block storage
+		EXPECT_FALSE(isStateLoaded);
+		EXPECT_EQ(Height(0), cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, SaveStateRemovesJournal) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+		pJournal->attach(cache);
+
+		for (auto height = Height(11); height <= Height(12); height = height + Height(1))
+			AppendBlockChange(*pJournal, cache, height);
+
+		// Act:
+		pJournal->detach();
+		cache::SupplementalData supplementalData;
+		supplementalData.ChainScore = GetChainScore(Height(12));
+		supplementalData.State.LastRecalculationHeight = model::ImportanceHeight(12);
+		SaveState(tempDir.name(), cache, supplementalData);
+
+		// Assert:
+		EXPECT_TRUE(FindStateJournalSegments(tempDir.name()).empty());
+		AssertLoadedState(tempDir.name(), Height(12));
+	}
+
+	// endregion
+
+	// region compaction
+
+	TEST(TEST_CLASS, AppendClosesSegmentAfterCheckpointInterval) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 2, CreateUnstartedPool());
+		pJournal->attach(cache);
+
+		// Act:
+		for (auto height = Height(11); height <= Height(15); height = height + Height(1))
+			AppendBlockChange(*pJournal, cache, height);
+
+		// Assert:
+		auto segments = FindStateJournalSegments(tempDir.name());
+		ASSERT_EQ(3u, segments.size());
+		EXPECT_EQ(2u, segments[0].NumRecords);
+		EXPECT_EQ(2u, segments[1].NumRecords);
+		EXPECT_EQ(1u, segments[2].NumRecords);
+		EXPECT_EQ(2u, pJournal->lastClosedSegmentId());
+	}
+
+	TEST(TEST_CLASS, CompactMergesClosedSegmentsIntoSavedState) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			auto cache = CreateCache();
+			SeedAndSaveState(tempDir.name(), cache);
+			auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 2, CreateUnstartedPool());
+			pJournal->attach(cache);
+
+			for (auto height = Height(11); height <= Height(15); height = height + Height(1))
+				AppendBlockChange(*pJournal, cache, height);
+
+			// Act:
+			auto isCompacted = pJournal->compact();
+
+			// Assert: only the open segment remains
+			EXPECT_TRUE(isCompacted);
+			auto segments = FindStateJournalSegments(tempDir.name());
+			ASSERT_EQ(1u, segments.size());
+			EXPECT_EQ(3u, segments[0].Id);
+
+			// - compacting again has no effect
+			EXPECT_FALSE(pJournal->compact());
+		}
+
+		// - the saved state is composed of the seed state and the changes in the closed segments
+		{
+			auto cache = CreateCache();
+			cache::SupplementalData supplementalData;
+			auto segments = FindStateJournalSegments(tempDir.name());
+			boost::filesystem::remove_all(segments[0].Directory);
+			auto pPool = test::CreateStartedIoServiceThreadPool(2);
+			ASSERT_TRUE(LoadState(tempDir.name(), cache, supplementalData, *pPool));
+			EXPECT_EQ(Height(14), cache.createView().height());
+		}
+	}
+
+	TEST(TEST_CLASS, CompactReplacesSavedStateWithoutLeavingTemporaryFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 2, CreateUnstartedPool());
+		pJournal->attach(cache);
+
+		for (auto height = Height(11); height <= Height(15); height = height + Height(1))
+			AppendBlockChange(*pJournal, cache, height);
+
+		// Act:
+		auto isCompacted = pJournal->compact();
+
+		// Assert: all merged files (including supplemental data) were renamed into place
+		EXPECT_TRUE(isCompacted);
+		for (const auto& entry : boost::filesystem::directory_iterator(boost::filesystem::path(tempDir.name()) / "state")) {
+			EXPECT_NE(".tmp", entry.path().extension()) << entry.path();
+			EXPECT_NE(".values", entry.path().extension()) << entry.path();
+		}
+
+		EXPECT_TRUE(boost::filesystem::exists(boost::filesystem::path(tempDir.name()) / "state" / "supplemental.dat"));
+	}
+
+	TEST(TEST_CLASS, CompactedStateAndRemainingSegmentsCanBeLoaded) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			auto cache = CreateCache();
+			SeedAndSaveState(tempDir.name(), cache);
+			auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 2, CreateUnstartedPool());
+			pJournal->attach(cache);
+
+			for (auto height = Height(11); height <= Height(15); height = height + Height(1))
+				AppendBlockChange(*pJournal, cache, height);
+
+			pJournal->compact();
+		}
+
+		// Act + Assert:
+		AssertLoadedState(tempDir.name(), Height(15));
+	}
+
+	TEST(TEST_CLASS, CompactedStateIsSavedInChunks) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		{
+			auto cache = CreateCache();
+			SeedAndSaveState(tempDir.name(), cache);
+			auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 2, CreateUnstartedPool());
+			pJournal->attach(cache);
+
+			for (auto height = Height(11); height <= Height(15); height = height + Height(1))
+				AppendBlockChange(*pJournal, cache, height);
+
+			pJournal->compact();
+		}
+
+		// - remove the open segment so that the compacted state is loaded directly (in parallel)
+		auto segments = FindStateJournalSegments(tempDir.name());
+		ASSERT_EQ(1u, segments.size());
+		boost::filesystem::remove_all(segments[0].Directory);
+
+		// Assert: each compacted cache file is composed of a header followed by all chunks, each preceded by its chunk info
+		for (const auto* filename : { "AccountStateCache.dat", "BlockDifficultyCache.dat" }) {
+			auto path = (boost::filesystem::path(tempDir.name()) / "state" / filename).generic_string();
+			io::BufferedInputFileStream input(io::RawFile(path, io::OpenMode::Read_Only));
+			auto header = cache::ReadChunkedDataHeader(input);
+
+			auto numRemainingEntries = header.NumEntries;
+			uint64_t totalChunkSize = 0;
+			for (auto i = 0u; i < header.NumChunks; ++i) {
+				auto chunk = cache::ReadChunkInfo(input, numRemainingEntries);
+				cache::ReadChunkData(input, chunk);
+				numRemainingEntries -= chunk.NumEntries;
+				totalChunkSize += chunk.Size;
+			}
+
+			ASSERT_NE(0u, header.NumChunks) << filename;
+			EXPECT_EQ(0u, numRemainingEntries) << filename;
+			EXPECT_EQ((3 + 2 * header.NumChunks) * sizeof(uint64_t) + totalChunkSize, boost::filesystem::file_size(path)) << filename;
+		}
+
+		// - the compacted state can be loaded
+		AssertLoadedState(tempDir.name(), Height(14));
+	}
+
+	TEST(TEST_CLASS, CompactIsIgnoredWhenJournalIsDetached) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 2, CreateUnstartedPool());
+		pJournal->attach(cache);
+
+		for (auto height = Height(11); height <= Height(12); height = height + Height(1))
+			AppendBlockChange(*pJournal, cache, height);
+
+		pJournal->detach();
+
+		// Act:
+		auto isCompacted = pJournal->compact();
+
+		// Assert:
+		EXPECT_FALSE(isCompacted);
+		EXPECT_EQ(1u, FindStateJournalSegments(tempDir.name()).size());
+	}
+
+	TEST(TEST_CLASS, CompactIsIgnoredWhenStateIsLocked) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 2, CreateUnstartedPool());
+		pJournal->attach(cache);
+
+		for (auto height = Height(11); height <= Height(12); height = height + Height(1))
+			AppendBlockChange(*pJournal, cache, height);
+
+		// - simulate a lock file
+		auto lockFilePath = boost::filesystem::path(tempDir.name()) / "state" / "state.lock";
+		{
+			std::ofstream lockFileStream(lockFilePath.generic_string());
+		}
+
+		// Act:
+		auto isCompacted = pJournal->compact();
+
+		// Assert:
+		EXPECT_FALSE(isCompacted);
+		EXPECT_EQ(1u, FindStateJournalSegments(tempDir.name()).size());
+	}
+
+	TEST(TEST_CLASS, ClosedSegmentsAreCompactedInBackground) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		std::shared_ptr<thread::IoServiceThreadPool> pPool = test::CreateStartedIoServiceThreadPool(1);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 2, pPool);
+		pJournal->attach(cache);
+
+		// Act:
+		for (auto height = Height(11); height <= Height(12); height = height + Height(1))
+			AppendBlockChange(*pJournal, cache, height);
+
+		// Assert: the closed segment is eventually merged and removed
+		WAIT_FOR_EXPR(FindStateJournalSegments(tempDir.name()).empty());
+
+		pJournal->detach();
+		AssertLoadedState(tempDir.name(), Height(12));
+	}
+
+	// endregion
+
+	// region CreateStateJournalSubscriber
+
+	TEST(TEST_CLASS, SubscriberAppendsStateChangesWithLastChainScore) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto cache = CreateCache();
+		SeedAndSaveState(tempDir.name(), cache);
+		auto pJournal = std::make_shared<StateJournal>(tempDir.name(), 10, CreateUnstartedPool());
+		pJournal->attach(cache);
+		auto pSubscriber = CreateStateJournalSubscriber(pJournal);
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta.sub<cache::BlockDifficultyCache>().insert(Height(11), Timestamp(11), Difficulty(11));
+
+			state::CatapultState state;
+			state.LastRecalculationHeight = model::ImportanceHeight(7);
+			model::ChainScore scoreDelta(1);
+			pSubscriber->notifyScoreChange(model::ChainScore(12345));
+			pSubscriber->notifyStateChange(consumers::StateChangeInfo(delta, scoreDelta, state, Height(11)));
+			cache.commit(Height(11));
+		}
+
+		// - close the open segment
+		pJournal->detach();
+
+		// Assert:
+		auto segments = FindStateJournalSegments(tempDir.name());
+		ASSERT_EQ(1u, segments.size());
+		ASSERT_EQ(1u, segments[0].NumRecords);
+
+		cache::SupplementalData supplementalData;
+		Height chainHeight;
+		LoadLastStateJournalRecord(segments[0], supplementalData, chainHeight);
+		EXPECT_EQ(model::ChainScore(12345), supplementalData.ChainScore);
+		EXPECT_EQ(model::ImportanceHeight(7), supplementalData.State.LastRecalculationHeight);
+		EXPECT_EQ(Height(11), chainHeight);
+	}
+
+	// endregion
+}}
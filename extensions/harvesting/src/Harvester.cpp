@@ -22,6 +22,7 @@
 #include "catapult/cache_core/ImportanceView.h"
 #include "catapult/chain/BlockDifficultyScorer.h"
 #include "catapult/chain/BlockScorer.h"
+#include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/KeyPair.h"
 #include "catapult/model/BlockUtils.h"
 
@@ -63,6 +64,40 @@ namespace catapult { namespace harvesting {
 			pBlock->BlockTransactionsHash = transactionsInfo.TransactionsHash;
 			return pBlock;
 		}
+
+		std::vector<Hash256> CalculateGenerationHashes(
+				const Hash256& parentGenerationHash,
+				const std::vector<const crypto::KeyPair*>& candidateKeyPairs) {
+			// each generation hash is calculated from the parent generation hash and the candidate public key
+			// (see model::CalculateGenerationHash), so all generation hashes can be calculated at once
+			std::vector<RawBuffer> buffers;
+			buffers.reserve(2 * candidateKeyPairs.size());
+			for (const auto* pKeyPair : candidateKeyPairs) {
+				buffers.push_back(parentGenerationHash);
+				buffers.push_back(pKeyPair->publicKey());
+			}
+
+			std::vector<Hash256> generationHashes(candidateKeyPairs.size());
+			crypto::Sha3_256_Multi(buffers.data(), 2, generationHashes.data(), generationHashes.size());
+			return generationHashes;
+		}
+
+		std::vector<Importance> LookupImportances(
+				const cache::AccountStateCache& accountStateCache,
+				const std::vector<const crypto::KeyPair*>& candidateKeyPairs,
+				Height height) {
+			// use a single view for all candidates
+			auto lockedCacheView = accountStateCache.createView();
+			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
+			cache::ImportanceView view(readOnlyCache);
+
+			std::vector<Importance> importances;
+			importances.reserve(candidateKeyPairs.size());
+			for (const auto* pKeyPair : candidateKeyPairs)
+				importances.push_back(view.getAccountImportanceOrDefault(pKeyPair->publicKey(), height));
+
+			return importances;
+		}
 	}
 
 	Harvester::Harvester(
@@ -83,27 +118,32 @@ namespace catapult { namespace harvesting {
 			return nullptr;
 		}
 
+		auto unlockedAccountsView = m_unlockedAccounts.view();
+		std::vector<const crypto::KeyPair*> candidateKeyPairs;
+		for (const auto& keyPair : unlockedAccountsView)
+			candidateKeyPairs.push_back(&keyPair);
+
+		if (candidateKeyPairs.empty())
+			return nullptr;
+
+		// evaluate all candidates in batches: most harvest attempts do not produce a hit for any candidate
+		auto generationHashes = CalculateGenerationHashes(context.ParentContext.GenerationHash, candidateKeyPairs);
+		auto importances = LookupImportances(m_cache.sub<cache::AccountStateCache>(), candidateKeyPairs, context.Height);
+
 		chain::BlockHitContext hitContext;
 		hitContext.ElapsedTime = context.BlockTime;
 		hitContext.Difficulty = context.Difficulty;
 		hitContext.Height = context.Height;
 
-		const auto& accountStateCache = m_cache.sub<cache::AccountStateCache>();
-		chain::BlockHitPredicate hitPredicate(m_config, [&accountStateCache](const auto& key, auto height) {
-			auto lockedCacheView = accountStateCache.createView();
-			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
-			cache::ImportanceView view(readOnlyCache);
-			return view.getAccountImportanceOrDefault(key, height);
-		});
-
-		auto unlockedAccountsView = m_unlockedAccounts.view();
+		// candidates are prioritized in unlocked accounts order, so the first candidate with a hit is selected
+		chain::BlockHitPredicate hitPredicate(m_config);
 		const crypto::KeyPair* pHarvesterKeyPair = nullptr;
-		for (const auto& keyPair : unlockedAccountsView) {
-			hitContext.Signer = keyPair.publicKey();
-			hitContext.GenerationHash = model::CalculateGenerationHash(context.ParentContext.GenerationHash, hitContext.Signer);
+		for (auto i = 0u; i < candidateKeyPairs.size(); ++i) {
+			hitContext.Signer = candidateKeyPairs[i]->publicKey();
+			hitContext.GenerationHash = generationHashes[i];
 
-			if (hitPredicate(hitContext)) {
-				pHarvesterKeyPair = &keyPair;
+			if (hitPredicate(hitContext, importances[i])) {
+				pHarvesterKeyPair = candidateKeyPairs[i];
 				break;
 			}
 		}
@@ -348,6 +348,49 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ(firstPublicKey, pBlock->Signer);
 	}
 
+	TEST(TEST_CLASS, HarvestHasFirstHarvesterWithHitAsSignerWhenEvaluatingAllCandidates) {
+		// Arrange: pick a timestamp at which at least one account has a hit
+		HarvesterContext context;
+		auto bestKey = BestHarvesterKey(context.LastBlockElement, context.KeyPairs);
+		auto timestamp = CalculateBlockGenerationTime(context, bestKey);
+		auto pHarvester = context.CreateHarvester();
+
+		// - determine the expected signer by evaluating each unlocked account individually
+		auto config = CreateConfiguration();
+		const auto& accountStateCache = context.Cache.sub<cache::AccountStateCache>();
+		chain::BlockHitPredicate hitPredicate(config, [&accountStateCache](const auto& key, auto) {
+			return accountStateCache.createView()->find(key).get().ImportanceInfo.current();
+		});
+
+		chain::BlockHitContext hitContext;
+		hitContext.ElapsedTime = utils::TimeSpan::FromDifference(timestamp, context.pLastBlock->Timestamp);
+		hitContext.Difficulty = chain::CalculateDifficulty(
+				context.Cache.sub<cache::BlockDifficultyCache>(),
+				context.pLastBlock->Height,
+				config);
+		hitContext.Height = Height(2);
+
+		Key expectedSigner;
+		for (const auto& keyPair : context.pUnlockedAccounts->view()) {
+			hitContext.Signer = keyPair.publicKey();
+			hitContext.GenerationHash = model::CalculateGenerationHash(context.LastBlockElement.GenerationHash, hitContext.Signer);
+			if (hitPredicate(hitContext)) {
+				expectedSigner = keyPair.publicKey();
+				break;
+			}
+		}
+
+		// Sanity:
+		ASSERT_NE(Key(), expectedSigner);
+
+		// Act:
+		auto pBlock = pHarvester->harvest(context.LastBlockElement, timestamp);
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock);
+		EXPECT_EQ(expectedSigner, pBlock->Signer);
+	}
+
 	TEST(TEST_CLASS, HarvestedBlockHasExpectedProperties) {
 		// Arrange:
 		// - the harvester accepts the first account that has a hit. That means that subsequent accounts might have
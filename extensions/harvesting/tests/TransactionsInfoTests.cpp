@@ -35,6 +35,18 @@ namespace catapult { namespace harvesting {
 			return pCache;
 		}
 
+		std::vector<const model::TransactionInfo*> ExtractTransactionInfosByPriority(const cache::MemoryUtCacheView& view, size_t count) {
+			std::vector<const model::TransactionInfo*> transactionInfos;
+			if (0 == count)
+				return transactionInfos;
+
+			view.forEachByPriority([count, &transactionInfos](const auto& transactionInfo) {
+				transactionInfos.push_back(&transactionInfo);
+				return count != transactionInfos.size();
+			});
+			return transactionInfos;
+		}
+
 		void AssertSupplierBehavior(uint32_t count, uint32_t numRequested, uint32_t expectedCount) {
 			// Arrange:
 			auto pCache = PrepareCache(count);
@@ -43,15 +55,17 @@ namespace catapult { namespace harvesting {
 			auto info = CreateTransactionsInfoSupplier(*pCache)(numRequested);
 
 			// Assert:
-			// - check transactions
-			auto expectedTransactions = test::ExtractTransactions(*pCache, expectedCount);
+			// - check transactions (they should be ordered by priority)
+			auto view = pCache->view();
+			auto expectedTransactionInfos = ExtractTransactionInfosByPriority(view, expectedCount);
+			ASSERT_EQ(expectedCount, expectedTransactionInfos.size());
 			ASSERT_EQ(expectedCount, info.Transactions.size());
 			for (auto i = 0u; i < expectedCount; ++i)
-				EXPECT_EQ(*expectedTransactions[i], *info.Transactions[i]) << "transaction at " << i;
+				EXPECT_EQ(*expectedTransactionInfos[i]->pEntity, *info.Transactions[i]) << "transaction at " << i;
 
 			// - check hash
 			Hash256 expectedHash;
-			CalculateBlockTransactionsHash(test::ExtractTransactionInfos(pCache->view(), expectedCount), expectedHash);
+			CalculateBlockTransactionsHash(expectedTransactionInfos, expectedHash);
 			EXPECT_EQ(expectedHash, info.TransactionsHash);
 		}
 	}
@@ -80,4 +94,24 @@ namespace catapult { namespace harvesting {
 		// Assert:
 		AssertSupplierBehavior(10, 15, 10);
 	}
+
+	TEST(TEST_CLASS, SupplierReturnsTransactionInfosWithHighestFeePerByte) {
+		// Arrange: transactions have same size and increasing fees
+		auto pCache = std::make_unique<cache::MemoryUtCache>(cache::MemoryCacheOptions(1000, 1000));
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		for (auto i = 0u; i < transactionInfos.size(); ++i) {
+			auto& transaction = const_cast<model::Transaction&>(*transactionInfos[i].pEntity);
+			transaction.Fee = Amount(100 * (i + 1));
+		}
+
+		test::AddAll(*pCache, transactionInfos);
+
+		// Act:
+		auto info = CreateTransactionsInfoSupplier(*pCache)(3);
+
+		// Assert: the transactions with the highest fees are returned first
+		ASSERT_EQ(3u, info.Transactions.size());
+		for (auto i = 0u; i < info.Transactions.size(); ++i)
+			EXPECT_EQ(*transactionInfos[4 - i].pEntity, *info.Transactions[i]) << "transaction at " << i;
+	}
 }}
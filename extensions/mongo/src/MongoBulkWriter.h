@@ -23,7 +23,7 @@
 #include "catapult/state/AccountState.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/thread/IoServiceThreadPool.h"
-#include "catapult/thread/ParallelFor.h"
+#include "catapult/thread/WorkStealingParallelFor.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
@@ -294,13 +294,18 @@ namespace catapult { namespace mongo {
 			if (entities.empty())
 				return thread::make_ready_future(std::vector<thread::future<BulkWriteResult>>());
 
+			// use a few bulk operations per thread so that threads finishing early can take over work from slower threads
+			constexpr size_t Chunks_Per_Thread = 4;
 			auto numThreads = m_pPool->numWorkerThreads();
-			auto pContext = std::make_shared<BulkWriteContext>(std::min<size_t>(entities.size(), numThreads));
+			auto chunkSize = std::max<size_t>(1, entities.size() / (numThreads * Chunks_Per_Thread));
+			auto numChunks = (entities.size() + chunkSize - 1) / chunkSize;
+			auto pContext = std::make_shared<BulkWriteContext>(numChunks);
 			return thread::compose(
-					thread::ParallelForPartition(
+					thread::WorkStealingParallelForPartition(
 							m_service,
 							entities,
 							numThreads,
+							chunkSize,
 							[pThis = shared_from_this(), entitiesStart = entities.cbegin(), collectionName, appendOperation, pContext](
 									auto itBegin,
 									auto itEnd,
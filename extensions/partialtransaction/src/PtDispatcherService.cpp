@@ -61,6 +61,7 @@ namespace catapult { namespace partialtransaction {
 			auto options = ConsumerDispatcherOptions("partial transaction dispatcher", config.TransactionDisruptorSize);
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.WaitStrategy = WaitStrategyType::Blocking;
 			return options;
 		}
 
@@ -62,6 +62,7 @@ namespace catapult { namespace sync {
 			auto options = ConsumerDispatcherOptions("block dispatcher", config.BlockDisruptorSize);
 			options.ElementTraceInterval = config.BlockElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.WaitStrategy = WaitStrategyType::Blocking;
 			return options;
 		}
 
@@ -69,13 +70,19 @@ namespace catapult { namespace sync {
 			auto options = ConsumerDispatcherOptions("transaction dispatcher", config.TransactionDisruptorSize);
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.WaitStrategy = WaitStrategyType::Blocking;
 			return options;
 		}
 
+		size_t GetNumParallelConsumerWorkers(const config::NodeConfiguration& config) {
+			return std::max<size_t>(1, config.NumParallelTransactionConsumerWorkers);
+		}
+
 		std::unique_ptr<ConsumerDispatcher> CreateConsumerDispatcher(
 				extensions::ServiceState& state,
 				const ConsumerDispatcherOptions& options,
-				std::vector<DisruptorConsumer>&& disruptorConsumers) {
+				std::vector<DisruptorConsumer>&& disruptorConsumers,
+				std::vector<size_t>&& numConsumerWorkers) {
 			auto& statusSubscriber = state.transactionStatusSubscriber();
 			auto reclaimMemoryInspector = CreateReclaimMemoryInspector();
 			auto inspector = [&statusSubscriber, reclaimMemoryInspector](auto& input, const auto& completionResult) {
@@ -92,9 +99,18 @@ namespace catapult { namespace sync {
 
 				boost::filesystem::create_directories(auditPath);
 				disruptorConsumers.insert(disruptorConsumers.begin(), CreateAuditConsumer(auditPath.generic_string()));
+				numConsumerWorkers.insert(numConsumerWorkers.begin(), 1);
 			}
 
-			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumers, inspector);
+			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumers, numConsumerWorkers, inspector);
+		}
+
+		std::unique_ptr<ConsumerDispatcher> CreateConsumerDispatcher(
+				extensions::ServiceState& state,
+				const ConsumerDispatcherOptions& options,
+				std::vector<DisruptorConsumer>&& disruptorConsumers) {
+			std::vector<size_t> numConsumerWorkers(disruptorConsumers.size(), 1);
+			return CreateConsumerDispatcher(state, options, std::move(disruptorConsumers), std::move(numConsumerWorkers));
 		}
 
 		// endregion
@@ -110,7 +126,10 @@ namespace catapult { namespace sync {
 					return view.getAccountImportanceOrDefault(publicKey, height);
 				});
 			};
-			return CreateBlockChainProcessor(blockHitPredicateFactory, chain::CreateBatchEntityProcessor(executionConfig));
+			return CreateBlockChainProcessor(
+					blockHitPredicateFactory,
+					chain::CreateBatchEntityProcessor(executionConfig),
+					CreateAccountStatePrefetcher());
 		}
 
 		BlockChainSyncHandlers CreateBlockChainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
@@ -235,6 +254,8 @@ namespace catapult { namespace sync {
 
 		public:
 			void addHashConsumers() {
+				// hash calculation is stateless, so it can be executed concurrently by multiple workers
+				m_parallelConsumerLevels.push_back(m_consumers.size());
 				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(m_state.pluginManager().transactionRegistry()));
 				m_consumers.push_back(CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
@@ -265,16 +286,22 @@ namespace catapult { namespace sync {
 					utUpdater.update(std::move(transactionInfos));
 				}));
 
+				std::vector<size_t> numConsumerWorkers(disruptorConsumers.size(), 1);
+				for (auto level : m_parallelConsumerLevels)
+					numConsumerWorkers[level] = GetNumParallelConsumerWorkers(m_nodeConfig);
+
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateTransactionConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						std::move(disruptorConsumers),
+						std::move(numConsumerWorkers));
 			}
 
 		private:
 			extensions::ServiceState& m_state;
 			const config::NodeConfiguration& m_nodeConfig;
 			std::vector<TransactionConsumer> m_consumers;
+			std::vector<size_t> m_parallelConsumerLevels;
 		};
 
 		void RegisterTransactionDispatcherService(
@@ -24,6 +24,7 @@
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/api/RemoteTransactionApi.h"
 #include "catapult/cache/MemoryUtCache.h"
+#include "catapult/chain/ChainSynchronizer.h"
 #include "catapult/chain/UtSynchronizer.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
@@ -52,9 +53,35 @@ namespace catapult { namespace sync {
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
 			chainSynchronizerConfig.MaxRollbackBlocks = config.BlockChain.MaxRollbackBlocks;
+			chainSynchronizerConfig.MaxParallelSyncPeers = config.Node.MaxParallelSyncPeers;
 			return chainSynchronizerConfig;
 		}
 
+		chain::RemoteChainApisSupplier CreateRemoteChainApisSupplier(
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters) {
+			const auto& transactionRegistry = state.pluginManager().transactionRegistry();
+			auto syncTimeout = state.config().Node.SyncTimeout;
+			return [&packetWriters, &transactionRegistry, syncTimeout](auto numRequested) {
+				std::vector<chain::AdditionalPeerChainApi> additionalPeerChainApis;
+				for (const auto& packetIoPair : net::PickMultiple(packetWriters, numRequested, syncTimeout)) {
+					auto pRemoteChainApi = utils::UniqueToShared(api::CreateRemoteChainApi(*packetIoPair.io(), transactionRegistry));
+
+					// extend the lifetime of packetIoPair until the api is destroyed
+					additionalPeerChainApis.push_back({
+						std::shared_ptr<const api::RemoteChainApi>(pRemoteChainApi.get(), [pRemoteChainApi, packetIoPair](const auto*) {}),
+						[node = packetIoPair.node()](auto result) {
+							auto isFailure = chain::NodeInteractionResult::Failure == result;
+							CATAPULT_LOG_LEVEL(isFailure ? utils::LogLevel::Warning : utils::LogLevel::Info)
+									<< "completed 'parallel blocks pull' (" << node << ") with result " << result;
+						}
+					});
+				}
+
+				return additionalPeerChainApis;
+			};
+		}
+
 		thread::Task CreateSynchronizerTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& config = state.config();
 			auto chainSynchronizer = chain::CreateChainSynchronizer(
@@ -62,6 +89,7 @@ namespace catapult { namespace sync {
 							state.storage(),
 							[&score = state.score()]() { return score.get(); }),
 					CreateChainSynchronizerConfiguration(config),
+					CreateRemoteChainApisSupplier(state, packetWriters),
 					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
 
 			thread::Task task;
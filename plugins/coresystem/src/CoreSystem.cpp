@@ -22,6 +22,7 @@
 #include "handlers/CoreDiagnosticHandlers.h"
 #include "observers/Observers.h"
 #include "validators/Validators.h"
+#include "catapult/cache/SubCacheMerkleRootTimings.h"
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/AccountStateCacheStorage.h"
 #include "catapult/cache_core/AccountStateCacheSubCachePlugin.h"
@@ -46,13 +47,17 @@ namespace catapult { namespace plugins {
 			auto cacheOptions = CreateAccountStateCacheOptions(config);
 			manager.addCacheSupport(std::make_unique<AccountStateCacheSubCachePlugin>(cacheConfig, cacheOptions));
 
-			manager.addDiagnosticHandlerHook([](auto& handlers, const CatapultCache& cache) {
+			auto maxStateMultiproofKeys = manager.storageConfig().MaxStateMultiproofKeys;
+			manager.addDiagnosticHandlerHook([maxStateMultiproofKeys](auto& handlers, const CatapultCache& cache) {
 				handlers::RegisterAccountInfosHandler(
 						handlers,
 						handlers::CacheEntryInfosProducerFactory<AccountStateCacheDescriptor>::Create(cache.sub<AccountStateCache>()));
 
 				using PacketType = handlers::StatePathRequestPacket<ionet::PacketType::Account_State_Path, Address>;
 				handlers::RegisterStatePathHandler<PacketType>(handlers, cache.sub<AccountStateCache>());
+
+				using ProofPacketType = handlers::StateMultiproofRequestPacket<ionet::PacketType::Account_State_Multiproof, Address>;
+				handlers::RegisterStateMultiproofHandler<ProofPacketType>(handlers, cache.sub<AccountStateCache>(), maxStateMultiproofKeys);
 			});
 
 			manager.addDiagnosticCounterHook([](auto& counters, const CatapultCache& cache) {
@@ -62,6 +67,9 @@ namespace catapult { namespace plugins {
 				counters.emplace_back(utils::DiagnosticCounterId("ACNTST C HVA"), [&cache]() {
 					return cache.sub<AccountStateCache>().createView()->highValueAddresses().size();
 				});
+				counters.emplace_back(utils::DiagnosticCounterId("ACNTST SH"), [&cache]() {
+					return cache.merkleRootTimings().elapsedMicros(AccountStateCache::Id);
+				});
 			});
 		}
 
@@ -110,9 +118,11 @@ namespace catapult { namespace plugins {
 				.add(observers::CreateHarvestFeeObserver());
 		});
 
-		manager.addTransientObserverHook([&config](auto& builder) {
+		manager.addTransientObserverHook([&config, &manager](auto& builder) {
+			// the node pool is looked up on each recalculation because it is set after plugins are registered
+			auto poolSupplier = [&manager]() { return manager.computationPool(); };
 			auto pRecalculateImportancesObserver = observers::CreateRecalculateImportancesObserver(
-					observers::CreateImportanceCalculator(config),
+					observers::CreateImportanceCalculator(config, poolSupplier),
 					observers::CreateRestoreImportanceCalculator());
 			builder
 				.add(std::move(pRecalculateImportancesObserver))
@@ -20,12 +20,14 @@
 
 #pragma once
 #include "catapult/model/ImportanceHeight.h"
+#include "catapult/functions.h"
 #include "catapult/types.h"
 #include <memory>
 
 namespace catapult {
 	namespace cache { class AccountStateCacheDelta; }
 	namespace model { struct BlockChainConfiguration; }
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace observers {
@@ -44,6 +46,12 @@ namespace catapult { namespace observers {
 	/// Creates an importance calculator for the block chain described by \a config.
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config);
 
+	/// Creates an importance calculator for the block chain described by \a config that calculates importances
+	/// on the pool returned by \a poolSupplier (or on the calling thread when no pool is returned).
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			const supplier<std::shared_ptr<thread::IoServiceThreadPool>>& poolSupplier);
+
 	/// Creates a restore importance calculator.
 	std::unique_ptr<ImportanceCalculator> CreateRestoreImportanceCalculator();
 }}
@@ -23,8 +23,9 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/ImportanceHeight.h"
 #include "catapult/state/AccountImportance.h"
+#include "catapult/state/PosImportances.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/utils/StackLogger.h"
-#include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
 #include <vector>
 
@@ -33,45 +34,49 @@ namespace catapult { namespace observers {
 	namespace {
 		class PosImportanceCalculator final : public ImportanceCalculator {
 		public:
-			explicit PosImportanceCalculator(const model::BlockChainConfiguration& config) : m_totalChainBalance(config.TotalChainBalance)
+			PosImportanceCalculator(
+					const model::BlockChainConfiguration& config,
+					const supplier<std::shared_ptr<thread::IoServiceThreadPool>>& poolSupplier)
+					: m_totalChainBalance(config.TotalChainBalance)
+					, m_poolSupplier(poolSupplier)
 			{}
 
 		public:
 			void recalculate(model::ImportanceHeight importanceHeight, cache::AccountStateCacheDelta& cache) const override {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::Debug);
 
-				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
-				auto highValueAddresses = cache.highValueAddresses();
-				std::vector<state::AccountState*> highValueAccounts;
-				highValueAccounts.reserve(highValueAddresses.size());
+				// 1. gather balances of high value accounts into contiguous memory
+				auto highValueAccounts = cache.highValueAccounts();
+				std::vector<Amount> balances;
+				balances.reserve(highValueAccounts.size());
+				for (const auto* pAccountState : highValueAccounts)
+					balances.push_back(pAccountState->Balances.get(Xem_Id));
 
-				// 2. calculate sum
-				Amount activeXem;
-				for (const auto& address : highValueAddresses) {
-					auto accountStateIter = cache.find(address);
-					auto& accountState = accountStateIter.get();
-					highValueAccounts.push_back(&accountState);
-					activeXem = activeXem + accountState.Balances.get(Xem_Id);
-				}
+				// 2. calculate importances
+				std::vector<Importance> importances;
+				auto pPool = m_poolSupplier();
+				state::CalculatePosImportances(m_totalChainBalance, balances, importances, pPool.get());
 
 				// 3. update accounts
-				for (auto* pAccountState : highValueAccounts) {
-					boost::multiprecision::uint128_t importance = m_totalChainBalance.microxem().unwrap();
-					importance *= pAccountState->Balances.get(Xem_Id).unwrap();
-					importance /= activeXem.unwrap();
-					importance /= utils::XemUnit(utils::XemAmount(1)).microxem().unwrap();
-					pAccountState->ImportanceInfo.set(Importance(static_cast<Importance::ValueType>(importance)), importanceHeight);
-				}
+				for (auto i = 0u; i < highValueAccounts.size(); ++i)
+					highValueAccounts[i]->ImportanceInfo.set(importances[i], importanceHeight);
 
-				CATAPULT_LOG(debug) << "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)";
+				CATAPULT_LOG(debug) << "recalculated importances (" << highValueAccounts.size() << " / " << cache.size() << " eligible)";
 			}
 
 		private:
 			const utils::XemUnit m_totalChainBalance;
+			supplier<std::shared_ptr<thread::IoServiceThreadPool>> m_poolSupplier;
 		};
 	}
 
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config) {
-		return std::make_unique<PosImportanceCalculator>(config);
+		return CreateImportanceCalculator(config, []() { return nullptr; });
+	}
+
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			const supplier<std::shared_ptr<thread::IoServiceThreadPool>>& poolSupplier) {
+		return std::make_unique<PosImportanceCalculator>(config, poolSupplier);
 	}
 }}
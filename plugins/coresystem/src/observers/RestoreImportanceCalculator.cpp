@@ -27,12 +27,9 @@ namespace catapult { namespace observers {
 		class RestoreImportanceCalculator final : public ImportanceCalculator {
 		public:
 			void recalculate(model::ImportanceHeight importanceHeight, cache::AccountStateCacheDelta& cache) const override {
-				auto highValueAddresses = cache.highValueAddresses();
-				for (const auto& address : highValueAddresses) {
-					auto accountStateIter = cache.find(address);
-					auto& accountState = accountStateIter.get();
-					if (importanceHeight < accountState.ImportanceInfo.height())
-						accountState.ImportanceInfo.pop();
+				for (auto* pAccountState : cache.highValueAccounts()) {
+					if (importanceHeight < pAccountState->ImportanceInfo.height())
+						pAccountState->ImportanceInfo.pop();
 				}
 
 				CATAPULT_LOG(debug) << "restored importances at height " << importanceHeight;
@@ -47,11 +47,15 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
-				return { ionet::PacketType::Account_Infos, ionet::PacketType::Account_State_Path };
+				return {
+					ionet::PacketType::Account_Infos,
+					ionet::PacketType::Account_State_Path,
+					ionet::PacketType::Account_State_Multiproof
+				};
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "ACNTST C", "ACNTST C HVA", "BLKDIF C" };
+				return { "ACNTST C", "ACNTST C HVA", "ACNTST SH", "BLKDIF C" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
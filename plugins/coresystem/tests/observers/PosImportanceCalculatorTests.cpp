@@ -23,6 +23,7 @@
 #include "catapult/model/Address.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkInfo.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace observers {
@@ -211,4 +212,36 @@ namespace catapult { namespace observers {
 		// Assert:
 		EXPECT_EQ(importance1 + importance1, importance2);
 	}
+
+	TEST(TEST_CLASS, ImportancesCalculatedOnSuppliedPoolMatchImportancesCalculatedOnCallingThread) {
+		// Arrange:
+		auto config = CreateConfiguration();
+		std::vector<Amount::ValueType> amounts;
+		for (auto i = 1u; i <= Num_Account_States; ++i)
+			amounts.push_back(i * i * config.MinHarvesterBalance.unwrap());
+
+		CacheHolder holder1(config.MinHarvesterBalance);
+		holder1.seedDelta(amounts, Recalculation_Height);
+		auto pCalculator1 = CreateImportanceCalculator(config);
+
+		CacheHolder holder2(config.MinHarvesterBalance);
+		holder2.seedDelta(amounts, Recalculation_Height);
+		std::shared_ptr<thread::IoServiceThreadPool> pPool = test::CreateStartedIoServiceThreadPool(4);
+		auto numPoolRequests = 0u;
+		auto pCalculator2 = CreateImportanceCalculator(config, [pPool, &numPoolRequests]() {
+			++numPoolRequests;
+			return pPool;
+		});
+
+		// Act:
+		pCalculator1->recalculate(Recalculation_Height, *holder1.Delta);
+		pCalculator2->recalculate(Recalculation_Height, *holder2.Delta);
+
+		// Assert: the pool is requested for each recalculation
+		EXPECT_EQ(1u, numPoolRequests);
+		for (uint8_t i = 1; i <= Num_Account_States; ++i) {
+			auto key = Key{ { i } };
+			EXPECT_EQ(holder1.get(key).ImportanceInfo.current(), holder2.get(key).ImportanceInfo.current()) << "account " << i;
+		}
+	}
 }}
@@ -25,24 +25,64 @@
 
 namespace catapult { namespace cache {
 
-	using HashBasicCache = BasicCache<HashCacheDescriptor, HashCacheTypes::BaseSets, HashCacheTypes::Options>;
+	using HashBasicCache = BasicCache<
+		HashCacheDescriptor,
+		HashCacheTypes::BaseSets,
+		HashCacheTypes::Options,
+		const TimestampedHashFilter&>;
 
 	/// Cache composed of timestamped hashes of (transaction) elements.
 	/// \note The cache can be pruned according to the retention time.
 	class BasicHashCache : public HashBasicCache {
+	private:
+		// number of filter partitions spanning the retention time
+		static constexpr uint64_t Num_Filter_Partitions_Per_Retention_Time = 8;
+
 	public:
 		/// Creates a cache around \a config with the specified retention time (\a retentionTime).
 		explicit BasicHashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime)
+				: BasicHashCache(
+						config,
+						retentionTime,
+						std::make_unique<TimestampedHashFilter>(
+								utils::TimeSpan::FromMilliseconds(retentionTime.millis() / Num_Filter_Partitions_Per_Retention_Time)))
+		{}
+
+	private:
+		BasicHashCache(
+				const CacheConfiguration& config,
+				const utils::TimeSpan& retentionTime,
+				std::unique_ptr<TimestampedHashFilter>&& pFilter)
 				// hash cache should always be excluded from state hash calculation
-				: HashBasicCache(DisablePatriciaTreeStorage(config), HashCacheTypes::Options{ retentionTime })
+				: HashBasicCache(DisablePatriciaTreeStorage(config), HashCacheTypes::Options{ retentionTime }, *pFilter)
+				, m_pFilter(std::move(pFilter))
 		{}
 
+	public:
+		/// Commits all pending changes to the underlying storage.
+		/// \note This hides HashBasicCache::commit.
+		void commit(const CacheDeltaType& delta) {
+			// filter needs to be updated before committing because committing clears the deltas
+			for (const auto* pTimestampedHash : delta.addedElements())
+				m_pFilter->insert(*pTimestampedHash);
+
+			HashBasicCache::commit(delta);
+
+			auto pruningBoundary = delta.pruningBoundary();
+			if (pruningBoundary.isSet())
+				m_pFilter->prune(pruningBoundary.value().Time);
+		}
+
 	private:
 		static CacheConfiguration DisablePatriciaTreeStorage(const CacheConfiguration& config) {
 			auto configCopy = config;
 			configCopy.ShouldStorePatriciaTrees = false;
 			return configCopy;
 		}
+
+	private:
+		// unique pointer to allow filter reference to be valid after moves of this cache
+		std::unique_ptr<TimestampedHashFilter> m_pFilter;
 	};
 
 	/// Synchronized cache composed of timestamped hashes of (transaction) elements.
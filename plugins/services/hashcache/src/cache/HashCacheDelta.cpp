@@ -22,18 +22,37 @@
 
 namespace catapult { namespace cache {
 
-	BasicHashCacheDelta::BasicHashCacheDelta(const HashCacheTypes::BaseSetDeltaPointers& hashSets, const HashCacheTypes::Options& options)
+	BasicHashCacheDelta::BasicHashCacheDelta(
+			const HashCacheTypes::BaseSetDeltaPointers& hashSets,
+			const HashCacheTypes::Options& options,
+			const TimestampedHashFilter& filter)
 			: HashCacheDeltaMixins::Size(*hashSets.pPrimary)
 			, HashCacheDeltaMixins::Contains(*hashSets.pPrimary)
 			, HashCacheDeltaMixins::BasicInsertRemove(*hashSets.pPrimary)
+			, HashCacheDeltaMixins::DeltaElements(*hashSets.pPrimary)
 			, m_pOrderedDelta(hashSets.pPrimary)
 			, m_retentionTime(options.RetentionTime)
+			, m_filter(filter)
 	{}
 
 	utils::TimeSpan BasicHashCacheDelta::retentionTime() const {
 		return m_retentionTime;
 	}
 
+	bool BasicHashCacheDelta::contains(const ValueType& timestampedHash) const {
+		// the filter only contains committed hashes, so hashes rejected by it can only be (uncommitted) added hashes
+		if (!m_filter.mayContain(timestampedHash)) {
+			const auto& addedElements = m_pOrderedDelta->deltas().Added;
+			return addedElements.cend() != addedElements.find(timestampedHash);
+		}
+
+		if (HashCacheDeltaMixins::Contains::contains(timestampedHash))
+			return true;
+
+		m_filter.recordFalsePositive();
+		return false;
+	}
+
 	deltaset::PruningBoundary<BasicHashCacheDelta::ValueType> BasicHashCacheDelta::pruningBoundary() const {
 		return m_pruningBoundary;
 	}
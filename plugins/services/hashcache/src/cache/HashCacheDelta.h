@@ -20,6 +20,7 @@
 
 #pragma once
 #include "HashCacheTypes.h"
+#include "TimestampedHashFilter.h"
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlySimpleCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
@@ -34,19 +35,27 @@ namespace catapult { namespace cache {
 			: public utils::MoveOnly
 			, public HashCacheDeltaMixins::Size
 			, public HashCacheDeltaMixins::Contains
-			, public HashCacheDeltaMixins::BasicInsertRemove {
+			, public HashCacheDeltaMixins::BasicInsertRemove
+			, public HashCacheDeltaMixins::DeltaElements {
 	public:
 		using ReadOnlyView = HashCacheTypes::CacheReadOnlyType;
 		using ValueType = HashCacheDescriptor::ValueType;
 
 	public:
-		/// Creates a delta around \a hashSets and \a options.
-		BasicHashCacheDelta(const HashCacheTypes::BaseSetDeltaPointers& hashSets, const HashCacheTypes::Options& options);
+		/// Creates a delta around \a hashSets, \a options and \a filter of committed hashes.
+		BasicHashCacheDelta(
+				const HashCacheTypes::BaseSetDeltaPointers& hashSets,
+				const HashCacheTypes::Options& options,
+				const TimestampedHashFilter& filter);
 
 	public:
 		/// Gets the retention time for the cache.
 		utils::TimeSpan retentionTime() const;
 
+		/// Gets a value indicating whether or not the cache contains \a timestampedHash.
+		/// \note This hides HashCacheDeltaMixins::Contains::contains in order to skip set lookups rejected by the filter.
+		bool contains(const ValueType& timestampedHash) const;
+
 		/// Gets the pruning boundary that is used during commit.
 		deltaset::PruningBoundary<ValueType> pruningBoundary() const;
 
@@ -57,15 +66,19 @@ namespace catapult { namespace cache {
 	private:
 		HashCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pOrderedDelta;
 		utils::TimeSpan m_retentionTime;
+		const TimestampedHashFilter& m_filter;
 		deltaset::PruningBoundary<ValueType> m_pruningBoundary;
 	};
 
 	/// Delta on top of the hash cache.
 	class HashCacheDelta : public ReadOnlyViewSupplier<BasicHashCacheDelta> {
 	public:
-		/// Creates a delta around \a hashSets and \a options.
-		HashCacheDelta(const HashCacheTypes::BaseSetDeltaPointers& hashSets, const HashCacheTypes::Options& options)
-				: ReadOnlyViewSupplier(hashSets, options)
+		/// Creates a delta around \a hashSets, \a options and \a filter of committed hashes.
+		HashCacheDelta(
+				const HashCacheTypes::BaseSetDeltaPointers& hashSets,
+				const HashCacheTypes::Options& options,
+				const TimestampedHashFilter& filter)
+				: ReadOnlyViewSupplier(hashSets, options, filter)
 		{}
 	};
 }}
@@ -21,6 +21,7 @@
 #pragma once
 #include "HashCacheSerializers.h"
 #include "HashCacheTypes.h"
+#include "TimestampedHashFilter.h"
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlySimpleCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
@@ -40,12 +41,16 @@ namespace catapult { namespace cache {
 		using ReadOnlyView = HashCacheTypes::CacheReadOnlyType;
 
 	public:
-		/// Creates a view around \a hashSets and \a options.
-		explicit BasicHashCacheView(const HashCacheTypes::BaseSets& hashSets, const HashCacheTypes::Options& options)
+		/// Creates a view around \a hashSets, \a options and \a filter.
+		explicit BasicHashCacheView(
+				const HashCacheTypes::BaseSets& hashSets,
+				const HashCacheTypes::Options& options,
+				const TimestampedHashFilter& filter)
 				: HashCacheViewMixins::Size(hashSets.Primary)
 				, HashCacheViewMixins::Contains(hashSets.Primary)
 				, HashCacheViewMixins::Iteration(hashSets.Primary)
 				, m_retentionTime(options.RetentionTime)
+				, m_filter(filter)
 		{}
 
 	public:
@@ -54,16 +59,39 @@ namespace catapult { namespace cache {
 			return m_retentionTime;
 		}
 
+		/// Gets the filter in front of all hashes.
+		const TimestampedHashFilter& filter() const {
+			return m_filter;
+		}
+
+	public:
+		/// Gets a value indicating whether or not the cache contains \a timestampedHash.
+		/// \note This hides HashCacheViewMixins::Contains::contains in order to skip set lookups rejected by the filter.
+		bool contains(const state::TimestampedHash& timestampedHash) const {
+			if (!m_filter.mayContain(timestampedHash))
+				return false;
+
+			if (HashCacheViewMixins::Contains::contains(timestampedHash))
+				return true;
+
+			m_filter.recordFalsePositive();
+			return false;
+		}
+
 	private:
 		utils::TimeSpan m_retentionTime;
+		const TimestampedHashFilter& m_filter;
 	};
 
 	/// View on top of the hash cache.
 	class HashCacheView : public ReadOnlyViewSupplier<BasicHashCacheView> {
 	public:
-		/// Creates a view around \a hashSets and \a options.
-		explicit HashCacheView(const HashCacheTypes::BaseSets& hashSets, const HashCacheTypes::Options& options)
-				: ReadOnlyViewSupplier(hashSets, options)
+		/// Creates a view around \a hashSets, \a options and \a filter.
+		explicit HashCacheView(
+				const HashCacheTypes::BaseSets& hashSets,
+				const HashCacheTypes::Options& options,
+				const TimestampedHashFilter& filter)
+				: ReadOnlyViewSupplier(hashSets, options, filter)
 		{}
 	};
 }}
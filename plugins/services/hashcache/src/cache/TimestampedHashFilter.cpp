@@ -0,0 +1,142 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TimestampedHashFilter.h"
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		// ~10 bits per hash and 7 probes result in a false positive rate of less than 1% per segment
+		constexpr size_t Num_Bits_Per_Hash = 10;
+		constexpr size_t Num_Probes = 7;
+		constexpr size_t Initial_Segment_Capacity = 1024;
+
+		struct ProbeHashes {
+			uint64_t First;
+			uint64_t Second;
+		};
+
+		ProbeHashes CalculateProbeHashes(const state::TimestampedHash& timestampedHash) {
+			// (partial) hashes are uniformly distributed, so they can be used directly after mixing in the timestamp
+			ProbeHashes hashes;
+			std::memcpy(&hashes.First, timestampedHash.Hash.data(), sizeof(uint64_t));
+			std::memcpy(&hashes.Second, timestampedHash.Hash.data() + sizeof(uint64_t), sizeof(uint64_t));
+			hashes.First ^= timestampedHash.Time.unwrap() * 0x9E3779B97F4A7C15ull;
+			hashes.Second |= 1; // odd step visits distinct bits
+			return hashes;
+		}
+
+		template<typename TAction>
+		void ForEachProbe(size_t numBits, const ProbeHashes& hashes, TAction action) {
+			auto mask = numBits - 1;
+			for (auto i = 0u; i < Num_Probes; ++i)
+				action((hashes.First + i * hashes.Second) & mask);
+		}
+
+		size_t CalculateNumBits(size_t capacity) {
+			// round up to a power of two so that probes can be masked
+			size_t numBits = 64;
+			while (numBits < capacity * Num_Bits_Per_Hash)
+				numBits <<= 1;
+
+			return numBits;
+		}
+	}
+
+	TimestampedHashFilter::TimestampedHashFilter(const utils::TimeSpan& partitionDuration)
+			: m_partitionDuration(std::max<uint64_t>(1, partitionDuration.millis()))
+			, m_numNegativeLookups(0)
+			, m_numFalsePositiveLookups(0)
+	{}
+
+	size_t TimestampedHashFilter::numPartitions() const {
+		return m_partitions.size();
+	}
+
+	size_t TimestampedHashFilter::memorySize() const {
+		size_t memorySize = 0;
+		for (const auto& pair : m_partitions) {
+			for (const auto& segment : pair.second)
+				memorySize += segment.Bits.size() * sizeof(uint64_t);
+		}
+
+		return memorySize;
+	}
+
+	uint64_t TimestampedHashFilter::numNegativeLookups() const {
+		return m_numNegativeLookups;
+	}
+
+	uint64_t TimestampedHashFilter::numFalsePositiveLookups() const {
+		return m_numFalsePositiveLookups;
+	}
+
+	uint64_t TimestampedHashFilter::falsePositiveRatePpm() const {
+		auto numFalsePositiveLookups = m_numFalsePositiveLookups.load();
+		auto numAbsentLookups = m_numNegativeLookups.load() + numFalsePositiveLookups;
+		return 0 == numAbsentLookups ? 0 : numFalsePositiveLookups * 1'000'000 / numAbsentLookups;
+	}
+
+	bool TimestampedHashFilter::mayContain(const state::TimestampedHash& timestampedHash) const {
+		auto partitionIter = m_partitions.find(timestampedHash.Time.unwrap() / m_partitionDuration);
+		if (m_partitions.cend() != partitionIter) {
+			auto hashes = CalculateProbeHashes(timestampedHash);
+			for (const auto& segment : partitionIter->second) {
+				auto isMatch = true;
+				ForEachProbe(segment.Bits.size() * 64, hashes, [&segment, &isMatch](auto bitIndex) {
+					isMatch = isMatch && 0 != (segment.Bits[bitIndex / 64] & (1ull << (bitIndex % 64)));
+				});
+
+				if (isMatch)
+					return true;
+			}
+		}
+
+		++m_numNegativeLookups;
+		return false;
+	}
+
+	void TimestampedHashFilter::recordFalsePositive() const {
+		++m_numFalsePositiveLookups;
+	}
+
+	void TimestampedHashFilter::insert(const state::TimestampedHash& timestampedHash) {
+		auto& partition = m_partitions[timestampedHash.Time.unwrap() / m_partitionDuration];
+		if (partition.empty() || partition.back().Capacity == partition.back().Size) {
+			auto capacity = partition.empty() ? Initial_Segment_Capacity : 2 * partition.back().Capacity;
+			partition.push_back(Segment{ std::vector<uint64_t>(CalculateNumBits(capacity) / 64, 0), capacity, 0 });
+		}
+
+		auto& segment = partition.back();
+		ForEachProbe(segment.Bits.size() * 64, CalculateProbeHashes(timestampedHash), [&segment](auto bitIndex) {
+			segment.Bits[bitIndex / 64] |= 1ull << (bitIndex % 64);
+		});
+
+		++segment.Size;
+	}
+
+	void TimestampedHashFilter::prune(Timestamp timestamp) {
+		// a partition can be removed when its last possible timestamp is prior to timestamp
+		auto iter = m_partitions.begin();
+		while (m_partitions.end() != iter && (iter->first + 1) * m_partitionDuration <= timestamp.unwrap())
+			iter = m_partitions.erase(iter);
+	}
+}}
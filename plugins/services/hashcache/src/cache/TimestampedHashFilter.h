@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/state/TimestampedHash.h"
+#include "catapult/utils/TimeSpan.h"
+#include <atomic>
+#include <map>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Rolling, time partitioned bloom filter in front of a set of timestamped hashes.
+	/// \note The filter never reports a timestamped hash that was inserted (and not pruned) as absent,
+	///       so a negative result allows lookups in the underlying set to be skipped.
+	class TimestampedHashFilter {
+	public:
+		/// Creates a filter that partitions timestamped hashes by time so that partitions span \a partitionDuration.
+		explicit TimestampedHashFilter(const utils::TimeSpan& partitionDuration);
+
+	public:
+		/// Gets the number of partitions.
+		size_t numPartitions() const;
+
+		/// Gets the number of bytes used by all partitions.
+		size_t memorySize() const;
+
+		/// Gets the number of lookups that were rejected by the filter.
+		uint64_t numNegativeLookups() const;
+
+		/// Gets the number of lookups that were accepted by the filter but not found in the underlying set.
+		uint64_t numFalsePositiveLookups() const;
+
+		/// Gets the false positive rate in parts per million (false positive lookups / all lookups of absent hashes).
+		uint64_t falsePositiveRatePpm() const;
+
+	public:
+		/// Returns \c false if \a timestampedHash is definitely not contained in the underlying set.
+		/// \note Negative results are counted.
+		bool mayContain(const state::TimestampedHash& timestampedHash) const;
+
+		/// Records that a lookup of a timestamped hash accepted by the filter was not found in the underlying set.
+		void recordFalsePositive() const;
+
+	public:
+		/// Inserts \a timestampedHash into the filter.
+		void insert(const state::TimestampedHash& timestampedHash);
+
+		/// Removes all partitions that only contain timestamped hashes with timestamps prior to \a timestamp.
+		void prune(Timestamp timestamp);
+
+	private:
+		// scalable bloom filter: a partition grows by adding larger segments instead of rehashing inserted hashes
+		struct Segment {
+			std::vector<uint64_t> Bits;
+			size_t Capacity;
+			size_t Size;
+		};
+
+		using Partition = std::vector<Segment>;
+
+	private:
+		uint64_t m_partitionDuration;
+		std::map<uint64_t, Partition> m_partitions;
+		mutable std::atomic<uint64_t> m_numNegativeLookups;
+		mutable std::atomic<uint64_t> m_numFalsePositiveLookups;
+	};
+}}
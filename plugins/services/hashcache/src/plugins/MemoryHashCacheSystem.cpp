@@ -45,6 +45,12 @@ namespace catapult { namespace plugins {
 			counters.emplace_back(utils::DiagnosticCounterId("HASH C"), [&cache]() {
 				return cache.sub<cache::HashCache>().createView()->size();
 			});
+			counters.emplace_back(utils::DiagnosticCounterId("HASH C FMEM"), [&cache]() {
+				return cache.sub<cache::HashCache>().createView()->filter().memorySize();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("HASH C FPR"), [&cache]() {
+				return cache.sub<cache::HashCache>().createView()->filter().falsePositiveRatePpm();
+			});
 		});
 
 		manager.addStatefulValidatorHook([](auto& builder) {
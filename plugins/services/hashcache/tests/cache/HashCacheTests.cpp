@@ -111,4 +111,131 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region delta elements
+
+	TEST(TEST_CLASS, DeltaTracksAddedAndRemovedHashes) {
+		// Arrange:
+		HashCacheMixinTraits::CacheType cache;
+		{
+			auto delta = cache.createDelta();
+			for (uint8_t i = 100; i < 105; ++i)
+				delta->insert(HashCacheMixinTraits::CreateWithId(i));
+
+			cache.commit();
+		}
+
+		auto delta = cache.createDelta();
+
+		// Act:
+		delta->insert(HashCacheMixinTraits::CreateWithId(123));
+		delta->remove(HashCacheMixinTraits::MakeId(101));
+
+		// Assert:
+		auto addedElements = delta->addedElements();
+		auto removedElements = delta->removedElements();
+		ASSERT_EQ(1u, addedElements.size());
+		EXPECT_EQ(HashCacheMixinTraits::MakeId(123), **addedElements.cbegin());
+
+		EXPECT_TRUE(delta->modifiedElements().empty());
+
+		ASSERT_EQ(1u, removedElements.size());
+		EXPECT_EQ(HashCacheMixinTraits::MakeId(101), **removedElements.cbegin());
+	}
+
+	// endregion
+
+	// region filter
+
+	namespace {
+		state::TimestampedHash CreateRandomTimestampedHash(Timestamp timestamp) {
+			return state::TimestampedHash(timestamp, test::GenerateRandomData<Hash256_Size>());
+		}
+	}
+
+	TEST(TEST_CLASS, FilterRejectsAbsentHashesWithoutFalseNegatives) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(1));
+		std::vector<state::TimestampedHash> timestampedHashes;
+		{
+			auto delta = cache.createDelta();
+			for (auto i = 0u; i < 100; ++i) {
+				timestampedHashes.push_back(CreateRandomTimestampedHash(Timestamp(i * 1000)));
+				delta->insert(timestampedHashes.back());
+			}
+
+			cache.commit();
+		}
+
+		// Act:
+		auto view = cache.createView();
+		auto numContained = 0u;
+		for (const auto& timestampedHash : timestampedHashes)
+			numContained += view->contains(timestampedHash) ? 1 : 0;
+
+		for (auto i = 0u; i < 100; ++i)
+			numContained += view->contains(CreateRandomTimestampedHash(Timestamp(i * 1000))) ? 1 : 0;
+
+		// Assert: all absent lookups were either rejected by the filter or recorded as false positives
+		const auto& filter = view->filter();
+		EXPECT_EQ(100u, numContained);
+		EXPECT_EQ(100u, filter.numNegativeLookups() + filter.numFalsePositiveLookups());
+		EXPECT_LT(0u, filter.memorySize());
+	}
+
+	TEST(TEST_CLASS, DeltaContainsUncommittedHashesRejectedByFilter) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(1));
+		auto delta = cache.createDelta();
+		auto timestampedHash = CreateRandomTimestampedHash(Timestamp(1000));
+
+		// Act:
+		delta->insert(timestampedHash);
+
+		// Assert: filter only contains committed hashes
+		EXPECT_TRUE(delta->contains(timestampedHash));
+		EXPECT_FALSE(cache.createView()->contains(timestampedHash));
+	}
+
+	TEST(TEST_CLASS, CommitAddsHashesToFilter) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(1));
+		auto delta = cache.createDelta();
+		auto timestampedHash = CreateRandomTimestampedHash(Timestamp(1000));
+		delta->insert(timestampedHash);
+
+		// Act:
+		cache.commit();
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_TRUE(view->filter().mayContain(timestampedHash));
+		EXPECT_TRUE(view->contains(timestampedHash));
+		EXPECT_TRUE(delta->contains(timestampedHash));
+	}
+
+	TEST(TEST_CLASS, CommitPrunesFilter) {
+		// Arrange: retention time of 8 hours results in hourly filter partitions
+		constexpr auto Hour_Millis = 60 * 60 * 1000ull;
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(8));
+		auto delta = cache.createDelta();
+		for (auto hour : { 1u, 2u, 3u })
+			delta->insert(CreateRandomTimestampedHash(Timestamp(hour * Hour_Millis)));
+
+		cache.commit();
+
+		// Sanity:
+		EXPECT_EQ(3u, cache.createView()->filter().numPartitions());
+
+		// Act: prune all hashes prior to 2.5 hours
+		delta->prune(Timestamp(8 * Hour_Millis + 5 * Hour_Millis / 2));
+		cache.commit();
+
+		// Assert: only the partition that contained the hash at 1 hour was removed
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_EQ(2u, view->filter().numPartitions());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,193 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/TimestampedHashFilter.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TimestampedHashFilterTests
+
+	namespace {
+		constexpr auto Partition_Duration = utils::TimeSpan::FromMilliseconds(1000);
+
+		std::vector<state::TimestampedHash> GenerateTimestampedHashes(size_t count, Timestamp::ValueType maxTime) {
+			std::vector<state::TimestampedHash> timestampedHashes;
+			for (auto i = 0u; i < count; ++i) {
+				auto time = Timestamp(test::Random() % maxTime);
+				timestampedHashes.push_back(state::TimestampedHash(time, test::GenerateRandomData<Hash256_Size>()));
+			}
+
+			return timestampedHashes;
+		}
+
+		size_t CountMayContain(const TimestampedHashFilter& filter, const std::vector<state::TimestampedHash>& timestampedHashes) {
+			return static_cast<size_t>(std::count_if(timestampedHashes.cbegin(), timestampedHashes.cend(), [&filter](const auto& hash) {
+				return filter.mayContain(hash);
+			}));
+		}
+	}
+
+	// region ctor
+
+	TEST(TEST_CLASS, CanCreateEmptyFilter) {
+		// Act:
+		TimestampedHashFilter filter(Partition_Duration);
+
+		// Assert:
+		EXPECT_EQ(0u, filter.numPartitions());
+		EXPECT_EQ(0u, filter.memorySize());
+		EXPECT_EQ(0u, filter.numNegativeLookups());
+		EXPECT_EQ(0u, filter.numFalsePositiveLookups());
+		EXPECT_EQ(0u, filter.falsePositiveRatePpm());
+	}
+
+	// endregion
+
+	// region insert / mayContain
+
+	TEST(TEST_CLASS, EmptyFilterDoesNotContainAnyHashes) {
+		// Arrange:
+		TimestampedHashFilter filter(Partition_Duration);
+		auto timestampedHashes = GenerateTimestampedHashes(100, 10'000);
+
+		// Act + Assert:
+		EXPECT_EQ(0u, CountMayContain(filter, timestampedHashes));
+		EXPECT_EQ(100u, filter.numNegativeLookups());
+	}
+
+	TEST(TEST_CLASS, FilterContainsAllInsertedHashes) {
+		// Arrange: insert enough hashes to require multiple segments in some partitions
+		TimestampedHashFilter filter(Partition_Duration);
+		auto timestampedHashes = GenerateTimestampedHashes(20'000, 10'000);
+
+		// Act:
+		for (const auto& timestampedHash : timestampedHashes)
+			filter.insert(timestampedHash);
+
+		// Assert:
+		EXPECT_EQ(10u, filter.numPartitions());
+		EXPECT_LT(0u, filter.memorySize());
+		EXPECT_EQ(timestampedHashes.size(), CountMayContain(filter, timestampedHashes));
+		EXPECT_EQ(0u, filter.numNegativeLookups());
+	}
+
+	TEST(TEST_CLASS, FilterRejectsMostAbsentHashes) {
+		// Arrange:
+		TimestampedHashFilter filter(Partition_Duration);
+		for (const auto& timestampedHash : GenerateTimestampedHashes(20'000, 10'000))
+			filter.insert(timestampedHash);
+
+		// Act:
+		auto numMayContain = CountMayContain(filter, GenerateTimestampedHashes(10'000, 10'000));
+
+		// Assert: false positive rate is less than 2%
+		EXPECT_GT(200u, numMayContain);
+		EXPECT_EQ(10'000u - numMayContain, filter.numNegativeLookups());
+	}
+
+	TEST(TEST_CLASS, FilterDoesNotContainHashWithDifferentTimestamp) {
+		// Arrange:
+		TimestampedHashFilter filter(Partition_Duration);
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		filter.insert(state::TimestampedHash(Timestamp(1500), hash));
+
+		// Act + Assert: other partitions do not contain hash
+		EXPECT_TRUE(filter.mayContain(state::TimestampedHash(Timestamp(1500), hash)));
+		EXPECT_FALSE(filter.mayContain(state::TimestampedHash(Timestamp(500), hash)));
+		EXPECT_FALSE(filter.mayContain(state::TimestampedHash(Timestamp(2500), hash)));
+	}
+
+	// endregion
+
+	// region prune
+
+	TEST(TEST_CLASS, PruneRemovesOnlyPartitionsWithAllTimestampsPriorToPruneTime) {
+		// Arrange: partitions [0, 1000), [1000, 2000), [2000, 3000)
+		TimestampedHashFilter filter(Partition_Duration);
+		std::vector<state::TimestampedHash> timestampedHashes;
+		for (auto time : { 100u, 999u, 1000u, 1999u, 2000u })
+			timestampedHashes.push_back(state::TimestampedHash(Timestamp(time), test::GenerateRandomData<Hash256_Size>()));
+
+		for (const auto& timestampedHash : timestampedHashes)
+			filter.insert(timestampedHash);
+
+		// Act: prune time is within second partition
+		filter.prune(Timestamp(1500));
+
+		// Assert:
+		EXPECT_EQ(2u, filter.numPartitions());
+		EXPECT_FALSE(filter.mayContain(timestampedHashes[0]));
+		EXPECT_FALSE(filter.mayContain(timestampedHashes[1]));
+		for (auto i = 2u; i < timestampedHashes.size(); ++i)
+			EXPECT_TRUE(filter.mayContain(timestampedHashes[i])) << "hash at " << i;
+	}
+
+	TEST(TEST_CLASS, PruneAtPartitionBoundaryRemovesPartition) {
+		// Arrange:
+		TimestampedHashFilter filter(Partition_Duration);
+		filter.insert(state::TimestampedHash(Timestamp(999), test::GenerateRandomData<Hash256_Size>()));
+		filter.insert(state::TimestampedHash(Timestamp(1000), test::GenerateRandomData<Hash256_Size>()));
+
+		// Act:
+		filter.prune(Timestamp(1000));
+
+		// Assert:
+		EXPECT_EQ(1u, filter.numPartitions());
+	}
+
+	TEST(TEST_CLASS, PruneReducesMemorySize) {
+		// Arrange:
+		TimestampedHashFilter filter(Partition_Duration);
+		for (const auto& timestampedHash : GenerateTimestampedHashes(1000, 10'000))
+			filter.insert(timestampedHash);
+
+		auto originalMemorySize = filter.memorySize();
+
+		// Act:
+		filter.prune(Timestamp(5000));
+
+		// Assert:
+		EXPECT_EQ(5u, filter.numPartitions());
+		EXPECT_GT(originalMemorySize, filter.memorySize());
+	}
+
+	// endregion
+
+	// region false positive rate
+
+	TEST(TEST_CLASS, FalsePositiveRateIsCalculatedFromNegativeAndFalsePositiveLookups) {
+		// Arrange:
+		TimestampedHashFilter filter(Partition_Duration);
+		for (auto i = 0u; i < 3; ++i)
+			filter.mayContain(state::TimestampedHash(Timestamp(i), test::GenerateRandomData<Hash256_Size>()));
+
+		// Act:
+		filter.recordFalsePositive();
+
+		// Assert: 1 / (3 + 1)
+		EXPECT_EQ(3u, filter.numNegativeLookups());
+		EXPECT_EQ(1u, filter.numFalsePositiveLookups());
+		EXPECT_EQ(250'000u, filter.falsePositiveRatePpm());
+	}
+
+	// endregion
+}}
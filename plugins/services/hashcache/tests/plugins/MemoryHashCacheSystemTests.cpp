@@ -51,7 +51,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "HASH C" };
+				return { "HASH C", "HASH C FMEM", "HASH C FPR" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -25,6 +25,7 @@
 #include "src/observers/Observers.h"
 #include "src/plugins/HashLockTransactionPlugin.h"
 #include "src/validators/Validators.h"
+#include "catapult/cache/SubCacheMerkleRootTimings.h"
 #include "catapult/handlers/CacheEntryInfosProducerFactory.h"
 #include "catapult/handlers/StatePathHandlerFactory.h"
 #include "catapult/observers/ObserverUtils.h"
@@ -50,6 +51,9 @@ namespace catapult { namespace plugins {
 			counters.emplace_back(utils::DiagnosticCounterId("HASHLOCK C"), [&cache]() {
 				return cache.sub<cache::HashLockInfoCache>().createView()->size();
 			});
+			counters.emplace_back(utils::DiagnosticCounterId("HASHLOCK SH"), [&cache]() {
+				return cache.merkleRootTimings().elapsedMicros(cache::HashLockInfoCache::Id);
+			});
 		});
 
 		auto config = model::LoadPluginConfiguration<config::HashLockConfiguration>(manager.config(), "catapult.plugins.lockhash");
@@ -62,7 +62,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "HASHLOCK C" };
+				return { "HASHLOCK C", "HASHLOCK SH" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -26,6 +26,7 @@
 #include "src/plugins/SecretLockTransactionPlugin.h"
 #include "src/plugins/SecretProofTransactionPlugin.h"
 #include "src/validators/Validators.h"
+#include "catapult/cache/SubCacheMerkleRootTimings.h"
 #include "catapult/handlers/CacheEntryInfosProducerFactory.h"
 #include "catapult/handlers/StatePathHandlerFactory.h"
 #include "catapult/observers/ObserverUtils.h"
@@ -55,6 +56,9 @@ namespace catapult { namespace plugins {
 			counters.emplace_back(utils::DiagnosticCounterId("SECRETLOCK C"), [&cache]() {
 				return cache.sub<cache::SecretLockInfoCache>().createView()->size();
 			});
+			counters.emplace_back(utils::DiagnosticCounterId("SECRETLOCK SH"), [&cache]() {
+				return cache.merkleRootTimings().elapsedMicros(cache::SecretLockInfoCache::Id);
+			});
 		});
 
 		auto config = model::LoadPluginConfiguration<config::SecretLockConfiguration>(manager.config(), "catapult.plugins.locksecret");
@@ -63,7 +63,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "SECRETLOCK C" };
+				return { "SECRETLOCK C", "SECRETLOCK SH" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
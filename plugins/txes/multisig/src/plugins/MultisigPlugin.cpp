@@ -26,6 +26,7 @@
 #include "src/observers/Observers.h"
 #include "src/plugins/ModifyMultisigAccountTransactionPlugin.h"
 #include "src/validators/Validators.h"
+#include "catapult/cache/SubCacheMerkleRootTimings.h"
 #include "catapult/handlers/CacheEntryInfosProducerFactory.h"
 #include "catapult/handlers/StatePathHandlerFactory.h"
 #include "catapult/plugins/PluginManager.h"
@@ -38,12 +39,22 @@ namespace catapult { namespace plugins {
 		manager.addCacheSupport<cache::MultisigCacheStorage>(
 				std::make_unique<cache::MultisigCache>(manager.cacheConfig(cache::MultisigCache::Name)));
 
-		manager.addDiagnosticHandlerHook([](auto& handlers, const cache::CatapultCache& cache) {
+		auto maxStateMultiproofKeys = manager.storageConfig().MaxStateMultiproofKeys;
+		manager.addDiagnosticHandlerHook([maxStateMultiproofKeys](auto& handlers, const cache::CatapultCache& cache) {
 			using MultisigInfosProducerFactory = handlers::CacheEntryInfosProducerFactory<cache::MultisigCacheDescriptor>;
 			handlers::RegisterMultisigInfosHandler(handlers, MultisigInfosProducerFactory::Create(cache.sub<cache::MultisigCache>()));
 
 			using PacketType = handlers::StatePathRequestPacket<ionet::PacketType::Multisig_State_Path, Key>;
 			handlers::RegisterStatePathHandler<PacketType>(handlers, cache.sub<cache::MultisigCache>());
+
+			using ProofPacketType = handlers::StateMultiproofRequestPacket<ionet::PacketType::Multisig_State_Multiproof, Key>;
+			handlers::RegisterStateMultiproofHandler<ProofPacketType>(handlers, cache.sub<cache::MultisigCache>(), maxStateMultiproofKeys);
+		});
+
+		manager.addDiagnosticCounterHook([](auto& counters, const cache::CatapultCache& cache) {
+			counters.emplace_back(utils::DiagnosticCounterId("MULTISIG SH"), [&cache]() {
+				return cache.merkleRootTimings().elapsedMicros(cache::MultisigCache::Id);
+			});
 		});
 
 		manager.addStatelessValidatorHook([](auto& builder) {
@@ -58,11 +58,15 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<ionet::PacketType> GetDiagnosticPacketTypes() {
-				return { ionet::PacketType::Multisig_Infos, ionet::PacketType::Multisig_State_Path };
+				return {
+					ionet::PacketType::Multisig_Infos,
+					ionet::PacketType::Multisig_State_Path,
+					ionet::PacketType::Multisig_State_Multiproof
+				};
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return {};
+				return { "MULTISIG SH" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -56,7 +56,7 @@ namespace catapult { namespace cache {
 				, Primary(GetContainerMode(config), database(), 0)
 				, NamespaceGrouping(GetContainerMode(config), database(), 1)
 				, HeightGrouping(GetContainerMode(config), database(), 2)
-				, PatriciaTree(hasPatriciaTreeSupport(), database(), 3)
+				, PatriciaTree(hasPatriciaTreeSupport(), database(), 3, patriciaTreeNodeCache())
 		{}
 
 	public:
@@ -33,6 +33,7 @@
 #include "src/model/NamespaceLifetimeConstraints.h"
 #include "src/observers/Observers.h"
 #include "src/validators/Validators.h"
+#include "catapult/cache/SubCacheMerkleRootTimings.h"
 #include "catapult/handlers/CacheEntryInfosProducerFactory.h"
 #include "catapult/handlers/StatePathHandlerFactory.h"
 #include "catapult/model/Address.h"
@@ -70,17 +71,24 @@ namespace catapult { namespace plugins {
 
 			manager.addCacheSupport(std::make_unique<cache::MosaicCacheSubCachePlugin>(manager.cacheConfig(cache::MosaicCache::Name)));
 
-			manager.addDiagnosticHandlerHook([](auto& handlers, const cache::CatapultCache& cache) {
+			auto maxStateMultiproofKeys = manager.storageConfig().MaxStateMultiproofKeys;
+			manager.addDiagnosticHandlerHook([maxStateMultiproofKeys](auto& handlers, const cache::CatapultCache& cache) {
 				using MosaicInfosProducerFactory = handlers::CacheEntryInfosProducerFactory<cache::MosaicCacheDescriptor>;
 				handlers::RegisterMosaicInfosHandler(handlers, MosaicInfosProducerFactory::Create(cache.sub<cache::MosaicCache>()));
 
 				using PacketType = handlers::StatePathRequestPacket<ionet::PacketType::Mosaic_State_Path, MosaicId>;
 				handlers::RegisterStatePathHandler<PacketType>(handlers, cache.sub<cache::MosaicCache>());
+
+				using ProofPacketType = handlers::StateMultiproofRequestPacket<ionet::PacketType::Mosaic_State_Multiproof, MosaicId>;
+				handlers::RegisterStateMultiproofHandler<ProofPacketType>(handlers, cache.sub<cache::MosaicCache>(), maxStateMultiproofKeys);
 			});
 
 			manager.addDiagnosticCounterHook([](auto& counters, const cache::CatapultCache& cache) {
 				counters.emplace_back(utils::DiagnosticCounterId("MOSAIC C"), [&cache]() { return GetMosaicView(cache)->size(); });
 				counters.emplace_back(utils::DiagnosticCounterId("MOSAIC C DS"), [&cache]() { return GetMosaicView(cache)->deepSize(); });
+				counters.emplace_back(utils::DiagnosticCounterId("MOSAIC SH"), [&cache]() {
+					return cache.merkleRootTimings().elapsedMicros(cache::MosaicCache::Id);
+				});
 			});
 
 			auto maxDuration = config.MaxMosaicDuration.blocks(manager.config().BlockGenerationTargetTime);
@@ -146,7 +154,8 @@ namespace catapult { namespace plugins {
 					manager.cacheConfig(cache::NamespaceCache::Name),
 					cache::NamespaceCacheTypes::Options{ gracePeriodDuration }));
 
-			manager.addDiagnosticHandlerHook([](auto& handlers, const cache::CatapultCache& cache) {
+			auto maxStateMultiproofKeys = manager.storageConfig().MaxStateMultiproofKeys;
+			manager.addDiagnosticHandlerHook([maxStateMultiproofKeys](auto& handlers, const cache::CatapultCache& cache) {
 				using NamespaceInfosProducerFactory = handlers::CacheEntryInfosProducerFactory<cache::NamespaceCacheDescriptor>;
 				handlers::RegisterNamespaceInfosHandler(
 						handlers,
@@ -154,12 +163,18 @@ namespace catapult { namespace plugins {
 
 				using PacketType = handlers::StatePathRequestPacket<ionet::PacketType::Namespace_State_Path, NamespaceId>;
 				handlers::RegisterStatePathHandler<PacketType>(handlers, cache.sub<cache::NamespaceCache>());
+
+				using ProofPacketType = handlers::StateMultiproofRequestPacket<ionet::PacketType::Namespace_State_Multiproof, NamespaceId>;
+				handlers::RegisterStateMultiproofHandler<ProofPacketType>(handlers, cache.sub<cache::NamespaceCache>(), maxStateMultiproofKeys);
 			});
 
 			manager.addDiagnosticCounterHook([](auto& counters, const cache::CatapultCache& cache) {
 				counters.emplace_back(utils::DiagnosticCounterId("NS C"), [&cache]() { return GetNamespaceView(cache)->size(); });
 				counters.emplace_back(utils::DiagnosticCounterId("NS C AS"), [&cache]() { return GetNamespaceView(cache)->activeSize(); });
 				counters.emplace_back(utils::DiagnosticCounterId("NS C DS"), [&cache]() { return GetNamespaceView(cache)->deepSize(); });
+				counters.emplace_back(utils::DiagnosticCounterId("NS SH"), [&cache]() {
+					return cache.merkleRootTimings().elapsedMicros(cache::NamespaceCache::Id);
+				});
 			});
 
 			manager.addStatelessValidatorHook([config, maxDuration](auto& builder) {
@@ -85,13 +85,15 @@ namespace catapult { namespace plugins {
 				return {
 					ionet::PacketType::Namespace_Infos,
 					ionet::PacketType::Namespace_State_Path,
+					ionet::PacketType::Namespace_State_Multiproof,
 					ionet::PacketType::Mosaic_Infos,
-					ionet::PacketType::Mosaic_State_Path
+					ionet::PacketType::Mosaic_State_Path,
+					ionet::PacketType::Mosaic_State_Multiproof
 				};
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "NS C", "NS C AS", "NS C DS", "MOSAIC C", "MOSAIC C DS" };
+				return { "NS C", "NS C AS", "NS C DS", "NS SH", "MOSAIC C", "MOSAIC C DS", "MOSAIC SH" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -26,6 +26,7 @@
 #include "src/observers/Observers.h"
 #include "src/plugins/PropertyTransactionPlugin.h"
 #include "src/validators/Validators.h"
+#include "catapult/cache/SubCacheMerkleRootTimings.h"
 #include "catapult/handlers/CacheEntryInfosProducerFactory.h"
 #include "catapult/handlers/StatePathHandlerFactory.h"
 #include "catapult/plugins/PluginManager.h"
@@ -56,6 +57,9 @@ namespace catapult { namespace plugins {
 			counters.emplace_back(utils::DiagnosticCounterId("PROPERTY C"), [&cache]() {
 				return cache.sub<cache::PropertyCache>().createView()->size();
 			});
+			counters.emplace_back(utils::DiagnosticCounterId("PROPERTY SH"), [&cache]() {
+				return cache.merkleRootTimings().elapsedMicros(cache::PropertyCache::Id);
+			});
 		});
 
 		manager.addStatelessValidatorHook([networkIdentifier](auto& builder) {
@@ -64,7 +64,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "PROPERTY C" };
+				return { "PROPERTY C", "PROPERTY SH" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -21,6 +21,7 @@
 #include "RemoteDiagnosticApi.h"
 #include "catapult/api/RemoteRequestDispatcher.h"
 #include "catapult/handlers/DiagnosticHandlers.h"
+#include "catapult/handlers/StatePathHandlerFactory.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketIo.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
@@ -120,6 +121,50 @@ namespace catapult { namespace extensions {
 			static constexpr auto FriendlyName() { return "mosaic infos"; }
 		};
 
+		template<typename TIdentifier, ionet::PacketType Packet_Type>
+		struct StateProofTraits {
+		public:
+			using ResultType = StateMultiproof;
+			static constexpr ionet::PacketType PacketType() { return Packet_Type; }
+
+			static auto CreateRequestPacketPayload(model::EntityRange<TIdentifier>&& ids) {
+				return ionet::PacketPayloadFactory::FromFixedSizeRange(PacketType(), std::move(ids));
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				using ResponseType = handlers::StateMultiproofResponse<Packet_Type>;
+				if (packet.Size < sizeof(ResponseType))
+					return false;
+
+				const auto& response = static_cast<const ResponseType&>(packet);
+				const auto* pSerializedNodes = reinterpret_cast<const uint8_t*>(&response + 1);
+				result.MerkleRoot = response.MerkleRoot;
+				result.SerializedNodes.assign(pSerializedNodes, pSerializedNodes + packet.Size - sizeof(ResponseType));
+				return true;
+			}
+		};
+
+		struct AccountStateProofTraits : public StateProofTraits<Address, ionet::PacketType::Account_State_Multiproof> {
+		public:
+			static constexpr auto FriendlyName() { return "account state proof"; }
+		};
+
+		struct NamespaceStateProofTraits : public StateProofTraits<NamespaceId, ionet::PacketType::Namespace_State_Multiproof> {
+		public:
+			static constexpr auto FriendlyName() { return "namespace state proof"; }
+		};
+
+		struct MosaicStateProofTraits : public StateProofTraits<MosaicId, ionet::PacketType::Mosaic_State_Multiproof> {
+		public:
+			static constexpr auto FriendlyName() { return "mosaic state proof"; }
+		};
+
+		struct MultisigStateProofTraits : public StateProofTraits<Key, ionet::PacketType::Multisig_State_Multiproof> {
+		public:
+			static constexpr auto FriendlyName() { return "multisig state proof"; }
+		};
+
 		// endregion
 
 		class DefaultRemoteDiagnosticApi : public RemoteDiagnosticApi {
@@ -161,6 +206,22 @@ namespace catapult { namespace extensions {
 				return m_impl.dispatch(MosaicInfosTraits(), std::move(mosaicIds));
 			}
 
+			FutureType<AccountStateProofTraits> accountStateProof(model::AddressRange&& addresses) const override {
+				return m_impl.dispatch(AccountStateProofTraits(), std::move(addresses));
+			}
+
+			FutureType<NamespaceStateProofTraits> namespaceStateProof(model::EntityRange<NamespaceId>&& namespaceIds) const override {
+				return m_impl.dispatch(NamespaceStateProofTraits(), std::move(namespaceIds));
+			}
+
+			FutureType<MosaicStateProofTraits> mosaicStateProof(model::EntityRange<MosaicId>&& mosaicIds) const override {
+				return m_impl.dispatch(MosaicStateProofTraits(), std::move(mosaicIds));
+			}
+
+			FutureType<MultisigStateProofTraits> multisigStateProof(model::EntityRange<Key>&& keys) const override {
+				return m_impl.dispatch(MultisigStateProofTraits(), std::move(keys));
+			}
+
 		private:
 			mutable api::RemoteRequestDispatcher m_impl;
 		};
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "StateProofVerifier.h"
 #include "plugins/txes/namespace/src/types.h"
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/model/CacheEntryInfo.h"
@@ -64,6 +65,18 @@ namespace catapult { namespace extensions {
 		/// Gets mosaic infos for all mosaic ids in \a mosaicIds.
 		virtual future<model::EntityRange<model::CacheEntryInfo<MosaicId>>> mosaicInfos(
 				model::EntityRange<MosaicId>&& mosaicIds) const = 0;
+
+		/// Gets a state multiproof for all accounts with addresses in \a addresses.
+		virtual future<StateMultiproof> accountStateProof(model::AddressRange&& addresses) const = 0;
+
+		/// Gets a state multiproof for all namespaces with ids in \a namespaceIds.
+		virtual future<StateMultiproof> namespaceStateProof(model::EntityRange<NamespaceId>&& namespaceIds) const = 0;
+
+		/// Gets a state multiproof for all mosaics with ids in \a mosaicIds.
+		virtual future<StateMultiproof> mosaicStateProof(model::EntityRange<MosaicId>&& mosaicIds) const = 0;
+
+		/// Gets a state multiproof for all multisig accounts with public keys in \a keys.
+		virtual future<StateMultiproof> multisigStateProof(model::EntityRange<Key>&& keys) const = 0;
 	};
 
 	/// Creates a diagnostic api for interacting with a remote node with the specified \a io.
@@ -0,0 +1,36 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StateProofVerifier.h"
+#include "catapult/crypto/Hashes.h"
+
+namespace catapult { namespace extensions {
+
+	StateProofVerifier::StateProofVerifier(const Hash256& merkleRoot, const RawBuffer& serializedProof)
+			: m_merkleRoot(merkleRoot)
+			, m_proof(serializedProof)
+	{}
+
+	tree::MultiproofLookupResult StateProofVerifier::lookup(const RawBuffer& key, Hash256& valueHash) const {
+		Hash256 keyHash;
+		crypto::Sha3_256(key, keyHash);
+		return m_proof.lookup(m_merkleRoot, tree::TreeNodePath(keyHash), valueHash);
+	}
+}}
@@ -0,0 +1,71 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/tree/PatriciaTreeMultiproof.h"
+
+namespace catapult { namespace extensions {
+
+	/// State multiproof returned by a remote node.
+	struct StateMultiproof {
+		/// Sub cache merkle root reported by the remote node.
+		/// \note This root is untrusted and must be checked against an independently verified root.
+		Hash256 MerkleRoot;
+
+		/// Deduplicated serialized tree nodes composing the proof.
+		std::vector<uint8_t> SerializedNodes;
+	};
+
+	/// Verifies the existence or non-existence of state entries using a state multiproof.
+	/// \note Keys are hashed in the same way as by the sub cache patricia trees.
+	class StateProofVerifier {
+	public:
+		/// Creates a verifier around a trusted sub cache merkle root (\a merkleRoot) and a serialized multiproof (\a serializedProof).
+		StateProofVerifier(const Hash256& merkleRoot, const RawBuffer& serializedProof);
+
+	public:
+		/// Looks up \a key in the proof and sets \a valueHash to the hash of the associated state entry when it is found.
+		template<typename TKey>
+		tree::MultiproofLookupResult lookup(const TKey& key, Hash256& valueHash) const {
+			return lookup(RawBuffer(reinterpret_cast<const uint8_t*>(&key), sizeof(TKey)), valueHash);
+		}
+
+		/// Returns \c true if the proof shows that \a key is associated with a state entry with hash \a valueHash.
+		template<typename TKey>
+		bool isProvenFound(const TKey& key, const Hash256& valueHash) const {
+			Hash256 provenValueHash;
+			return tree::MultiproofLookupResult::Found == lookup(key, provenValueHash) && valueHash == provenValueHash;
+		}
+
+		/// Returns \c true if the proof shows that \a key is not associated with any state entry.
+		template<typename TKey>
+		bool isProvenNotFound(const TKey& key) const {
+			Hash256 provenValueHash;
+			return tree::MultiproofLookupResult::Not_Found == lookup(key, provenValueHash);
+		}
+
+	private:
+		tree::MultiproofLookupResult lookup(const RawBuffer& key, Hash256& valueHash) const;
+
+	private:
+		Hash256 m_merkleRoot;
+		tree::PatriciaTreeMultiproof m_proof;
+	};
+}}
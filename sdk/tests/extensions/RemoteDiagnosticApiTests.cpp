@@ -306,6 +306,65 @@ namespace catapult { namespace extensions {
 
 		// endregion
 
+		// region StateProofTraits
+
+		template<typename TIdentifier, ionet::PacketType Packet_Type>
+		struct StateProofTraits {
+		public:
+			using RequestParamType = model::EntityRange<TIdentifier>;
+			using ResponseType = StateMultiproof;
+
+			static constexpr auto PacketType() { return Packet_Type; }
+			static constexpr auto Request_Entity_Size = sizeof(TIdentifier);
+			static constexpr auto Response_Node_Size = 35u;
+
+		public:
+			static auto CreateResponsePacket(uint32_t numNodes) {
+				// merkle root followed by serialized nodes
+				uint32_t payloadSize = Hash256_Size + numNodes * Response_Node_Size;
+				auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				test::FillWithRandomData({ pPacket->Data(), payloadSize });
+				return pPacket;
+			}
+
+			static std::vector<TIdentifier> RequestParamValues() {
+				return InfosTraits<TIdentifier, Packet_Type>::RequestParamValues();
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const StateMultiproof& proof) {
+				EXPECT_EQ(reinterpret_cast<const Hash256&>(*response.Data()), proof.MerkleRoot);
+
+				ASSERT_EQ(response.Size - sizeof(ionet::Packet) - Hash256_Size, proof.SerializedNodes.size());
+				EXPECT_TRUE(0 == std::memcmp(response.Data() + Hash256_Size, proof.SerializedNodes.data(), proof.SerializedNodes.size()));
+			}
+		};
+
+		struct AccountStateProofTraits : public StateProofTraits<Address, ionet::PacketType::Account_State_Multiproof> {
+			static auto Invoke(const RemoteDiagnosticApi& api, RequestParamType&& param) {
+				return api.accountStateProof(std::move(param));
+			}
+		};
+
+		struct NamespaceStateProofTraits : public StateProofTraits<NamespaceId, ionet::PacketType::Namespace_State_Multiproof> {
+			static auto Invoke(const RemoteDiagnosticApi& api, RequestParamType&& param) {
+				return api.namespaceStateProof(std::move(param));
+			}
+		};
+
+		struct MosaicStateProofTraits : public StateProofTraits<MosaicId, ionet::PacketType::Mosaic_State_Multiproof> {
+			static auto Invoke(const RemoteDiagnosticApi& api, RequestParamType&& param) {
+				return api.mosaicStateProof(std::move(param));
+			}
+		};
+
+		struct MultisigStateProofTraits : public StateProofTraits<Key, ionet::PacketType::Multisig_State_Multiproof> {
+			static auto Invoke(const RemoteDiagnosticApi& api, RequestParamType&& param) {
+				return api.multisigStateProof(std::move(param));
+			}
+		};
+
+		// endregion
+
 		// region DiagnosticApiTraits
 
 		template<typename TTraits>
@@ -347,6 +406,16 @@ namespace catapult { namespace extensions {
 			}
 		};
 
+		template<typename TTraits>
+		struct StateProofApiTraits : public DiagnosticApiTraits<TTraits> {
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial merkle root
+				auto pResponsePacket = DiagnosticApiTraits<TTraits>::CreateValidResponsePacket();
+				pResponsePacket->Size = static_cast<uint32_t>(sizeof(ionet::Packet) + Hash256_Size - 1);
+				return pResponsePacket;
+			}
+		};
+
 		// endregion
 
 		// region RemoteDiagnosticApiTraits
@@ -374,4 +443,13 @@ namespace catapult { namespace extensions {
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticAccountPropertiesInfos)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticNamespaceInfos)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticMosaicInfos)
+
+	using DiagnosticAccountStateProofTraits = StateProofApiTraits<AccountStateProofTraits>;
+	using DiagnosticNamespaceStateProofTraits = StateProofApiTraits<NamespaceStateProofTraits>;
+	using DiagnosticMosaicStateProofTraits = StateProofApiTraits<MosaicStateProofTraits>;
+	using DiagnosticMultisigStateProofTraits = StateProofApiTraits<MultisigStateProofTraits>;
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticAccountStateProof)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticNamespaceStateProof)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticMosaicStateProof)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticMultisigStateProof)
 }}
@@ -0,0 +1,158 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/extensions/StateProofVerifier.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace extensions {
+
+#define TEST_CLASS StateProofVerifierTests
+
+	namespace {
+		// mirrors the key hashing of the sub cache patricia trees
+		struct HashedAddressEncoder {
+			using KeyType = Address;
+			using ValueType = Hash256;
+
+			static Hash256 EncodeKey(const KeyType& key) {
+				Hash256 keyHash;
+				crypto::Sha3_256(key, keyHash);
+				return keyHash;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using MemoryPatriciaTree = tree::PatriciaTree<HashedAddressEncoder, tree::MemoryDataSource>;
+
+		class TestContext {
+		public:
+			explicit TestContext(size_t numAccounts) : m_tree(m_dataSource) {
+				for (auto i = 0u; i < numAccounts; ++i) {
+					m_addresses.push_back(test::GenerateRandomData<Address_Decoded_Size>());
+					m_valueHashes.push_back(test::GenerateRandomData<Hash256_Size>());
+					m_tree.set(m_addresses.back(), m_valueHashes.back());
+				}
+			}
+
+		public:
+			const auto& addresses() const {
+				return m_addresses;
+			}
+
+			const auto& valueHashes() const {
+				return m_valueHashes;
+			}
+
+			auto root() const {
+				return m_tree.root();
+			}
+
+			std::vector<uint8_t> buildProof(const std::vector<Address>& addresses) const {
+				tree::PatriciaTreeMultiproofBuilder builder;
+				for (const auto& address : addresses) {
+					std::vector<tree::TreeNode> nodePath;
+					m_tree.lookup(address, nodePath);
+					builder.add(nodePath);
+				}
+
+				return builder.serializedProof();
+			}
+
+		private:
+			std::vector<Address> m_addresses;
+			std::vector<Hash256> m_valueHashes;
+			tree::MemoryDataSource m_dataSource;
+			MemoryPatriciaTree m_tree;
+		};
+	}
+
+	TEST(TEST_CLASS, CanProveAccountsInState) {
+		// Arrange:
+		TestContext context(10);
+		const auto& addresses = context.addresses();
+		StateProofVerifier verifier(context.root(), context.buildProof({ addresses[2], addresses[7] }));
+
+		// Act + Assert:
+		for (auto i : { 2u, 7u }) {
+			Hash256 valueHash;
+			EXPECT_EQ(tree::MultiproofLookupResult::Found, verifier.lookup(addresses[i], valueHash)) << i;
+			EXPECT_EQ(context.valueHashes()[i], valueHash) << i;
+
+			EXPECT_TRUE(verifier.isProvenFound(addresses[i], context.valueHashes()[i])) << i;
+			EXPECT_FALSE(verifier.isProvenFound(addresses[i], test::GenerateRandomData<Hash256_Size>())) << i;
+			EXPECT_FALSE(verifier.isProvenNotFound(addresses[i])) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanProveAccountsNotInState) {
+		// Arrange:
+		TestContext context(10);
+		auto unknownAddress = test::GenerateRandomData<Address_Decoded_Size>();
+		StateProofVerifier verifier(context.root(), context.buildProof({ unknownAddress }));
+
+		// Act + Assert:
+		Hash256 valueHash;
+		EXPECT_EQ(tree::MultiproofLookupResult::Not_Found, verifier.lookup(unknownAddress, valueHash));
+		EXPECT_TRUE(verifier.isProvenNotFound(unknownAddress));
+	}
+
+	TEST(TEST_CLASS, CannotProveAccountsNotCoveredByProof) {
+		// Arrange:
+		TestContext context(10);
+		const auto& addresses = context.addresses();
+		StateProofVerifier verifier(context.root(), context.buildProof({ addresses[2] }));
+
+		// Act + Assert: proof for a single leaf cannot include the leaves of any other accounts
+		for (auto i : { 0u, 5u, 9u }) {
+			Hash256 valueHash;
+			EXPECT_EQ(tree::MultiproofLookupResult::Incomplete, verifier.lookup(addresses[i], valueHash)) << i;
+			EXPECT_FALSE(verifier.isProvenFound(addresses[i], context.valueHashes()[i])) << i;
+			EXPECT_FALSE(verifier.isProvenNotFound(addresses[i])) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotProveAnythingWithUntrustedMerkleRoot) {
+		// Arrange:
+		TestContext context(10);
+		const auto& addresses = context.addresses();
+		StateProofVerifier verifier(test::GenerateRandomData<Hash256_Size>(), context.buildProof({ addresses[2] }));
+
+		// Act + Assert:
+		Hash256 valueHash;
+		EXPECT_EQ(tree::MultiproofLookupResult::Incomplete, verifier.lookup(addresses[2], valueHash));
+		EXPECT_FALSE(verifier.isProvenFound(addresses[2], context.valueHashes()[2]));
+	}
+
+	TEST(TEST_CLASS, CannotCreateVerifierAroundMalformedProof) {
+		// Arrange:
+		TestContext context(10);
+		auto serializedProof = context.buildProof({ context.addresses()[2] });
+		serializedProof.pop_back();
+
+		// Act + Assert:
+		EXPECT_THROW(StateProofVerifier(context.root(), serializedProof), catapult_invalid_argument);
+	}
+}}
@@ -20,10 +20,14 @@
 
 #pragma once
 #include "catapult/utils/FileSize.h"
+#include <memory>
 #include <string>
 
 namespace catapult { namespace cache {
 
+	class PatriciaTreeNodeCache;
+	class RocksTuning;
+
 	/// Possible patricia tree storage modes.
 	enum class PatriciaTreeStorageMode {
 		/// Patricia tree storage should be disabled.
@@ -65,5 +69,11 @@ namespace catapult { namespace cache {
 
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
+
+		/// Optional cache of decoded patricia tree nodes that can be shared by all caches.
+		std::shared_ptr<PatriciaTreeNodeCache> TreeNodeCache;
+
+		/// Optional cache database tuning that can be shared by all caches.
+		std::shared_ptr<const RocksTuning> DatabaseTuning;
 	};
 }}
@@ -39,10 +39,12 @@ namespace catapult { namespace cache {
 								config.CacheDatabaseDirectory,
 								GetAdjustedColumnFamilyNames(config, columnFamilyNames),
 								config.MaxCacheDatabaseWriteBatchSize,
-								pruningMode))
+								pruningMode,
+								config.DatabaseTuning))
 						: std::make_unique<CacheDatabase>())
 				, m_containerMode(GetContainerMode(config))
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
+				, m_pPatriciaTreeNodeCache(config.TreeNodeCache)
 		{}
 
 	protected:
@@ -51,6 +53,11 @@ namespace catapult { namespace cache {
 			return m_hasPatriciaTreeSupport;
 		}
 
+		/// Gets the (optional) patricia tree node cache.
+		const std::shared_ptr<PatriciaTreeNodeCache>& patriciaTreeNodeCache() const {
+			return m_pPatriciaTreeNodeCache;
+		}
+
 		/// Gets the database.
 		CacheDatabase& database() {
 			return *m_pDatabase;
@@ -76,7 +83,7 @@ namespace catapult { namespace cache {
 				const std::vector<std::string>& columnFamilyNames) {
 			auto adjustedColumnFamilyNames = columnFamilyNames;
 			if (config.ShouldStorePatriciaTrees)
-				adjustedColumnFamilyNames.push_back("patricia_tree");
+				adjustedColumnFamilyNames.push_back(Patricia_Tree_Column_Family_Name);
 
 			return adjustedColumnFamilyNames;
 		}
@@ -85,5 +92,6 @@ namespace catapult { namespace cache {
 		std::unique_ptr<CacheDatabase> m_pDatabase;
 		const deltaset::ConditionalContainerMode m_containerMode;
 		const bool m_hasPatriciaTreeSupport;
+		std::shared_ptr<PatriciaTreeNodeCache> m_pPatriciaTreeNodeCache;
 	};
 }}
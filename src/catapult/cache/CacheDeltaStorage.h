@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "CacheStorageInclude.h"
+#include "ChunkedDataHeader.h"
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace catapult {
+	namespace cache { class CatapultCacheDelta; }
+	namespace thread { class IoServiceThreadPool; }
+}
+
+namespace catapult { namespace cache {
+
+	/// A stream of consecutive serialized cache deltas.
+	struct SerializedCacheDeltas {
+		/// Input stream containing the serialized deltas.
+		io::InputStream& Input;
+
+		/// Number of deltas in the input stream.
+		size_t NumDeltas;
+	};
+
+	/// Interface for saving cache deltas and merging them into saved cache data.
+	/// \note Serialized deltas contain full (not differential) values, so merging a delta more than once is idempotent.
+	class CacheDeltaStorage {
+	public:
+		virtual ~CacheDeltaStorage() {}
+
+	public:
+		/// Gets the cache name.
+		virtual const std::string& name() const = 0;
+
+	public:
+		/// Saves all (uncommitted) changes of the corresponding sub cache in \a cacheDelta to \a output.
+		virtual void saveDelta(const CatapultCacheDelta& cacheDelta, io::OutputStream& output) const = 0;
+
+		/// Saves cache data from \a input merged with all \a deltas to \a output and returns the header describing the saved values.
+		/// \note Unlike CacheStorage::saveAll, the header is not written to \a output because it is only known after all values are saved.
+		virtual ChunkedDataHeader mergeAll(
+				io::InputStream& input,
+				const std::vector<SerializedCacheDeltas>& deltas,
+				io::OutputStream& output) const = 0;
+
+		/// Loads cache data from \a input merged with all \a deltas using \a pool to decode the cache data chunks.
+		/// \note All loaded values are committed at once.
+		virtual void loadAllParallel(
+				io::InputStream& input,
+				const std::vector<SerializedCacheDeltas>& deltas,
+				thread::IoServiceThreadPool& pool) = 0;
+	};
+}}
@@ -0,0 +1,248 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "CacheDeltaStorage.h"
+#include "CatapultCacheDelta.h"
+#include "ChunkedDataHeader.h"
+#include "ChunkedDataLoader.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/Stream.h"
+#include "catapult/utils/traits/Traits.h"
+#include "catapult/exceptions.h"
+#include <map>
+
+namespace catapult { namespace cache {
+
+	namespace detail {
+		/// Determines whether or not deltas of type \a T expose added, modified and removed elements.
+		template<typename T, typename = void>
+		struct SupportsDeltaElements : std::false_type {};
+
+		template<typename T>
+		struct SupportsDeltaElements<
+				T,
+				typename utils::traits::enable_if_type<decltype(std::declval<const T&>().addedElements())>::type>
+				: std::true_type {};
+
+		/// Determines whether or not deltas of type \a T are pruned during commit.
+		template<typename T, typename = void>
+		struct SupportsPruningBoundary : std::false_type {};
+
+		template<typename T>
+		struct SupportsPruningBoundary<
+				T,
+				typename utils::traits::enable_if_type<decltype(std::declval<const T&>().pruningBoundary())>::type>
+				: std::true_type {};
+
+		/// Accumulates the net changes of consecutive serialized cache deltas.
+		template<typename TStorageTraits, typename TPruningFlag>
+		class CacheDeltaAccumulator {
+		private:
+			using KeyType = typename TStorageTraits::KeyType;
+			using ValueType = typename TStorageTraits::ValueType;
+
+		public:
+			/// Reads \a numDeltas deltas from \a input and accumulates their changes.
+			void read(io::InputStream& input, size_t numDeltas) {
+				for (auto i = 0u; i < numDeltas; ++i)
+					readDelta(input);
+			}
+
+			/// Returns \c true if the saved \a value is superseded (modified, removed or pruned) by the accumulated changes.
+			bool isSuperseded(const ValueType& value) const {
+				auto key = TStorageTraits::ToKey(value);
+				return m_values.cend() != m_values.find(key) || isPruned(key, TPruningFlag());
+			}
+
+			/// Calls \a consumer with all values that have been added or modified by the accumulated changes.
+			template<typename TConsumer>
+			void forEachValue(TConsumer consumer) const {
+				for (const auto& pair : m_values) {
+					if (pair.second)
+						consumer(*pair.second);
+				}
+			}
+
+		private:
+			void readDelta(io::InputStream& input) {
+				auto numSavedValues = io::Read64(input);
+				for (uint64_t i = 0; i < numSavedValues; ++i) {
+					auto pValue = std::make_unique<ValueType>(TStorageTraits::Load(input));
+					auto key = TStorageTraits::ToKey(*pValue);
+					m_values[key] = std::move(pValue);
+				}
+
+				// removed values are represented by empty pointers
+				auto numRemovedValues = io::Read64(input);
+				for (uint64_t i = 0; i < numRemovedValues; ++i) {
+					auto value = TStorageTraits::Load(input);
+					m_values[TStorageTraits::ToKey(value)].reset();
+				}
+
+				if (io::Read8(input))
+					prune(TStorageTraits::Load(input), TPruningFlag());
+			}
+
+			void prune(const ValueType& pruningBoundary, std::true_type) {
+				// all values preceding the pruning boundary are removed, irrespective of their previous state
+				auto key = TStorageTraits::ToKey(pruningBoundary);
+				m_values.erase(m_values.begin(), m_values.lower_bound(key));
+
+				if (!m_pPruningKey || *m_pPruningKey < key)
+					m_pPruningKey = std::make_unique<KeyType>(key);
+			}
+
+			void prune(const ValueType&, std::false_type) {
+				CATAPULT_THROW_RUNTIME_ERROR("cache delta contains pruning boundary but cache does not support pruning");
+			}
+
+			bool isPruned(const KeyType& key, std::true_type) const {
+				return m_pPruningKey && key < *m_pPruningKey;
+			}
+
+			bool isPruned(const KeyType&, std::false_type) const {
+				return false;
+			}
+
+		private:
+			std::map<KeyType, std::unique_ptr<ValueType>> m_values;
+			std::unique_ptr<KeyType> m_pPruningKey;
+		};
+	}
+
+	/// A CacheDeltaStorage implementation that wraps a cache and associated storage traits.
+	/// \note Each serialized delta is composed of all added and modified values, all removed values and an optional pruning boundary.
+	template<typename TCache, typename TStorageTraits>
+	class CacheDeltaStorageAdapter : public CacheDeltaStorage {
+	private:
+		using CacheDeltaType = typename TCache::CacheDeltaType;
+		using PruningFlag = typename detail::SupportsPruningBoundary<CacheDeltaType>::type;
+		using Accumulator = detail::CacheDeltaAccumulator<TStorageTraits, PruningFlag>;
+
+	public:
+		/// Creates an adapter around \a cache that merges at most \a numEntriesPerChunk entries into each chunk.
+		explicit CacheDeltaStorageAdapter(TCache& cache, size_t numEntriesPerChunk = Default_Num_Entries_Per_Chunk)
+				: m_cache(cache)
+				, m_name(TCache::Name)
+				, m_numEntriesPerChunk(numEntriesPerChunk)
+		{}
+
+	public:
+		const std::string& name() const override {
+			return m_name;
+		}
+
+	public:
+		void saveDelta(const CatapultCacheDelta& cacheDelta, io::OutputStream& output) const override {
+			const auto& delta = cacheDelta.sub<TCache>();
+			auto addedElements = delta.addedElements();
+			auto modifiedElements = delta.modifiedElements();
+			auto removedElements = delta.removedElements();
+
+			io::Write64(output, addedElements.size() + modifiedElements.size());
+			SaveAll(addedElements, output);
+			SaveAll(modifiedElements, output);
+
+			io::Write64(output, removedElements.size());
+			SaveAll(removedElements, output);
+
+			SavePruningBoundary(delta, output, PruningFlag());
+			output.flush();
+		}
+
+		ChunkedDataHeader mergeAll(
+				io::InputStream& input,
+				const std::vector<SerializedCacheDeltas>& deltas,
+				io::OutputStream& output) const override {
+			ChunkedDataWriter writer(output, m_numEntriesPerChunk);
+			ForEachMergedValue(input, deltas, [&writer](const auto& value) {
+				writer.add([&value](auto& chunkOutput) { TStorageTraits::Save(value, chunkOutput); });
+			});
+
+			writer.flush();
+			output.flush();
+			return writer.header();
+		}
+
+		void loadAllParallel(
+				io::InputStream& input,
+				const std::vector<SerializedCacheDeltas>& deltas,
+				thread::IoServiceThreadPool& pool) override {
+			auto accumulator = Accumulate(deltas);
+			auto delta = m_cache.createDelta();
+
+			// 1. load all saved values that have not been changed by any delta
+			ParallelChunkedDataLoader<TStorageTraits> loader(input, pool);
+			loader.loadAll(*delta, [&accumulator](const auto& value) { return !accumulator.isSuperseded(value); });
+
+			// 2. load all values that have been added or modified by deltas
+			accumulator.forEachValue([&delta](const auto& value) { TStorageTraits::LoadInto(value, *delta); });
+			m_cache.commit();
+		}
+
+	private:
+		template<typename TElements>
+		static void SaveAll(const TElements& elements, io::OutputStream& output) {
+			for (const auto* pElement : elements)
+				TStorageTraits::Save(*pElement, output);
+		}
+
+		static void SavePruningBoundary(const CacheDeltaType& delta, io::OutputStream& output, std::true_type) {
+			auto pruningBoundary = delta.pruningBoundary();
+			io::Write8(output, pruningBoundary.isSet() ? 1 : 0);
+			if (pruningBoundary.isSet())
+				TStorageTraits::Save(pruningBoundary.value(), output);
+		}
+
+		static void SavePruningBoundary(const CacheDeltaType&, io::OutputStream& output, std::false_type) {
+			io::Write8(output, 0);
+		}
+
+		static Accumulator Accumulate(const std::vector<SerializedCacheDeltas>& deltas) {
+			Accumulator accumulator;
+			for (const auto& serializedDeltas : deltas)
+				accumulator.read(serializedDeltas.Input, serializedDeltas.NumDeltas);
+
+			return accumulator;
+		}
+
+		template<typename TConsumer>
+		static void ForEachMergedValue(io::InputStream& input, const std::vector<SerializedCacheDeltas>& deltas, TConsumer consumer) {
+			auto accumulator = Accumulate(deltas);
+
+			// 1. forward all saved values that have not been changed by any delta
+			ChunkedDataReader reader(input);
+			while (0 != reader.numRemainingEntries()) {
+				auto value = TStorageTraits::Load(reader.next());
+				if (!accumulator.isSuperseded(value))
+					consumer(value);
+			}
+
+			// 2. forward all values that have been added or modified by deltas
+			accumulator.forEachValue(consumer);
+		}
+
+	private:
+		TCache& m_cache;
+		std::string m_name;
+		size_t m_numEntriesPerChunk;
+	};
+}}
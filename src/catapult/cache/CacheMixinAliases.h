@@ -41,6 +41,7 @@ namespace catapult { namespace cache {
 		template<typename TValueAdapter>
 		using MutableAccessorWithAdapter = MutableAccessorMixin<TSet, TCacheDescriptor, TValueAdapter>;
 
+		using Prefetch = PrefetchMixin<TSet, TCacheDescriptor>;
 		using ActivePredicate = ActivePredicateMixin<TSet, TCacheDescriptor>;
 		using BasicInsertRemove = BasicInsertRemoveMixin<TSet, TCacheDescriptor>;
 
@@ -244,6 +244,27 @@ namespace catapult { namespace cache {
 		TSet& m_set;
 	};
 
+	/// A mixin for adding prefetch support to a cache delta.
+	template<typename TSet, typename TCacheDescriptor>
+	class PrefetchMixin {
+	private:
+		using KeyType = typename TCacheDescriptor::KeyType;
+
+	public:
+		/// Creates a mixin around \a set.
+		explicit PrefetchMixin(TSet& set) : m_set(set)
+		{}
+
+	public:
+		/// Prefetches all cache values identified by \a keys so that subsequent lookups are served from memory.
+		void prefetch(const std::vector<KeyType>& keys) {
+			m_set.prefetch(keys);
+		}
+
+	private:
+		TSet& m_set;
+	};
+
 	/// A mixin for adding active querying support to a cache.
 	template<typename TSet, typename TCacheDescriptor>
 	class ActivePredicateMixin {
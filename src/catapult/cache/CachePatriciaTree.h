@@ -30,8 +30,13 @@ namespace catapult { namespace cache {
 	class CachePatriciaTree {
 	public:
 		/// Creates a tree around \a database and \a columnId if \a enable is \c true.
-		CachePatriciaTree(bool enable, CacheDatabase& database, size_t columnId)
-				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId) : nullptr)
+		/// Nodes read from \a database are cached in \a pNodeCache when it is not \c nullptr.
+		CachePatriciaTree(
+				bool enable,
+				CacheDatabase& database,
+				size_t columnId,
+				const std::shared_ptr<PatriciaTreeNodeCache>& pNodeCache = nullptr)
+				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId, pNodeCache) : nullptr)
 		{}
 
 	public:
@@ -61,9 +66,9 @@ namespace catapult { namespace cache {
 	private:
 		class Impl {
 		public:
-			Impl(CacheDatabase& database, size_t columnId)
+			Impl(CacheDatabase& database, size_t columnId, const std::shared_ptr<PatriciaTreeNodeCache>& pNodeCache)
 					: m_container(database, columnId)
-					, m_dataSource(m_container)
+					, m_dataSource(m_container, pNodeCache)
 					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
 				Hash256 rootHash;
 				if (!m_container.prop("root", rootHash))
@@ -22,6 +22,8 @@
 #include "CacheStorageInclude.h"
 #include <string>
 
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
+
 namespace catapult { namespace cache {
 
 	/// Interface for loading and saving cache data.
@@ -39,5 +41,8 @@ namespace catapult { namespace cache {
 
 		/// Loads cache data from \a input in batches of \a batchSize.
 		virtual void loadAll(io::InputStream& input, size_t batchSize) = 0;
+
+		/// Loads cache data from \a input using \a pool and commits it once.
+		virtual void loadAllParallel(io::InputStream& input, thread::IoServiceThreadPool& pool) = 0;
 	};
 }}
@@ -21,6 +21,7 @@
 #pragma once
 #include "CacheStorage.h"
 #include "ChunkedDataLoader.h"
+#include "catapult/exceptions.h"
 
 namespace catapult { namespace cache {
 
@@ -28,10 +29,11 @@ namespace catapult { namespace cache {
 	template<typename TCache, typename TStorageTraits>
 	class CacheStorageAdapter : public CacheStorage {
 	public:
-		/// Creates an adapter around \a cache.
-		explicit CacheStorageAdapter(TCache& cache)
+		/// Creates an adapter around \a cache that saves at most \a numEntriesPerChunk entries in each chunk.
+		explicit CacheStorageAdapter(TCache& cache, size_t numEntriesPerChunk = Default_Num_Entries_Per_Chunk)
 				: m_cache(cache)
 				, m_name(TCache::Name)
+				, m_numEntriesPerChunk(numEntriesPerChunk)
 		{}
 
 	public:
@@ -42,11 +44,20 @@ namespace catapult { namespace cache {
 	public:
 		void saveAll(io::OutputStream& output) const override {
 			auto view = m_cache.createView();
-			io::Write64(output, view->size());
-
 			auto pIterableView = view->tryMakeIterableView();
+
+			// the number of chunks is known up front, so each entry only needs to be serialized once
+			auto numEntries = view->size();
+			WriteChunkedDataHeader(output, CreateChunkedDataHeader(numEntries, m_numEntriesPerChunk));
+
+			ChunkedDataWriter writer(output, m_numEntriesPerChunk);
 			for (const auto& element : *pIterableView)
-				SaveValue(element, output);
+				writer.add([&element](auto& chunkOutput) { SaveValue(element, chunkOutput); });
+
+			writer.flush();
+			auto numSavedEntries = writer.header().NumEntries;
+			if (numEntries != numSavedEntries)
+				CATAPULT_THROW_RUNTIME_ERROR_2("cache view size does not match number of saved entries", numEntries, numSavedEntries);
 
 			output.flush();
 		}
@@ -61,6 +72,14 @@ namespace catapult { namespace cache {
 			}
 		}
 
+		void loadAllParallel(io::InputStream& input, thread::IoServiceThreadPool& pool) override {
+			auto delta = m_cache.createDelta();
+
+			ParallelChunkedDataLoader<TStorageTraits> loader(input, pool);
+			loader.loadAll(*delta);
+			m_cache.commit();
+		}
+
 	private:
 		// assume pair indicates maps and only forward value to save
 
@@ -77,5 +96,6 @@ namespace catapult { namespace cache {
 	private:
 		TCache& m_cache;
 		std::string m_name;
+		size_t m_numEntriesPerChunk;
 	};
 }}
@@ -44,5 +44,10 @@ namespace catapult { namespace cache {
 
 		/// Cache value type.
 		using ValueType = typename TDescriptor::ValueType;
+
+		/// Gets the key corresponding to \a value.
+		static KeyType ToKey(const ValueType& value) {
+			return TDescriptor::GetKeyFromValue(value);
+		}
 	};
 }}
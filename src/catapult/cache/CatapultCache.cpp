@@ -22,11 +22,15 @@
 #include "CacheHeight.h"
 #include "CatapultCacheDetachedDelta.h"
 #include "ReadOnlyCatapultCache.h"
+#include "SubCacheMerkleRootTimings.h"
 #include "SubCachePluginAdapter.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkInfo.h"
+#include "catapult/thread/BlockingParallelFor.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/utils/StackLogger.h"
+#include "catapult/utils/StackTimer.h"
 
 namespace catapult { namespace cache {
 
@@ -46,15 +50,14 @@ namespace catapult { namespace cache {
 			return readOnlyViews;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		std::vector<Hash256> CollectSubCacheMerkleRoots(TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		template<typename TSubCacheViews>
+		std::vector<Hash256> CollectSubCacheMerkleRoots(const TSubCacheViews& subViews) {
 			std::vector<Hash256> merkleRoots;
 			for (const auto& pSubView : subViews) {
 				Hash256 merkleRoot;
 				if (!pSubView)
 					continue;
 
-				updateMerkleRoot(*pSubView);
 				if (pSubView->tryGetMerkleRoot(merkleRoot))
 					merkleRoots.push_back(merkleRoot);
 			}
@@ -62,6 +65,38 @@ namespace catapult { namespace cache {
 			return merkleRoots;
 		}
 
+		std::vector<Hash256> UpdateAndCollectSubCacheMerkleRoots(
+				const std::vector<std::unique_ptr<SubCacheView>>& subViews,
+				Height height,
+				SubCacheMerkleRootTimings* pMerkleRootTimings,
+				const std::weak_ptr<thread::IoServiceThreadPool>& pMerkleRootUpdatePool) {
+			std::vector<size_t> merkleSubViewIds;
+			for (auto id = 0u; id < subViews.size(); ++id) {
+				if (subViews[id] && subViews[id]->supportsMerkleRoot())
+					merkleSubViewIds.push_back(id);
+			}
+
+			// each subcache owns an independent patricia tree, so all trees can be updated concurrently
+			auto pPool = pMerkleRootUpdatePool.lock();
+			auto updateMerkleRoot = [&subViews, &merkleSubViewIds, height, pMerkleRootTimings, &pPool](auto index) {
+				auto id = merkleSubViewIds[index];
+				utils::StackTimer timer;
+				subViews[id]->updateMerkleRoot(height, pPool.get());
+				if (pMerkleRootTimings)
+					pMerkleRootTimings->setElapsedMicros(id, timer.micros());
+			};
+
+			if (pPool) {
+				thread::BlockingParallelFor(pPool->service(), pPool->numWorkerThreads(), merkleSubViewIds.size(), updateMerkleRoot);
+			} else {
+				for (auto i = 0u; i < merkleSubViewIds.size(); ++i)
+					updateMerkleRoot(i);
+			}
+
+			// merkle roots are collected in subcache id order, independent of update completion order
+			return CollectSubCacheMerkleRoots(subViews);
+		}
+
 		Hash256 CalculateStateHash(const std::vector<Hash256>& subCacheMerkleRoots) {
 			Hash256 stateHash;
 			if (subCacheMerkleRoots.empty()) {
@@ -77,12 +112,12 @@ namespace catapult { namespace cache {
 			return stateHash;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		template<typename TCollectSubCacheMerkleRoots>
+		StateHashInfo CalculateStateHashInfo(TCollectSubCacheMerkleRoots collectSubCacheMerkleRoots) {
 			utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::Warning);
 
 			StateHashInfo stateHashInfo;
-			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews, updateMerkleRoot);
+			stateHashInfo.SubCacheMerkleRoots = collectSubCacheMerkleRoots();
 			stateHashInfo.StateHash = CalculateStateHash(stateHashInfo.SubCacheMerkleRoots);
 			return stateHashInfo;
 		}
@@ -102,7 +137,7 @@ namespace catapult { namespace cache {
 	CatapultCacheView& CatapultCacheView::operator=(CatapultCacheView&&) = default;
 
 	StateHashInfo CatapultCacheView::calculateStateHash() const {
-		return CalculateStateHashInfo(m_subViews, [](const auto&) {});
+		return CalculateStateHashInfo([&subViews = m_subViews]() { return CollectSubCacheMerkleRoots(subViews); });
 	}
 
 	Height CatapultCacheView::height() const {
@@ -118,7 +153,16 @@ namespace catapult { namespace cache {
 	// region CatapultCacheDelta
 
 	CatapultCacheDelta::CatapultCacheDelta(std::vector<std::unique_ptr<SubCacheView>>&& subViews)
+			: CatapultCacheDelta(std::move(subViews), nullptr, std::weak_ptr<thread::IoServiceThreadPool>())
+	{}
+
+	CatapultCacheDelta::CatapultCacheDelta(
+			std::vector<std::unique_ptr<SubCacheView>>&& subViews,
+			SubCacheMerkleRootTimings* pMerkleRootTimings,
+			const std::weak_ptr<thread::IoServiceThreadPool>& pMerkleRootUpdatePool)
 			: m_subViews(std::move(subViews))
+			, m_pMerkleRootTimings(pMerkleRootTimings)
+			, m_pMerkleRootUpdatePool(pMerkleRootUpdatePool)
 	{}
 
 	CatapultCacheDelta::~CatapultCacheDelta() = default;
@@ -128,7 +172,9 @@ namespace catapult { namespace cache {
 	CatapultCacheDelta& CatapultCacheDelta::operator=(CatapultCacheDelta&&) = default;
 
 	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height) const {
-		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
+		return CalculateStateHashInfo([this, height]() {
+			return UpdateAndCollectSubCacheMerkleRoots(m_subViews, height, m_pMerkleRootTimings, m_pMerkleRootUpdatePool);
+		});
 	}
 
 	void CatapultCacheDelta::setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots) {
@@ -230,11 +276,20 @@ namespace catapult { namespace cache {
 
 			return resultViews;
 		}
+
+		std::vector<std::string> GetMerkleSubCacheNames(const std::vector<std::unique_ptr<SubCachePlugin>>& subCaches) {
+			std::vector<std::string> names;
+			for (const auto& pSubCache : subCaches)
+				names.push_back(pSubCache && pSubCache->createView()->supportsMerkleRoot() ? pSubCache->name() : std::string());
+
+			return names;
+		}
 	}
 
 	CatapultCache::CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches)
 			: m_pCacheHeight(std::make_unique<CacheHeight>())
 			, m_subCaches(std::move(subCaches))
+			, m_pMerkleRootTimings(std::make_unique<SubCacheMerkleRootTimings>(GetMerkleSubCacheNames(m_subCaches)))
 	{}
 
 	CatapultCache::~CatapultCache() = default;
@@ -254,7 +309,7 @@ namespace catapult { namespace cache {
 		// since only one subcache delta is allowed outstanding at a time and an outstanding delta is required for commit,
 		// subcache deltas will always be consistent
 		auto subViews = MapSubCaches<SubCacheView>(m_subCaches, [](const auto& pSubCache) { return pSubCache->createDelta(); });
-		return CatapultCacheDelta(std::move(subViews));
+		return CatapultCacheDelta(std::move(subViews), m_pMerkleRootTimings.get(), m_pMerkleRootUpdatePool);
 	}
 
 	CatapultCacheDetachableDelta CatapultCache::createDetachableDelta() const {
@@ -293,5 +348,27 @@ namespace catapult { namespace cache {
 				false);
 	}
 
+	std::vector<std::unique_ptr<const CacheDeltaStorage>> CatapultCache::deltaStorages() const {
+		return MapSubCaches<const CacheDeltaStorage>(
+				m_subCaches,
+				[](const auto& pSubCache) { return pSubCache->createDeltaStorage(); },
+				false);
+	}
+
+	std::vector<std::unique_ptr<CacheDeltaStorage>> CatapultCache::deltaStorages() {
+		return MapSubCaches<CacheDeltaStorage>(
+				m_subCaches,
+				[](const auto& pSubCache) { return pSubCache->createDeltaStorage(); },
+				false);
+	}
+
+	const SubCacheMerkleRootTimings& CatapultCache::merkleRootTimings() const {
+		return *m_pMerkleRootTimings;
+	}
+
+	void CatapultCache::setMerkleRootUpdatePool(const std::weak_ptr<thread::IoServiceThreadPool>& pMerkleRootUpdatePool) {
+		m_pMerkleRootUpdatePool = pMerkleRootUpdatePool;
+	}
+
 	// endregion
 }}
@@ -26,11 +26,14 @@
 
 namespace catapult {
 	namespace cache {
+		class CacheDeltaStorage;
 		class CacheHeight;
 		class CacheStorage;
+		class SubCacheMerkleRootTimings;
 		class SubCachePlugin;
 	}
 	namespace model { struct BlockChainConfiguration; }
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -78,8 +81,23 @@ namespace catapult { namespace cache {
 		/// Gets cache storages for all subcaches.
 		std::vector<std::unique_ptr<CacheStorage>> storages();
 
+		/// Gets cache delta storages for all subcaches that support saving cache deltas.
+		std::vector<std::unique_ptr<const CacheDeltaStorage>> deltaStorages() const;
+
+		/// Gets cache delta storages for all subcaches that support saving cache deltas.
+		std::vector<std::unique_ptr<CacheDeltaStorage>> deltaStorages();
+
+		/// Gets the merkle root update times of all subcaches recorded by deltas created via createDelta.
+		const SubCacheMerkleRootTimings& merkleRootTimings() const;
+
+		/// Sets the pool (\a pMerkleRootUpdatePool) used by deltas created via createDelta to update subcache merkle roots.
+		/// \note The pool is not owned by the cache; merkle roots are updated on the calling thread when it is unavailable.
+		void setMerkleRootUpdatePool(const std::weak_ptr<thread::IoServiceThreadPool>& pMerkleRootUpdatePool);
+
 	private:
 		std::unique_ptr<CacheHeight> m_pCacheHeight; // use a unique_ptr to allow fwd declare
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		std::unique_ptr<SubCacheMerkleRootTimings> m_pMerkleRootTimings; // use a unique_ptr to keep address stable across moves
+		std::weak_ptr<thread::IoServiceThreadPool> m_pMerkleRootUpdatePool;
 	};
 }}
@@ -23,7 +23,13 @@
 #include "SubCachePlugin.h"
 #include <memory>
 
-namespace catapult { namespace cache { class ReadOnlyCatapultCache; } }
+namespace catapult {
+	namespace cache {
+		class ReadOnlyCatapultCache;
+		class SubCacheMerkleRootTimings;
+	}
+	namespace thread { class IoServiceThreadPool; }
+}
 
 namespace catapult { namespace cache {
 
@@ -33,6 +39,13 @@ namespace catapult { namespace cache {
 		/// Creates a locked catapult cache delta from \a subViews.
 		explicit CatapultCacheDelta(std::vector<std::unique_ptr<SubCacheView>>&& subViews);
 
+		/// Creates a locked catapult cache delta from \a subViews that records merkle root update times in \a pMerkleRootTimings
+		/// and updates merkle roots in parallel on \a pMerkleRootUpdatePool when it is available.
+		CatapultCacheDelta(
+				std::vector<std::unique_ptr<SubCacheView>>&& subViews,
+				SubCacheMerkleRootTimings* pMerkleRootTimings,
+				const std::weak_ptr<thread::IoServiceThreadPool>& pMerkleRootUpdatePool);
+
 		/// Destroys the delta.
 		~CatapultCacheDelta();
 
@@ -54,8 +67,17 @@ namespace catapult { namespace cache {
 			return *static_cast<typename TCache::CacheDeltaType*>(m_subViews[TCache::Id]->get());
 		}
 
+	public:
+		/// Prefetches all values identified by \a keys from the subcache \a TCache.
+		/// \note Subsequent lookups of prefetched values are served from memory instead of from (database) storage.
+		template<typename TCache, typename TKey>
+		void prefetch(const std::vector<TKey>& keys) {
+			sub<TCache>().prefetch(keys);
+		}
+
 	public:
 		/// Calculates the cache state hash given \a height.
+		/// \note Subcache merkle roots are updated in parallel when a merkle root update pool is available.
 		StateHashInfo calculateStateHash(Height height) const;
 
 		/// Sets the merkle roots for all subcaches (\a subCacheMerkleRoots).
@@ -67,5 +89,7 @@ namespace catapult { namespace cache {
 
 	private:
 		std::vector<std::unique_ptr<SubCacheView>> m_subViews;
+		SubCacheMerkleRootTimings* m_pMerkleRootTimings;
+		std::weak_ptr<thread::IoServiceThreadPool> m_pMerkleRootUpdatePool;
 	};
 }}
@@ -0,0 +1,149 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "ChunkedDataHeader.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace cache {
+
+	ChunkedDataHeader CreateChunkedDataHeader(uint64_t numEntries, size_t numEntriesPerChunk) {
+		ChunkedDataHeader header;
+		header.NumEntries = numEntries;
+		header.NumChunks = (numEntries + numEntriesPerChunk - 1) / numEntriesPerChunk;
+		return header;
+	}
+
+	void WriteChunkedDataHeader(io::OutputStream& output, const ChunkedDataHeader& header) {
+		io::Write64(output, Chunk_Index_Marker);
+		io::Write64(output, header.NumEntries);
+		io::Write64(output, header.NumChunks);
+	}
+
+	ChunkedDataHeader ReadChunkedDataHeader(io::InputStream& input) {
+		ChunkedDataHeader header;
+		header.NumEntries = io::Read64(input);
+		if (Chunk_Index_Marker != header.NumEntries)
+			return header;
+
+		header.NumEntries = io::Read64(input);
+		header.NumChunks = io::Read64(input);
+		if (header.NumChunks > header.NumEntries)
+			CATAPULT_THROW_RUNTIME_ERROR_2("header contains more chunks than entries", header.NumChunks, header.NumEntries);
+
+		if (0 == header.NumChunks && 0 != header.NumEntries)
+			CATAPULT_THROW_RUNTIME_ERROR_1("header contains entries but no chunks", header.NumEntries);
+
+		return header;
+	}
+
+	ChunkInfo ReadChunkInfo(io::InputStream& input, uint64_t numRemainingEntries) {
+		ChunkInfo chunk;
+		chunk.NumEntries = io::Read64(input);
+		chunk.Size = io::Read64(input);
+		if (0 == chunk.NumEntries || chunk.NumEntries > numRemainingEntries)
+			CATAPULT_THROW_RUNTIME_ERROR_2("chunk contains invalid number of entries", chunk.NumEntries, numRemainingEntries);
+
+		// every serialized entry is composed of at least one byte
+		if (chunk.Size < chunk.NumEntries)
+			CATAPULT_THROW_RUNTIME_ERROR_2("chunk is too small for its entries", chunk.Size, chunk.NumEntries);
+
+		return chunk;
+	}
+
+	std::vector<uint8_t> ReadChunkData(io::InputStream& input, const ChunkInfo& chunk) {
+		// read in bounded steps so that a corrupt chunk size fails when the input is exhausted instead of on allocation
+		std::vector<uint8_t> buffer;
+		while (buffer.size() != chunk.Size) {
+			auto offset = buffer.size();
+			buffer.resize(offset + std::min<uint64_t>(Max_Chunk_Read_Size, chunk.Size - offset));
+			input.read({ buffer.data() + offset, buffer.size() - offset });
+		}
+
+		return buffer;
+	}
+
+	// region ChunkedDataWriter
+
+	ChunkedDataWriter::ChunkedDataWriter(io::OutputStream& output, size_t numEntriesPerChunk)
+			: m_output(output)
+			, m_numEntriesPerChunk(numEntriesPerChunk)
+			, m_numChunkEntries(0)
+	{}
+
+	const ChunkedDataHeader& ChunkedDataWriter::header() const {
+		return m_header;
+	}
+
+	void ChunkedDataWriter::flush() {
+		if (0 != m_numChunkEntries)
+			writeChunk();
+	}
+
+	void ChunkedDataWriter::writeChunk() {
+		auto& buffer = m_chunkOutput.buffer();
+		io::Write64(m_output, m_numChunkEntries);
+		io::Write64(m_output, buffer.size());
+		m_output.write(buffer);
+
+		buffer.clear();
+		m_numChunkEntries = 0;
+		++m_header.NumChunks;
+	}
+
+	// endregion
+
+	// region ChunkedDataReader
+
+	ChunkedDataReader::ChunkedDataReader(io::InputStream& input)
+			: m_input(input)
+			, m_header(ReadChunkedDataHeader(input))
+			, m_numRemainingEntries(m_header.NumEntries)
+			, m_numRemainingChunkEntries(0)
+			, m_numChunks(0)
+	{}
+
+	uint64_t ChunkedDataReader::numRemainingEntries() const {
+		return m_numRemainingEntries;
+	}
+
+	io::InputStream& ChunkedDataReader::next() {
+		if (0 == m_numRemainingEntries)
+			CATAPULT_THROW_RUNTIME_ERROR("cannot read entry past end of chunked data");
+
+		// chunks are stored contiguously, so only the chunk infos need to be skipped when reading sequentially
+		if (0 != m_header.NumChunks && 0 == m_numRemainingChunkEntries) {
+			if (++m_numChunks > m_header.NumChunks)
+				CATAPULT_THROW_RUNTIME_ERROR_1("chunked data contains more chunks than expected", m_header.NumChunks);
+
+			m_numRemainingChunkEntries = ReadChunkInfo(m_input, m_numRemainingEntries).NumEntries;
+		}
+
+		if (0 != m_numRemainingChunkEntries)
+			--m_numRemainingChunkEntries;
+
+		--m_numRemainingEntries;
+		return m_input;
+	}
+
+	// endregion
+}}
@@ -0,0 +1,151 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "catapult/io/Stream.h"
+#include <limits>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Default number of entries saved in each independently loadable chunk.
+	constexpr size_t Default_Num_Entries_Per_Chunk = 10'000;
+
+	/// Marker written in place of the number of entries when serialized entries are grouped into chunks.
+	constexpr uint64_t Chunk_Index_Marker = std::numeric_limits<uint64_t>::max();
+
+	/// Maximum number of chunk bytes that are read at once.
+	/// \note Chunk sizes are untrusted, so chunk buffers are only grown as data is actually read.
+	constexpr uint64_t Max_Chunk_Read_Size = 1024 * 1024;
+
+	/// Header preceding serialized cache entries.
+	/// \note When entries are grouped into chunks, each chunk is preceded by its chunk info.
+	struct ChunkedDataHeader {
+		/// Total number of entries.
+		uint64_t NumEntries = 0;
+
+		/// Total number of chunks.
+		/// \note This is zero when the entries were not saved in chunks.
+		uint64_t NumChunks = 0;
+	};
+
+	/// Information about a chunk of serialized entries that can be decoded independently of all other chunks.
+	struct ChunkInfo {
+		/// Number of entries in the chunk.
+		uint64_t NumEntries;
+
+		/// Size of the chunk in bytes.
+		uint64_t Size;
+	};
+
+	/// Creates a header for \a numEntries entries grouped into chunks of at most \a numEntriesPerChunk entries.
+	ChunkedDataHeader CreateChunkedDataHeader(uint64_t numEntries, size_t numEntriesPerChunk);
+
+	/// Writes \a header to \a output.
+	void WriteChunkedDataHeader(io::OutputStream& output, const ChunkedDataHeader& header);
+
+	/// Reads a header from \a input.
+	/// \note Headers of entries not saved in chunks (only containing the number of entries) are also supported.
+	ChunkedDataHeader ReadChunkedDataHeader(io::InputStream& input);
+
+	/// Reads a chunk info from \a input given \a numRemainingEntries entries have not yet been read.
+	ChunkInfo ReadChunkInfo(io::InputStream& input, uint64_t numRemainingEntries);
+
+	/// Reads the data of \a chunk from \a input.
+	std::vector<uint8_t> ReadChunkData(io::InputStream& input, const ChunkInfo& chunk);
+
+	/// Writes serialized entries grouped into chunks to an output stream.
+	/// \note Each entry is serialized exactly once into an in-memory chunk buffer that is written when the chunk is complete.
+	class ChunkedDataWriter {
+	private:
+		class ChunkOutputStream : public io::OutputStream {
+		public:
+			std::vector<uint8_t>& buffer() {
+				return m_buffer;
+			}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
+			}
+
+			void flush() override
+			{}
+
+		private:
+			std::vector<uint8_t> m_buffer;
+		};
+
+	public:
+		/// Creates a writer around \a output that groups at most \a numEntriesPerChunk entries into each chunk.
+		ChunkedDataWriter(io::OutputStream& output, size_t numEntriesPerChunk);
+
+	public:
+		/// Gets the header describing all entries added so far.
+		const ChunkedDataHeader& header() const;
+
+	public:
+		/// Adds an entry that is serialized by \a save.
+		template<typename TSave>
+		void add(TSave save) {
+			save(static_cast<io::OutputStream&>(m_chunkOutput));
+			++m_numChunkEntries;
+			++m_header.NumEntries;
+
+			if (m_numEntriesPerChunk == m_numChunkEntries)
+				writeChunk();
+		}
+
+		/// Writes the last (partial) chunk.
+		void flush();
+
+	private:
+		void writeChunk();
+
+	private:
+		io::OutputStream& m_output;
+		size_t m_numEntriesPerChunk;
+		ChunkOutputStream m_chunkOutput;
+		uint64_t m_numChunkEntries;
+		ChunkedDataHeader m_header;
+	};
+
+	/// Reads serialized entries sequentially, skipping chunk infos.
+	class ChunkedDataReader {
+	public:
+		/// Creates a reader around \a input.
+		explicit ChunkedDataReader(io::InputStream& input);
+
+	public:
+		/// Gets the number of entries that have not yet been read.
+		uint64_t numRemainingEntries() const;
+
+		/// Prepares the next entry for reading and returns the stream from which it should be read.
+		io::InputStream& next();
+
+	private:
+		io::InputStream& m_input;
+		ChunkedDataHeader m_header;
+		uint64_t m_numRemainingEntries;
+		uint64_t m_numRemainingChunkEntries;
+		uint64_t m_numChunks;
+	};
+}}
@@ -19,8 +19,12 @@
 **/
 
 #pragma once
+#include "ChunkedDataHeader.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
+#include "catapult/thread/BlockingParallelFor.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/functions.h"
 
 namespace catapult { namespace cache {
@@ -30,26 +34,139 @@ namespace catapult { namespace cache {
 	class ChunkedDataLoader {
 	public:
 		/// Creates a chunked loader around \a input.
-		explicit ChunkedDataLoader(io::InputStream& input) : m_input(input) {
-			m_numRemainingEntries = io::Read64(input);
-		}
+		explicit ChunkedDataLoader(io::InputStream& input) : m_reader(input)
+		{}
 
 	public:
 		/// Returns \c true if there are more entries in the input.
 		bool hasNext() const {
-			return 0 != m_numRemainingEntries;
+			return 0 != m_reader.numRemainingEntries();
 		}
 
 		/// Loads the next data chunk of at most \a numRequestedEntries into \a destination.
 		void next(uint64_t numRequestedEntries, typename TStorageTraits::DestinationType& destination) {
-			numRequestedEntries = std::min(numRequestedEntries, m_numRemainingEntries);
-			m_numRemainingEntries -= numRequestedEntries;
+			numRequestedEntries = std::min(numRequestedEntries, m_reader.numRemainingEntries());
 			while (numRequestedEntries--)
-				TStorageTraits::LoadInto(TStorageTraits::Load(m_input), destination);
+				TStorageTraits::LoadInto(TStorageTraits::Load(m_reader.next()), destination);
+		}
+
+	private:
+		ChunkedDataReader m_reader;
+	};
+
+	/// Loads all data from an input stream by decoding independent chunks on a thread pool.
+	template<typename TStorageTraits>
+	class ParallelChunkedDataLoader {
+	private:
+		using ValueType = decltype(TStorageTraits::Load(std::declval<io::InputStream&>()));
+		using DecodedChunks = std::vector<std::vector<ValueType>>;
+
+		struct Chunk {
+			uint64_t NumEntries;
+			std::vector<uint8_t> Buffer;
+		};
+
+	public:
+		/// Creates a parallel chunked loader around \a input that decodes chunks on \a pool.
+		ParallelChunkedDataLoader(io::InputStream& input, thread::IoServiceThreadPool& pool)
+				: m_input(input)
+				, m_header(ReadChunkedDataHeader(input))
+				, m_pool(pool)
+		{}
+
+	public:
+		/// Gets the total number of entries in the input.
+		uint64_t numEntries() const {
+			return m_header.NumEntries;
+		}
+
+		/// Loads all entries into \a destination.
+		/// \note Entries are inserted into \a destination by one thread at a time in the order in which they were saved.
+		void loadAll(typename TStorageTraits::DestinationType& destination) {
+			loadAll(destination, [](const auto&) { return true; });
+		}
+
+		/// Loads all entries passing \a predicate into \a destination.
+		/// \note \a predicate is called concurrently by pool threads while chunks are decoded.
+		template<typename TPredicate>
+		void loadAll(typename TStorageTraits::DestinationType& destination, TPredicate predicate) {
+			if (0 == m_header.NumChunks) {
+				// entries saved without chunks can only be decoded sequentially
+				for (uint64_t i = 0; i < m_header.NumEntries; ++i) {
+					auto value = TStorageTraits::Load(m_input);
+					if (predicate(value))
+						TStorageTraits::LoadInto(value, destination);
+				}
+
+				return;
+			}
+
+			// decode (at most) one chunk per pool thread at a time and insert the previously decoded chunks concurrently
+			auto numWorkerThreads = m_pool.numWorkerThreads();
+			auto maxChunksPerRound = std::max<size_t>(1, numWorkerThreads);
+			auto numRemainingEntries = m_header.NumEntries;
+			uint64_t numChunks = 0;
+			DecodedChunks previousDecodedChunks;
+			while (0 != numRemainingEntries || !previousDecodedChunks.empty()) {
+				auto chunks = readChunks(maxChunksPerRound, numRemainingEntries);
+				numChunks += chunks.size();
+				if (numChunks > m_header.NumChunks)
+					CATAPULT_THROW_RUNTIME_ERROR_1("chunked data contains more chunks than expected", m_header.NumChunks);
+
+				DecodedChunks decodedChunks(chunks.size());
+				thread::BlockingParallelFor(m_pool.service(), numWorkerThreads, chunks.size() + 1, [&](auto index) {
+					if (0 == index) {
+						for (const auto& values : previousDecodedChunks) {
+							for (const auto& value : values)
+								TStorageTraits::LoadInto(value, destination);
+						}
+
+						return;
+					}
+
+					auto& chunk = chunks[index - 1];
+					decodedChunks[index - 1] = DecodeChunk(chunk.Buffer, chunk.NumEntries, predicate);
+				});
+
+				previousDecodedChunks = std::move(decodedChunks);
+			}
+
+			if (numChunks != m_header.NumChunks)
+				CATAPULT_THROW_RUNTIME_ERROR_2("chunked data contains unexpected number of chunks", numChunks, m_header.NumChunks);
+		}
+
+	private:
+		std::vector<Chunk> readChunks(size_t maxChunks, uint64_t& numRemainingEntries) {
+			std::vector<Chunk> chunks;
+			while (chunks.size() < maxChunks && 0 != numRemainingEntries) {
+				auto chunkInfo = ReadChunkInfo(m_input, numRemainingEntries);
+				chunks.push_back({ chunkInfo.NumEntries, ReadChunkData(m_input, chunkInfo) });
+				numRemainingEntries -= chunkInfo.NumEntries;
+			}
+
+			return chunks;
+		}
+
+		template<typename TPredicate>
+		static std::vector<ValueType> DecodeChunk(std::vector<uint8_t>& buffer, uint64_t numEntries, TPredicate predicate) {
+			io::BufferInputStreamAdapter<std::vector<uint8_t>> input(buffer);
+			std::vector<ValueType> values;
+			values.reserve(numEntries);
+			for (uint64_t i = 0; i < numEntries; ++i) {
+				auto value = TStorageTraits::Load(input);
+				if (predicate(value))
+					values.push_back(std::move(value));
+			}
+
+			if (input.position() != buffer.size())
+				CATAPULT_THROW_RUNTIME_ERROR_2("chunk contains unexpected data", input.position(), buffer.size());
+
+			return values;
 		}
 
 	private:
 		io::InputStream& m_input;
-		uint64_t m_numRemainingEntries;
+		ChunkedDataHeader m_header;
+		thread::IoServiceThreadPool& m_pool;
 	};
 }}
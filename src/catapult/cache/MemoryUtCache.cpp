@@ -22,6 +22,8 @@
 #include "AccountCounters.h"
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
+#include <boost/multiprecision/cpp_int.hpp>
+#include <map>
 
 namespace catapult { namespace cache {
 
@@ -46,16 +48,31 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	bool TransactionDataPriorityComparator::operator()(const TransactionData* pLhs, const TransactionData* pRhs) const {
+		// compare fees per byte (lhs.Fee / lhs.Size vs rhs.Fee / rhs.Size) without any loss of precision
+		using boost::multiprecision::uint128_t;
+		auto lhsScaledFee = uint128_t(pLhs->pEntity->Fee.unwrap()) * pRhs->pEntity->Size;
+		auto rhsScaledFee = uint128_t(pRhs->pEntity->Fee.unwrap()) * pLhs->pEntity->Size;
+		if (lhsScaledFee != rhsScaledFee)
+			return lhsScaledFee > rhsScaledFee;
+
+		return pLhs->Id < pRhs->Id;
+	}
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
 			const IdLookup& idLookup,
+			const TransactionDataPriorityIndex& priorityIndex,
+			const SignerIdsLookup& signerIdsLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
 			, m_idLookup(idLookup)
+			, m_priorityIndex(priorityIndex)
+			, m_signerIdsLookup(signerIdsLookup)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -74,6 +91,88 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	namespace {
+		// forwards transaction data in priority order while preserving the relative order of transactions with the same signer
+		class PriorityOrderedTraversal {
+		private:
+			struct SignerState {
+				std::set<size_t>::const_iterator NextIdIter;
+				std::set<size_t>::const_iterator EndIdIter;
+				std::map<size_t, const TransactionData*> DeferredData;
+			};
+
+		public:
+			PriorityOrderedTraversal(const TransactionDataPriorityIndex& priorityIndex, const SignerIdsLookup& signerIdsLookup)
+					: m_priorityIndex(priorityIndex)
+					, m_signerIdsLookup(signerIdsLookup)
+			{}
+
+		public:
+			template<typename TConsumer>
+			void forEach(TConsumer consumer) {
+				auto iter = m_priorityIndex.cbegin();
+				for (;;) {
+					const TransactionData* pData;
+					if (!m_readyData.empty()) {
+						// previously deferred data always has a higher priority than all data that has not yet been visited
+						pData = *m_readyData.cbegin();
+						m_readyData.erase(m_readyData.cbegin());
+					} else {
+						if (m_priorityIndex.cend() == iter)
+							return;
+
+						pData = *iter++;
+						auto& signerState = getSignerState(pData->pEntity->Signer);
+						if (*signerState.NextIdIter != pData->Id) {
+							// an older transaction with the same signer has not been forwarded yet
+							signerState.DeferredData.emplace(pData->Id, pData);
+							continue;
+						}
+					}
+
+					if (!consumer(*pData))
+						return;
+
+					markForwarded(getSignerState(pData->pEntity->Signer));
+				}
+			}
+
+		private:
+			SignerState& getSignerState(const Key& signer) {
+				auto iter = m_signerStates.find(signer);
+				if (m_signerStates.cend() != iter)
+					return iter->second;
+
+				const auto& signerIds = m_signerIdsLookup.at(signer);
+				return m_signerStates.emplace(signer, SignerState{ signerIds.cbegin(), signerIds.cend(), {} }).first->second;
+			}
+
+			void markForwarded(SignerState& signerState) {
+				if (signerState.EndIdIter == ++signerState.NextIdIter)
+					return;
+
+				// unblock the next transaction with the same signer if it has already been visited
+				auto deferredIter = signerState.DeferredData.find(*signerState.NextIdIter);
+				if (signerState.DeferredData.cend() == deferredIter)
+					return;
+
+				m_readyData.insert(deferredIter->second);
+				signerState.DeferredData.erase(deferredIter);
+			}
+
+		private:
+			const TransactionDataPriorityIndex& m_priorityIndex;
+			const SignerIdsLookup& m_signerIdsLookup;
+			std::unordered_map<Key, SignerState, utils::ArrayHasher<Key>> m_signerStates;
+			TransactionDataPriorityIndex m_readyData;
+		};
+	}
+
+	void MemoryUtCacheView::forEachByPriority(const TransactionInfoConsumer& consumer) const {
+		PriorityOrderedTraversal traversal(m_priorityIndex, m_signerIdsLookup);
+		traversal.forEach(consumer);
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -117,12 +216,16 @@ namespace catapult { namespace cache {
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
 					IdLookup& idLookup,
+					TransactionDataPriorityIndex& priorityIndex,
+					SignerIdsLookup& signerIdsLookup,
 					AccountCounters& counters,
 					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
 					, m_idLookup(idLookup)
+					, m_priorityIndex(priorityIndex)
+					, m_signerIdsLookup(signerIdsLookup)
 					, m_counters(counters)
 					, m_readLock(std::move(readLock))
 					, m_writeLock(m_readLock.promoteToWriter())
@@ -141,7 +244,9 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_priorityIndex.insert(&*dataIter);
+				m_signerIdsLookup[transactionInfo.pEntity->Signer].insert(m_idSequence);
 
 				m_counters.increment(transactionInfo.pEntity->Signer);
 
@@ -157,8 +262,15 @@ namespace catapult { namespace cache {
 				auto dataIter = m_transactionDataContainer.find(TransactionData(iter->second));
 				auto erasedInfo = dataIter->copy();
 
-				m_counters.decrement(dataIter->pEntity->Signer);
+				const auto& signer = dataIter->pEntity->Signer;
+				m_counters.decrement(signer);
 
+				auto signerIdsIter = m_signerIdsLookup.find(signer);
+				signerIdsIter->second.erase(dataIter->Id);
+				if (signerIdsIter->second.empty())
+					m_signerIdsLookup.erase(signerIdsIter);
+
+				m_priorityIndex.erase(&*dataIter);
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -179,6 +291,8 @@ namespace catapult { namespace cache {
 				for (const auto& data : m_transactionDataContainer)
 					transactionInfosCopy.emplace_back(data.copy());
 
+				m_priorityIndex.clear();
+				m_signerIdsLookup.clear();
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
 				m_counters.reset();
@@ -190,6 +304,8 @@ namespace catapult { namespace cache {
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
 			IdLookup& m_idLookup;
+			TransactionDataPriorityIndex& m_priorityIndex;
+			SignerIdsLookup& m_signerIdsLookup;
 			AccountCounters& m_counters;
 			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
@@ -203,6 +319,8 @@ namespace catapult { namespace cache {
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+		TransactionDataPriorityIndex PriorityIndex;
+		cache::SignerIdsLookup SignerIdsLookup;
 		AccountCounters Counters;
 	};
 
@@ -215,7 +333,13 @@ namespace catapult { namespace cache {
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, m_lock.acquireReader());
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->IdLookup,
+				m_pImpl->PriorityIndex,
+				m_pImpl->SignerIdsLookup,
+				m_lock.acquireReader());
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -224,6 +348,8 @@ namespace catapult { namespace cache {
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
 				m_pImpl->IdLookup,
+				m_pImpl->PriorityIndex,
+				m_pImpl->SignerIdsLookup,
 				m_pImpl->Counters,
 				m_lock.acquireReader()));
 	}
@@ -36,6 +36,19 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Comparator for ordering transaction data by priority.
+	struct TransactionDataPriorityComparator {
+		/// Returns \c true if \a pLhs has a higher priority than \a pRhs.
+		/// \note Transaction data with higher fee per byte has higher priority; ties are broken by insertion order.
+		bool operator()(const TransactionData* pLhs, const TransactionData* pRhs) const;
+	};
+
+	/// Internal index of transaction data ordered by priority.
+	using TransactionDataPriorityIndex = std::set<const TransactionData*, TransactionDataPriorityComparator>;
+
+	/// Internal lookup of the (insertion ordered) ids of all transactions with the same signer.
+	using SignerIdsLookup = std::unordered_map<Key, std::set<size_t>, utils::ArrayHasher<Key>>;
+
 	/// A read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
@@ -45,11 +58,14 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), an id lookup (\a idLookup), a priority index (\a priorityIndex)
+		/// and a signer ids lookup (\a signerIdsLookup) with lock context \a readLock.
 		explicit MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
 				const IdLookup& idLookup,
+				const TransactionDataPriorityIndex& priorityIndex,
+				const SignerIdsLookup& signerIdsLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
@@ -62,6 +78,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos in priority order until all are consumed or \c false is returned by consumer.
+		/// \note Transactions are ordered by descending fee per byte but a transaction is never forwarded before
+		///        any transaction with the same signer that was added to the cache before it.
+		void forEachByPriority(const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// A short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -73,6 +94,8 @@ namespace catapult { namespace cache {
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
 		const IdLookup& m_idLookup;
+		const TransactionDataPriorityIndex& m_priorityIndex;
+		const SignerIdsLookup& m_signerIdsLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
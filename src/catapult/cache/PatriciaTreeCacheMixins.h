@@ -60,6 +60,10 @@ namespace catapult { namespace cache {
 	/// A mixin for adding patricia tree support to a delta cache.
 	template<typename TSet, typename TTree>
 	class PatriciaTreeDeltaMixin {
+	private:
+		static constexpr size_t Min_Changes_For_Parallel_Hashing = 1000;
+		static constexpr size_t Num_Subtree_Fan_Out_Levels = 2;
+
 	public:
 		/// Creates a mixin around delta \a set and \a pTree.
 		PatriciaTreeDeltaMixin(TSet& set, const std::shared_ptr<TTree>& pTree)
@@ -83,10 +87,24 @@ namespace catapult { namespace cache {
 
 		/// Recalculates the merkle root given the specified chain \a height if supported.
 		void updateMerkleRoot(Height height) {
+			updateMerkleRoot(height, nullptr);
+		}
+
+		/// Recalculates the merkle root given the specified chain \a height if supported.
+		/// \note Independent subtrees of large change sets are hashed in parallel on \a pPool when it is not \c nullptr.
+		void updateMerkleRoot(Height height, thread::IoServiceThreadPool* pPool) {
 			if (!m_pTree)
 				return;
 
-			ApplyDeltasToTree(*m_pTree, m_set, m_nextGenerationId, height);
+			auto numChanges = ApplyDeltasToTree(*m_pTree, m_set, m_nextGenerationId, height);
+
+			// checkpointing hashes all changed nodes serially, so hash independent subtrees of large change sets in parallel first
+			if (pPool && numChanges >= Min_Changes_For_Parallel_Hashing) {
+				m_pTree->root(Num_Subtree_Fan_Out_Levels, [pPool](const auto& subtrees) {
+					HashSubtreesInParallel(subtrees, *pPool);
+				});
+			}
+
 			setApplyCheckpoint();
 		}
 
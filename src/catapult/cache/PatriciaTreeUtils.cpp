@@ -0,0 +1,33 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeUtils.h"
+#include "catapult/thread/BlockingParallelFor.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+
+namespace catapult { namespace cache {
+
+	void HashSubtreesInParallel(const std::vector<const tree::TreeNode*>& subtrees, thread::IoServiceThreadPool& pool) {
+		// subtrees are claimed dynamically, so a few large subtrees do not stall the other workers
+		thread::BlockingParallelFor(pool.service(), pool.numWorkerThreads(), subtrees.size(), [&subtrees](auto index) {
+			subtrees[index]->hash();
+		});
+	}
+}}
@@ -23,6 +23,8 @@
 #include "catapult/tree/PatriciaTree.h"
 #include "catapult/exceptions.h"
 
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
+
 namespace catapult { namespace cache {
 
 	// region IsActiveAdapter
@@ -66,15 +68,20 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	/// Calculates the hashes of all (independent) \a subtrees using \a pool and the calling thread.
+	void HashSubtreesInParallel(const std::vector<const tree::TreeNode*>& subtrees, thread::IoServiceThreadPool& pool);
+
 	/// Applies all changes in \a set to \a tree for all generations starting at \a minGenerationId through the current generation
-	/// given the current chain \a height.
+	/// given the current chain \a height and returns the number of applied changes.
+	/// \note All changes are applied to \a tree as a single batch.
 	template<typename TTree, typename TSet>
-	void ApplyDeltasToTree(TTree& tree, const TSet& set, uint32_t minGenerationId, Height height) {
+	size_t ApplyDeltasToTree(TTree& tree, const TSet& set, uint32_t minGenerationId, Height height) {
 		auto needsApplication = [&set, minGenerationId, maxGenerationId = set.generationId()](const auto& key) {
 			auto generationId = set.generationId(key);
 			return minGenerationId <= generationId && generationId <= maxGenerationId;
 		};
 
+		typename TTree::ChangeSet changeSet;
 		auto deltas = set.deltas();
 		for (const auto& pair : deltas.Added) {
 			if (needsApplication(pair.first)) {
@@ -82,22 +89,25 @@ namespace catapult { namespace cache {
 				if (!detail::IsActiveAdapter::IsActive(pair.second, height))
 					CATAPULT_THROW_RUNTIME_ERROR("cannot add inactive value to tree");
 
-				tree.set(pair.first, pair.second);
+				changeSet.set(pair.first, pair.second);
 			}
 		}
 
 		for (const auto& pair : deltas.Copied) {
 			if (needsApplication(pair.first)) {
 				if (detail::IsActiveAdapter::IsActive(pair.second, height))
-					tree.set(pair.first, pair.second);
+					changeSet.set(pair.first, pair.second);
 				else
-					tree.unset(pair.first);
+					changeSet.unset(pair.first);
 			}
 		}
 
 		for (const auto& pair : deltas.Removed) {
 			if (needsApplication(pair.first))
-				tree.unset(pair.first);
+				changeSet.unset(pair.first);
 		}
+
+		tree.applyChanges(changeSet);
+		return changeSet.size();
 	}
 }}
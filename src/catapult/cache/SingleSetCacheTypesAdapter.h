@@ -101,7 +101,7 @@ namespace catapult { namespace cache {
 			explicit BaseSets(const CacheConfiguration& config)
 					: CacheDatabaseMixin(config, { "default" })
 					, Primary(GetContainerMode(config), database(), 0)
-					, PatriciaTree(hasPatriciaTreeSupport(), database(), 1)
+					, PatriciaTree(hasPatriciaTreeSupport(), database(), 1, patriciaTreeNodeCache())
 			{}
 
 		public:
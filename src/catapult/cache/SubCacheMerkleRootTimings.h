@@ -0,0 +1,74 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/exceptions.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Elapsed times of the most recent merkle root updates of all subcaches.
+	class SubCacheMerkleRootTimings {
+	public:
+		/// Creates timings for subcaches with \a subCacheNames (indexed by subcache id).
+		/// \note Empty names indicate subcaches that are not registered or do not support merkle roots.
+		explicit SubCacheMerkleRootTimings(const std::vector<std::string>& subCacheNames)
+				: m_subCacheNames(subCacheNames)
+				, m_elapsedMicros(new std::atomic<uint64_t>[subCacheNames.size()]())
+		{}
+
+	public:
+		/// Gets the number of subcache ids.
+		size_t size() const {
+			return m_subCacheNames.size();
+		}
+
+		/// Gets the name of the subcache with \a id or an empty string if it does not support merkle roots.
+		const std::string& name(size_t id) const {
+			return m_subCacheNames[checkId(id)];
+		}
+
+		/// Gets the number of microseconds elapsed during the most recent merkle root update of the subcache with \a id.
+		uint64_t elapsedMicros(size_t id) const {
+			return m_elapsedMicros[checkId(id)];
+		}
+
+		/// Sets the number of microseconds elapsed during the most recent merkle root update of the subcache with \a id
+		/// to \a elapsedMicros.
+		void setElapsedMicros(size_t id, uint64_t elapsedMicros) {
+			m_elapsedMicros[checkId(id)] = elapsedMicros;
+		}
+
+	private:
+		size_t checkId(size_t id) const {
+			if (id >= m_subCacheNames.size())
+				CATAPULT_THROW_OUT_OF_RANGE("subcache id is out of range");
+
+			return id;
+		}
+
+	private:
+		std::vector<std::string> m_subCacheNames;
+		std::unique_ptr<std::atomic<uint64_t>[]> m_elapsedMicros;
+	};
+}}
@@ -25,9 +25,11 @@
 
 namespace catapult {
 	namespace cache {
+		class CacheDeltaStorage;
 		class CacheStorage;
 		class CatapultCache;
 	}
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -54,7 +56,8 @@ namespace catapult { namespace cache {
 		virtual bool trySetMerkleRoot(const Hash256& merkleRoot) = 0;
 
 		/// Recalculates the merkle root given the specified chain \a height if supported.
-		virtual void updateMerkleRoot(Height height) = 0;
+		/// \note When \a pPool is not \c nullptr, it can be used to parallelize the calculation.
+		virtual void updateMerkleRoot(Height height, thread::IoServiceThreadPool* pPool) = 0;
 
 		/// Returns a read-only view of this view.
 		virtual const void* asReadOnly() const = 0;
@@ -105,5 +108,9 @@ namespace catapult { namespace cache {
 	public:
 		/// Returns a cache storage based on this cache.
 		virtual std::unique_ptr<CacheStorage> createStorage() = 0;
+
+		/// Returns a cache delta storage based on this cache.
+		/// \note Returns \c nullptr if cache deltas cannot be saved.
+		virtual std::unique_ptr<CacheDeltaStorage> createDeltaStorage() = 0;
 	};
 }}
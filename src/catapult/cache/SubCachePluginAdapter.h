@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "CacheDeltaStorageAdapter.h"
 #include "CacheStorageAdapter.h"
 #include "SubCachePlugin.h"
 #include <memory>
@@ -82,11 +83,24 @@ namespace catapult { namespace cache {
 					: nullptr;
 		}
 
+		std::unique_ptr<CacheDeltaStorage> createDeltaStorage() override {
+			using DeltaElementsFlag = typename detail::SupportsDeltaElements<typename TCache::CacheDeltaType>::type;
+			return IsCacheStorageSupported(*m_pCache) ? CreateDeltaStorage(*m_pCache, DeltaElementsFlag()) : nullptr;
+		}
+
 	private:
 		bool IsCacheStorageSupported(const TCache& cache) {
 			return !!cache.createView()->tryMakeIterableView();
 		}
 
+		static std::unique_ptr<CacheDeltaStorage> CreateDeltaStorage(TCache& cache, std::true_type) {
+			return std::make_unique<CacheDeltaStorageAdapter<TCache, TStorageTraits>>(cache);
+		}
+
+		static std::unique_ptr<CacheDeltaStorage> CreateDeltaStorage(TCache&, std::false_type) {
+			return nullptr;
+		}
+
 	private:
 		template<typename TView>
 		class SubCacheViewAdapter : public SubCacheView {
@@ -128,8 +142,8 @@ namespace catapult { namespace cache {
 				return TrySetMerkleRoot(m_view, merkleRoot, merkleRootMutator());
 			}
 
-			void updateMerkleRoot(Height height) override {
-				UpdateMerkleRoot(m_view, height, merkleRootMutator());
+			void updateMerkleRoot(Height height, thread::IoServiceThreadPool* pPool) override {
+				UpdateMerkleRoot(m_view, height, pPool, merkleRootMutator());
 			}
 
 			const void* asReadOnly() const override {
@@ -193,11 +207,11 @@ namespace catapult { namespace cache {
 				return true;
 			}
 
-			static void UpdateMerkleRoot(TView&, Height, UnsupportedMerkleRootFlag) {
+			static void UpdateMerkleRoot(TView&, Height, thread::IoServiceThreadPool*, UnsupportedMerkleRootFlag) {
 			}
 
-			static void UpdateMerkleRoot(TView& view, Height height, SupportedMerkleRootFlag) {
-				view->updateMerkleRoot(height);
+			static void UpdateMerkleRoot(TView& view, Height height, thread::IoServiceThreadPool* pPool, SupportedMerkleRootFlag) {
+				view->updateMerkleRoot(height, pPool);
 			}
 
 		private:
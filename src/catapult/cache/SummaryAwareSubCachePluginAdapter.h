@@ -20,6 +20,7 @@
 
 #pragma once
 #include "SubCachePluginAdapter.h"
+#include <limits>
 
 namespace catapult { namespace cache {
 
@@ -38,6 +39,12 @@ namespace catapult { namespace cache {
 			return m_name;
 		}
 
+	public:
+		void loadAllParallel(io::InputStream& input, thread::IoServiceThreadPool&) override {
+			// summary data is small, so it is always loaded sequentially
+			loadAll(input, std::numeric_limits<size_t>::max());
+		}
+
 	protected:
 		/// Gets a typed const reference to the underlying cache.
 		const TCache& cache() const {
@@ -57,10 +57,15 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides AccountStateBasicCache::commit.
 		void commit(const CacheDeltaType& delta) {
-			// high value addresses need to be captured before committing because committing clears the deltas
-			auto highValueAddresses = delta.highValueAddresses();
+			// high value address changes need to be captured before committing because committing clears the deltas
+			auto highValueAddressChanges = delta.highValueAddressChanges();
 			AccountStateBasicCache::commit(delta);
-			*m_pHighValueAddresses = std::move(highValueAddresses);
+
+			// apply changes in place so that commit cost is proportional to the number of changed accounts
+			for (const auto& address : highValueAddressChanges.Removed)
+				m_pHighValueAddresses->erase(address);
+
+			m_pHighValueAddresses->insert(highValueAddressChanges.Added.cbegin(), highValueAddressChanges.Added.cend());
 		}
 
 	private:
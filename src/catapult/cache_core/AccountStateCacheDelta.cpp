@@ -51,6 +51,8 @@ namespace catapult { namespace cache {
 			, AccountStateCacheDeltaMixins::ConstAccessorKey(*pKeyLookupAdapter)
 			, AccountStateCacheDeltaMixins::MutableAccessorAddress(*accountStateSets.pPrimary)
 			, AccountStateCacheDeltaMixins::MutableAccessorKey(*pKeyLookupAdapter)
+			, AccountStateCacheDeltaMixins::PrefetchAddress(*accountStateSets.pPrimary)
+			, AccountStateCacheDeltaMixins::PrefetchKey(*accountStateSets.pKeyLookupMap)
 			, AccountStateCacheDeltaMixins::PatriciaTreeDelta(*accountStateSets.pPrimary, accountStateSets.pPatriciaTree)
 			, AccountStateCacheDeltaMixins::DeltaElements(*accountStateSets.pPrimary)
 			, m_pStateByAddress(accountStateSets.pPrimary)
@@ -171,31 +173,77 @@ namespace catapult { namespace cache {
 
 	namespace {
 		using DeltasSet = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::SetType::MemorySetType;
+		using HighValueFlagMap = std::unordered_map<Address, bool, utils::ArrayHasher<Address>>;
 
-		void UpdateAddresses(model::AddressSet& addresses, const DeltasSet& source, const predicate<const state::AccountState&>& include) {
-			for (const auto& pair : source) {
-				const auto& accountState = pair.second;
-				if (include(accountState))
-					addresses.insert(accountState.Address);
-				else
-					addresses.erase(accountState.Address);
-			}
+		void UpdateFlags(HighValueFlagMap& flags, const DeltasSet& source, const predicate<const state::AccountState&>& include) {
+			for (const auto& pair : source)
+				flags[pair.first] = include(pair.second);
 		}
 	}
 
 	model::AddressSet BasicAccountStateCacheDelta::highValueAddresses() const {
-		// 1. copy original high value addresses
-		auto highValueAddresses = m_highValueAddresses;
+		model::AddressSet highValueAddresses;
+		forEachHighValueAddress([&highValueAddresses](const auto& address) {
+			highValueAddresses.insert(address);
+		});
 
-		// 2. update for changes
+		return highValueAddresses;
+	}
+
+	HighValueAddressChanges BasicAccountStateCacheDelta::highValueAddressChanges() const {
+		// 1. determine which changed accounts have high values (later changes take precedence)
 		auto hasHighValue = [minBalance = m_options.MinHighValueAccountBalance](const auto& accountState) {
 			return accountState.Balances.get(Xem_Id) >= minBalance;
 		};
 
+		HighValueFlagMap flags;
 		auto deltas = m_pStateByAddress->deltas();
-		UpdateAddresses(highValueAddresses, deltas.Added, hasHighValue);
-		UpdateAddresses(highValueAddresses, deltas.Copied, hasHighValue);
-		UpdateAddresses(highValueAddresses, deltas.Removed, [](const auto&) { return false; });
-		return highValueAddresses;
+		UpdateFlags(flags, deltas.Added, hasHighValue);
+		UpdateFlags(flags, deltas.Copied, hasHighValue);
+		UpdateFlags(flags, deltas.Removed, [](const auto&) { return false; });
+
+		// 2. only changed accounts can be added to or removed from the committed high value addresses
+		HighValueAddressChanges changes;
+		for (const auto& pair : flags) {
+			auto isCommitted = m_highValueAddresses.cend() != m_highValueAddresses.find(pair.first);
+			if (pair.second && !isCommitted)
+				changes.Added.insert(pair.first);
+			else if (!pair.second && isCommitted)
+				changes.Removed.insert(pair.first);
+		}
+
+		return changes;
+	}
+
+	void BasicAccountStateCacheDelta::forEachHighValueAddress(const consumer<const Address&>& consumer) const {
+		auto changes = highValueAddressChanges();
+		for (const auto& address : m_highValueAddresses) {
+			if (changes.Removed.cend() == changes.Removed.find(address))
+				consumer(address);
+		}
+
+		for (const auto& address : changes.Added)
+			consumer(address);
+	}
+
+	std::vector<state::AccountState*> BasicAccountStateCacheDelta::highValueAccounts() {
+		std::vector<const Address*> addresses;
+		auto changes = highValueAddressChanges();
+		addresses.reserve(m_highValueAddresses.size() + changes.Added.size() - changes.Removed.size());
+		for (const auto& address : m_highValueAddresses) {
+			if (changes.Removed.cend() == changes.Removed.find(address))
+				addresses.push_back(&address);
+		}
+
+		for (const auto& address : changes.Added)
+			addresses.push_back(&address);
+
+		// account states are stored in nodes of the delta set, so pointers remain valid as other accounts are found
+		std::vector<state::AccountState*> accountStates;
+		accountStates.reserve(addresses.size());
+		for (const auto* pAddress : addresses)
+			accountStates.push_back(&this->find(*pAddress).get());
+
+		return accountStates;
 	}
 }}
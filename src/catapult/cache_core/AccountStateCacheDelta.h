@@ -24,6 +24,7 @@
 #include "ReadOnlyAccountStateCache.h"
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
+#include "catapult/functions.h"
 #include "catapult/model/ContainerTypes.h"
 
 namespace catapult { namespace cache {
@@ -47,12 +48,25 @@ namespace catapult { namespace cache {
 		using ConstAccessorKey = KeyMixins::ConstAccessor;
 		using MutableAccessorAddress = AddressMixins::MutableAccessor;
 		using MutableAccessorKey = KeyMixins::MutableAccessor;
+		using PrefetchAddress = AddressMixins::Prefetch;
+		using PrefetchKey = PrefetchMixin<
+			AccountStateCacheTypes::KeyLookupMapTypes::BaseSetDeltaType,
+			AccountStateCacheTypes::KeyLookupMapTypesDescriptor>;
 		using PatriciaTreeDelta = AddressMixins::PatriciaTreeDelta;
 		using DeltaElements = AddressMixins::DeltaElements;
 
 		// no mutable key accessor because address-to-key pairs are immutable
 	};
 
+	/// Changes to the high value addresses relative to the committed high value addresses.
+	struct HighValueAddressChanges {
+		/// Addresses that became high value addresses.
+		model::AddressSet Added;
+
+		/// Addresses that are no longer high value addresses.
+		model::AddressSet Removed;
+	};
+
 	/// Basic delta on top of the account state cache.
 	class BasicAccountStateCacheDelta
 			: public utils::MoveOnly
@@ -63,6 +77,8 @@ namespace catapult { namespace cache {
 			, public AccountStateCacheDeltaMixins::ConstAccessorKey
 			, public AccountStateCacheDeltaMixins::MutableAccessorAddress
 			, public AccountStateCacheDeltaMixins::MutableAccessorKey
+			, public AccountStateCacheDeltaMixins::PrefetchAddress
+			, public AccountStateCacheDeltaMixins::PrefetchKey
 			, public AccountStateCacheDeltaMixins::PatriciaTreeDelta
 			, public AccountStateCacheDeltaMixins::DeltaElements {
 	public:
@@ -91,6 +107,9 @@ namespace catapult { namespace cache {
 		using AccountStateCacheDeltaMixins::MutableAccessorAddress::find;
 		using AccountStateCacheDeltaMixins::MutableAccessorKey::find;
 
+		using AccountStateCacheDeltaMixins::PrefetchAddress::prefetch;
+		using AccountStateCacheDeltaMixins::PrefetchKey::prefetch;
+
 	public:
 		/// Gets the network identifier.
 		model::NetworkIdentifier networkIdentifier() const;
@@ -123,8 +142,18 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Gets all high value addresses.
+		/// \note This copies all committed high value addresses, so prefer forEachHighValueAddress when possible.
 		model::AddressSet highValueAddresses() const;
 
+		/// Gets the changes to the committed high value addresses made by this delta.
+		HighValueAddressChanges highValueAddressChanges() const;
+
+		/// Calls \a consumer with each high value address.
+		void forEachHighValueAddress(const consumer<const Address&>& consumer) const;
+
+		/// Gets (mutable) pointers to the account states of all high value accounts.
+		std::vector<state::AccountState*> highValueAccounts();
+
 	private:
 		Address getAddress(const Key& publicKey);
 
@@ -29,6 +29,7 @@ namespace catapult { namespace cache {
 			const BlockDifficultyCacheTypes::Options& options)
 			: BlockDifficultyCacheDeltaMixins::Size(*difficultyInfoSets.pPrimary)
 			, BlockDifficultyCacheDeltaMixins::Contains(*difficultyInfoSets.pPrimary)
+			, BlockDifficultyCacheDeltaMixins::DeltaElements(*difficultyInfoSets.pPrimary)
 			, m_pOrderedDelta(difficultyInfoSets.pPrimary)
 			, m_difficultyHistorySize(options.DifficultyHistorySize)
 			// note: empty indicates initial cache seeding;
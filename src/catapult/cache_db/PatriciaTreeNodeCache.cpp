@@ -0,0 +1,146 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeNodeCache.h"
+#include "catapult/tree/TreeNode.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	class PatriciaTreeNodeCache::Shard {
+	private:
+		using NodePair = std::pair<Hash256, std::shared_ptr<const tree::TreeNode>>;
+		using NodeList = std::list<NodePair>;
+
+	public:
+		explicit Shard(size_t maxSize)
+				: m_maxSize(maxSize)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
+
+	public:
+		size_t size() const {
+			utils::SpinLockGuard guard(m_lock);
+			return m_nodes.size();
+		}
+
+		uint64_t numHits() const {
+			utils::SpinLockGuard guard(m_lock);
+			return m_numHits;
+		}
+
+		uint64_t numMisses() const {
+			utils::SpinLockGuard guard(m_lock);
+			return m_numMisses;
+		}
+
+	public:
+		std::shared_ptr<const tree::TreeNode> find(const Hash256& hash) {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_nodeIterators.find(hash);
+			if (m_nodeIterators.cend() == iter) {
+				++m_numMisses;
+				return nullptr;
+			}
+
+			// move the node to the front of the recently used list
+			++m_numHits;
+			m_nodes.splice(m_nodes.begin(), m_nodes, iter->second);
+			return iter->second->second;
+		}
+
+		void insert(const Hash256& hash, const std::shared_ptr<const tree::TreeNode>& pNode) {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_nodeIterators.find(hash);
+			if (m_nodeIterators.cend() != iter) {
+				m_nodes.splice(m_nodes.begin(), m_nodes, iter->second);
+				return;
+			}
+
+			if (m_nodes.size() == m_maxSize) {
+				m_nodeIterators.erase(m_nodes.back().first);
+				m_nodes.pop_back();
+			}
+
+			m_nodes.emplace_front(hash, pNode);
+			m_nodeIterators.emplace(hash, m_nodes.begin());
+		}
+
+	private:
+		size_t m_maxSize;
+		NodeList m_nodes;
+		std::unordered_map<Hash256, NodeList::iterator, utils::ArrayHasher<Hash256>> m_nodeIterators;
+		uint64_t m_numHits;
+		uint64_t m_numMisses;
+		mutable utils::SpinLock m_lock;
+	};
+
+	PatriciaTreeNodeCache::PatriciaTreeNodeCache(size_t maxSize, size_t numShards) {
+		if (0 == maxSize || 0 == numShards)
+			CATAPULT_THROW_INVALID_ARGUMENT("node cache size and number of shards must be nonzero");
+
+		// distribute capacity across shards so that the total never exceeds maxSize
+		numShards = std::min(numShards, maxSize);
+		for (auto i = 0u; i < numShards; ++i)
+			m_shards.push_back(std::make_unique<Shard>(maxSize / numShards + (i < maxSize % numShards ? 1 : 0)));
+	}
+
+	PatriciaTreeNodeCache::~PatriciaTreeNodeCache() = default;
+
+	size_t PatriciaTreeNodeCache::size() const {
+		size_t size = 0;
+		for (const auto& pShard : m_shards)
+			size += pShard->size();
+
+		return size;
+	}
+
+	PatriciaTreeNodeCacheStatistics PatriciaTreeNodeCache::statistics() const {
+		PatriciaTreeNodeCacheStatistics statistics{};
+		for (const auto& pShard : m_shards) {
+			statistics.Size += pShard->size();
+			statistics.Hits += pShard->numHits();
+			statistics.Misses += pShard->numMisses();
+		}
+
+		return statistics;
+	}
+
+	std::shared_ptr<const tree::TreeNode> PatriciaTreeNodeCache::find(const Hash256& hash) {
+		return shard(hash).find(hash);
+	}
+
+	void PatriciaTreeNodeCache::insert(const Hash256& hash, const std::shared_ptr<const tree::TreeNode>& pNode) {
+		shard(hash).insert(hash, pNode);
+	}
+
+	PatriciaTreeNodeCache::Shard& PatriciaTreeNodeCache::shard(const Hash256& hash) {
+		// node hashes are uniformly distributed, so any bytes can be used to select a shard
+		// (use trailing bytes because leading bytes are used by the per shard map hasher)
+		auto shardKey = static_cast<size_t>(hash[Hash256_Size - 2] << 8 | hash[Hash256_Size - 1]);
+		return *m_shards[shardKey % m_shards.size()];
+	}
+}}
@@ -0,0 +1,74 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace tree { class TreeNode; } }
+
+namespace catapult { namespace cache {
+
+	/// Patricia tree node cache statistics.
+	struct PatriciaTreeNodeCacheStatistics {
+		/// Number of cached nodes.
+		uint64_t Size;
+
+		/// Number of node lookups served from the cache.
+		uint64_t Hits;
+
+		/// Number of node lookups not served from the cache.
+		uint64_t Misses;
+	};
+
+	/// Bounded cache of decoded patricia tree nodes keyed by node hash.
+	/// \note Tree nodes are content addressed, so cached nodes never need to be invalidated, only evicted.
+	class PatriciaTreeNodeCache {
+	public:
+		/// Creates a cache that holds at most \a maxSize nodes split across \a numShards independently locked shards.
+		PatriciaTreeNodeCache(size_t maxSize, size_t numShards);
+
+		/// Destroys the cache.
+		~PatriciaTreeNodeCache();
+
+	public:
+		/// Gets the number of cached nodes.
+		size_t size() const;
+
+		/// Gets the cache statistics.
+		PatriciaTreeNodeCacheStatistics statistics() const;
+
+	public:
+		/// Gets the node with \a hash or \c nullptr if it is not cached.
+		std::shared_ptr<const tree::TreeNode> find(const Hash256& hash);
+
+		/// Adds \a pNode with \a hash to the cache, evicting the least recently used node in its shard when full.
+		void insert(const Hash256& hash, const std::shared_ptr<const tree::TreeNode>& pNode);
+
+	private:
+		class Shard;
+
+		Shard& shard(const Hash256& hash);
+
+	private:
+		std::vector<std::unique_ptr<Shard>> m_shards;
+	};
+}}
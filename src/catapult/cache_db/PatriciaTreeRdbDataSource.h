@@ -20,6 +20,7 @@
 
 #pragma once
 #include "PatriciaTreeContainer.h"
+#include "PatriciaTreeNodeCache.h"
 #include "catapult/types.h"
 
 namespace catapult { namespace cache {
@@ -27,8 +28,12 @@ namespace catapult { namespace cache {
 	/// Patricia tree rocksdb-based data source.
 	class PatriciaTreeRdbDataSource {
 	public:
-		/// Creates data source around \a container.
-		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : m_container(container)
+		/// Creates data source around \a container with optional decoded node cache (\a pNodeCache).
+		explicit PatriciaTreeRdbDataSource(
+				PatriciaTreeContainer& container,
+				const std::shared_ptr<PatriciaTreeNodeCache>& pNodeCache = nullptr)
+				: m_container(container)
+				, m_pNodeCache(pNodeCache)
 		{}
 
 	public:
@@ -38,13 +43,26 @@ namespace catapult { namespace cache {
 		}
 
 		/// Gets the tree node associated with \a hash.
-		std::unique_ptr<const tree::TreeNode> get(const Hash256& hash) const {
+		std::shared_ptr<const tree::TreeNode> get(const Hash256& hash) const {
+			if (m_pNodeCache) {
+				auto pNode = m_pNodeCache->find(hash);
+				if (pNode)
+					return pNode;
+			}
+
 			auto iter = m_container.find(hash);
 			if (m_container.cend() == iter)
 				return nullptr;
 
 			const auto& pair = *iter;
-			return std::make_unique<const tree::TreeNode>(pair.second.copy());
+			auto pNode = std::make_shared<const tree::TreeNode>(pair.second.copy());
+			if (m_pNodeCache) {
+				// calculate the (lazy) node hash before the node is shared across threads
+				pNode->hash();
+				m_pNodeCache->insert(hash, pNode);
+			}
+
+			return pNode;
 		}
 
 	public:
@@ -65,5 +83,6 @@ namespace catapult { namespace cache {
 
 	private:
 		PatriciaTreeContainer& m_container;
+		std::shared_ptr<PatriciaTreeNodeCache> m_pNodeCache;
 	};
 }}
@@ -22,6 +22,7 @@
 #include "catapult/exceptions.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
+#include <vector>
 
 namespace catapult {
 	namespace cache {
@@ -78,6 +79,9 @@ namespace catapult { namespace cache {
 		/// Finds element with \a key, storing result in \a iterator.
 		void find(const RawBuffer& key, RdbDataIterator& iterator) const;
 
+		/// Finds all elements with \a keys, storing results in \a iterators.
+		void findAll(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const;
+
 		/// Inserts element with \a key and \a value.
 		void insert(const RawBuffer& key, const std::string& value);
 
@@ -125,6 +125,24 @@ namespace catapult { namespace cache {
 			return iter;
 		}
 
+		/// Finds all elements with \a keys using a single batched lookup.
+		/// \note Returned iterators are in the same order as \a keys and are equal to cend() for keys that have not been found.
+		std::vector<const_iterator> findAll(const std::vector<KeyType>& keys) const {
+			std::vector<RawBuffer> serializedKeys;
+			serializedKeys.reserve(keys.size());
+			for (const auto& key : keys)
+				serializedKeys.push_back(SerializeKey(key));
+
+			std::vector<RdbDataIterator> dbIterators;
+			TContainer::findAll(serializedKeys, dbIterators);
+
+			std::vector<const_iterator> iterators(keys.size());
+			for (auto i = 0u; i < keys.size(); ++i)
+				iterators[i].dbIterator() = std::move(dbIterators[i]);
+
+			return iterators;
+		}
+
 		/// Prunes elements with keys smaller than \a key. Returns number of pruned elements.
 		size_t prune(const KeyType& key) {
 			return TContainer::prune(TDescriptor::Serializer::KeyToBoundary(key));
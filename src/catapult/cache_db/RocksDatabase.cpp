@@ -84,11 +84,13 @@ namespace catapult { namespace cache {
 			const std::string& databaseDirectory,
 			const std::vector<std::string>& columnFamilyNames,
 			utils::FileSize maxDatabaseWriteBatchSize,
-			FilterPruningMode pruningMode)
+			FilterPruningMode pruningMode,
+			const std::shared_ptr<const RocksTuning>& pTuning)
 			: DatabaseDirectory(databaseDirectory)
 			, ColumnFamilyNames(columnFamilyNames)
 			, MaxDatabaseWriteBatchSize(maxDatabaseWriteBatchSize)
 			, PruningMode(pruningMode)
+			, pTuning(pTuning)
 	{}
 
 	// endregion
@@ -114,13 +116,18 @@ namespace catapult { namespace cache {
 		rocksdb::Options dbOptions;
 		dbOptions.create_if_missing = true;
 		dbOptions.create_missing_column_families = true;
-
-		rocksdb::ColumnFamilyOptions defaultColumnOptions;
-		defaultColumnOptions.compaction_filter = m_pruningFilter.compactionFilter();
+		if (m_settings.pTuning)
+			m_settings.pTuning->apply(dbOptions);
 
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		for (const auto& columnFamilyName : settings.ColumnFamilyNames)
-			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, defaultColumnOptions));
+		for (const auto& columnFamilyName : settings.ColumnFamilyNames) {
+			rocksdb::ColumnFamilyOptions columnOptions;
+			columnOptions.compaction_filter = m_pruningFilter.compactionFilter();
+			if (m_settings.pTuning)
+				m_settings.pTuning->apply(columnOptions, columnFamilyName);
+
+			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnOptions));
+		}
 
 		auto status = rocksdb::DB::Open(dbOptions, m_settings.DatabaseDirectory, columnFamilies, &m_handles, &pDb);
 		m_pDb.reset(pDb);
@@ -165,6 +172,31 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		std::vector<std::string> values;
+		std::vector<rocksdb::ColumnFamilyHandle*> handles(keys.size(), m_handles[columnId]);
+		auto statuses = m_pDb->MultiGet(rocksdb::ReadOptions(), handles, keys, &values);
+
+		results.resize(keys.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& status = statuses[i];
+			const auto& key = keys[i];
+			if (!status.ok() && !status.IsNotFound())
+				CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
+
+			auto& result = results[i];
+			result.setFound(status.ok());
+			if (!status.ok())
+				continue;
+
+			*result.storage().GetSelf() = std::move(values[i]);
+			result.storage().PinSelf();
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
@@ -204,6 +236,8 @@ namespace catapult { namespace cache {
 
 		rocksdb::WriteOptions writeOptions;
 		writeOptions.sync = true;
+		if (m_settings.pTuning)
+			m_settings.pTuning->apply(writeOptions);
 
 		auto directory = m_settings.DatabaseDirectory + "/";
 		utils::SlowOperationLogger logger(utils::ExtractDirectoryName(directory.c_str()).pData, utils::LogLevel::Warning);
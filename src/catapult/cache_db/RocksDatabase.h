@@ -20,6 +20,7 @@
 
 #pragma once
 #include "RocksPruningFilter.h"
+#include "RocksTuning.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/types.h"
 #include <memory>
@@ -91,12 +92,13 @@ namespace catapult { namespace cache {
 		RocksDatabaseSettings();
 
 		/// Creates database settings around \a databaseDirectory, column names (\a columnFamilyNames),
-		/// maximum size of saved batch (\a maxDatabaseWriteBatchSize) and \a pruningMode.
+		/// maximum size of saved batch (\a maxDatabaseWriteBatchSize), \a pruningMode and optional \a pTuning.
 		RocksDatabaseSettings(
 				const std::string& databaseDirectory,
 				const std::vector<std::string>& columnFamilyNames,
 				utils::FileSize maxDatabaseWriteBatchSize,
-				FilterPruningMode pruningMode);
+				FilterPruningMode pruningMode,
+				const std::shared_ptr<const RocksTuning>& pTuning = nullptr);
 
 	public:
 		/// Database directory.
@@ -110,6 +112,9 @@ namespace catapult { namespace cache {
 
 		/// Database pruning mode.
 		const FilterPruningMode PruningMode;
+
+		/// Database tuning (optional).
+		const std::shared_ptr<const RocksTuning> pTuning;
 	};
 
 	/// RocksDb-backed database.
@@ -135,6 +140,10 @@ namespace catapult { namespace cache {
 		/// Gets \a key from \a columnId returning data in \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets all \a keys from \a columnId using a single batched lookup returning data in \a results.
+		/// \note \a results is resized to match the number of keys and results are in the same order as \a keys.
+		void multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Puts \a value with \a key in \a columnId.
 		void put(size_t columnId, const rocksdb::Slice& key, const std::string& value);
 
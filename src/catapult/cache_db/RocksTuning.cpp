@@ -0,0 +1,117 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RocksTuning.h"
+#include "RocksInclude.h"
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/table.h>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr double Memtable_Prefix_Bloom_Size_Ratio = 0.1;
+
+		void SetWriteBufferSize(rocksdb::ColumnFamilyOptions& columnOptions, utils::FileSize writeBufferSize) {
+			if (0 != writeBufferSize.bytes())
+				columnOptions.write_buffer_size = writeBufferSize.bytes();
+		}
+	}
+
+	RocksTuning::RocksTuning(const RocksTuningSettings& settings) : m_settings(settings) {
+		if (0 != m_settings.BlockCacheSize.bytes())
+			m_pBlockCache = rocksdb::NewLRUCache(m_settings.BlockCacheSize.bytes());
+
+		if (m_settings.ShouldEnableStatistics)
+			m_pStatistics = rocksdb::CreateDBStatistics();
+	}
+
+	RocksTuning::~RocksTuning() = default;
+
+	const RocksTuningSettings& RocksTuning::settings() const {
+		return m_settings;
+	}
+
+	bool RocksTuning::hasSharedBlockCache() const {
+		return !!m_pBlockCache;
+	}
+
+	size_t RocksTuning::blockCacheUsage() const {
+		return m_pBlockCache ? m_pBlockCache->GetUsage() : 0;
+	}
+
+	bool RocksTuning::hasStatistics() const {
+		return !!m_pStatistics;
+	}
+
+	RocksStatistics RocksTuning::statistics() const {
+		RocksStatistics statistics{};
+		if (!m_pStatistics)
+			return statistics;
+
+		statistics.BlockCacheHits = m_pStatistics->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+		statistics.BlockCacheMisses = m_pStatistics->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+		statistics.BloomFilterUseful = m_pStatistics->getTickerCount(rocksdb::BLOOM_FILTER_USEFUL);
+		statistics.MemtableHits = m_pStatistics->getTickerCount(rocksdb::MEMTABLE_HIT);
+		statistics.BytesRead = m_pStatistics->getTickerCount(rocksdb::BYTES_READ);
+		statistics.BytesWritten = m_pStatistics->getTickerCount(rocksdb::BYTES_WRITTEN);
+		statistics.WalSyncs = m_pStatistics->getTickerCount(rocksdb::WAL_FILE_SYNCED);
+		return statistics;
+	}
+
+	void RocksTuning::apply(rocksdb::DBOptions& dbOptions) const {
+		dbOptions.statistics = m_pStatistics;
+	}
+
+	void RocksTuning::apply(rocksdb::ColumnFamilyOptions& columnOptions, const std::string& columnFamilyName) const {
+		rocksdb::BlockBasedTableOptions tableOptions;
+		tableOptions.block_cache = m_pBlockCache;
+		if (0 != m_settings.BloomFilterBitsPerKey)
+			tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(m_settings.BloomFilterBitsPerKey));
+
+		if (m_settings.ShouldPinIndexAndFilterBlocks) {
+			tableOptions.cache_index_and_filter_blocks = true;
+			tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+		}
+
+		columnOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+
+		if (0 != m_settings.KeyPrefixSize) {
+			columnOptions.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(m_settings.KeyPrefixSize));
+			columnOptions.memtable_prefix_bloom_size_ratio = Memtable_Prefix_Bloom_Size_Ratio;
+		}
+
+		if (m_settings.ShouldUseUniversalCompaction)
+			columnOptions.compaction_style = rocksdb::kCompactionStyleUniversal;
+
+		// patricia tree nodes are keyed by (random) hashes and written in bursts, so they can be tuned independently
+		auto isPatriciaTreeColumn = Patricia_Tree_Column_Family_Name == columnFamilyName;
+		SetWriteBufferSize(columnOptions, isPatriciaTreeColumn ? m_settings.PatriciaTreeWriteBufferSize : m_settings.WriteBufferSize);
+
+		if (0 != m_settings.MaxWriteBufferNumber)
+			columnOptions.max_write_buffer_number = static_cast<int>(m_settings.MaxWriteBufferNumber);
+	}
+
+	void RocksTuning::apply(rocksdb::WriteOptions& writeOptions) const {
+		writeOptions.sync = m_settings.ShouldSyncWrites;
+	}
+}}
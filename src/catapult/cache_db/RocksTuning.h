@@ -0,0 +1,138 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/FileSize.h"
+#include <memory>
+#include <string>
+
+namespace rocksdb {
+	class Cache;
+	struct ColumnFamilyOptions;
+	struct DBOptions;
+	class Statistics;
+	struct WriteOptions;
+}
+
+namespace catapult { namespace cache {
+
+	/// Name of the column family used for storing patricia tree nodes.
+	constexpr auto Patricia_Tree_Column_Family_Name = "patricia_tree";
+
+	/// RocksDb tuning settings applied to all cache databases.
+	struct RocksTuningSettings {
+	public:
+		/// Size of the block cache shared by all databases (\c 0 uses a default block cache per database).
+		utils::FileSize BlockCacheSize;
+
+		/// Number of bloom filter bits per key (\c 0 disables bloom filters).
+		uint32_t BloomFilterBitsPerKey = 0;
+
+		/// \c true if index and filter blocks should be stored in the block cache and level zero blocks pinned.
+		bool ShouldPinIndexAndFilterBlocks = false;
+
+		/// Size of fixed width key prefixes used for memtable prefix bloom filters (\c 0 disables prefix extraction).
+		uint32_t KeyPrefixSize = 0;
+
+		/// \c true if universal compaction should be used instead of level compaction.
+		bool ShouldUseUniversalCompaction = false;
+
+		/// Write buffer size of primary columns (\c 0 uses the rocksdb default).
+		utils::FileSize WriteBufferSize;
+
+		/// Write buffer size of patricia tree columns (\c 0 uses the rocksdb default).
+		utils::FileSize PatriciaTreeWriteBufferSize;
+
+		/// Maximum number of write buffers per column (\c 0 uses the rocksdb default).
+		uint32_t MaxWriteBufferNumber = 0;
+
+		/// \c true if the write ahead log should be synced when writes are flushed.
+		/// \note When \c false, syncing is left to the operating system.
+		bool ShouldSyncWrites = true;
+
+		/// \c true if rocksdb statistics should be collected.
+		bool ShouldEnableStatistics = false;
+	};
+
+	/// RocksDb statistics collected across all cache databases.
+	struct RocksStatistics {
+		/// Number of block cache hits.
+		uint64_t BlockCacheHits;
+
+		/// Number of block cache misses.
+		uint64_t BlockCacheMisses;
+
+		/// Number of reads avoided by bloom filters.
+		uint64_t BloomFilterUseful;
+
+		/// Number of reads served by memtables.
+		uint64_t MemtableHits;
+
+		/// Number of bytes read.
+		uint64_t BytesRead;
+
+		/// Number of bytes written.
+		uint64_t BytesWritten;
+
+		/// Number of write ahead log syncs.
+		uint64_t WalSyncs;
+	};
+
+	/// RocksDb tuning settings and resources shared by all cache databases.
+	class RocksTuning {
+	public:
+		/// Creates tuning around \a settings.
+		explicit RocksTuning(const RocksTuningSettings& settings);
+
+		/// Destroys tuning.
+		~RocksTuning();
+
+	public:
+		/// Gets the tuning settings.
+		const RocksTuningSettings& settings() const;
+
+		/// Returns \c true if a block cache is shared by all databases.
+		bool hasSharedBlockCache() const;
+
+		/// Gets the number of bytes used by the shared block cache.
+		size_t blockCacheUsage() const;
+
+		/// Returns \c true if statistics are collected.
+		bool hasStatistics() const;
+
+		/// Gets the statistics collected across all databases.
+		RocksStatistics statistics() const;
+
+	public:
+		/// Applies tuning to database options (\a dbOptions).
+		void apply(rocksdb::DBOptions& dbOptions) const;
+
+		/// Applies tuning to options (\a columnOptions) of the column family named \a columnFamilyName.
+		void apply(rocksdb::ColumnFamilyOptions& columnOptions, const std::string& columnFamilyName) const;
+
+		/// Applies tuning to write options (\a writeOptions).
+		void apply(rocksdb::WriteOptions& writeOptions) const;
+
+	private:
+		RocksTuningSettings m_settings;
+		std::shared_ptr<rocksdb::Cache> m_pBlockCache;
+		std::shared_ptr<rocksdb::Statistics> m_pStatistics;
+	};
+}}
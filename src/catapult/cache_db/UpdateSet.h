@@ -45,6 +45,12 @@ namespace catapult { namespace cache {
 		elements.setSize(size);
 	}
 
+	/// Finds all elements with \a keys in \a elements using a single batched lookup.
+	template<typename TDescriptor, typename TContainer, typename TKey>
+	auto BatchFind(const RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const std::vector<TKey>& keys) {
+		return elements.findAll(keys);
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	template<typename TDescriptor, typename TContainer, typename TPruningBoundary>
 	void PruneBaseSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const TPruningBoundary& pruningBoundary) {
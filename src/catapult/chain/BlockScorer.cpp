@@ -149,6 +149,9 @@ namespace catapult { namespace chain {
 			, m_importanceLookup(importanceLookup)
 	{}
 
+	BlockHitPredicate::BlockHitPredicate(const model::BlockChainConfiguration& config) : m_config(config)
+	{}
+
 	bool BlockHitPredicate::operator()(const model::Block& parentBlock, const model::Block& block, const Hash256& generationHash) const {
 		auto importance = m_importanceLookup(block.Signer, block.Height);
 		auto hit = CalculateHit(generationHash);
@@ -157,9 +160,12 @@ namespace catapult { namespace chain {
 	}
 
 	bool BlockHitPredicate::operator()(const BlockHitContext& context) const {
-		auto importance = m_importanceLookup(context.Signer, context.Height);
+		return (*this)(context, m_importanceLookup(context.Signer, context.Height));
+	}
+
+	bool BlockHitPredicate::operator()(const BlockHitContext& context, Importance signerImportance) const {
 		auto hit = CalculateHit(context.GenerationHash);
-		auto target = CalculateTarget(context.ElapsedTime, context.Difficulty, importance, m_config);
+		auto target = CalculateTarget(context.ElapsedTime, context.Difficulty, signerImportance, m_config);
 		return hit < target;
 	}
 }}
@@ -86,6 +86,10 @@ namespace catapult { namespace chain {
 		/// (\a importanceLookup).
 		BlockHitPredicate(const model::BlockChainConfiguration& config, const ImportanceLookupFunc& importanceLookup);
 
+		/// Creates a predicate around a block chain configuration (\a config) without an importance lookup function.
+		/// \note Only the overload accepting a precomputed importance can be used.
+		explicit BlockHitPredicate(const model::BlockChainConfiguration& config);
+
 	public:
 		/// Determines if the \a block is a hit given its parent (\a parentBlock) and generation hash (\a generationHash).
 		bool operator()(const model::Block& parentBlock, const model::Block& block, const Hash256& generationHash) const;
@@ -93,6 +97,9 @@ namespace catapult { namespace chain {
 		/// Determines if the specified \a context is a hit.
 		bool operator()(const BlockHitContext& context) const;
 
+		/// Determines if the specified \a context is a hit given the precomputed effective signer importance (\a signerImportance).
+		bool operator()(const BlockHitContext& context, Importance signerImportance) const;
+
 	private:
 		model::BlockChainConfiguration m_config;
 		ImportanceLookupFunc m_importanceLookup;
@@ -22,9 +22,14 @@
 #include "CompareChains.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/thread/FutureUtils.h"
+#include "catapult/utils/ExceptionLogging.h"
 #include "catapult/utils/SpinLock.h"
+#include "catapult/utils/StackTimer.h"
+#include <deque>
 #include <queue>
+#include <set>
 
 namespace catapult { namespace chain {
 
@@ -57,6 +62,10 @@ namespace catapult { namespace chain {
 				return m_numBytes;
 			}
 
+			size_t maxSize() const {
+				return m_maxSize;
+			}
+
 			bool shouldStartSync() {
 				utils::SpinLockGuard guard(m_spinLock);
 				if (m_numBytes >= m_maxSize || m_hasPendingSync || m_dirty)
@@ -217,6 +226,601 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		// region ParallelBlocksPuller
+
+		// pulls consecutive windows of blocks concurrently from multiple peers and forwards completed windows in height order
+		class ParallelBlocksPuller : public std::enable_shared_from_this<ParallelBlocksPuller> {
+		private:
+			enum class WindowStatus { Pending, Complete, Terminal, Forwarding };
+
+			enum class ForwardingResult { Unprocessed, Empty, Forwarded, Unlinked, Rejected };
+
+			struct PullAttempt;
+
+			struct BlocksWindow {
+				Height StartHeight;
+				WindowStatus Status;
+				std::vector<model::BlockRange> Ranges;
+				uint64_t NumBytes;
+				size_t SourcePeerIndex;
+				size_t NumActiveAttempts;
+				std::set<size_t> TriedPeerIndexes;
+				std::shared_ptr<PullAttempt> pLastAttempt;
+				std::shared_ptr<PullAttempt> pDeferredAttempt;
+			};
+
+			struct PeerState {
+				std::shared_ptr<const api::RemoteChainApi> pApi;
+				consumer<NodeInteractionResult> InteractionResultHandler;
+				bool IsBusy;
+				bool IsExcluded;
+				bool HasReturnedBadData;
+				Height EmptyResponseHeight;
+				uint64_t NumBytes;
+				uint64_t NumMillis;
+				uint32_t NumCompletedWindows;
+				uint32_t NumForwardedWindows;
+			};
+
+			struct PullAttempt {
+				size_t WindowIndex;
+				size_t PeerIndex;
+				Height NextHeight;
+				uint32_t NumRemainingBlocks;
+				std::vector<model::BlockRange> Ranges;
+				uint64_t NumBytes;
+				utils::StackTimer Timer;
+				uint64_t NumRecordedMillis;
+			};
+
+			struct ForwardedWindow {
+				size_t WindowIndex;
+				bool IsTerminal;
+				std::vector<model::BlockRange> Ranges;
+				ForwardingResult Result;
+				Hash256 LastBlockHash;
+				Height LastBlockHeight;
+			};
+
+			using PullAttempts = std::vector<std::shared_ptr<PullAttempt>>;
+			using ForwardedWindows = std::deque<ForwardedWindow>;
+
+			static constexpr size_t Compared_Peer_Index = 0;
+
+		public:
+			ParallelBlocksPuller(
+					const api::RemoteChainApi& remoteChainApi,
+					const std::vector<AdditionalPeerChainApi>& additionalPeerChainApis,
+					Height startHeight,
+					const api::BlocksFromOptions& options,
+					UnprocessedElements& unprocessedElements)
+					: m_options(options)
+					, m_unprocessedElements(unprocessedElements)
+					, m_windows(additionalPeerChainApis.size() + 1)
+					, m_nextWindowIndex(0)
+					, m_numActiveAttempts(0)
+					, m_numBufferedBytes(0)
+					, m_numUnprocessedBytes(0)
+					, m_hasLastDeliveredBlockHash(false)
+					, m_lastDeliveredPeerIndex(Compared_Peer_Index)
+					, m_hasAddedRange(false)
+					, m_hasPrimaryFailure(false)
+					, m_isDone(false)
+					, m_isForwarding(false)
+					, m_isPromiseSet(false) {
+				// remoteChainApi outlives the returned future, so it can be referenced without ownership
+				auto pRemoteChainApi = std::shared_ptr<const api::RemoteChainApi>(&remoteChainApi, [](const auto*) {});
+				m_peers.push_back(createPeerState(pRemoteChainApi, consumer<NodeInteractionResult>()));
+				for (const auto& additionalPeerChainApi : additionalPeerChainApis) {
+					const auto& interactionResultHandler = additionalPeerChainApi.InteractionResultHandler;
+					m_peers.push_back(createPeerState(additionalPeerChainApi.pRemoteChainApi, interactionResultHandler));
+				}
+
+				// use one window per peer so that at most one window per peer is buffered at any time
+				for (auto i = 0u; i < m_windows.size(); ++i) {
+					auto& window = m_windows[i];
+					window.StartHeight = startHeight + Height(i * m_options.NumBlocks);
+					window.Status = WindowStatus::Pending;
+					window.NumBytes = 0;
+					window.SourcePeerIndex = Compared_Peer_Index;
+					window.NumActiveAttempts = 0;
+				}
+			}
+
+		public:
+			NodeInteractionFuture start() {
+				auto future = m_promise.get_future();
+
+				PullAttempts attempts;
+				auto numUnprocessedBytes = m_unprocessedElements.numBytes();
+				{
+					utils::SpinLockGuard guard(m_spinLock);
+					m_numUnprocessedBytes = numUnprocessedBytes;
+
+					// the first (most critical) window is pulled from the peer with the compared chain
+					for (auto i = 0u; i < m_windows.size() && canPull(i); ++i)
+						attempts.push_back(createAttempt(i, i));
+				}
+
+				issue(attempts);
+				return future;
+			}
+
+		private:
+			static PeerState createPeerState(
+					const std::shared_ptr<const api::RemoteChainApi>& pApi,
+					const consumer<NodeInteractionResult>& interactionResultHandler) {
+				return PeerState{ pApi, interactionResultHandler, false, false, false, Height(0), 0, 0, 0, 0 };
+			}
+
+			bool canPull(size_t windowIndex) const {
+				// the window blocking forwarding is always pulled so that forwarding cannot stall, all other windows are only
+				// pulled when all buffered and unprocessed blocks and the responses of all active requests fit into the budget
+				// of the unprocessed elements
+				if (m_nextWindowIndex == windowIndex)
+					return true;
+
+				auto numReservedBytes = m_numBufferedBytes + (m_numActiveAttempts + 1) * m_options.NumBytes;
+				return m_numUnprocessedBytes + numReservedBytes <= m_unprocessedElements.maxSize();
+			}
+
+			std::shared_ptr<PullAttempt> createAttempt(size_t windowIndex, size_t peerIndex) {
+				auto& window = m_windows[windowIndex];
+				window.TriedPeerIndexes.insert(peerIndex);
+
+				auto pAttempt = std::make_shared<PullAttempt>();
+				pAttempt->WindowIndex = windowIndex;
+				pAttempt->PeerIndex = peerIndex;
+				pAttempt->NextHeight = window.StartHeight;
+				pAttempt->NumRemainingBlocks = m_options.NumBlocks;
+				pAttempt->NumBytes = 0;
+				pAttempt->NumRecordedMillis = 0;
+				window.pLastAttempt = pAttempt;
+				return activateAttempt(pAttempt);
+			}
+
+			std::shared_ptr<PullAttempt> activateAttempt(const std::shared_ptr<PullAttempt>& pAttempt) {
+				++m_windows[pAttempt->WindowIndex].NumActiveAttempts;
+				m_peers[pAttempt->PeerIndex].IsBusy = true;
+				++m_numActiveAttempts;
+
+				// time spent waiting for budget is not attributed to the peer
+				pAttempt->NumRecordedMillis = pAttempt->Timer.millis();
+				return pAttempt;
+			}
+
+			void releaseAttempt(PullAttempt& attempt) {
+				m_numBufferedBytes -= attempt.NumBytes;
+				attempt.NumBytes = 0;
+				attempt.Ranges.clear();
+			}
+
+			void releaseWindow(BlocksWindow& window) {
+				m_numBufferedBytes -= window.NumBytes;
+				window.NumBytes = 0;
+				window.Ranges.clear();
+			}
+
+			void issue(const PullAttempts& attempts) {
+				for (const auto& pAttempt : attempts) {
+					const auto& remoteChainApi = *m_peers[pAttempt->PeerIndex].pApi;
+					auto options = api::BlocksFromOptions(pAttempt->NumRemainingBlocks, m_options.NumBytes);
+					remoteChainApi.blocksFrom(pAttempt->NextHeight, options).then([pThis = shared_from_this(), pAttempt](
+							auto&& blocksFuture) {
+						pThis->onBlocks(pAttempt, blocksFuture);
+					});
+				}
+			}
+
+			void onBlocks(const std::shared_ptr<PullAttempt>& pAttempt, thread::future<model::BlockRange>& blocksFuture) {
+				try {
+					processBlocks(pAttempt, blocksFuture);
+					forwardAndContinue();
+				} catch (...) {
+					// the round must always complete, even when pulling or forwarding blocks fails unexpectedly
+					CATAPULT_LOG(error) << "unexpected exception thrown while pulling blocks: " << EXCEPTION_DIAGNOSTIC_MESSAGE();
+					fail();
+				}
+			}
+
+			void processBlocks(const std::shared_ptr<PullAttempt>& pAttempt, thread::future<model::BlockRange>& blocksFuture) {
+				model::BlockRange range;
+				auto isFailure = false;
+				try {
+					range = blocksFuture.get();
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning)
+							<< "exception thrown while requesting blocks from peer " << pAttempt->PeerIndex << ": " << e.what();
+					isFailure = true;
+				}
+
+				PullAttempts attempts;
+				auto numUnprocessedBytes = m_unprocessedElements.numBytes();
+				{
+					utils::SpinLockGuard guard(m_spinLock);
+					m_numUnprocessedBytes = numUnprocessedBytes;
+					--m_numActiveAttempts;
+
+					auto& attempt = *pAttempt;
+					auto& peer = m_peers[attempt.PeerIndex];
+					auto& window = m_windows[attempt.WindowIndex];
+					--window.NumActiveAttempts;
+					peer.IsBusy = false;
+
+					auto elapsedMillis = attempt.Timer.millis();
+					peer.NumBytes += range.totalSize();
+					peer.NumMillis += elapsedMillis - attempt.NumRecordedMillis;
+					attempt.NumRecordedMillis = elapsedMillis;
+
+					auto isAttemptPending = false;
+					if (isFailure) {
+						excludePeer(attempt.PeerIndex);
+					} else if (WindowStatus::Pending == window.Status && !m_isDone) {
+						if (!range.empty()) {
+							auto endHeight = (--range.cend())->Height;
+							attempt.NumRemainingBlocks -= std::min(attempt.NumRemainingBlocks, static_cast<uint32_t>(range.size()));
+							attempt.NextHeight = endHeight + Height(1);
+							attempt.NumBytes += range.totalSize();
+							m_numBufferedBytes += range.totalSize();
+							attempt.Ranges.push_back(std::move(range));
+
+							// a partial response indicates that the byte limit was hit, so keep pulling the rest of the window
+							// (or defer pulling it until the budget allows)
+							isAttemptPending = 0 != attempt.NumRemainingBlocks;
+							if (!isAttemptPending)
+								completeWindow(window, attempt, WindowStatus::Complete);
+							else if (canPull(attempt.WindowIndex))
+								attempts.push_back(activateAttempt(pAttempt));
+							else
+								window.pDeferredAttempt = pAttempt;
+						} else if (Compared_Peer_Index == attempt.PeerIndex) {
+							// only the compared peer can end the chain, so no further blocks can follow
+							completeWindow(window, attempt, WindowStatus::Terminal);
+						} else {
+							// an additional peer that does not have the blocks of a window cannot be used for any later window
+							CATAPULT_LOG(debug) << "peer " << attempt.PeerIndex << " returned 0 blocks at height " << attempt.NextHeight;
+							peer.EmptyResponseHeight = attempt.NextHeight;
+							peer.IsExcluded = true;
+						}
+					}
+
+					if (!isAttemptPending)
+						releaseAttempt(attempt);
+				}
+
+				issue(attempts);
+			}
+
+			void forwardAndContinue() {
+				// completed windows are merged, hashed and added to the unprocessed elements outside of the lock by a single
+				// thread at a time, which also forwards all windows that other threads complete in the meantime
+				ForwardedWindows forwardedWindows;
+				for (;;) {
+					PullAttempts attempts;
+					auto shouldComplete = false;
+					auto numUnprocessedBytes = m_unprocessedElements.numBytes();
+					{
+						utils::SpinLockGuard guard(m_spinLock);
+						m_numUnprocessedBytes = numUnprocessedBytes;
+						if (!forwardedWindows.empty())
+							applyForwardedWindows(forwardedWindows);
+
+						forwardedWindows = collectForwardableWindows();
+						if (!m_isDone)
+							assignIdlePeers(attempts);
+
+						if (m_isDone && 0 == m_numActiveAttempts && !m_isForwarding && !m_isPromiseSet) {
+							m_isPromiseSet = true;
+							shouldComplete = true;
+						}
+					}
+
+					issue(attempts);
+					if (forwardedWindows.empty()) {
+						if (shouldComplete)
+							complete();
+
+						return;
+					}
+
+					forwardWindows(forwardedWindows);
+				}
+			}
+
+			void fail() {
+				{
+					utils::SpinLockGuard guard(m_spinLock);
+					if (m_isPromiseSet)
+						return;
+
+					m_isPromiseSet = true;
+					m_isForwarding = false;
+					finish();
+				}
+
+				m_promise.set_value(NodeInteractionResult::Failure);
+			}
+
+			void excludePeer(size_t peerIndex) {
+				auto& peer = m_peers[peerIndex];
+				peer.IsExcluded = true;
+				peer.HasReturnedBadData = true;
+				m_hasPrimaryFailure = m_hasPrimaryFailure || Compared_Peer_Index == peerIndex;
+			}
+
+			void completeWindow(BlocksWindow& window, PullAttempt& attempt, WindowStatus status) {
+				window.Status = status;
+				window.Ranges = std::move(attempt.Ranges);
+				window.NumBytes = attempt.NumBytes;
+				window.SourcePeerIndex = attempt.PeerIndex;
+				attempt.NumBytes = 0;
+				++m_peers[attempt.PeerIndex].NumCompletedWindows;
+			}
+
+			ForwardedWindows collectForwardableWindows() {
+				ForwardedWindows forwardedWindows;
+				if (m_isForwarding || m_isDone)
+					return forwardedWindows;
+
+				for (auto i = m_nextWindowIndex; i < m_windows.size(); ++i) {
+					auto& window = m_windows[i];
+					if (WindowStatus::Pending == window.Status)
+						break;
+
+					// the buffered bytes of a window are only released after it has been forwarded
+					auto isTerminal = WindowStatus::Terminal == window.Status;
+					forwardedWindows.push_back(ForwardedWindow{
+						i, isTerminal, std::move(window.Ranges), ForwardingResult::Unprocessed, Hash256(), Height(0)
+					});
+					window.Ranges.clear();
+					window.Status = WindowStatus::Forwarding;
+					if (isTerminal)
+						break;
+				}
+
+				m_isForwarding = !forwardedWindows.empty();
+				return forwardedWindows;
+			}
+
+			void forwardWindows(ForwardedWindows& forwardedWindows) {
+				// the last delivered block is only changed by the forwarding thread
+				auto hasPreviousBlockHash = m_hasLastDeliveredBlockHash;
+				auto previousBlockHash = m_lastDeliveredBlockHash;
+				for (auto& forwardedWindow : forwardedWindows) {
+					if (forwardedWindow.Ranges.empty()) {
+						forwardedWindow.Result = ForwardingResult::Empty;
+						continue;
+					}
+
+					// additional peers did not take part in the chain comparison, so reject windows that do not link
+					const auto& firstBlock = *forwardedWindow.Ranges.front().cbegin();
+					if (hasPreviousBlockHash && previousBlockHash != firstBlock.PreviousBlockHash) {
+						forwardedWindow.Result = ForwardingResult::Unlinked;
+						return;
+					}
+
+					auto range = model::BlockRange::MergeRanges(std::move(forwardedWindow.Ranges));
+					forwardedWindow.LastBlockHash = model::CalculateHash(*--range.cend());
+					forwardedWindow.LastBlockHeight = (--range.cend())->Height;
+					if (!m_unprocessedElements.add(std::move(range))) {
+						forwardedWindow.Result = ForwardingResult::Rejected;
+						return;
+					}
+
+					forwardedWindow.Result = ForwardingResult::Forwarded;
+					hasPreviousBlockHash = true;
+					previousBlockHash = forwardedWindow.LastBlockHash;
+				}
+			}
+
+			void applyForwardedWindows(ForwardedWindows& forwardedWindows) {
+				m_isForwarding = false;
+				for (auto& forwardedWindow : forwardedWindows) {
+					auto& window = m_windows[forwardedWindow.WindowIndex];
+					switch (forwardedWindow.Result) {
+					case ForwardingResult::Unprocessed:
+						// windows following a window that could not be forwarded are forwarded later unless the round has ended
+						if (m_isDone) {
+							releaseWindow(window);
+						} else {
+							window.Ranges = std::move(forwardedWindow.Ranges);
+							window.Status = forwardedWindow.IsTerminal ? WindowStatus::Terminal : WindowStatus::Complete;
+						}
+						break;
+
+					case ForwardingResult::Empty:
+					case ForwardingResult::Forwarded:
+						releaseWindow(window);
+						if (ForwardingResult::Forwarded == forwardedWindow.Result) {
+							m_lastDeliveredBlockHash = forwardedWindow.LastBlockHash;
+							m_lastDeliveredBlockHeight = forwardedWindow.LastBlockHeight;
+							m_lastDeliveredPeerIndex = window.SourcePeerIndex;
+							m_hasLastDeliveredBlockHash = true;
+							m_hasAddedRange = true;
+							++m_peers[window.SourcePeerIndex].NumForwardedWindows;
+						}
+
+						++m_nextWindowIndex;
+						if (forwardedWindow.IsTerminal)
+							m_isDone = true;
+
+						break;
+
+					case ForwardingResult::Unlinked:
+						CATAPULT_LOG(warning)
+								<< "peer " << window.SourcePeerIndex << " returned blocks starting at height "
+								<< forwardedWindow.Ranges.front().cbegin()->Height << " that do not link to the previous window";
+
+						releaseWindow(window);
+						if (Compared_Peer_Index != window.SourcePeerIndex) {
+							excludePeer(window.SourcePeerIndex);
+							if (!m_isDone)
+								window.Status = WindowStatus::Pending;
+						} else {
+							// the compared chain does not link to the blocks forwarded from an additional peer
+							excludePeer(m_lastDeliveredPeerIndex);
+							m_isDone = true;
+						}
+
+						break;
+
+					case ForwardingResult::Rejected:
+						releaseWindow(window);
+						m_isDone = true;
+						break;
+					}
+				}
+
+				if (m_isDone || m_nextWindowIndex == m_windows.size())
+					finish();
+			}
+
+			void finish() {
+				m_isDone = true;
+
+				// release all buffered blocks that will never be forwarded
+				for (auto& window : m_windows) {
+					releaseWindow(window);
+					if (window.pDeferredAttempt) {
+						releaseAttempt(*window.pDeferredAttempt);
+						window.pDeferredAttempt.reset();
+					}
+				}
+			}
+
+			void assignIdlePeers(PullAttempts& attempts) {
+				for (auto i = m_nextWindowIndex; i < m_windows.size(); ++i) {
+					auto& window = m_windows[i];
+					if (WindowStatus::Pending != window.Status || 0 != window.NumActiveAttempts)
+						continue;
+
+					if (!canPull(i))
+						break;
+
+					// a partially pulled window is continued by the same peer as soon as it is idle
+					if (window.pDeferredAttempt) {
+						auto pAttempt = window.pDeferredAttempt;
+						if (m_peers[pAttempt->PeerIndex].IsBusy)
+							continue;
+
+						window.pDeferredAttempt.reset();
+						if (!m_peers[pAttempt->PeerIndex].IsExcluded) {
+							attempts.push_back(activateAttempt(pAttempt));
+							continue;
+						}
+
+						releaseAttempt(*pAttempt);
+					}
+
+					auto peerIndex = findFastestPeer(window, false);
+					if (m_peers.size() != peerIndex) {
+						attempts.push_back(createAttempt(i, peerIndex));
+						continue;
+					}
+
+					// the compared peer can pull any window, so the end of the chain can only become unknown when it failed
+					if (m_nextWindowIndex == i && m_peers.size() == findFastestPeer(window, true)) {
+						finish();
+						return;
+					}
+				}
+
+				if (m_nextWindowIndex == m_windows.size())
+					return;
+
+				// reassign the window blocking forwarding to an idle peer when it has been pending for longer than
+				// half of the time that peer needed on average for pulling a complete window
+				auto& window = m_windows[m_nextWindowIndex];
+				if (WindowStatus::Pending != window.Status || 1 != window.NumActiveAttempts)
+					return;
+
+				auto peerIndex = findFastestPeer(window, false);
+				if (m_peers.size() == peerIndex || 0 == m_peers[peerIndex].NumCompletedWindows)
+					return;
+
+				const auto& peer = m_peers[peerIndex];
+				auto averageWindowMillis = peer.NumMillis / peer.NumCompletedWindows;
+				if (window.pLastAttempt->Timer.millis() <= averageWindowMillis / 2)
+					return;
+
+				CATAPULT_LOG(debug)
+						<< "reassigning blocks starting at height " << window.StartHeight
+						<< " from peer " << window.pLastAttempt->PeerIndex << " to peer " << peerIndex;
+				attempts.push_back(createAttempt(m_nextWindowIndex, peerIndex));
+			}
+
+			size_t findFastestPeer(const BlocksWindow& window, bool includeBusyPeers) const {
+				auto bestPeerIndex = m_peers.size();
+				for (auto i = 0u; i < m_peers.size(); ++i) {
+					// the compared peer can be asked again for a window because its chain is authoritative
+					const auto& peer = m_peers[i];
+					auto isTried = Compared_Peer_Index != i && 0 != window.TriedPeerIndexes.count(i);
+					if (peer.IsExcluded || (peer.IsBusy && !includeBusyPeers) || isTried)
+						continue;
+
+					if (m_peers.size() == bestPeerIndex || isFaster(peer, m_peers[bestPeerIndex]))
+						bestPeerIndex = i;
+				}
+
+				return bestPeerIndex;
+			}
+
+			static bool isFaster(const PeerState& lhs, const PeerState& rhs) {
+				// compare throughputs (bytes per millisecond) without division
+				return lhs.NumBytes * (rhs.NumMillis + 1) > rhs.NumBytes * (lhs.NumMillis + 1);
+			}
+
+			NodeInteractionResult getInteractionResult(const PeerState& peer) const {
+				// an empty response is only bad when blocks at the same height were forwarded from another peer
+				auto hasHiddenBlocks = Height(0) != peer.EmptyResponseHeight
+						&& m_hasLastDeliveredBlockHash
+						&& peer.EmptyResponseHeight <= m_lastDeliveredBlockHeight;
+				if (peer.HasReturnedBadData || hasHiddenBlocks)
+					return NodeInteractionResult::Failure;
+
+				return 0 != peer.NumForwardedWindows ? NodeInteractionResult::Success : NodeInteractionResult::Neutral;
+			}
+
+			void complete() {
+				for (auto i = 0u; i < m_peers.size(); ++i) {
+					const auto& peer = m_peers[i];
+					CATAPULT_LOG(debug) << "peer " << i << " returned " << peer.NumBytes << " bytes in " << peer.NumMillis << "ms";
+
+					// the interaction with the compared peer is reported by the caller via the returned future
+					if (Compared_Peer_Index != i && peer.InteractionResultHandler)
+						peer.InteractionResultHandler(getInteractionResult(peer));
+				}
+
+				auto result = m_hasAddedRange
+						? NodeInteractionResult::Success
+						: m_hasPrimaryFailure ? NodeInteractionResult::Failure : NodeInteractionResult::Neutral;
+				m_promise.set_value(std::move(result));
+			}
+
+		private:
+			api::BlocksFromOptions m_options;
+			UnprocessedElements& m_unprocessedElements;
+			std::vector<PeerState> m_peers;
+			std::vector<BlocksWindow> m_windows;
+			size_t m_nextWindowIndex;
+			size_t m_numActiveAttempts;
+			uint64_t m_numBufferedBytes;
+			size_t m_numUnprocessedBytes;
+			Hash256 m_lastDeliveredBlockHash;
+			Height m_lastDeliveredBlockHeight;
+			bool m_hasLastDeliveredBlockHash;
+			size_t m_lastDeliveredPeerIndex;
+			bool m_hasAddedRange;
+			bool m_hasPrimaryFailure;
+			bool m_isDone;
+			bool m_isForwarding;
+			bool m_isPromiseSet;
+			thread::promise<NodeInteractionResult> m_promise;
+			utils::SpinLock m_spinLock;
+		};
+
+		// endregion
+
 		class DefaultChainSynchronizer {
 		public:
 			using RemoteApiType = api::RemoteChainApi;
@@ -227,10 +831,13 @@ namespace catapult { namespace chain {
 			explicit DefaultChainSynchronizer(
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
+					const RemoteChainApisSupplier& remoteChainApisSupplier,
 					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
 					: m_pLocalChainApi(pLocalChainApi)
 					, m_compareChainOptions(config.MaxBlocksPerSyncAttempt, config.MaxRollbackBlocks)
 					, m_blocksFromOptions(config.MaxBlocksPerSyncAttempt, config.MaxChainBytesPerSyncAttempt)
+					, m_maxParallelSyncPeers(config.MaxParallelSyncPeers)
+					, m_remoteChainApisSupplier(remoteChainApisSupplier)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
 							3 * config.MaxChainBytesPerSyncAttempt))
@@ -290,6 +897,22 @@ namespace catapult { namespace chain {
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ")";
+
+				// blocks can only be pulled from multiple peers when no rollback is required because
+				// a fork must be resolved with blocks from the peer with the compared chain
+				if (0 == compareResult.ForkDepth && m_maxParallelSyncPeers > 1 && m_remoteChainApisSupplier) {
+					auto additionalPeerChainApis = m_remoteChainApisSupplier(m_maxParallelSyncPeers - 1);
+					if (!additionalPeerChainApis.empty()) {
+						auto pPuller = std::make_shared<ParallelBlocksPuller>(
+								remoteChainApi,
+								additionalPeerChainApis,
+								compareResult.CommonBlockHeight + Height(1),
+								m_blocksFromOptions,
+								*m_pUnprocessedElements);
+						return pPuller->start();
+					}
+				}
+
 				return ChainBlocksFrom(
 						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
 						compareResult.CommonBlockHeight + Height(1),
@@ -302,6 +925,8 @@ namespace catapult { namespace chain {
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
+			uint32_t m_maxParallelSyncPeers;
+			RemoteChainApisSupplier m_remoteChainApisSupplier;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
 		};
 	}
@@ -310,7 +935,19 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
-		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer);
+		return CreateChainSynchronizer(pLocalChainApi, config, RemoteChainApisSupplier(), blockRangeConsumer);
+	}
+
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const RemoteChainApisSupplier& remoteChainApisSupplier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
+		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(
+				pLocalChainApi,
+				config,
+				remoteChainApisSupplier,
+				blockRangeConsumer);
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
 }}
@@ -41,6 +41,18 @@ namespace catapult { namespace chain {
 			model::BlockRange&&,
 			const disruptor::ProcessingCompleteFunc&)>;
 
+	/// Remote chain api around an additional peer.
+	struct AdditionalPeerChainApi {
+		/// Remote chain api.
+		std::shared_ptr<const api::RemoteChainApi> pRemoteChainApi;
+
+		/// Handler that is passed the result of the interaction with the peer.
+		consumer<NodeInteractionResult> InteractionResultHandler;
+	};
+
+	/// Function signature for supplying remote chain apis around (at most) the requested number of additional peers.
+	using RemoteChainApisSupplier = std::function<std::vector<AdditionalPeerChainApi> (size_t)>;
+
 	/// Configuration for customizing a chain synchronizer.
 	struct ChainSynchronizerConfiguration {
 		/// Maximum number of blocks per sync attempt.
@@ -51,6 +63,10 @@ namespace catapult { namespace chain {
 
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
+
+		/// Maximum number of peers (including the peer with the compared chain) from which blocks are pulled concurrently.
+		/// \note Values less than two disable parallel block pulling.
+		uint32_t MaxParallelSyncPeers;
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
@@ -59,4 +75,15 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
+
+	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config,
+	/// a supplier of additional peers (\a remoteChainApisSupplier) and a block range consumer (\a blockRangeConsumer).
+	/// \note When the local chain can be extended without a rollback, windows of blocks are pulled concurrently from
+	///       the compared peer and the additional peers. All pulled blocks are limited by the same byte budget as the
+	///       unprocessed blocks and only the compared peer can end the pulled chain.
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const RemoteChainApisSupplier& remoteChainApisSupplier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
 }}
@@ -40,12 +40,15 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(ShouldAllowAddressReuse);
 		LOAD_NODE_PROPERTY(ShouldUseSingleThreadPool);
 		LOAD_NODE_PROPERTY(ShouldUseCacheDatabaseStorage);
+		LOAD_NODE_PROPERTY(ShouldUsePackedBlockStorage);
+		LOAD_NODE_PROPERTY(StateCheckpointInterval);
 
 		LOAD_NODE_PROPERTY(ShouldEnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxParallelSyncPeers);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -55,6 +58,9 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
 
+		LOAD_NODE_PROPERTY(BlockStorageCacheMaxBlocks);
+		LOAD_NODE_PROPERTY(BlockStorageCacheMaxHashes);
+
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
 
@@ -66,6 +72,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(BlockElementTraceInterval);
 		LOAD_NODE_PROPERTY(TransactionDisruptorSize);
 		LOAD_NODE_PROPERTY(TransactionElementTraceInterval);
+		LOAD_NODE_PROPERTY(NumParallelTransactionConsumerWorkers);
 
 		LOAD_NODE_PROPERTY(ShouldAbortWhenDispatcherIsFull);
 		LOAD_NODE_PROPERTY(ShouldAuditDispatcherInputs);
@@ -75,6 +82,8 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(IncomingSecurityModes);
 
 		LOAD_NODE_PROPERTY(MaxCacheDatabaseWriteBatchSize);
+		LOAD_NODE_PROPERTY(PatriciaTreeNodeCacheMaxSize);
+		LOAD_NODE_PROPERTY(MaxStateMultiproofKeys);
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
 #undef LOAD_NODE_PROPERTY
@@ -107,10 +116,25 @@ namespace catapult { namespace config {
 
 #undef LOAD_IN_CONNECTIONS_PROPERTY
 
+#define LOAD_CACHE_DATABASE_PROPERTY(NAME) utils::LoadIniProperty(bag, "cache_database", #NAME, config.CacheDatabase.NAME)
+
+		LOAD_CACHE_DATABASE_PROPERTY(BlockCacheSize);
+		LOAD_CACHE_DATABASE_PROPERTY(BloomFilterBitsPerKey);
+		LOAD_CACHE_DATABASE_PROPERTY(ShouldPinIndexAndFilterBlocks);
+		LOAD_CACHE_DATABASE_PROPERTY(KeyPrefixSize);
+		LOAD_CACHE_DATABASE_PROPERTY(ShouldUseUniversalCompaction);
+		LOAD_CACHE_DATABASE_PROPERTY(WriteBufferSize);
+		LOAD_CACHE_DATABASE_PROPERTY(PatriciaTreeWriteBufferSize);
+		LOAD_CACHE_DATABASE_PROPERTY(MaxWriteBufferNumber);
+		LOAD_CACHE_DATABASE_PROPERTY(ShouldSyncWrites);
+		LOAD_CACHE_DATABASE_PROPERTY(ShouldEnableStatistics);
+
+#undef LOAD_CACHE_DATABASE_PROPERTY
+
 		auto extensionsPair = utils::ExtractSectionAsOrderedVector(bag, "extensions");
 		config.Extensions = extensionsPair.first;
 
-		utils::VerifyBagSizeLte(bag, 31 + 4 + 4 + 5 + extensionsPair.second);
+		utils::VerifyBagSizeLte(bag, 39 + 4 + 4 + 5 + 10 + extensionsPair.second);
 		return config;
 	}
 
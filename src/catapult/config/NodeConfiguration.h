@@ -47,6 +47,15 @@ namespace catapult { namespace config {
 		/// \c true if cache data should be saved in a database.
 		bool ShouldUseCacheDatabaseStorage;
 
+		/// \c true if blocks should be saved in packed (memory-mapped) block storage instead of one file per block.
+		/// \note Existing file-based block storage must be converted before enabling this setting.
+		bool ShouldUsePackedBlockStorage;
+
+		/// Number of blocks with journaled state changes between state checkpoints.
+		/// \note Zero disables incremental state checkpoints.
+		/// \note State changes are only journaled when cache database storage is disabled.
+		uint32_t StateCheckpointInterval;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool ShouldEnableTransactionSpamThrottling;
 
@@ -59,6 +68,10 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of peers (including the peer with the compared chain) from which blocks are pulled concurrently.
+		/// \note Values less than two disable parallel block pulling.
+		uint32_t MaxParallelSyncPeers;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -77,6 +90,12 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		uint32_t UnconfirmedTransactionsCacheMaxSize;
 
+		/// Maximum number of block elements cached in memory by the block storage cache.
+		uint32_t BlockStorageCacheMaxBlocks;
+
+		/// Maximum number of (most recent) block hashes cached in memory by the block storage cache.
+		uint32_t BlockStorageCacheMaxHashes;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -105,6 +124,10 @@ namespace catapult { namespace config {
 		/// Multiple of elements at which a transaction element should be traced through queue and completion.
 		uint32_t TransactionElementTraceInterval;
 
+		/// Number of workers executing each parallel transaction dispatcher consumer (e.g. the hash calculator).
+		/// \note Values less than one are treated as one.
+		uint32_t NumParallelTransactionConsumerWorkers;
+
 		/// \c true if the process should terminate when any dispatcher is full.
 		bool ShouldAbortWhenDispatcherIsFull;
 
@@ -123,6 +146,12 @@ namespace catapult { namespace config {
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
 
+		/// Maximum number of decoded patricia tree nodes cached in memory (\c 0 disables the cache).
+		uint32_t PatriciaTreeNodeCacheMaxSize;
+
+		/// Maximum number of keys in a state multiproof request.
+		uint32_t MaxStateMultiproofKeys;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -179,6 +208,44 @@ namespace catapult { namespace config {
 		/// Incoming connections configuration.
 		IncomingConnectionsSubConfiguration IncomingConnections;
 
+	public:
+		/// Cache database configuration.
+		struct CacheDatabaseSubConfiguration {
+			/// Size of the block cache shared by all cache databases (\c 0 uses a default block cache per database).
+			utils::FileSize BlockCacheSize;
+
+			/// Number of bloom filter bits per key (\c 0 disables bloom filters).
+			uint32_t BloomFilterBitsPerKey;
+
+			/// \c true if index and filter blocks should be stored in (and pinned by) the block cache.
+			bool ShouldPinIndexAndFilterBlocks;
+
+			/// Size of fixed width key prefixes used for prefix bloom filters (\c 0 disables prefix extraction).
+			uint32_t KeyPrefixSize;
+
+			/// \c true if universal compaction should be used instead of level compaction.
+			bool ShouldUseUniversalCompaction;
+
+			/// Write buffer size of primary cache columns (\c 0 uses the default).
+			utils::FileSize WriteBufferSize;
+
+			/// Write buffer size of patricia tree columns (\c 0 uses the default).
+			utils::FileSize PatriciaTreeWriteBufferSize;
+
+			/// Maximum number of write buffers per column (\c 0 uses the default).
+			uint32_t MaxWriteBufferNumber;
+
+			/// \c true if the write ahead log should be synced when writes are flushed.
+			bool ShouldSyncWrites;
+
+			/// \c true if database statistics should be collected.
+			bool ShouldEnableStatistics;
+		};
+
+	public:
+		/// Cache database configuration.
+		CacheDatabaseSubConfiguration CacheDatabase;
+
 	private:
 		NodeConfiguration() = default;
 
@@ -22,9 +22,13 @@
 #include "InputUtils.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/chain/ChainResults.h"
 #include "catapult/chain/ChainUtils.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_set>
 
 using namespace catapult::validators;
 
@@ -56,9 +60,11 @@ namespace catapult { namespace consumers {
 		public:
 			DefaultBlockChainProcessor(
 					const BlockHitPredicateFactory& blockHitPredicateFactory,
-					const chain::BatchEntityProcessor& batchEntityProcessor)
+					const chain::BatchEntityProcessor& batchEntityProcessor,
+					const BlockChainPrefetcher& prefetcher)
 					: m_blockHitPredicateFactory(blockHitPredicateFactory)
 					, m_batchEntityProcessor(batchEntityProcessor)
+					, m_prefetcher(prefetcher)
 			{}
 
 		public:
@@ -81,6 +87,10 @@ namespace catapult { namespace consumers {
 				// initial cache state will be either last cache state or unwound cache state
 				LogCacheStateHashInformation(pParent->Height, state.Cache.calculateStateHash(pParent->Height));
 
+				// prefetch the state of all blocks at once so that it is loaded with as few storage lookups as possible
+				if (m_prefetcher)
+					m_prefetcher(elements, state.Cache);
+
 				for (auto& element : elements) {
 					const auto& block = element.Block;
 					element.GenerationHash = model::CalculateGenerationHash(*pParentGenerationHash, block.Signer);
@@ -118,12 +128,42 @@ namespace catapult { namespace consumers {
 		private:
 			BlockHitPredicateFactory m_blockHitPredicateFactory;
 			chain::BatchEntityProcessor m_batchEntityProcessor;
+			BlockChainPrefetcher m_prefetcher;
+		};
+	}
+
+	BlockChainPrefetcher CreateAccountStatePrefetcher() {
+		return [](const auto& elements, auto& cacheDelta) {
+			auto& accountStateCacheDelta = cacheDelta.template sub<cache::AccountStateCache>();
+			auto networkIdentifier = accountStateCacheDelta.networkIdentifier();
+
+			model::AddressSet addresses;
+			std::unordered_set<Key, utils::ArrayHasher<Key>> publicKeys;
+			auto addPublicKey = [networkIdentifier, &addresses, &publicKeys](const auto& publicKey) {
+				publicKeys.insert(publicKey);
+				addresses.insert(model::PublicKeyToAddress(publicKey, networkIdentifier));
+			};
+
+			for (const auto& element : elements) {
+				addPublicKey(element.Block.Signer);
+				for (const auto& transactionElement : element.Transactions) {
+					addPublicKey(transactionElement.Transaction.Signer);
+					if (transactionElement.OptionalExtractedAddresses) {
+						const auto& extractedAddresses = *transactionElement.OptionalExtractedAddresses;
+						addresses.insert(extractedAddresses.cbegin(), extractedAddresses.cend());
+					}
+				}
+			}
+
+			accountStateCacheDelta.prefetch(std::vector<Key>(publicKeys.cbegin(), publicKeys.cend()));
+			accountStateCacheDelta.prefetch(std::vector<Address>(addresses.cbegin(), addresses.cend()));
 		};
 	}
 
 	BlockChainProcessor CreateBlockChainProcessor(
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
-			const chain::BatchEntityProcessor& batchEntityProcessor) {
-		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor);
+			const chain::BatchEntityProcessor& batchEntityProcessor,
+			const BlockChainPrefetcher& prefetcher) {
+		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, prefetcher);
 	}
 }}
@@ -25,7 +25,10 @@
 #include <functional>
 
 namespace catapult {
-	namespace cache { class ReadOnlyCatapultCache; }
+	namespace cache {
+		class CatapultCacheDelta;
+		class ReadOnlyCatapultCache;
+	}
 	namespace chain { struct ObserverState; }
 }
 
@@ -67,9 +70,17 @@ namespace catapult { namespace consumers {
 	/// A factory for creating a predicate for determining whether or not two blocks form a hit.
 	using BlockHitPredicateFactory = std::function<BlockHitPredicate (const cache::ReadOnlyCatapultCache&)>;
 
-	/// Creates a block chain processor around the specified block hit predicate factory (\a blockHitPredicateFactory)
-	/// and batch entity processor (\a batchEntityProcessor).
+	/// Function signature for prefetching the cache state needed to process block elements into a cache delta.
+	using BlockChainPrefetcher = consumer<const disruptor::BlockElements&, cache::CatapultCacheDelta&>;
+
+	/// Creates a block chain prefetcher that prefetches the account states of all block signers, transaction signers
+	/// and (previously) extracted transaction addresses.
+	BlockChainPrefetcher CreateAccountStatePrefetcher();
+
+	/// Creates a block chain processor around the specified block hit predicate factory (\a blockHitPredicateFactory),
+	/// batch entity processor (\a batchEntityProcessor) and optional \a prefetcher.
 	BlockChainProcessor CreateBlockChainProcessor(
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
-			const chain::BatchEntityProcessor& batchEntityProcessor);
+			const chain::BatchEntityProcessor& batchEntityProcessor,
+			const BlockChainPrefetcher& prefetcher = BlockChainPrefetcher());
 }}
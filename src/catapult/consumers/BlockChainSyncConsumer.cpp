@@ -77,6 +77,10 @@ namespace catapult { namespace consumers {
 				return *m_pCacheDelta;
 			}
 
+			const state::CatapultState& state() const {
+				return m_stateCopy;
+			}
+
 		public:
 			TransactionInfos detachRemovedTransactionInfos() {
 				return std::move(m_removedTransactionInfos);
@@ -254,7 +258,7 @@ namespace catapult { namespace consumers {
 				commitToStorage(syncState.commonBlockHeight(), elements);
 
 				// 2. indicate a state change
-				m_handlers.StateChange(StateChangeInfo(syncState.cacheDelta(), syncState.scoreDelta(), newHeight));
+				m_handlers.StateChange(StateChangeInfo(syncState.cacheDelta(), syncState.scoreDelta(), syncState.state(), newHeight));
 
 				// 3. commit changes to the in-memory cache
 				syncState.commit(newHeight);
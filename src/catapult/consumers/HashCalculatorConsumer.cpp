@@ -39,17 +39,26 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// note that disruptor input elements have been extracted from a packet (or created within this
+				// process), so their sizes have already been validated
 				for (auto& element : elements) {
-					// note that disruptor input elements have been extracted from a packet (or created within this
-					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
+				}
+
+				// calculate the hashes of all transactions in all blocks together
+				std::vector<model::TransactionElement*> transactionElements;
+				for (auto& element : elements) {
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+				}
 
+				model::UpdateHashes(m_transactionRegistry, transactionElements);
+
+				for (auto& element : elements) {
+					crypto::MerkleHashBuilder transactionsHashBuilder(element.Transactions.size());
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
@@ -83,8 +92,12 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				std::vector<model::TransactionElement*> transactionElements;
+				transactionElements.reserve(elements.size());
 				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, element);
+					transactionElements.push_back(&element);
+
+				model::UpdateHashes(m_transactionRegistry, transactionElements);
 
 				return Continue();
 			}
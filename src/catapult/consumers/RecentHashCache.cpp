@@ -19,19 +19,163 @@
 **/
 
 #include "RecentHashCache.h"
-#include "catapult/utils/ContainerHelpers.h"
 #include "catapult/utils/Logging.h"
+#include <algorithm>
+#include <cstring>
 
 namespace catapult { namespace consumers {
 
+	namespace {
+		// number of buckets spanning the cache duration (more buckets allow finer grained bucket drops but require more lookups)
+		constexpr uint64_t Num_Buckets_Per_Cache_Duration = 8;
+
+		constexpr size_t Initial_Bucket_Capacity = 16;
+
+		uint64_t GetTag(const Hash256& hash) {
+			// hashes are uniformly distributed, so any eight bytes are a good short hash (zero is reserved for empty slots)
+			uint64_t tag;
+			std::memcpy(&tag, hash.data(), sizeof(uint64_t));
+			return 0 == tag ? 1 : tag;
+		}
+	}
+
+	// region TimeBucket
+
+	RecentHashCache::TimeBucket::TimeBucket(uint64_t id)
+			: m_id(id)
+			, m_size(0)
+			, m_tags(Initial_Bucket_Capacity, 0)
+			, m_entries(Initial_Bucket_Capacity)
+	{}
+
+	uint64_t RecentHashCache::TimeBucket::id() const {
+		return m_id;
+	}
+
+	size_t RecentHashCache::TimeBucket::size() const {
+		return m_size;
+	}
+
+	Timestamp RecentHashCache::TimeBucket::maxTime() const {
+		return m_maxTime;
+	}
+
+	bool RecentHashCache::TimeBucket::contains(const Hash256& hash) const {
+		return m_tags.size() != findSlot(hash, GetTag(hash));
+	}
+
+	void RecentHashCache::TimeBucket::insert(const Hash256& hash, const Timestamp& time) {
+		// keep load factor at most 1/2 so that probe sequences stay short
+		if (2 * (m_size + 1) > m_tags.size())
+			rehash(2 * m_tags.size());
+
+		insertEntry({ hash, time }, GetTag(hash));
+		m_maxTime = std::max(m_maxTime, time);
+		++m_size;
+	}
+
+	bool RecentHashCache::TimeBucket::remove(const Hash256& hash) {
+		auto slot = findSlot(hash, GetTag(hash));
+		if (m_tags.size() == slot)
+			return false;
+
+		eraseSlot(slot);
+		--m_size;
+		return true;
+	}
+
+	size_t RecentHashCache::TimeBucket::removeExpired(const Timestamp& time, uint64_t duration) {
+		std::vector<Entry> entries;
+		entries.reserve(m_size);
+		for (auto i = 0u; i < m_tags.size(); ++i) {
+			if (0 != m_tags[i] && !(m_entries[i].Time + Timestamp(duration) < time))
+				entries.push_back(m_entries[i]);
+		}
+
+		auto numRemoved = m_size - entries.size();
+		if (0 == numRemoved)
+			return 0;
+
+		std::fill(m_tags.begin(), m_tags.end(), 0);
+		for (const auto& entry : entries)
+			insertEntry(entry, GetTag(entry.Hash));
+
+		m_size = entries.size();
+		return numRemoved;
+	}
+
+	size_t RecentHashCache::TimeBucket::findSlot(const Hash256& hash, uint64_t tag) const {
+		auto mask = m_tags.size() - 1;
+		for (auto slot = tag & mask; 0 != m_tags[slot]; slot = (slot + 1) & mask) {
+			// only compare full hashes when short hashes match
+			if (tag == m_tags[slot] && hash == m_entries[slot].Hash)
+				return slot;
+		}
+
+		return m_tags.size();
+	}
+
+	void RecentHashCache::TimeBucket::insertEntry(const Entry& entry, uint64_t tag) {
+		auto mask = m_tags.size() - 1;
+		auto slot = tag & mask;
+		while (0 != m_tags[slot])
+			slot = (slot + 1) & mask;
+
+		m_tags[slot] = tag;
+		m_entries[slot] = entry;
+	}
+
+	void RecentHashCache::TimeBucket::eraseSlot(size_t slot) {
+		// shift subsequent entries of the probe sequence backwards instead of leaving tombstones
+		auto mask = m_tags.size() - 1;
+		auto nextSlot = slot;
+		for (;;) {
+			nextSlot = (nextSlot + 1) & mask;
+			if (0 == m_tags[nextSlot])
+				break;
+
+			// entry can be moved into the free slot unless its home slot lies cyclically within (slot, nextSlot]
+			auto homeSlot = m_tags[nextSlot] & mask;
+			auto isHomeInRange = slot < nextSlot
+					? slot < homeSlot && homeSlot <= nextSlot
+					: slot < homeSlot || homeSlot <= nextSlot;
+			if (isHomeInRange)
+				continue;
+
+			m_tags[slot] = m_tags[nextSlot];
+			m_entries[slot] = m_entries[nextSlot];
+			slot = nextSlot;
+		}
+
+		m_tags[slot] = 0;
+	}
+
+	void RecentHashCache::TimeBucket::rehash(size_t capacity) {
+		std::vector<uint64_t> tags(capacity, 0);
+		std::vector<Entry> entries(capacity);
+		tags.swap(m_tags);
+		entries.swap(m_entries);
+
+		for (auto i = 0u; i < tags.size(); ++i) {
+			if (0 != tags[i])
+				insertEntry(entries[i], tags[i]);
+		}
+	}
+
+	// endregion
+
+	// region RecentHashCache
+
 	RecentHashCache::RecentHashCache(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options)
 			: m_timeSupplier(timeSupplier)
 			, m_options(options)
+			, m_bucketDuration(std::max<uint64_t>(1, options.CacheDuration / Num_Buckets_Per_Cache_Duration))
 			, m_lastPruneTime(m_timeSupplier())
+			, m_size(0)
 	{}
 
 	size_t RecentHashCache::size() const {
-		return m_cache.size();
+		return m_size;
 	}
 
 	bool RecentHashCache::add(const Hash256& hash) {
@@ -46,13 +190,19 @@ namespace catapult { namespace consumers {
 	}
 
 	bool RecentHashCache::contains(const Hash256& hash) const {
-		return m_cache.cend() != m_cache.find(hash);
+		// search newest buckets first because recently seen hashes are most likely to be seen again
+		return std::any_of(m_buckets.crbegin(), m_buckets.crend(), [&hash](const auto& bucket) {
+			return bucket.contains(hash);
+		});
 	}
 
 	bool RecentHashCache::checkAndUpdateExisting(const Hash256& hash, const Timestamp& time) {
-		auto iter = m_cache.find(hash);
-		if (m_cache.end() != iter) {
-			iter->second = time;
+		for (auto iter = m_buckets.rbegin(); m_buckets.rend() != iter; ++iter) {
+			if (!iter->remove(hash))
+				continue;
+
+			// move the hash into the current bucket so that it expires relative to time
+			currentBucket(time).insert(hash, time);
 			return true;
 		}
 
@@ -64,18 +214,38 @@ namespace catapult { namespace consumers {
 			return;
 
 		m_lastPruneTime = time;
-		utils::map_erase_if(m_cache, [duration = m_options.CacheDuration, time](const auto& pair) {
-			return pair.second + Timestamp(duration) < time;
-		});
+
+		// 1. drop all buckets that only contain expired hashes
+		auto duration = Timestamp(m_options.CacheDuration);
+		while (!m_buckets.empty() && m_buckets.front().maxTime() + duration < time) {
+			m_size -= m_buckets.front().size();
+			m_buckets.pop_front();
+		}
+
+		// 2. the oldest remaining bucket can contain some expired hashes, but all hashes in newer buckets are unexpired
+		if (!m_buckets.empty())
+			m_size -= m_buckets.front().removeExpired(time, m_options.CacheDuration);
 	}
 
 	void RecentHashCache::tryAddToCache(const Hash256& hash, const Timestamp& time) {
 		// only add the hash if the cache is not full
-		if (m_options.MaxCacheSize <= m_cache.size())
+		if (m_options.MaxCacheSize <= m_size)
 			return;
 
-		m_cache.emplace(hash, time);
-		if (m_options.MaxCacheSize == m_cache.size())
+		currentBucket(time).insert(hash, time);
+		++m_size;
+		if (m_options.MaxCacheSize == m_size)
 			CATAPULT_LOG(warning) << "short lived hash check cache is full";
 	}
+
+	RecentHashCache::TimeBucket& RecentHashCache::currentBucket(const Timestamp& time) {
+		// if time moves backwards, hashes are added to the newest bucket, which tracks its maximum time explicitly
+		auto bucketId = time.unwrap() / m_bucketDuration;
+		if (m_buckets.empty() || m_buckets.back().id() < bucketId)
+			m_buckets.emplace_back(bucketId);
+
+		return m_buckets.back();
+	}
+
+	// endregion
 }}
@@ -21,13 +21,14 @@
 #pragma once
 #include "HashCheckOptions.h"
 #include "catapult/chain/ChainFunctions.h"
-#include "catapult/utils/Hashers.h"
 #include "catapult/types.h"
-#include <unordered_map>
+#include <deque>
+#include <vector>
 
 namespace catapult { namespace consumers {
 
 	/// A hash cache that holds recently seen hashes.
+	/// \note Hashes are grouped into time buckets so that expired hashes can be pruned by dropping whole buckets.
 	class RecentHashCache {
 	public:
 		/// Creates a recent hash cache around \a timeSupplier and \a options.
@@ -45,6 +46,43 @@ namespace catapult { namespace consumers {
 		/// Returns \c true if the cache contains \a hash, \c false otherwise.
 		bool contains(const Hash256& hash) const;
 
+	private:
+		// open addressing (linear probing) set of hashes last seen within a single time interval
+		class TimeBucket {
+		public:
+			explicit TimeBucket(uint64_t id);
+
+		public:
+			uint64_t id() const;
+			size_t size() const;
+			Timestamp maxTime() const;
+
+		public:
+			bool contains(const Hash256& hash) const;
+			void insert(const Hash256& hash, const Timestamp& time);
+			bool remove(const Hash256& hash);
+			size_t removeExpired(const Timestamp& time, uint64_t duration);
+
+		private:
+			struct Entry {
+				Hash256 Hash;
+				Timestamp Time;
+			};
+
+		private:
+			size_t findSlot(const Hash256& hash, uint64_t tag) const;
+			void insertEntry(const Entry& entry, uint64_t tag);
+			void eraseSlot(size_t slot);
+			void rehash(size_t capacity);
+
+		private:
+			uint64_t m_id;
+			Timestamp m_maxTime;
+			size_t m_size;
+			std::vector<uint64_t> m_tags; // short hashes of occupied slots, zero for empty slots
+			std::vector<Entry> m_entries;
+		};
+
 	private:
 		bool checkAndUpdateExisting(const Hash256& hash, const Timestamp& time);
 
@@ -52,10 +90,14 @@ namespace catapult { namespace consumers {
 
 		void tryAddToCache(const Hash256& hash, const Timestamp& time);
 
+		TimeBucket& currentBucket(const Timestamp& time);
+
 	private:
 		chain::TimeSupplier m_timeSupplier;
 		HashCheckOptions m_options;
+		uint64_t m_bucketDuration;
 		Timestamp m_lastPruneTime;
-		std::unordered_map<Hash256, Timestamp, utils::ArrayHasher<Hash256>> m_cache;
+		size_t m_size;
+		std::deque<TimeBucket> m_buckets; // ordered from oldest to newest
 	};
 }}
@@ -24,6 +24,7 @@
 namespace catapult {
 	namespace cache { class CatapultCacheDelta; }
 	namespace model { class ChainScore; }
+	namespace state { struct CatapultState; }
 }
 
 namespace catapult { namespace consumers {
@@ -31,10 +32,15 @@ namespace catapult { namespace consumers {
 	/// State change information.
 	struct StateChangeInfo {
 	public:
-		/// Creates a new state change info around \a cacheDelta, \a scoreDelta and \a height.
-		StateChangeInfo(const cache::CatapultCacheDelta& cacheDelta, const model::ChainScore& scoreDelta, Height height)
+		/// Creates a new state change info around \a cacheDelta, \a scoreDelta, \a state and \a height.
+		StateChangeInfo(
+				const cache::CatapultCacheDelta& cacheDelta,
+				const model::ChainScore& scoreDelta,
+				const state::CatapultState& state,
+				Height height)
 				: CacheDelta(cacheDelta)
 				, ScoreDelta(scoreDelta)
+				, State(state)
 				, Height(height)
 		{}
 
@@ -45,6 +51,9 @@ namespace catapult { namespace consumers {
 		/// Chain score delta.
 		const model::ChainScore& ScoreDelta;
 
+		/// New catapult state (uncommitted).
+		const state::CatapultState& State;
+
 		/// New chain height.
 		const catapult::Height Height;
 	};
@@ -32,6 +32,15 @@ namespace catapult { namespace crypto {
 	/// Calculates the 512-bit SHA3 hash of \a dataBuffer into \a hash.
 	void Sha3_512(const RawBuffer& dataBuffer, Hash512& hash) noexcept;
 
+	/// Calculates the 256-bit SHA3 hashes of all \a count buffers pointed to by \a pDataBuffers into \a pHashes.
+	/// \note Multiple messages are hashed at once in vector lanes when supported by the cpu.
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count) noexcept;
+
+	/// Calculates the 256-bit SHA3 hashes of \a count messages into \a pHashes, where each message is composed of
+	/// \a numPartsPerMessage consecutive buffers pointed to by \a pDataBuffers.
+	/// \note Multiple messages are hashed at once in vector lanes when supported by the cpu.
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, size_t numPartsPerMessage, Hash256* pHashes, size_t count) noexcept;
+
 	/// Wraps 256-bit sha3 into an object.
 	class alignas(32) Sha3_256_Builder {
 	public:
@@ -21,6 +21,7 @@
 #include "MerkleHashBuilder.h"
 #include "Hashes.h"
 #include "catapult/functions.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
@@ -35,30 +36,34 @@ namespace catapult { namespace crypto {
 			// build the merkle tree
 			auto numRemainingHashes = hashes.size();
 			hashConsumer(hashes.data(), hashes.size());
+
+			std::vector<RawBuffer> pairBuffers;
+			std::vector<Hash256> levelHashes;
 			while (numRemainingHashes > 1) {
 				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
 				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
-				if (1 == numRemainingHashes % 2)
+				if (1 == numRemainingHashes % 2) {
+					// if there is an odd number of hashes, duplicate the last one
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
+					if (hashes.size() == numRemainingHashes)
+						hashes.push_back(hashes[numRemainingHashes - 1]);
+					else
+						hashes[numRemainingHashes] = hashes[numRemainingHashes - 1];
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256_Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
-					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
 					++numRemainingHashes;
 				}
 
+				// all (adjacent) pairs of hashes on the current level are hashed together at once
+				pairBuffers.clear();
+				for (auto i = 0u; i < numRemainingHashes; i += 2)
+					pairBuffers.push_back({ hashes[i].data(), 2 * Hash256_Size });
+
 				numRemainingHashes /= 2;
+				levelHashes.resize(numRemainingHashes);
+				Sha3_256_Multi(pairBuffers.data(), levelHashes.data(), numRemainingHashes);
+
+				std::copy(levelHashes.cbegin(), levelHashes.cend(), hashes.begin());
+				hashConsumer(hashes.data(), numRemainingHashes);
 			}
 
 			return hashes[0];
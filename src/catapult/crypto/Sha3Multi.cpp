@@ -0,0 +1,338 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Hashes.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CATAPULT_SHA3_MULTI_X86
+#define CATAPULT_SHA3_ALWAYS_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		constexpr size_t Sha3_256_Rate = 136;
+		constexpr size_t Num_Rate_Words = Sha3_256_Rate / sizeof(uint64_t);
+		constexpr size_t Num_State_Words = 25;
+
+		// maximum number of messages that are sorted by length and grouped into lanes at once
+		constexpr size_t Window_Size = 64;
+
+#ifdef SIGNATURE_SCHEME_NIS1
+		constexpr uint8_t Domain_Suffix = 0x01;
+#else
+		constexpr uint8_t Domain_Suffix = 0x06;
+#endif
+
+		// region MessageReader
+
+		// reads a (possibly fragmented) message one padded rate-sized block at a time
+		class MessageReader {
+		public:
+			MessageReader() : MessageReader(nullptr, 0)
+			{}
+
+			MessageReader(const RawBuffer* pParts, size_t numParts)
+					: m_pParts(pParts)
+					, m_numParts(numParts)
+					, m_partIndex(0)
+					, m_partOffset(0)
+					, m_size(0) {
+				for (auto i = 0u; i < m_numParts; ++i)
+					m_size += m_pParts[i].Size;
+			}
+
+		public:
+			size_t numBlocks() const {
+				// the final block always contains at least one byte of padding
+				return m_size / Sha3_256_Rate + 1;
+			}
+
+			void readBlock(uint8_t* pBlock) {
+				size_t numBytesRead = 0;
+				while (numBytesRead < Sha3_256_Rate && m_partIndex < m_numParts) {
+					const auto& part = m_pParts[m_partIndex];
+					auto numBytesToCopy = std::min(Sha3_256_Rate - numBytesRead, part.Size - m_partOffset);
+					if (0 != numBytesToCopy)
+						std::memcpy(pBlock + numBytesRead, part.pData + m_partOffset, numBytesToCopy);
+
+					numBytesRead += numBytesToCopy;
+					m_partOffset += numBytesToCopy;
+					if (part.Size == m_partOffset) {
+						++m_partIndex;
+						m_partOffset = 0;
+					}
+				}
+
+				if (Sha3_256_Rate == numBytesRead)
+					return;
+
+				std::memset(pBlock + numBytesRead, 0, Sha3_256_Rate - numBytesRead);
+				pBlock[numBytesRead] ^= Domain_Suffix;
+				pBlock[Sha3_256_Rate - 1] ^= 0x80;
+			}
+
+		private:
+			const RawBuffer* m_pParts;
+			size_t m_numParts;
+			size_t m_partIndex;
+			size_t m_partOffset;
+			size_t m_size;
+		};
+
+		// endregion
+
+		// region scalar
+
+		void HashSerial(const RawBuffer* pDataBuffers, size_t numPartsPerMessage, Hash256* pHashes, size_t count) noexcept {
+			for (auto i = 0u; i < count; ++i) {
+				Sha3_256_Builder builder;
+				for (auto j = 0u; j < numPartsPerMessage; ++j)
+					builder.update(pDataBuffers[i * numPartsPerMessage + j]);
+
+				builder.final(pHashes[i]);
+			}
+		}
+
+		// endregion
+
+#ifdef CATAPULT_SHA3_MULTI_X86
+
+		// region lane-parallel keccak-f[1600]
+
+		// each state word holds the corresponding word of NumLanes independent keccak states
+		using Lanes4 = uint64_t __attribute__((vector_size(32)));
+		using Lanes8 = uint64_t __attribute__((vector_size(64)));
+
+		constexpr uint64_t Round_Constants[] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// notice that vectors are never passed by value in order to avoid target dependent abi differences
+		template<int Shift, typename TLanes>
+		CATAPULT_SHA3_ALWAYS_INLINE void Rotate(TLanes& result, const TLanes& lanes) {
+			result = (lanes << Shift) | (lanes >> (64 - Shift));
+		}
+
+		template<typename TLanes>
+		CATAPULT_SHA3_ALWAYS_INLINE void Permute(TLanes* A) {
+			TLanes C[5];
+			TLanes D[5];
+			TLanes B[25];
+			for (auto round = 0u; round < 24; ++round) {
+				// theta
+				for (auto x = 0u; x < 5; ++x)
+					C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+
+				for (auto x = 0u; x < 5; ++x) {
+					Rotate<1>(D[x], C[(x + 1) % 5]);
+					D[x] ^= C[(x + 4) % 5];
+				}
+
+				for (auto i = 0u; i < 25; ++i)
+					A[i] ^= D[i % 5];
+
+				// rho and pi (B[y, 2x + 3y] = ROT(A[x, y], r[x, y]))
+				B[0] = A[0];
+				Rotate<1>(B[10], A[1]);
+				Rotate<62>(B[20], A[2]);
+				Rotate<28>(B[5], A[3]);
+				Rotate<27>(B[15], A[4]);
+				Rotate<36>(B[16], A[5]);
+				Rotate<44>(B[1], A[6]);
+				Rotate<6>(B[11], A[7]);
+				Rotate<55>(B[21], A[8]);
+				Rotate<20>(B[6], A[9]);
+				Rotate<3>(B[7], A[10]);
+				Rotate<10>(B[17], A[11]);
+				Rotate<43>(B[2], A[12]);
+				Rotate<25>(B[12], A[13]);
+				Rotate<39>(B[22], A[14]);
+				Rotate<41>(B[23], A[15]);
+				Rotate<45>(B[8], A[16]);
+				Rotate<15>(B[18], A[17]);
+				Rotate<21>(B[3], A[18]);
+				Rotate<8>(B[13], A[19]);
+				Rotate<18>(B[14], A[20]);
+				Rotate<2>(B[24], A[21]);
+				Rotate<61>(B[9], A[22]);
+				Rotate<56>(B[19], A[23]);
+				Rotate<14>(B[4], A[24]);
+
+				// chi
+				for (auto y = 0u; y < 25; y += 5) {
+					for (auto x = 0u; x < 5; ++x)
+						A[y + x] = B[y + x] ^ (~B[y + (x + 1) % 5] & B[y + (x + 2) % 5]);
+				}
+
+				// iota
+				A[0] ^= Round_Constants[round];
+			}
+		}
+
+		template<typename TLanes, size_t NumLanes>
+		CATAPULT_SHA3_ALWAYS_INLINE void HashLanes(MessageReader* pReaders, Hash256** ppHashes) {
+			TLanes state[Num_State_Words];
+			std::memset(state, 0, sizeof(state));
+
+			size_t numBlocks[NumLanes];
+			size_t maxNumBlocks = 0;
+			for (auto lane = 0u; lane < NumLanes; ++lane) {
+				numBlocks[lane] = pReaders[lane].numBlocks();
+				maxNumBlocks = std::max(maxNumBlocks, numBlocks[lane]);
+			}
+
+			for (auto blockIndex = 0u; blockIndex < maxNumBlocks; ++blockIndex) {
+				// absorb the next block of every message that is still being processed
+				// (notice that keccak words are little endian, which matches all supported x86 targets)
+				uint64_t words[NumLanes][Num_Rate_Words];
+				for (auto lane = 0u; lane < NumLanes; ++lane) {
+					if (blockIndex < numBlocks[lane])
+						pReaders[lane].readBlock(reinterpret_cast<uint8_t*>(words[lane]));
+					else
+						std::memset(words[lane], 0, sizeof(words[lane]));
+				}
+
+				for (auto i = 0u; i < Num_Rate_Words; ++i) {
+					TLanes blockWords;
+					for (auto lane = 0u; lane < NumLanes; ++lane)
+						blockWords[lane] = words[lane][i];
+
+					state[i] ^= blockWords;
+				}
+
+				Permute(state);
+
+				// squeeze the hashes of all messages that have been fully absorbed
+				for (auto lane = 0u; lane < NumLanes; ++lane) {
+					if (blockIndex + 1 != numBlocks[lane] || !ppHashes[lane])
+						continue;
+
+					uint64_t hashWords[Hash256_Size / sizeof(uint64_t)];
+					for (auto i = 0u; i < CountOf(hashWords); ++i)
+						hashWords[i] = state[i][lane];
+
+					std::memcpy(ppHashes[lane]->data(), hashWords, Hash256_Size);
+				}
+			}
+		}
+
+		__attribute__((target("avx2")))
+		void HashLanesAvx2(MessageReader* pReaders, Hash256** ppHashes) {
+			HashLanes<Lanes4, 4>(pReaders, ppHashes);
+		}
+
+		__attribute__((target("avx512f")))
+		void HashLanesAvx512(MessageReader* pReaders, Hash256** ppHashes) {
+			HashLanes<Lanes8, 8>(pReaders, ppHashes);
+		}
+
+		// endregion
+
+		// region HashParallel
+
+		using HashLanesFunc = void (*)(MessageReader*, Hash256**);
+
+		struct LanesKernel {
+			HashLanesFunc HashLanes;
+			size_t NumLanes;
+		};
+
+		LanesKernel SelectKernel() {
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx512f"))
+				return { HashLanesAvx512, 8 };
+
+			if (__builtin_cpu_supports("avx2"))
+				return { HashLanesAvx2, 4 };
+
+			return { nullptr, 1 };
+		}
+
+		const LanesKernel& GetKernel() {
+			static const LanesKernel kernel = SelectKernel();
+			return kernel;
+		}
+
+		void HashWindow(
+				const LanesKernel& kernel,
+				const RawBuffer* pDataBuffers,
+				size_t numPartsPerMessage,
+				Hash256* pHashes,
+				size_t count) noexcept {
+			// group messages with similar lengths into the same lanes to minimize the number of wasted permutations
+			std::array<MessageReader, Window_Size> readers;
+			std::array<size_t, Window_Size> messageIndexes;
+			for (auto i = 0u; i < count; ++i) {
+				readers[i] = MessageReader(pDataBuffers + i * numPartsPerMessage, numPartsPerMessage);
+				messageIndexes[i] = i;
+			}
+
+			std::stable_sort(messageIndexes.begin(), messageIndexes.begin() + static_cast<std::ptrdiff_t>(count), [&readers](auto lhs, auto rhs) {
+				return readers[lhs].numBlocks() < readers[rhs].numBlocks();
+			});
+
+			for (auto i = 0u; i < count; i += kernel.NumLanes) {
+				// unused lanes process empty messages and their hashes are discarded
+				MessageReader laneReaders[8];
+				Hash256* laneHashes[8] = {};
+				for (auto lane = 0u; lane < kernel.NumLanes && i + lane < count; ++lane) {
+					auto messageIndex = messageIndexes[i + lane];
+					laneReaders[lane] = readers[messageIndex];
+					laneHashes[lane] = &pHashes[messageIndex];
+				}
+
+				kernel.HashLanes(laneReaders, laneHashes);
+			}
+		}
+
+		// endregion
+
+#endif
+	}
+
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, Hash256* pHashes, size_t count) noexcept {
+		Sha3_256_Multi(pDataBuffers, 1, pHashes, count);
+	}
+
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, size_t numPartsPerMessage, Hash256* pHashes, size_t count) noexcept {
+#ifdef CATAPULT_SHA3_MULTI_X86
+		const auto& kernel = GetKernel();
+		if (kernel.HashLanes && count > 1) {
+			for (auto i = 0u; i < count; i += Window_Size) {
+				auto windowSize = std::min(Window_Size, count - i);
+				HashWindow(kernel, pDataBuffers + i * numPartsPerMessage, numPartsPerMessage, pHashes + i, windowSize);
+			}
+
+			return;
+		}
+#endif
+
+		HashSerial(pDataBuffers, numPartsPerMessage, pHashes, count);
+	}
+}}
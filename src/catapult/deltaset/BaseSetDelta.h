@@ -21,6 +21,7 @@
 #pragma once
 #include "BaseSetDefaultTraits.h"
 #include "BaseSetFindIterator.h"
+#include "BatchFind.h"
 #include "DeltaElements.h"
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/exceptions.h"
@@ -156,6 +157,10 @@ namespace catapult { namespace deltaset {
 		}
 
 		FindConstIterator find(const KeyType& key, ImmutableTypeTag) const {
+			auto prefetchedIter = m_prefetchedElements.find(key);
+			if (m_prefetchedElements.cend() != prefetchedIter)
+				return FindConstIterator(std::move(prefetchedIter));
+
 			auto originalIter = m_originalElements.find(key);
 			return m_originalElements.cend() != originalIter ? FindConstIterator(std::move(originalIter)) : FindConstIterator();
 		}
@@ -172,7 +177,28 @@ namespace catapult { namespace deltaset {
 		/// Searches for \a key in this set.
 		/// Returns \c true if it is found or \c false if it is not found.
 		bool contains(const KeyType& key) const {
-			return !contains(m_removedElements, key) && (contains(m_addedElements, key) || contains(m_originalElements, key));
+			return !contains(m_removedElements, key) && (contains(m_addedElements, key) || containsOriginal(key));
+		}
+
+		/// Prefetches all original elements with \a keys so that subsequent finds do not need to search the original set.
+		/// \note This is a no-op when finds in the original set are inexpensive.
+		void prefetch(const std::vector<KeyType>& keys) {
+			if (!ShouldBatchFind(m_originalElements))
+				return;
+
+			std::vector<KeyType> unresolvedKeys;
+			for (const auto& key : keys) {
+				if (!contains(m_addedElements, key) && !contains(m_removedElements, key) && !isCopiedOrPrefetched(key))
+					unresolvedKeys.push_back(key);
+			}
+
+			if (unresolvedKeys.empty())
+				return;
+
+			for (const auto& originalIter : BatchFind(m_originalElements, unresolvedKeys)) {
+				if (m_originalElements.cend() != originalIter)
+					m_prefetchedElements.insert(*originalIter);
+			}
 		}
 
 	private:
@@ -181,6 +207,14 @@ namespace catapult { namespace deltaset {
 			return set.cend() != set.find(key);
 		}
 
+		bool containsOriginal(const KeyType& key) const {
+			return contains(m_prefetchedElements, key) || contains(m_originalElements, key);
+		}
+
+		bool isCopiedOrPrefetched(const KeyType& key) const {
+			return contains(m_copiedElements, key) || contains(m_prefetchedElements, key);
+		}
+
 	private:
 		// used to support creating values and values pointed to by shared_ptr
 		// (this is required to support shared_ptr value types in BaseSet)
@@ -232,7 +266,7 @@ namespace catapult { namespace deltaset {
 
 			auto insertResult = InsertResult::Inserted;
 			decltype(m_copiedElements)* pTargetElements;
-			if (contains(m_originalElements, key)) {
+			if (containsOriginal(key)) {
 				pTargetElements = &m_copiedElements; // original element, possibly modified
 				insertResult = InsertResult::Updated;
 			} else {
@@ -260,7 +294,7 @@ namespace catapult { namespace deltaset {
 				return InsertResult::Unremoved;
 			}
 
-			if (contains(m_originalElements, key) || contains(m_addedElements, key))
+			if (containsOriginal(key) || contains(m_addedElements, key))
 				return InsertResult::Redundant;
 
 			markKey(key);
@@ -319,6 +353,7 @@ namespace catapult { namespace deltaset {
 			m_addedElements.clear();
 			m_removedElements.clear();
 			m_copiedElements.clear();
+			m_prefetchedElements.clear();
 
 			m_generationId = 1;
 			m_keyGenerationIdMap.clear();
@@ -369,6 +404,7 @@ namespace catapult { namespace deltaset {
 		MemorySetType m_addedElements;
 		MemorySetType m_removedElements;
 		MemorySetType m_copiedElements;
+		MemorySetType m_prefetchedElements; // unmodified original elements that have been prefetched
 
 		uint32_t m_generationId;
 		typename KeyGenerationIdMap<SetType>::type m_keyGenerationIdMap;
@@ -0,0 +1,43 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <vector>
+
+namespace catapult { namespace deltaset {
+
+	/// Returns \c true if finds in \a elements are expensive and should be batched.
+	template<typename TSet>
+	bool ShouldBatchFind(const TSet&) {
+		return false;
+	}
+
+	/// Finds all elements with \a keys in \a elements.
+	/// \note Returned iterators are in the same order as \a keys.
+	template<typename TSet, typename TKey>
+	std::vector<typename TSet::const_iterator> BatchFind(const TSet& elements, const std::vector<TKey>& keys) {
+		std::vector<typename TSet::const_iterator> iterators;
+		iterators.reserve(keys.size());
+		for (const auto& key : keys)
+			iterators.push_back(elements.find(key));
+
+		return iterators;
+	}
+}}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "BaseSetCommitPolicy.h"
+#include "BatchFind.h"
 #include "DeltaElements.h"
 #include <memory>
 
@@ -153,6 +154,22 @@ namespace catapult { namespace deltaset {
 					: ConditionalIterator(m_pContainer2->find(key), MemoryFlag());
 		}
 
+		/// Searches for all \a keys in this set.
+		/// \note Returned iterators are in the same order as \a keys.
+		std::vector<ConditionalIterator> findAll(const std::vector<typename TKeyTraits::KeyType>& keys) const {
+			std::vector<ConditionalIterator> iterators;
+			iterators.reserve(keys.size());
+			if (m_pContainer1) {
+				for (auto& iter : BatchFind(*m_pContainer1, keys))
+					iterators.emplace_back(std::move(iter), StorageFlag());
+			} else {
+				for (auto& iter : BatchFind(*m_pContainer2, keys))
+					iterators.emplace_back(std::move(iter), MemoryFlag());
+			}
+
+			return iterators;
+		}
+
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
 		void update(const DeltaElements<MemorySetType>& deltas) {
@@ -179,6 +196,9 @@ namespace catapult { namespace deltaset {
 		template<typename TKeyTraits2, typename TStorageSet2, typename TMemorySet2>
 		friend bool IsSetIterable(const ConditionalContainer<TKeyTraits2, TStorageSet2, TMemorySet2>& set);
 
+		template<typename TKeyTraits2, typename TStorageSet2, typename TMemorySet2>
+		friend bool ShouldBatchFind(const ConditionalContainer<TKeyTraits2, TStorageSet2, TMemorySet2>& set);
+
 		template<typename TKeyTraits2, typename TStorageSet2, typename TMemorySet2>
 		friend const TMemorySet2& SelectIterableSet(const ConditionalContainer<TKeyTraits2, TStorageSet2, TMemorySet2>& set);
 	};
@@ -190,6 +210,20 @@ namespace catapult { namespace deltaset {
 		return !!set.m_pContainer2;
 	}
 
+	/// Returns \c true if finds in \a set are expensive and should be batched.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
+	bool ShouldBatchFind(const ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& set) {
+		return !!set.m_pContainer1;
+	}
+
+	/// Finds all elements with \a keys in \a set.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TKey>
+	auto BatchFind(const ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& set, const std::vector<TKey>& keys) {
+		return set.findAll(keys);
+	}
+
 	/// Selects the iterable set from \a set.
 	/// \throws catapult_invalid_argument if the set is not memory-based.
 	/// \note Specialization for ConditionalContainer.
@@ -20,12 +20,12 @@
 
 #pragma once
 #include "BaseSetDefaultTraits.h"
+#include <type_traits>
 #include <unordered_set>
 
 namespace catapult { namespace deltaset {
 
 	/// Mixin that wraps BaseSetDelta and provides a facade on top of BaseSetDelta::deltas().
-	/// \note This only works for map-based delta sets.
 	template<typename TSetDelta>
 	class DeltaElementsMixin {
 	private:
@@ -51,7 +51,8 @@ namespace catapult { namespace deltaset {
 		};
 
 	private:
-		using DerefHelper = DerefHelperT<typename TSetDelta::SetType::value_type::second_type>;
+		using SetTraits = typename TSetDelta::SetTraits;
+		using DerefHelper = DerefHelperT<typename std::remove_const<typename SetTraits::ValueType>::type>;
 		using PointerContainer = std::unordered_set<typename DerefHelper::const_pointer_type>;
 
 	public:
@@ -79,8 +80,8 @@ namespace catapult { namespace deltaset {
 		template<typename TSource>
 		static PointerContainer CollectAllPointers(const TSource& source) {
 			PointerContainer dest;
-			for (const auto& pair : source)
-				dest.insert(&DerefHelper::Deref(pair.second));
+			for (const auto& element : source)
+				dest.insert(&DerefHelper::Deref(SetTraits::ToValue(element)));
 
 			return dest;
 		}
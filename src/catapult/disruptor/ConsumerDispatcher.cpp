@@ -20,10 +20,11 @@
 
 #include "ConsumerDispatcher.h"
 #include "ConsumerEntry.h"
+#include "ParallelConsumerEntry.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/ExceptionLogging.h"
 #include "catapult/utils/Functional.h"
-#include <thread>
+#include <algorithm>
 
 namespace catapult { namespace disruptor {
 
@@ -35,6 +36,26 @@ namespace catapult { namespace disruptor {
 			return options;
 		}
 
+		const std::vector<DisruptorConsumer>& CheckWorkers(
+				const std::vector<DisruptorConsumer>& consumers,
+				const std::vector<size_t>& numConsumerWorkers) {
+			if (consumers.size() != numConsumerWorkers.size())
+				CATAPULT_THROW_INVALID_ARGUMENT("number of consumer workers must be specified for every consumer");
+
+			auto hasZeroWorkers = std::any_of(numConsumerWorkers.cbegin(), numConsumerWorkers.cend(), [](auto numWorkers) {
+				return 0 == numWorkers;
+			});
+			if (hasZeroWorkers)
+				CATAPULT_THROW_INVALID_ARGUMENT("every consumer must have at least one worker");
+
+			return consumers;
+		}
+
+		void LogConsumerException(size_t level) {
+			CATAPULT_LOG(fatal) << "consumer at level " << level << " threw exception: " << EXCEPTION_DIAGNOSTIC_MESSAGE();
+			utils::CatapultLogFlush();
+		}
+
 		void LogCompletion(const DisruptorElement& element, const DisruptorBarriers& barriers, size_t elementTraceInterval) {
 			if (!IsIntervalElementId(element.id(), elementTraceInterval))
 				return;
@@ -55,52 +76,95 @@ namespace catapult { namespace disruptor {
 			const ConsumerDispatcherOptions& options,
 			const std::vector<DisruptorConsumer>& consumers,
 			const DisruptorInspector& inspector)
+			: ConsumerDispatcher(options, consumers, std::vector<size_t>(consumers.size(), 1), inspector)
+	{}
+
+	ConsumerDispatcher::ConsumerDispatcher(
+			const ConsumerDispatcherOptions& options,
+			const std::vector<DisruptorConsumer>& consumers,
+			const std::vector<size_t>& numConsumerWorkers,
+			const DisruptorInspector& inspector)
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_elementTraceInterval(options.ElementTraceInterval)
 			, m_shouldThrowIfFull(options.ShouldThrowIfFull)
 			, m_keepRunning(true)
-			, m_barriers(consumers.size() + 1)
+			, m_pWaitStrategy(CreateDisruptorWaitStrategy(options.WaitStrategy))
+			, m_barriers(CheckWorkers(consumers, numConsumerWorkers).size() + 1, *m_pWaitStrategy)
 			, m_disruptor(options.DisruptorSize, options.ElementTraceInterval)
 			, m_inspector(inspector)
 			, m_numActiveElements(0) {
-		auto currentLevel = 0u;
-		for (const auto& consumer : consumers) {
-			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
-				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
-				while (pThis->m_keepRunning) {
-					try {
-						auto* pDisruptorElement = pThis->tryNext(consumerEntry);
-						if (!pDisruptorElement) {
-							std::this_thread::sleep_for(std::chrono::milliseconds(10));
-							continue;
-						}
-
-						auto result = consumer(pDisruptorElement->input());
-						if (CompletionStatus::Aborted == result.CompletionStatus)
-							pThis->m_disruptor.markSkipped(consumerEntry.position(), result.CompletionCode);
-
-						pThis->advance(consumerEntry);
-					} catch (...) {
-						CATAPULT_LOG(fatal)
-								<< "consumer at level " << consumerEntry.level() << " threw exception: "
-								<< EXCEPTION_DIAGNOSTIC_MESSAGE();
-						utils::CatapultLogFlush();
-						throw;
-					}
-				}
-			});
+		for (auto level = 0u; level < consumers.size(); ++level) {
+			if (1 == numConsumerWorkers[level]) {
+				startWorker(ConsumerEntry(level), consumers[level]);
+				continue;
+			}
+
+			m_parallelConsumerEntries.push_back(std::make_unique<ParallelConsumerEntry>(level, m_disruptor.capacity()));
+			for (auto i = 0u; i < numConsumerWorkers[level]; ++i)
+				startWorker(*m_parallelConsumerEntries.back(), consumers[level]);
 		}
 
 		CATAPULT_LOG(info) << options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size() << " workers";
 	}
 
+	void ConsumerDispatcher::startWorker(ConsumerEntry consumerEntry, const DisruptorConsumer& consumer) {
+		m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
+			thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+			while (pThis->m_keepRunning) {
+				try {
+					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
+					if (!pDisruptorElement) {
+						pThis->m_pWaitStrategy->wait(pThis->m_barriers[consumerEntry.level()], consumerEntry.position());
+						continue;
+					}
+
+					auto result = consumer(pDisruptorElement->input());
+					if (CompletionStatus::Aborted == result.CompletionStatus)
+						pThis->m_disruptor.markSkipped(consumerEntry.position(), result.CompletionCode);
+
+					pThis->advance(consumerEntry);
+				} catch (...) {
+					LogConsumerException(consumerEntry.level());
+					throw;
+				}
+			}
+		});
+	}
+
+	void ConsumerDispatcher::startWorker(ParallelConsumerEntry& consumerEntry, const DisruptorConsumer& consumer) {
+		m_threads.create_thread([pThis = this, &consumerEntry, consumer]() {
+			thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+			while (pThis->m_keepRunning) {
+				try {
+					PositionType position;
+					const auto& barrier = pThis->m_barriers[consumerEntry.level()];
+					if (!consumerEntry.tryClaim(barrier, position)) {
+						pThis->m_pWaitStrategy->wait(barrier, consumerEntry.claimPosition());
+						continue;
+					}
+
+					if (!pThis->m_disruptor.isSkipped(position)) {
+						auto result = consumer(pThis->m_disruptor.elementAt(position).input());
+						if (CompletionStatus::Aborted == result.CompletionStatus)
+							pThis->m_disruptor.markSkipped(position, result.CompletionCode);
+					}
+
+					pThis->advance(consumerEntry, position);
+				} catch (...) {
+					LogConsumerException(consumerEntry.level());
+					throw;
+				}
+			}
+		});
+	}
+
 	ConsumerDispatcher::~ConsumerDispatcher() {
 		shutdown();
 	}
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+		m_pWaitStrategy->signalAll();
 		m_threads.join_all();
 	}
 
@@ -109,7 +173,7 @@ namespace catapult { namespace disruptor {
 	}
 
 	size_t ConsumerDispatcher::size() const {
-		return m_threads.size();
+		return m_barriers.size() - 1;
 	}
 
 	size_t ConsumerDispatcher::numAddedElements() const {
@@ -137,13 +201,24 @@ namespace catapult { namespace disruptor {
 	void ConsumerDispatcher::advance(ConsumerEntry& consumerEntry) {
 		auto consumerPosition = consumerEntry.position();
 		consumerEntry.advance();
-		m_barriers[consumerEntry.level() + 1].advance();
+		advanceBarrier(consumerEntry.level(), consumerPosition);
+	}
+
+	void ConsumerDispatcher::advance(ParallelConsumerEntry& consumerEntry, PositionType position) {
+		// next barrier is only advanced over contiguous completed positions in order to preserve element ordering
+		consumerEntry.complete(position, [this, level = consumerEntry.level()](auto completedPosition) {
+			this->advanceBarrier(level, completedPosition);
+		});
+	}
+
+	void ConsumerDispatcher::advanceBarrier(size_t level, PositionType position) {
+		m_barriers[level + 1].advance();
 
 		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
-		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
+		if (level + 1 != m_barriers.size() - 1)
 			return;
 
-		auto& element = m_disruptor.elementAt(consumerPosition);
+		auto& element = m_disruptor.elementAt(position);
 		LogCompletion(element, m_barriers, m_elementTraceInterval);
 		m_inspector(element.input(), element.completionResult());
 		element.markProcessingComplete();
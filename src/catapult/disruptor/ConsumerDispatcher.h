@@ -27,7 +27,12 @@
 #include <boost/thread.hpp>
 #include <atomic>
 
-namespace catapult { namespace disruptor { class ConsumerEntry; } }
+namespace catapult {
+	namespace disruptor {
+		class ConsumerEntry;
+		class ParallelConsumerEntry;
+	}
+}
 
 namespace catapult { namespace disruptor {
 
@@ -42,6 +47,17 @@ namespace catapult { namespace disruptor {
 				const std::vector<DisruptorConsumer>& consumers,
 				const DisruptorInspector& inspector);
 
+		/// Creates a dispatcher of \a consumers configured with \a options, where each consumer is executed concurrently
+		/// by the corresponding number of workers in \a numConsumerWorkers.
+		/// Inspector (\a inspector) is a special consumer that is always run (independent of skip) and as a last one.
+		/// \note A consumer with multiple workers must be stateless (or thread safe) because distinct elements are processed
+		///       concurrently, but elements are still passed to subsequent consumers in order.
+		ConsumerDispatcher(
+				const ConsumerDispatcherOptions& options,
+				const std::vector<DisruptorConsumer>& consumers,
+				const std::vector<size_t>& numConsumerWorkers,
+				const DisruptorInspector& inspector);
+
 		/// Creates a dispatcher of \a consumers configured with \a options.
 		explicit ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers);
 
@@ -54,7 +70,7 @@ namespace catapult { namespace disruptor {
 		/// Returns \c true if dispatcher is running, \c false otherwise.
 		bool isRunning() const;
 
-		/// Returns the number of registered consumers.
+		/// Returns the number of registered consumers (independent of the number of workers).
 		size_t size() const;
 
 		/// Pushes the \a input into underlying disruptor and returns the assigned element id.
@@ -75,6 +91,14 @@ namespace catapult { namespace disruptor {
 
 		void advance(ConsumerEntry& consumerEntry);
 
+		void advance(ParallelConsumerEntry& consumerEntry, PositionType position);
+
+		void advanceBarrier(size_t level, PositionType position);
+
+		void startWorker(ConsumerEntry consumerEntry, const DisruptorConsumer& consumer);
+
+		void startWorker(ParallelConsumerEntry& consumerEntry, const DisruptorConsumer& consumer);
+
 		bool canProcessNextElement() const;
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete);
@@ -83,9 +107,11 @@ namespace catapult { namespace disruptor {
 		size_t m_elementTraceInterval;
 		bool m_shouldThrowIfFull;
 		std::atomic_bool m_keepRunning;
+		std::unique_ptr<DisruptorWaitStrategy> m_pWaitStrategy;
 		DisruptorBarriers m_barriers;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
+		std::vector<std::unique_ptr<ParallelConsumerEntry>> m_parallelConsumerEntries;
 		boost::thread_group m_threads;
 		std::atomic<size_t> m_numActiveElements;
 
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "DisruptorTypes.h"
+#include "DisruptorWaitStrategy.h"
 #include "catapult/utils/Logging.h"
 #include "catapult/preprocessor.h"
 #include <atomic>
@@ -33,14 +34,23 @@ namespace catapult { namespace disruptor {
 	class DisruptorBarrier {
 	public:
 		/// Creates a barrier given its \a level and position (\a barrierEndPosition).
-		DisruptorBarrier(size_t level, PositionType position)
+		DisruptorBarrier(size_t level, PositionType position) : DisruptorBarrier(level, position, nullptr)
+		{}
+
+		/// Creates a barrier given its \a level and position (\a barrierEndPosition) that signals \a pWaitStrategy
+		/// whenever it is advanced.
+		DisruptorBarrier(size_t level, PositionType position, DisruptorWaitStrategy* pWaitStrategy)
 				: m_level(level)
 				, m_position(position)
+				, m_pWaitStrategy(pWaitStrategy)
 		{}
 
 		/// Advances the barrier.
 		CATAPULT_INLINE void advance() {
 			++m_position;
+
+			if (m_pWaitStrategy)
+				m_pWaitStrategy->signalAll();
 		}
 
 		/// Returns level of the barrier.
@@ -56,5 +66,6 @@ namespace catapult { namespace disruptor {
 	private:
 		const size_t m_level;
 		std::atomic<PositionType> m_position;
+		DisruptorWaitStrategy* m_pWaitStrategy;
 	};
 }}
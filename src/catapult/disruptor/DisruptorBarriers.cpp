@@ -23,8 +23,15 @@
 
 namespace catapult { namespace disruptor {
 
-	DisruptorBarriers::DisruptorBarriers(size_t levelsCount) {
+	DisruptorBarriers::DisruptorBarriers(size_t levelsCount) : DisruptorBarriers(levelsCount, nullptr)
+	{}
+
+	DisruptorBarriers::DisruptorBarriers(size_t levelsCount, DisruptorWaitStrategy& waitStrategy)
+			: DisruptorBarriers(levelsCount, &waitStrategy)
+	{}
+
+	DisruptorBarriers::DisruptorBarriers(size_t levelsCount, DisruptorWaitStrategy* pWaitStrategy) {
 		for (size_t i = 0; i < levelsCount; ++i)
-			m_barriers.emplace_back(std::make_unique<DisruptorBarrier>(i, 0));
+			m_barriers.emplace_back(std::make_unique<DisruptorBarrier>(i, 0, pWaitStrategy));
 	}
 }}
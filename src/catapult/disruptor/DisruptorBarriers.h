@@ -32,6 +32,12 @@ namespace catapult { namespace disruptor {
 		/// Creates \a levelsCount barriers with consecutive levels.
 		explicit DisruptorBarriers(size_t levelsCount);
 
+		/// Creates \a levelsCount barriers with consecutive levels that signal \a waitStrategy when advanced.
+		DisruptorBarriers(size_t levelsCount, DisruptorWaitStrategy& waitStrategy);
+
+	private:
+		DisruptorBarriers(size_t levelsCount, DisruptorWaitStrategy* pWaitStrategy);
+
 	public:
 		/// Returns number of barriers.
 		CATAPULT_INLINE size_t size() const {
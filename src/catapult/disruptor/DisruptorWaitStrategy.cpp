@@ -0,0 +1,130 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "DisruptorWaitStrategy.h"
+#include "DisruptorBarrier.h"
+#include "catapult/utils/Casting.h"
+#include "catapult/exceptions.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		// upper bound on any single wait so that waiters periodically recheck external state (e.g. shutdown)
+		constexpr auto Max_Wait_Duration = std::chrono::milliseconds(10);
+		constexpr auto Num_Spin_Iterations = 100u;
+
+		bool HasAdvanced(const DisruptorBarrier& barrier, PositionType position) {
+			return barrier.position() != position;
+		}
+
+		class SleepWaitStrategy : public DisruptorWaitStrategy {
+		public:
+			void wait(const DisruptorBarrier&, PositionType) override {
+				std::this_thread::sleep_for(Max_Wait_Duration);
+			}
+
+			void signalAll() override
+			{}
+		};
+
+		class BusySpinWaitStrategy : public DisruptorWaitStrategy {
+		public:
+			void wait(const DisruptorBarrier&, PositionType) override
+			{}
+
+			void signalAll() override
+			{}
+		};
+
+		class SpinThenYieldWaitStrategy : public DisruptorWaitStrategy {
+		public:
+			void wait(const DisruptorBarrier& barrier, PositionType position) override {
+				for (auto i = 0u; i < Num_Spin_Iterations; ++i) {
+					if (HasAdvanced(barrier, position))
+						return;
+				}
+
+				std::this_thread::yield();
+			}
+
+			void signalAll() override
+			{}
+		};
+
+		class BlockingWaitStrategy : public DisruptorWaitStrategy {
+		public:
+			BlockingWaitStrategy()
+					: m_numWaiters(0)
+					, m_generation(0)
+			{}
+
+		public:
+			void wait(const DisruptorBarrier& barrier, PositionType position) override {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				++m_numWaiters;
+
+				auto generation = m_generation;
+				m_condition.wait_for(lock, Max_Wait_Duration, [this, &barrier, position, generation]() {
+					return generation != m_generation || HasAdvanced(barrier, position);
+				});
+
+				--m_numWaiters;
+			}
+
+			void signalAll() override {
+				// barrier position is updated before this check, so either the waiter observes the new position
+				// or this observes the waiter; in the common case (no waiters) the mutex is not acquired at all
+				if (0 == m_numWaiters)
+					return;
+
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					++m_generation;
+				}
+
+				m_condition.notify_all();
+			}
+
+		private:
+			std::atomic<size_t> m_numWaiters;
+			uint64_t m_generation;
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+		};
+	}
+
+	std::unique_ptr<DisruptorWaitStrategy> CreateDisruptorWaitStrategy(WaitStrategyType type) {
+		switch (type) {
+		case WaitStrategyType::Sleep:
+			return std::make_unique<SleepWaitStrategy>();
+		case WaitStrategyType::Busy_Spin:
+			return std::make_unique<BusySpinWaitStrategy>();
+		case WaitStrategyType::Spin_Then_Yield:
+			return std::make_unique<SpinThenYieldWaitStrategy>();
+		case WaitStrategyType::Blocking:
+			return std::make_unique<BlockingWaitStrategy>();
+		}
+
+		CATAPULT_THROW_INVALID_ARGUMENT_1("unsupported wait strategy", utils::to_underlying_type(type));
+	}
+}}
@@ -0,0 +1,60 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DisruptorTypes.h"
+#include <memory>
+
+namespace catapult { namespace disruptor { class DisruptorBarrier; } }
+
+namespace catapult { namespace disruptor {
+
+	/// Strategies used by consumers waiting for new disruptor elements.
+	enum class WaitStrategyType {
+		/// Sleep for a fixed interval between checks.
+		Sleep,
+
+		/// Continuously poll the barrier.
+		Busy_Spin,
+
+		/// Poll the barrier for a bounded number of iterations and then yield the thread.
+		Spin_Then_Yield,
+
+		/// Block until the barrier is advanced (or a timeout elapses).
+		Blocking
+	};
+
+	/// Strategy used by consumers waiting for a barrier to advance.
+	class DisruptorWaitStrategy {
+	public:
+		virtual ~DisruptorWaitStrategy() = default;
+
+	public:
+		/// Waits until \a barrier (possibly) advances beyond \a position.
+		/// \note Implementations are allowed to return early, so callers must recheck their condition.
+		virtual void wait(const DisruptorBarrier& barrier, PositionType position) = 0;
+
+		/// Signals all waiters that a barrier has advanced.
+		virtual void signalAll() = 0;
+	};
+
+	/// Creates a wait strategy of the specified \a type.
+	std::unique_ptr<DisruptorWaitStrategy> CreateDisruptorWaitStrategy(WaitStrategyType type);
+}}
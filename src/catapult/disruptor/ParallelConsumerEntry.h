@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DisruptorBarrier.h"
+#include <mutex>
+#include <vector>
+
+namespace catapult { namespace disruptor {
+
+	/// Holds information about a consumer that is executed concurrently by multiple workers.
+	/// \note Workers claim distinct positions but completed positions are only published in order.
+	class ParallelConsumerEntry {
+	public:
+		/// Creates an entry with a \a level for a disruptor with \a capacity.
+		ParallelConsumerEntry(size_t level, size_t capacity)
+				: m_level(level)
+				, m_claimPosition(0)
+				, m_position(0)
+				, m_completedFlags(capacity, false)
+		{}
+
+	public:
+		/// Returns next position that will be claimed.
+		PositionType claimPosition() const {
+			return m_claimPosition;
+		}
+
+		/// Returns position up to which (exclusive) all elements have been completed.
+		PositionType position() const {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			return m_position;
+		}
+
+		/// Returns consumer level.
+		size_t level() const {
+			return m_level;
+		}
+
+	public:
+		/// Tries to claim the next position that is below \a barrier and stores it in \a position.
+		bool tryClaim(const DisruptorBarrier& barrier, PositionType& position) {
+			auto claimPosition = m_claimPosition.load();
+			while (claimPosition != barrier.position()) {
+				if (m_claimPosition.compare_exchange_weak(claimPosition, claimPosition + 1)) {
+					position = claimPosition;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/// Marks the claimed \a position as completed and calls \a publish with all positions that have become contiguously
+		/// completed as a result, in order.
+		template<typename TPublish>
+		void complete(PositionType position, TPublish publish) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_completedFlags[position % m_completedFlags.size()] = true;
+
+			while (true) {
+				auto index = m_position % m_completedFlags.size();
+				if (!m_completedFlags[index])
+					break;
+
+				m_completedFlags[index] = false;
+				publish(m_position++);
+			}
+		}
+
+	private:
+		const size_t m_level;
+		std::atomic<PositionType> m_claimPosition;
+		PositionType m_position;
+		std::vector<bool> m_completedFlags;
+		mutable std::mutex m_mutex;
+	};
+}}
@@ -32,6 +32,21 @@ namespace catapult { namespace extensions {
 		storageConfig.PreferCacheDatabase = config.Node.ShouldUseCacheDatabaseStorage;
 		storageConfig.CacheDatabaseDirectory = (boost::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
 		storageConfig.MaxCacheDatabaseWriteBatchSize = config.Node.MaxCacheDatabaseWriteBatchSize;
+		storageConfig.PatriciaTreeNodeCacheMaxSize = config.Node.PatriciaTreeNodeCacheMaxSize;
+		storageConfig.MaxStateMultiproofKeys = config.Node.MaxStateMultiproofKeys;
+
+		const auto& cacheDatabaseConfig = config.Node.CacheDatabase;
+		auto& tuningSettings = storageConfig.CacheDatabaseTuning;
+		tuningSettings.BlockCacheSize = cacheDatabaseConfig.BlockCacheSize;
+		tuningSettings.BloomFilterBitsPerKey = cacheDatabaseConfig.BloomFilterBitsPerKey;
+		tuningSettings.ShouldPinIndexAndFilterBlocks = cacheDatabaseConfig.ShouldPinIndexAndFilterBlocks;
+		tuningSettings.KeyPrefixSize = cacheDatabaseConfig.KeyPrefixSize;
+		tuningSettings.ShouldUseUniversalCompaction = cacheDatabaseConfig.ShouldUseUniversalCompaction;
+		tuningSettings.WriteBufferSize = cacheDatabaseConfig.WriteBufferSize;
+		tuningSettings.PatriciaTreeWriteBufferSize = cacheDatabaseConfig.PatriciaTreeWriteBufferSize;
+		tuningSettings.MaxWriteBufferNumber = cacheDatabaseConfig.MaxWriteBufferNumber;
+		tuningSettings.ShouldSyncWrites = cacheDatabaseConfig.ShouldSyncWrites;
+		tuningSettings.ShouldEnableStatistics = cacheDatabaseConfig.ShouldEnableStatistics;
 		return storageConfig;
 	}
 
@@ -20,9 +20,12 @@
 
 #pragma once
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketHandlers.h"
+#include "catapult/tree/PatriciaTreeMultiproof.h"
 #include "catapult/tree/PatriciaTreeSerializer.h"
 #include "catapult/utils/Casting.h"
+#include "catapult/utils/Logging.h"
 
 namespace catapult { namespace handlers {
 
@@ -37,6 +40,35 @@ namespace catapult { namespace handlers {
 		TKey Key;
 	};
 
+	/// State multiproof request packet.
+	/// \note Packet header is followed by one or more keys.
+	template<ionet::PacketType PacketType, typename TKey>
+	struct StateMultiproofRequestPacket : public ionet::Packet {
+	public:
+		/// Packet type.
+		static constexpr ionet::PacketType Packet_Type = PacketType;
+
+		/// Key type.
+		using KeyType = TKey;
+	};
+
+#pragma pack(push, 1)
+
+	/// State multiproof response packet.
+	/// \note Packet header is followed by the deduplicated serialized tree nodes composing the proof.
+	template<ionet::PacketType PacketType>
+	struct StateMultiproofResponse : public ionet::Packet {
+	public:
+		/// Packet type.
+		static constexpr ionet::PacketType Packet_Type = PacketType;
+
+	public:
+		/// Sub cache merkle root against which the proof was generated.
+		Hash256 MerkleRoot;
+	};
+
+#pragma pack(pop)
+
 	/// Registers a handler in \a handlers that responds with serialized state path produced by querying \a cache.
 	template<typename TPacket, typename TCache>
 	static void RegisterStatePathHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache) {
@@ -64,4 +96,38 @@ namespace catapult { namespace handlers {
 			context.response(ionet::PacketPayload(pResponsePacket));
 		});
 	}
+
+	/// Registers a handler in \a handlers that responds with a serialized state multiproof produced by querying \a cache.
+	/// Requests containing more than \a maxKeys keys are rejected.
+	/// \note Nodes shared by the paths of multiple requested keys are only sent once.
+	template<typename TPacket, typename TCache>
+	static void RegisterStateMultiproofHandler(ionet::ServerPacketHandlers& handlers, const TCache& cache, uint32_t maxKeys) {
+		handlers.registerHandler(TPacket::Packet_Type, [&cache, maxKeys](const auto& packet, auto& context) {
+			auto keys = ionet::ExtractFixedSizeStructuresFromPacket<typename TPacket::KeyType>(packet);
+			if (keys.empty())
+				return;
+
+			if (keys.size() > maxKeys) {
+				CATAPULT_LOG(warning) << "rejecting state multiproof request with " << keys.size() << " keys (max " << maxKeys << ")";
+				return;
+			}
+
+			auto view = cache.createView();
+			tree::PatriciaTreeMultiproofBuilder builder;
+			std::vector<tree::TreeNode> path;
+			for (const auto& key : keys) {
+				// add path even if lookup failed (to provide proof that key does not exist in state)
+				path.clear();
+				view->tryLookup(key, path);
+				builder.add(path);
+			}
+
+			const auto& serializedProof = builder.serializedProof();
+			auto payloadSize = utils::checked_cast<size_t, uint32_t>(serializedProof.size());
+			auto pResponsePacket = ionet::CreateSharedPacket<StateMultiproofResponse<TPacket::Packet_Type>>(payloadSize);
+			pResponsePacket->MerkleRoot = view->tryGetMerkleRoot().first;
+			std::memcpy(reinterpret_cast<uint8_t*>(pResponsePacket.get() + 1), serializedProof.data(), serializedProof.size());
+			context.response(ionet::PacketPayload(pResponsePacket));
+		});
+	}
 }}
@@ -21,6 +21,10 @@
 #include "BlockStorageCache.h"
 #include "catapult/model/Elements.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include <atomic>
+#include <list>
+#include <map>
 
 namespace catapult { namespace io {
 
@@ -67,58 +71,181 @@ namespace catapult { namespace io {
 	/// Cached data holder.
 	struct CachedData {
 	public:
-		CachedData() = default;
+		/// Creates cached data with \a options.
+		explicit CachedData(const BlockStorageCacheOptions& options)
+				: m_options(options)
+				, m_hashes(options.MaxCachedHashes)
+				, m_blockHits(0)
+				, m_blockMisses(0)
+				, m_hashHits(0)
+				, m_hashMisses(0)
+		{}
 
+	public:
 		/// Returns cached height.
 		Height getHeight() const {
 			return m_chainHeight;
 		}
 
-		/// Returns \c true if cache contains element at \a height.
-		bool contains(Height height) const {
-			return m_pBlockElement && height == m_pBlockElement->Block.Height;
+		/// Returns cached block element at \a height or \c nullptr if it is not cached.
+		/// \note This marks the element as most recently used.
+		std::shared_ptr<const model::BlockElement> tryGetBlockElement(Height height) {
+			utils::SpinLockGuard guard(m_blocksLock);
+			auto iter = m_blockElementIterators.find(height);
+			if (m_blockElementIterators.cend() == iter) {
+				++m_blockMisses;
+				return nullptr;
+			}
+
+			++m_blockHits;
+			m_blockElements.splice(m_blockElements.begin(), m_blockElements, iter->second);
+			return *iter->second;
 		}
 
-		/// Returns cached block element.
-		std::shared_ptr<const model::BlockElement> getBlockElement(Height) const {
-			return m_pBlockElement;
+		/// Adds \a pBlockElement loaded from storage to the cache.
+		void add(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			utils::SpinLockGuard guard(m_blocksLock);
+			addUnlocked(pBlockElement);
 		}
 
-		/// Returns cached block.
-		std::shared_ptr<const model::Block> getBlock(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+		/// Tries to copy at most \a maxHashes cached hashes starting at \a height into \a hashes.
+		bool tryLoadHashesFrom(Height height, size_t maxHashes, model::HashRange& hashes) {
+			if (m_hashes.empty() || height < m_hashesStartHeight || height > m_chainHeight) {
+				++m_hashMisses;
+				return false;
+			}
+
+			++m_hashHits;
+			auto numHashes = std::min<size_t>(maxHashes, static_cast<size_t>((m_chainHeight - height).unwrap() + 1));
+
+			uint8_t* pData = nullptr;
+			hashes = model::HashRange::PrepareFixed(numHashes, &pData);
+			for (auto i = 0u; i < numHashes; ++i) {
+				const auto& hash = m_hashes[(height.unwrap() + i) % m_hashes.size()];
+				std::memcpy(pData, hash.data(), Hash256_Size);
+				pData += Hash256_Size;
+			}
+
+			return true;
+		}
+
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const {
+			return { m_blockHits, m_blockMisses, m_hashHits, m_hashMisses };
+		}
+
+		/// Initializes cache with the chain height and most recent hashes of \a storage.
+		void initialize(const BlockStorage& storage) {
+			m_chainHeight = storage.chainHeight();
+			auto numHashes = std::min<uint64_t>(m_hashes.size(), m_chainHeight.unwrap());
+			m_hashesStartHeight = m_chainHeight - Height(numHashes) + Height(1);
+			if (0 == numHashes)
+				return;
+
+			auto height = m_hashesStartHeight;
+			for (const auto& hash : storage.loadHashesFrom(m_hashesStartHeight, numHashes)) {
+				m_hashes[height.unwrap() % m_hashes.size()] = hash;
+				height = height + Height(1);
+			}
 		}
 
 		/// Updates cache with block element (\a blockElement).
 		void update(const model::BlockElement& blockElement) {
-			// note: update receives elements during loadBlock, but also saveBlock. We get them from BlockChainSyncConsumer,
+			auto height = blockElement.Block.Height;
+			if (!m_hashes.empty()) {
+				// restart the hashes ring when the saved block does not extend the chain
+				if (height != m_chainHeight + Height(1))
+					m_hashesStartHeight = height;
+
+				m_hashes[height.unwrap() % m_hashes.size()] = blockElement.EntityHash;
+				if ((height - m_hashesStartHeight).unwrap() >= m_hashes.size())
+					m_hashesStartHeight = height - Height(m_hashes.size() - 1);
+			}
+
+			if (height > m_chainHeight)
+				m_chainHeight = height;
+
+			if (0 == m_options.MaxCachedBlocks)
+				return;
+
+			// note: update receives elements during saveBlock. We get them from BlockChainSyncConsumer,
 			// and it gets them from disruptor... in order NOT to copy here we'd need to take ownership of those.
 			// Currently we can't/shouldn't do it, as there's "new block" consumer afterwards and possibly ProcessingCompleteFunc.
-			m_pBlockElement = Copy(blockElement);
+			utils::SpinLockGuard guard(m_blocksLock);
+			addUnlocked(Copy(blockElement));
 		}
 
-		/// Updates cached height to \a height.
+		/// Updates cached height to \a height and removes all cached data above it.
 		void update(Height height) {
 			m_chainHeight = height;
+			if (m_hashesStartHeight > height)
+				m_hashesStartHeight = height + Height(1);
+
+			utils::SpinLockGuard guard(m_blocksLock);
+			auto iter = m_blockElementIterators.upper_bound(height);
+			while (m_blockElementIterators.end() != iter) {
+				m_blockElements.erase(iter->second);
+				iter = m_blockElementIterators.erase(iter);
+			}
+		}
+
+	private:
+		void addUnlocked(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			if (0 == m_options.MaxCachedBlocks)
+				return;
+
+			// replace any previous element at the same height (e.g. after a rollback)
+			auto height = pBlockElement->Block.Height;
+			auto iter = m_blockElementIterators.find(height);
+			if (m_blockElementIterators.end() != iter) {
+				m_blockElements.erase(iter->second);
+				m_blockElementIterators.erase(iter);
+			}
+
+			m_blockElements.push_front(pBlockElement);
+			m_blockElementIterators.emplace(height, m_blockElements.begin());
 
-			if (m_pBlockElement && height < m_pBlockElement->Block.Height)
-				m_pBlockElement.reset();
+			if (m_blockElements.size() > m_options.MaxCachedBlocks) {
+				m_blockElementIterators.erase(m_blockElements.back()->Block.Height);
+				m_blockElements.pop_back();
+			}
 		}
 
 	private:
+		using BlockElements = std::list<std::shared_ptr<const model::BlockElement>>;
+
+		BlockStorageCacheOptions m_options;
+
 		// note: the reason to have them separated is drop blocks, which
 		// updates the height, but we don't want to touch cached block(s).
 		Height m_chainHeight;
-		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+
+		// ring of the most recent hashes, which contains valid hashes for heights [m_hashesStartHeight, m_chainHeight]
+		std::vector<Hash256> m_hashes;
+		Height m_hashesStartHeight;
+
+		// block elements ordered from most to least recently used (these are accessed by concurrent readers)
+		BlockElements m_blockElements;
+		std::map<Height, BlockElements::iterator> m_blockElementIterators;
+		utils::SpinLock m_blocksLock;
+
+		std::atomic<uint64_t> m_blockHits;
+		std::atomic<uint64_t> m_blockMisses;
+		std::atomic<uint64_t> m_hashHits;
+		std::atomic<uint64_t> m_hashMisses;
 	};
 
 	BlockStorageCache::~BlockStorageCache() = default;
 
 	// This ctor takes r-value, to move the storage (that's not a move ctor).
 	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage)
+			: BlockStorageCache(std::move(pStorage), { 1, 0 })
+	{}
+
+	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, const BlockStorageCacheOptions& options)
 			: m_pStorage(std::move(pStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
-		m_pCachedData->update(m_pStorage->chainHeight());
+			, m_pCachedData(std::make_unique<CachedData>(options)) {
+		m_pCachedData->initialize(*m_pStorage);
 	}
 
 	// region BlockStorageView
@@ -131,9 +258,11 @@ namespace catapult { namespace io {
 		if (height > chainHeight())
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
-		if (m_cachedData.contains(height))
-			return m_cachedData.getBlock(height);
+		auto pBlockElement = m_cachedData.tryGetBlockElement(height);
+		if (pBlockElement)
+			return BlockElementAsSharedBlock(pBlockElement);
 
+		// note: blocks are not added to the cache because they are not block elements
 		return m_storage.loadBlock(height);
 	}
 
@@ -141,13 +270,23 @@ namespace catapult { namespace io {
 		if (height > chainHeight())
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
-		if (m_cachedData.contains(height))
-			return m_cachedData.getBlockElement(height);
+		auto pBlockElement = m_cachedData.tryGetBlockElement(height);
+		if (pBlockElement)
+			return pBlockElement;
 
-		return m_storage.loadBlockElement(height);
+		pBlockElement = m_storage.loadBlockElement(height);
+		m_cachedData.add(pBlockElement);
+		return pBlockElement;
 	}
 
 	model::HashRange BlockStorageView::loadHashesFrom(Height height, size_t maxHashes) const {
+		if (Height(0) == height || height > chainHeight())
+			return model::HashRange();
+
+		model::HashRange hashes;
+		if (m_cachedData.tryLoadHashesFrom(height, maxHashes, hashes))
+			return hashes;
+
 		return m_storage.loadHashesFrom(height, maxHashes);
 	}
 
@@ -155,28 +294,19 @@ namespace catapult { namespace io {
 
 	// region BlockStorageModifier
 
-	namespace {
-		void CacheBlockElement(CachedData& cachedData, const model::BlockElement& blockElement) {
-			if (blockElement.Block.Height > cachedData.getHeight())
-				cachedData.update(blockElement.Block.Height);
-
-			cachedData.update(blockElement);
-		}
-	}
-
 	void BlockStorageModifier::saveBlock(const model::BlockElement& blockElement) {
 		m_storage.saveBlock(blockElement);
-		CacheBlockElement(m_cachedData, blockElement);
+		m_cachedData.update(blockElement);
 	}
 
 	void BlockStorageModifier::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
 		if (blockElements.empty())
 			return;
 
-		for (const auto& blockElement : blockElements)
+		for (const auto& blockElement : blockElements) {
 			m_storage.saveBlock(blockElement);
-
-		CacheBlockElement(m_cachedData, blockElements.back());
+			m_cachedData.update(blockElement);
+		}
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
@@ -196,5 +326,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, m_lock.acquireReader(), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
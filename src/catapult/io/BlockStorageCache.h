@@ -26,6 +26,30 @@ namespace catapult { namespace io { struct CachedData; } }
 
 namespace catapult { namespace io {
 
+	/// Block storage cache options.
+	struct BlockStorageCacheOptions {
+		/// Maximum number of block elements to cache.
+		size_t MaxCachedBlocks;
+
+		/// Maximum number of (most recent) block hashes to cache.
+		size_t MaxCachedHashes;
+	};
+
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of block (element) loads served from the cache.
+		uint64_t BlockHits;
+
+		/// Number of block (element) loads forwarded to the storage.
+		uint64_t BlockMisses;
+
+		/// Number of hash loads served from the cache.
+		uint64_t HashHits;
+
+		/// Number of hash loads forwarded to the storage.
+		uint64_t HashMisses;
+	};
+
 	/// A read only view on top of block storage.
 	class BlockStorageView : utils::MoveOnly {
 	public:
@@ -33,7 +57,7 @@ namespace catapult { namespace io {
 		explicit BlockStorageView(
 				const BlockStorage& storage,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-				const CachedData& cachedData)
+				CachedData& cachedData)
 				: m_storage(storage)
 				, m_readLock(std::move(readLock))
 				, m_cachedData(cachedData)
@@ -55,7 +79,7 @@ namespace catapult { namespace io {
 	private:
 		const BlockStorage& m_storage;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		const CachedData& m_cachedData;
+		CachedData& m_cachedData;
 	};
 
 	/// A write only view on top of block storage.
@@ -90,12 +114,16 @@ namespace catapult { namespace io {
 	};
 
 	/// A cache around a BlockStorage.
-	/// \note Currently this "cache" only provides synchronization.
+	/// \note In addition to synchronization, this cache keeps the most recently used block elements and
+	///       the hashes of the most recent blocks in memory.
 	class BlockStorageCache {
 	public:
-		/// Creates a new cache around \a pStorage.
+		/// Creates a new cache around \a pStorage that only caches the most recently saved block.
 		explicit BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage);
 
+		/// Creates a new cache around \a pStorage with custom \a options.
+		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, const BlockStorageCacheOptions& options);
+
 		/// Destroys the cache.
 		~BlockStorageCache();
 
@@ -106,6 +134,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
@@ -35,6 +35,11 @@ namespace catapult { namespace io {
 		m_bufferPosition = 0;
 	}
 
+	void BufferedOutputFileStream::sync() {
+		flush();
+		m_rawFile.sync();
+	}
+
 	void BufferedOutputFileStream::write(const RawBuffer& buffer) {
 		// bypass caching if write buffer is larger than internal buffer
 		if (buffer.Size > m_buffer.size()) {
@@ -39,6 +39,10 @@ namespace catapult { namespace io {
 
 		void flush() override;
 
+	public:
+		/// Flushes all buffered data and synchronizes it with the storage device.
+		void sync();
+
 	private:
 		RawFile m_rawFile;
 		std::vector<uint8_t> m_buffer;
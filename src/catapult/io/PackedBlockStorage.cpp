@@ -0,0 +1,536 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PackedBlockStorage.h"
+#include "PodIoUtils.h"
+#include "catapult/model/Elements.h"
+#include "catapult/utils/Logging.h"
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <algorithm>
+#include <cstring>
+#include <inttypes.h>
+
+using catapult::model::Block;
+using catapult::model::BlockElement;
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr uint64_t Blocks_Per_Segment = 65536u;
+		static constexpr uint64_t Record_Alignment = 8u;
+		static constexpr uint64_t Min_Blocks_File_Growth_Size = 1024u * 1024;
+		static constexpr uint64_t Max_Blocks_File_Growth_Size = 64u * 1024 * 1024;
+		static constexpr uint64_t Zero_Fill_Chunk_Size = 1024u * 1024;
+		static constexpr auto Blocks_File_Extension = ".blocks";
+		static constexpr auto Offsets_File_Extension = ".offsets";
+		static constexpr auto Hashes_File_Extension = ".hashes";
+		static constexpr auto Index_File = "packed_index.dat";
+
+		// index file and first block file of the (one file per block) layout used by FileBlockStorage
+		static constexpr auto File_Layout_Index_File = "index.dat";
+		static constexpr auto File_Layout_Nemesis_Block_File = "00000/00001.dat";
+
+#pragma pack(push, 1)
+
+		/// Location of a block record inside a segment blocks file.
+		struct OffsetsSlot {
+			/// Offset of the record.
+			uint64_t Offset;
+
+			/// Size of the (padded) record or \c 0 if the slot is empty.
+			uint64_t Size;
+		};
+
+#pragma pack(pop)
+
+		static constexpr uint64_t Offsets_File_Size = Blocks_Per_Segment * sizeof(OffsetsSlot);
+		static constexpr uint64_t Hashes_File_Size = Blocks_Per_Segment * Hash256_Size;
+
+#ifdef _MSC_VER
+#define SPRINTF sprintf_s
+#else
+#define SPRINTF sprintf
+#endif
+		std::string GetSegmentPath(const std::string& baseDirectory, uint64_t segmentId, const char* extension) {
+			char filename[16];
+			SPRINTF(filename, "%05" PRIu64, segmentId);
+			boost::filesystem::path path = baseDirectory;
+			path /= filename;
+			path += extension;
+			return path.generic_string();
+		}
+
+		uint64_t GetSegmentId(Height height) {
+			return height.unwrap() / Blocks_Per_Segment;
+		}
+
+		uint64_t GetSegmentIndex(Height height) {
+			return height.unwrap() % Blocks_Per_Segment;
+		}
+
+		std::string GetIndexPath(const std::string& baseDirectory) {
+			boost::filesystem::path indexPath = baseDirectory;
+			indexPath /= Index_File;
+			return indexPath.generic_string();
+		}
+
+		bool IsNonEmptyFile(const std::string& path) {
+			return boost::filesystem::is_regular_file(path) && 0 != boost::filesystem::file_size(path);
+		}
+
+		bool ContainsFileLayout(const std::string& baseDirectory) {
+			boost::filesystem::path path = baseDirectory;
+			return boost::filesystem::exists(path / File_Layout_Index_File)
+					|| boost::filesystem::exists(path / File_Layout_Nemesis_Block_File);
+		}
+
+		Height LoadChainHeight(const std::string& baseDirectory) {
+			auto indexPath = GetIndexPath(baseDirectory);
+			if (boost::filesystem::is_regular_file(indexPath)) {
+				RawFile indexFile(indexPath, OpenMode::Read_Only);
+				return Read<Height>(indexFile);
+			}
+
+			// without an index file, the chain height is one when the nemesis block is present and zero otherwise
+			auto offsetsPath = GetSegmentPath(baseDirectory, 0, Offsets_File_Extension);
+			if (!IsNonEmptyFile(offsetsPath)) {
+				// refuse to start over blocks that are stored in the file layout instead of silently ignoring them
+				if (ContainsFileLayout(baseDirectory)) {
+					CATAPULT_THROW_RUNTIME_ERROR_1(
+							"data directory contains file-based block storage, convert it with the packblocks tool",
+							baseDirectory);
+				}
+
+				return Height(0);
+			}
+
+			RawFile offsetsFile(offsetsPath, OpenMode::Read_Only, LockMode::None);
+			offsetsFile.seek(sizeof(OffsetsSlot));
+			OffsetsSlot slot;
+			offsetsFile.read({ reinterpret_cast<uint8_t*>(&slot), sizeof(OffsetsSlot) });
+			return 0 == slot.Size ? Height(0) : Height(1);
+		}
+
+		void EnsureMinimumSize(RawFile& file, uint64_t size) {
+			if (file.size() >= size)
+				return;
+
+			// zero-fill the remainder of the file (raw files do not allow seeking past the end)
+			std::vector<uint8_t> zeros(std::min(size - file.size(), Zero_Fill_Chunk_Size));
+			file.seek(file.size());
+			while (file.size() < size)
+				file.write({ zeros.data(), std::min<uint64_t>(size - file.size(), zeros.size()) });
+		}
+
+		uint64_t CalculateBlocksFileCapacity(uint64_t currentCapacity, uint64_t requiredSize) {
+			// grow geometrically up to fixed extents so that readers only need to remap a segment a few times
+			auto growthSize = std::min(std::max(currentCapacity, Min_Blocks_File_Growth_Size), Max_Blocks_File_Growth_Size);
+			return requiredSize + growthSize;
+		}
+
+		uint64_t FindRecordsEnd(RawFile& offsetsFile) {
+			// blocks files are preallocated, so the append position is the end of the last record referenced by any slot
+			std::vector<OffsetsSlot> slots(Blocks_Per_Segment);
+			offsetsFile.seek(0);
+			offsetsFile.read({ reinterpret_cast<uint8_t*>(slots.data()), Offsets_File_Size });
+
+			uint64_t recordsEnd = 0;
+			for (const auto& slot : slots)
+				recordsEnd = std::max(recordsEnd, slot.Offset + slot.Size);
+
+			return recordsEnd;
+		}
+
+		class RecordReader {
+		public:
+			RecordReader(const uint8_t* pData, uint64_t size)
+					: m_pData(pData)
+					, m_size(size)
+					, m_offset(0)
+			{}
+
+		public:
+			const uint8_t* advance(uint64_t numBytes) {
+				if (numBytes > m_size - m_offset)
+					CATAPULT_THROW_RUNTIME_ERROR_2("block record is truncated", m_size, m_offset + numBytes);
+
+				const auto* pData = m_pData + m_offset;
+				m_offset += numBytes;
+				return pData;
+			}
+
+			template<typename T>
+			T peek() const {
+				if (sizeof(T) > m_size - m_offset)
+					CATAPULT_THROW_RUNTIME_ERROR_2("block record is truncated", m_size, m_offset + sizeof(T));
+
+				T value;
+				std::memcpy(static_cast<void*>(&value), m_pData + m_offset, sizeof(T));
+				return value;
+			}
+
+			template<typename T>
+			T read() {
+				auto value = peek<T>();
+				m_offset += sizeof(T);
+				return value;
+			}
+
+		private:
+			const uint8_t* m_pData;
+			uint64_t m_size;
+			uint64_t m_offset;
+		};
+
+		std::vector<uint8_t> SerializeRecord(const BlockElement& blockElement) {
+			const auto& block = blockElement.Block;
+			auto numTransactions = static_cast<uint32_t>(blockElement.Transactions.size());
+			auto numRoots = static_cast<uint32_t>(blockElement.SubCacheMerkleRoots.size());
+			auto recordSize = block.Size
+					+ 2 * Hash256_Size
+					+ sizeof(uint32_t) + 2 * numTransactions * Hash256_Size
+					+ sizeof(uint32_t) + numRoots * Hash256_Size;
+
+			std::vector<uint8_t> record((recordSize + Record_Alignment - 1) / Record_Alignment * Record_Alignment);
+			auto* pData = record.data();
+			auto append = [&pData](const void* pSource, size_t size) {
+				std::memcpy(pData, pSource, size);
+				pData += size;
+			};
+
+			// 1. write constant size data
+			append(&block, block.Size);
+			append(blockElement.EntityHash.data(), Hash256_Size);
+			append(blockElement.GenerationHash.data(), Hash256_Size);
+
+			// 2. write transaction hashes
+			append(&numTransactions, sizeof(uint32_t));
+			for (const auto& transactionElement : blockElement.Transactions) {
+				append(transactionElement.EntityHash.data(), Hash256_Size);
+				append(transactionElement.MerkleComponentHash.data(), Hash256_Size);
+			}
+
+			// 3. write sub cache merkle roots
+			append(&numRoots, sizeof(uint32_t));
+			for (const auto& root : blockElement.SubCacheMerkleRoots)
+				append(root.data(), Hash256_Size);
+
+			return record;
+		}
+
+		/// Block element sharing ownership of the memory holding its block.
+		struct MappedBlockElement {
+		public:
+			MappedBlockElement(const std::shared_ptr<const void>& pOwner, const Block& block)
+					: pMemoryOwner(pOwner)
+					, Element(block)
+			{}
+
+		public:
+			std::shared_ptr<const void> pMemoryOwner;
+			BlockElement Element;
+		};
+	}
+
+	// region MappedSegment / SegmentWriter
+
+	class PackedBlockStorage::MappedSegment {
+	public:
+		MappedSegment(const std::string& blocksPath, const std::string& offsetsPath)
+				: m_blocksMapping(blocksPath.c_str(), boost::interprocess::read_only)
+				, m_blocksRegion(m_blocksMapping, boost::interprocess::read_only)
+				, m_offsetsMapping(offsetsPath.c_str(), boost::interprocess::read_only)
+				, m_offsetsRegion(m_offsetsMapping, boost::interprocess::read_only) {
+			if (Offsets_File_Size > m_offsetsRegion.get_size())
+				CATAPULT_THROW_RUNTIME_ERROR_1("offsets file has invalid size", m_offsetsRegion.get_size());
+		}
+
+	public:
+		/// Gets a pointer to the mapped blocks data.
+		const uint8_t* data() const {
+			return static_cast<const uint8_t*>(m_blocksRegion.get_address());
+		}
+
+		/// Gets the size of the mapped blocks data.
+		uint64_t size() const {
+			return m_blocksRegion.get_size();
+		}
+
+		/// Gets the offsets slot for the block at \a height.
+		OffsetsSlot slot(Height height) const {
+			OffsetsSlot slot;
+			const auto* pSlots = static_cast<const uint8_t*>(m_offsetsRegion.get_address());
+			std::memcpy(&slot, pSlots + GetSegmentIndex(height) * sizeof(OffsetsSlot), sizeof(OffsetsSlot));
+			return slot;
+		}
+
+	private:
+		boost::interprocess::file_mapping m_blocksMapping;
+		boost::interprocess::mapped_region m_blocksRegion;
+		boost::interprocess::file_mapping m_offsetsMapping;
+		boost::interprocess::mapped_region m_offsetsRegion;
+	};
+
+	struct PackedBlockStorage::SegmentWriter {
+	public:
+		SegmentWriter(const std::string& baseDirectory, uint64_t segmentId)
+				: SegmentId(segmentId)
+				, BlocksFile(GetSegmentPath(baseDirectory, segmentId, Blocks_File_Extension), OpenMode::Read_Append, LockMode::None)
+				, OffsetsFile(GetSegmentPath(baseDirectory, segmentId, Offsets_File_Extension), OpenMode::Read_Append, LockMode::None)
+				, HashesFile(GetSegmentPath(baseDirectory, segmentId, Hashes_File_Extension), OpenMode::Read_Append, LockMode::None) {
+			// preallocate fixed-width files so that they can be mapped and indexed directly
+			EnsureMinimumSize(OffsetsFile, Offsets_File_Size);
+			EnsureMinimumSize(HashesFile, Hashes_File_Size);
+			RecordsEnd = FindRecordsEnd(OffsetsFile);
+		}
+
+	public:
+		uint64_t SegmentId;
+		RawFile BlocksFile;
+		RawFile OffsetsFile;
+		RawFile HashesFile;
+		uint64_t RecordsEnd;
+	};
+
+	struct PackedBlockStorage::BlockRecord {
+		std::shared_ptr<const MappedSegment> pSegment;
+		const uint8_t* pData;
+		uint64_t Size;
+	};
+
+	// endregion
+
+	PackedBlockStorage::PackedBlockStorage(const std::string& dataDirectory)
+			: m_dataDirectory(dataDirectory)
+			, m_chainHeight(LoadChainHeight(m_dataDirectory))
+	{}
+
+	PackedBlockStorage::~PackedBlockStorage() = default;
+
+	Height PackedBlockStorage::chainHeight() const {
+		return m_chainHeight;
+	}
+
+	std::shared_ptr<const PackedBlockStorage::MappedSegment> PackedBlockStorage::getSegment(
+			uint64_t segmentId,
+			uint64_t minSize) const {
+		{
+			utils::SpinLockGuard guard(m_segmentsLock);
+			auto iter = m_segments.find(segmentId);
+			if (m_segments.cend() != iter && iter->second->size() >= minSize)
+				return iter->second;
+		}
+
+		// map (or remap after growth) the segment outside of the lock; outstanding blocks keep previous mappings alive
+		// (blocks files grow in extents, so a segment is only remapped when a record is appended past its preallocated end)
+		auto blocksPath = GetSegmentPath(m_dataDirectory, segmentId, Blocks_File_Extension);
+		auto offsetsPath = GetSegmentPath(m_dataDirectory, segmentId, Offsets_File_Extension);
+		if (!IsNonEmptyFile(blocksPath) || !IsNonEmptyFile(offsetsPath))
+			CATAPULT_THROW_RUNTIME_ERROR_1("block segment is not present in storage", segmentId);
+
+		auto pSegment = std::make_shared<const MappedSegment>(blocksPath, offsetsPath);
+
+		utils::SpinLockGuard guard(m_segmentsLock);
+		m_segments[segmentId] = pSegment;
+		return pSegment;
+	}
+
+	PackedBlockStorage::BlockRecord PackedBlockStorage::loadBlockRecord(Height height) const {
+		if (height > chainHeight())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
+
+		auto segmentId = GetSegmentId(height);
+		auto pSegment = getSegment(segmentId, 0);
+		auto slot = pSegment->slot(height);
+		if (0 == slot.Size)
+			CATAPULT_THROW_RUNTIME_ERROR_1("block is not present in storage at height", height);
+
+		auto recordEnd = slot.Offset + slot.Size;
+		if (recordEnd > pSegment->size()) {
+			pSegment = getSegment(segmentId, recordEnd);
+			if (recordEnd > pSegment->size())
+				CATAPULT_THROW_RUNTIME_ERROR_1("block record exceeds segment at height", height);
+		}
+
+		const auto* pData = pSegment->data() + slot.Offset;
+		return { std::move(pSegment), pData, slot.Size };
+	}
+
+	namespace {
+		const Block& ReadRecordBlock(RecordReader& reader) {
+			auto size = reader.peek<uint32_t>();
+			if (size < sizeof(Block))
+				CATAPULT_THROW_RUNTIME_ERROR_1("block record contains block with invalid size", size);
+
+			return *reinterpret_cast<const Block*>(reader.advance(size));
+		}
+	}
+
+	std::shared_ptr<const model::Block> PackedBlockStorage::loadBlock(Height height) const {
+		auto record = loadBlockRecord(height);
+		RecordReader reader(record.pData, record.Size);
+		const auto& block = ReadRecordBlock(reader);
+
+		// the block aliases the mapping, which is kept alive as long as the block is
+		return std::shared_ptr<const Block>(std::move(record.pSegment), &block);
+	}
+
+	std::shared_ptr<const model::BlockElement> PackedBlockStorage::loadBlockElement(Height height) const {
+		auto record = loadBlockRecord(height);
+		RecordReader reader(record.pData, record.Size);
+		const auto& block = ReadRecordBlock(reader);
+
+		auto pMappedBlockElement = std::make_shared<MappedBlockElement>(std::move(record.pSegment), block);
+		auto& blockElement = pMappedBlockElement->Element;
+
+		// read metadata
+		std::memcpy(blockElement.EntityHash.data(), reader.advance(Hash256_Size), Hash256_Size);
+		std::memcpy(blockElement.GenerationHash.data(), reader.advance(Hash256_Size), Hash256_Size);
+
+		// read transaction hashes
+		auto numTransactions = reader.read<uint32_t>();
+		const auto* pTransactionHashes = reader.advance(2 * static_cast<uint64_t>(numTransactions) * Hash256_Size);
+		for (const auto& transaction : block.Transactions()) {
+			if (blockElement.Transactions.size() == numTransactions)
+				CATAPULT_THROW_RUNTIME_ERROR_1("block record has too few transaction hashes at height", height);
+
+			blockElement.Transactions.push_back(model::TransactionElement(transaction));
+			auto& transactionElement = blockElement.Transactions.back();
+			std::memcpy(transactionElement.EntityHash.data(), pTransactionHashes, Hash256_Size);
+			std::memcpy(transactionElement.MerkleComponentHash.data(), pTransactionHashes + Hash256_Size, Hash256_Size);
+			pTransactionHashes += 2 * Hash256_Size;
+		}
+
+		// read sub cache merkle roots
+		auto numRoots = reader.read<uint32_t>();
+		const auto* pRoots = reader.advance(static_cast<uint64_t>(numRoots) * Hash256_Size);
+		blockElement.SubCacheMerkleRoots.resize(numRoots);
+		std::memcpy(static_cast<void*>(blockElement.SubCacheMerkleRoots.data()), pRoots, numRoots * Hash256_Size);
+
+		return std::shared_ptr<const BlockElement>(pMappedBlockElement, &blockElement);
+	}
+
+	model::HashRange PackedBlockStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		auto currentHeight = chainHeight();
+		if (Height(0) == height || currentHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((currentHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+		while (numHashes) {
+			auto hashesPath = GetSegmentPath(m_dataDirectory, GetSegmentId(height), Hashes_File_Extension);
+			RawFile hashesFile(hashesPath, OpenMode::Read_Only, LockMode::None);
+			hashesFile.seek(GetSegmentIndex(height) * Hash256_Size);
+
+			auto count = std::min<size_t>(numHashes, Blocks_Per_Segment - GetSegmentIndex(height));
+			hashesFile.read(MutableRawBuffer(pData, count * Hash256_Size));
+
+			pData += count * Hash256_Size;
+			numHashes -= count;
+			height = height + Height(count);
+		}
+
+		return range;
+	}
+
+	PackedBlockStorage::SegmentWriter& PackedBlockStorage::getWriter(uint64_t segmentId) {
+		if (!m_pWriter || segmentId != m_pWriter->SegmentId) {
+			m_pWriter.reset();
+			m_pWriter = std::make_unique<SegmentWriter>(m_dataDirectory, segmentId);
+		}
+
+		return *m_pWriter;
+	}
+
+	void PackedBlockStorage::setChainHeight(Height height) {
+		RawFile indexFile(GetIndexPath(m_dataDirectory), OpenMode::Read_Write);
+		Write(indexFile, height);
+		m_chainHeight = height;
+	}
+
+	void PackedBlockStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto height = blockElement.Block.Height;
+		if (height != chainHeight() + Height(1))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
+
+		auto& writer = getWriter(GetSegmentId(height));
+
+		// 1. append the (padded) record; existing records are never modified so that outstanding mappings stay valid
+		auto record = SerializeRecord(blockElement);
+		OffsetsSlot slot;
+		slot.Offset = writer.RecordsEnd;
+		slot.Size = record.size();
+		if (writer.BlocksFile.size() < slot.Offset + slot.Size)
+			EnsureMinimumSize(writer.BlocksFile, CalculateBlocksFileCapacity(writer.BlocksFile.size(), slot.Offset + slot.Size));
+
+		writer.BlocksFile.seek(slot.Offset);
+		writer.BlocksFile.write(record);
+		writer.RecordsEnd += slot.Size;
+
+		// 2. make the record durable before it is referenced
+		writer.BlocksFile.sync();
+
+		// 3. point the offsets slot at the new record and save the block hash
+		writer.OffsetsFile.seek(GetSegmentIndex(height) * sizeof(OffsetsSlot));
+		writer.OffsetsFile.write({ reinterpret_cast<const uint8_t*>(&slot), sizeof(OffsetsSlot) });
+		writer.HashesFile.seek(GetSegmentIndex(height) * Hash256_Size);
+		writer.HashesFile.write(blockElement.EntityHash);
+
+		// 4. make the slot and hash durable before the chain height covers them
+		writer.OffsetsFile.sync();
+		writer.HashesFile.sync();
+		setChainHeight(height);
+	}
+
+	void PackedBlockStorage::dropBlocksAfter(Height height) {
+		setChainHeight(height);
+	}
+
+	void PackedBlockStorage::pruneBlocksBefore(Height pruneHeight) {
+		if (pruneHeight > chainHeight())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("prune requested with height", pruneHeight);
+
+		// only prune segments that do not contain any heights at or after pruneHeight (segment zero is always kept)
+		for (auto segmentId = GetSegmentId(pruneHeight); segmentId > 1; --segmentId) {
+			auto prunedSegmentId = segmentId - 1;
+			if (!boost::filesystem::remove(GetSegmentPath(m_dataDirectory, prunedSegmentId, Blocks_File_Extension)))
+				break;
+
+			boost::filesystem::remove(GetSegmentPath(m_dataDirectory, prunedSegmentId, Offsets_File_Extension));
+			if (m_pWriter && prunedSegmentId == m_pWriter->SegmentId)
+				m_pWriter.reset();
+
+			utils::SpinLockGuard guard(m_segmentsLock);
+			m_segments.erase(prunedSegmentId);
+			CATAPULT_LOG(debug) << "pruned block segment " << prunedSegmentId;
+		}
+	}
+
+	void CopyBlocks(const BlockStorage& source, LightBlockStorage& destination) {
+		auto sourceHeight = source.chainHeight();
+		for (auto height = destination.chainHeight() + Height(1); height <= sourceHeight; height = height + Height(1))
+			destination.saveBlock(*source.loadBlockElement(height));
+	}
+}}
@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BlockStorage.h"
+#include "RawFile.h"
+#include "catapult/utils/SpinLock.h"
+#include <map>
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Packed file-based block storage.
+	/// \note Blocks are appended to large segment files, each holding a fixed number of heights, and are located via
+	///       a fixed-width height-to-offset index. Segments are memory-mapped when read and loaded blocks alias the mapping.
+	/// \note Segment blocks files are preallocated in geometrically growing extents, so they are only remapped after growth.
+	/// \note Records of dropped (or overwritten) blocks are never modified because they can still be mapped, so their space is
+	///       only reclaimed when their segment is pruned. CopyBlocks (e.g. via packblocks) writes segments without unreferenced records.
+	class PackedBlockStorage final : public PrunableBlockStorage {
+	public:
+		/// Creates a packed file-based block storage, where blocks will be stored inside \a dataDirectory.
+		/// \note Throws when \a dataDirectory contains blocks stored by FileBlockStorage but no packed blocks.
+		explicit PackedBlockStorage(const std::string& dataDirectory);
+
+		/// Destroys the storage.
+		~PackedBlockStorage() override;
+
+	public:
+		Height chainHeight() const override;
+
+	public:
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+	public:
+		/// Prunes all whole segments containing only blocks before \a height.
+		/// \note The segment containing the nemesis block is never pruned and hashes of pruned blocks are preserved.
+		void pruneBlocksBefore(Height height) override;
+
+	private:
+		struct BlockRecord;
+		class MappedSegment;
+		struct SegmentWriter;
+
+		BlockRecord loadBlockRecord(Height height) const;
+		std::shared_ptr<const MappedSegment> getSegment(uint64_t segmentId, uint64_t minSize) const;
+		SegmentWriter& getWriter(uint64_t segmentId);
+		void setChainHeight(Height height);
+
+	private:
+		std::string m_dataDirectory;
+		Height m_chainHeight;
+		std::unique_ptr<SegmentWriter> m_pWriter;
+
+		mutable std::map<uint64_t, std::shared_ptr<const MappedSegment>> m_segments;
+		mutable utils::SpinLock m_segmentsLock;
+	};
+
+	/// Copies all blocks in \a source above the chain height of \a destination into \a destination.
+	/// \note All copied blocks must be present (unpruned) in \a source.
+	void CopyBlocks(const BlockStorage& source, LightBlockStorage& destination);
+}}
@@ -46,6 +46,7 @@ namespace catapult { namespace io {
 		static const char* Error_Write = "couldn't write to file";
 		static const char* Error_Read = "couldn't read from file";
 		static const char* Error_Seek = "couldn't seek in file";
+		static const char* Error_Sync = "couldn't synchronize file";
 		static const char* Error_Desc = "invalid file descriptor";
 
 #ifdef _MSC_VER
@@ -64,6 +65,7 @@ namespace catapult { namespace io {
 		constexpr auto read = ::_read;
 		constexpr auto lseek = ::_lseeki64;
 		constexpr auto fstat = ::_fstati64;
+		constexpr auto fsync = ::_commit;
 		using StatStruct = struct ::_stat64;
 
 		template<typename TSize>
@@ -154,6 +156,10 @@ namespace catapult { namespace io {
 			return offset == r;
 		}
 
+		bool nemSync(int fd) {
+			return 0 == fsync(fd);
+		}
+
 		bool nemFileSize(int fd, uint64_t& fileSize) {
 			StatStruct st;
 			fileSize = 0;
@@ -253,6 +259,11 @@ namespace catapult { namespace io {
 		m_position = position;
 	}
 
+	void RawFile::sync() {
+		if (!nemSync(m_fd.raw()))
+			CATAPULT_THROW_AND_LOG_RAW_FILE_ERROR(Error_Sync);
+	}
+
 	uint64_t RawFile::size() const {
 		return m_fileSize;
 	}
@@ -260,4 +271,21 @@ namespace catapult { namespace io {
 	uint64_t RawFile::position() const {
 		return m_position;
 	}
+
+	void SyncDirectory(const std::string& directoryPath) {
+#ifdef _MSC_VER
+		// directories cannot be opened via the low-level api, and ntfs journals directory changes
+		static_cast<void>(directoryPath);
+#else
+		auto fd = ::open(directoryPath.c_str(), O_RDONLY);
+		auto isSynchronized = Invalid_Descriptor != fd && nemSync(fd);
+		if (Invalid_Descriptor != fd)
+			::close(fd);
+
+		if (!isSynchronized) {
+			CATAPULT_LOG(error) << Error_Sync << " " << directoryPath;
+			CATAPULT_THROW_FILE_IO_ERROR(Error_Sync);
+		}
+#endif
+	}
 }}
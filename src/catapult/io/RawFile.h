@@ -71,6 +71,10 @@ namespace catapult { namespace io {
 		/// Throws catapult_file_io_error exception if requested amount of data could not be read.
 		void read(const MutableRawBuffer& dataBuffer);
 
+		/// Synchronizes all data written to the file with the storage device.
+		/// Throws catapult_file_io_error exception if synchronization has failed.
+		void sync();
+
 		/// Returns size of the file.
 		uint64_t size() const;
 
@@ -99,4 +103,9 @@ namespace catapult { namespace io {
 		uint64_t m_fileSize;
 		uint64_t m_position;
 	};
+
+	/// Synchronizes the entries (e.g. created or renamed files) of the directory pointed to by \a directoryPath
+	/// with the storage device.
+	/// Throws catapult_file_io_error exception if synchronization has failed.
+	void SyncDirectory(const std::string& directoryPath);
 }}
@@ -84,9 +84,10 @@ namespace catapult { namespace ionet {
 					return;
 				}
 
+				// write the header and all data buffers with a single gathered write directly from the memory backing the payload
 				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+				boost::asio::async_write(m_socket, pContext->buffers(), m_wrapper.wrap([pContext](const auto& ec, auto) {
+					pContext->complete(ec);
 				}));
 			}
 
@@ -95,47 +96,29 @@ namespace catapult { namespace ionet {
 			public:
 				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
 						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
-				{}
-
-			public:
-				auto headerBuffer() const {
+						, m_callback(callback) {
 					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+					m_buffers.reserve(1 + m_payload.buffers().size());
+					m_buffers.push_back(boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header)));
+					for (const auto& rawBuffer : m_payload.buffers())
+						m_buffers.push_back(boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
 				}
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+			public:
+				const std::vector<boost::asio::const_buffer>& buffers() const {
+					return m_buffers;
 				}
 
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
-					}
-
-					return false;
+				void complete(const boost::system::error_code& ec) {
+					m_callback(mapWriteErrorCodeToSocketOperationCode(ec));
 				}
 
 			private:
 				const PacketPayload m_payload;
 				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				std::vector<boost::asio::const_buffer> m_buffers;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
-
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
-			}
-
 		public:
 			void read(const PacketSocket::ReadCallback& callback, bool allowMultiple) {
 				// try to extract a packet from the working buffer
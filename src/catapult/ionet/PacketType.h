@@ -119,6 +119,18 @@ namespace catapult { namespace ionet {
 	/* Multisig state path has been requested by a client. */ \
 	ENUM_VALUE(Multisig_State_Path, FACILITY_BASED_CODE(800, Multisig)) \
 	\
+	/* Account state multiproof has been requested by a client. */ \
+	ENUM_VALUE(Account_State_Multiproof, FACILITY_BASED_CODE(900, Core)) \
+	\
+	/* Namespace state multiproof has been requested by a client. */ \
+	ENUM_VALUE(Namespace_State_Multiproof, FACILITY_BASED_CODE(900, Namespace)) \
+	\
+	/* Mosaic state multiproof has been requested by a client. */ \
+	ENUM_VALUE(Mosaic_State_Multiproof, FACILITY_BASED_CODE(900, Mosaic)) \
+	\
+	/* Multisig state multiproof has been requested by a client. */ \
+	ENUM_VALUE(Multisig_State_Multiproof, FACILITY_BASED_CODE(900, Multisig)) \
+	\
 	/* diagnostic packets have types [1100, 2000) */ \
 	\
 	/* Request for the current diagnostic counter values. */ \
@@ -51,7 +51,9 @@ namespace catapult { namespace local {
 					, m_config(m_pBootstrapper->config())
 					, m_nodes(m_config.Node.MaxTrackedNodes)
 					, m_catapultCache({}) // note that subcaches are added in boot
-					, m_storage(m_pBootstrapper->subscriptionManager().createBlockStorage())
+					, m_storage(
+							m_pBootstrapper->subscriptionManager().createBlockStorage(),
+							GetBlockStorageCacheOptions(m_config.Node))
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(GetUtCacheOptions(m_config.Node)))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pStateChangeSubscriber(m_pBootstrapper->subscriptionManager().createStateChangeSubscriber())
@@ -74,6 +76,9 @@ namespace catapult { namespace local {
 
 				CATAPULT_LOG(debug) << "initializing cache";
 				m_catapultCache = m_pluginManager.createCache();
+				auto pStateHashPool = m_pBootstrapper->pool().pushIsolatedPool("state hash");
+				m_catapultCache.setMerkleRootUpdatePool(pStateHashPool);
+				m_pluginManager.setComputationPool(pStateHashPool);
 
 				CATAPULT_LOG(debug) << "registering counters";
 				registerCounters();
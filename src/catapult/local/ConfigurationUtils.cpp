@@ -28,4 +28,8 @@ namespace catapult { namespace local {
 				config.UnconfirmedTransactionsCacheMaxResponseSize.bytes(),
 				config.UnconfirmedTransactionsCacheMaxSize);
 	}
+
+	io::BlockStorageCacheOptions GetBlockStorageCacheOptions(const config::NodeConfiguration& config) {
+		return { config.BlockStorageCacheMaxBlocks, config.BlockStorageCacheMaxHashes };
+	}
 }}
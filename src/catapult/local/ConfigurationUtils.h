@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/cache/MemoryUtCache.h"
+#include "catapult/io/BlockStorageCache.h"
 
 namespace catapult { namespace config { struct NodeConfiguration; } }
 
@@ -27,4 +28,7 @@ namespace catapult { namespace local {
 
 	/// Extracts unconfirmed transactions cache options from \a config.
 	cache::MemoryCacheOptions GetUtCacheOptions(const config::NodeConfiguration& config);
+
+	/// Extracts block storage cache options from \a config.
+	io::BlockStorageCacheOptions GetBlockStorageCacheOptions(const config::NodeConfiguration& config);
 }}
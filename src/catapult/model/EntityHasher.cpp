@@ -95,4 +95,31 @@ namespace catapult { namespace model {
 				transactionElement.EntityHash,
 				transactionRegistry);
 	}
+
+	void UpdateHashes(const TransactionRegistry& transactionRegistry, const std::vector<TransactionElement*>& transactionElements) {
+		// each entity hash is calculated over three buffers (see CalculateHash)
+		constexpr size_t Num_Parts_Per_Entity = 3;
+		std::vector<RawBuffer> buffers;
+		buffers.reserve(Num_Parts_Per_Entity * transactionElements.size());
+		for (const auto* pTransactionElement : transactionElements) {
+			const auto& transaction = pTransactionElement->Transaction;
+			const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
+
+			buffers.push_back({ transaction.Signature.data(), Signature_Size / 2 });
+			buffers.push_back(transaction.Signer);
+			buffers.push_back(plugin.dataBuffer(transaction));
+		}
+
+		std::vector<Hash256> entityHashes(transactionElements.size());
+		crypto::Sha3_256_Multi(buffers.data(), Num_Parts_Per_Entity, entityHashes.data(), entityHashes.size());
+
+		for (auto i = 0u; i < transactionElements.size(); ++i) {
+			auto& transactionElement = *transactionElements[i];
+			transactionElement.EntityHash = entityHashes[i];
+			transactionElement.MerkleComponentHash = CalculateMerkleComponentHash(
+					transactionElement.Transaction,
+					transactionElement.EntityHash,
+					transactionRegistry);
+		}
+	}
 }}
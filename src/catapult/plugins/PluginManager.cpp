@@ -19,13 +19,42 @@
 **/
 
 #include "PluginManager.h"
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
 #include <boost/filesystem/path.hpp>
 
 namespace catapult { namespace plugins {
 
+	namespace {
+		constexpr size_t Num_Patricia_Tree_Node_Cache_Shards = 16;
+
+		std::shared_ptr<cache::PatriciaTreeNodeCache> CreatePatriciaTreeNodeCache(
+				const model::BlockChainConfiguration& config,
+				const StorageConfiguration& storageConfig) {
+			// nodes are only read from storage when patricia trees are stored in the cache database
+			if (!config.ShouldEnableVerifiableState || !storageConfig.PreferCacheDatabase)
+				return nullptr;
+
+			if (0 == storageConfig.PatriciaTreeNodeCacheMaxSize)
+				return nullptr;
+
+			return std::make_shared<cache::PatriciaTreeNodeCache>(
+					storageConfig.PatriciaTreeNodeCacheMaxSize,
+					Num_Patricia_Tree_Node_Cache_Shards);
+		}
+
+		std::shared_ptr<const cache::RocksTuning> CreateCacheDatabaseTuning(const StorageConfiguration& storageConfig) {
+			if (!storageConfig.PreferCacheDatabase)
+				return nullptr;
+
+			return std::make_shared<cache::RocksTuning>(storageConfig.CacheDatabaseTuning);
+		}
+	}
+
 	PluginManager::PluginManager(const model::BlockChainConfiguration& config, const StorageConfiguration& storageConfig)
 			: m_config(config)
 			, m_storageConfig(storageConfig)
+			, m_pPatriciaTreeNodeCache(CreatePatriciaTreeNodeCache(m_config, m_storageConfig))
+			, m_pCacheDatabaseTuning(CreateCacheDatabaseTuning(m_storageConfig))
 	{}
 
 	// region config
@@ -42,10 +71,33 @@ namespace catapult { namespace plugins {
 		if (!m_storageConfig.PreferCacheDatabase)
 			return cache::CacheConfiguration();
 
-		return cache::CacheConfiguration(
+		auto cacheConfig = cache::CacheConfiguration(
 				(boost::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
 				m_storageConfig.MaxCacheDatabaseWriteBatchSize,
 				m_config.ShouldEnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
+		cacheConfig.TreeNodeCache = m_pPatriciaTreeNodeCache;
+		cacheConfig.DatabaseTuning = m_pCacheDatabaseTuning;
+		return cacheConfig;
+	}
+
+	const cache::PatriciaTreeNodeCache* PluginManager::patriciaTreeNodeCache() const {
+		return m_pPatriciaTreeNodeCache.get();
+	}
+
+	const cache::RocksTuning* PluginManager::cacheDatabaseTuning() const {
+		return m_pCacheDatabaseTuning.get();
+	}
+
+	// endregion
+
+	// region pool
+
+	void PluginManager::setComputationPool(const std::weak_ptr<thread::IoServiceThreadPool>& pComputationPool) {
+		m_pComputationPool = pComputationPool;
+	}
+
+	std::shared_ptr<thread::IoServiceThreadPool> PluginManager::computationPool() const {
+		return m_pComputationPool.lock();
 	}
 
 	// endregion
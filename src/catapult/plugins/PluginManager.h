@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/cache/CacheConfiguration.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache_db/RocksTuning.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NotificationPublisher.h"
@@ -31,6 +32,9 @@
 #include "catapult/validators/DemuxValidatorBuilder.h"
 #include "catapult/validators/ValidatorTypes.h"
 #include "catapult/plugins.h"
+#include <memory>
+
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
 
 namespace catapult { namespace plugins {
 
@@ -44,6 +48,15 @@ namespace catapult { namespace plugins {
 
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
+
+		/// Maximum number of decoded patricia tree nodes cached in memory (\c 0 disables the cache).
+		uint32_t PatriciaTreeNodeCacheMaxSize = 0;
+
+		/// Maximum number of keys in a state multiproof request (\c 0 rejects all state multiproof requests).
+		uint32_t MaxStateMultiproofKeys = 0;
+
+		/// Cache database tuning settings.
+		cache::RocksTuningSettings CacheDatabaseTuning;
 	};
 
 	/// A manager for registering plugins.
@@ -87,6 +100,22 @@ namespace catapult { namespace plugins {
 		/// Gets the cache configuration for cache with \a name.
 		cache::CacheConfiguration cacheConfig(const std::string& name) const;
 
+		/// Gets the patricia tree node cache shared by all caches or \c nullptr if it is disabled.
+		const cache::PatriciaTreeNodeCache* patriciaTreeNodeCache() const;
+
+		/// Gets the cache database tuning shared by all caches or \c nullptr if cache databases are disabled.
+		const cache::RocksTuning* cacheDatabaseTuning() const;
+
+		// endregion
+
+		// region pool
+
+		/// Sets the pool (\a pComputationPool) that plugins can use for parallelizing expensive calculations.
+		void setComputationPool(const std::weak_ptr<thread::IoServiceThreadPool>& pComputationPool);
+
+		/// Gets the pool that plugins can use for parallelizing expensive calculations or \c nullptr if none is available.
+		std::shared_ptr<thread::IoServiceThreadPool> computationPool() const;
+
 		// endregion
 
 		// region transactions
@@ -195,6 +224,9 @@ namespace catapult { namespace plugins {
 	private:
 		model::BlockChainConfiguration m_config;
 		StorageConfiguration m_storageConfig;
+		std::shared_ptr<cache::PatriciaTreeNodeCache> m_pPatriciaTreeNodeCache;
+		std::shared_ptr<const cache::RocksTuning> m_pCacheDatabaseTuning;
+		std::weak_ptr<thread::IoServiceThreadPool> m_pComputationPool;
 		model::TransactionRegistry m_transactionRegistry;
 		cache::CatapultCacheBuilder m_cacheBuilder;
 
@@ -0,0 +1,110 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PosImportances.h"
+#include "catapult/thread/BlockingParallelFor.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
+
+namespace catapult { namespace state {
+
+	namespace {
+		// minimum number of accounts processed by a single thread (smaller partitions are dominated by thread overhead)
+		constexpr size_t Min_Accounts_Per_Partition = 10'000;
+
+		// calculates floor(floor(multiplicand * multiplier / divisor1) / divisor2) with 128-bit intermediate precision
+#ifdef __SIZEOF_INT128__
+		__extension__ using NativeUint128 = unsigned __int128;
+
+		uint64_t MultiplyDivide(uint64_t multiplicand, uint64_t multiplier, uint64_t divisor1, uint64_t divisor2) {
+			return static_cast<uint64_t>(static_cast<NativeUint128>(multiplicand) * multiplier / divisor1 / divisor2);
+		}
+#else
+		uint64_t MultiplyDivide(uint64_t multiplicand, uint64_t multiplier, uint64_t divisor1, uint64_t divisor2) {
+			boost::multiprecision::uint128_t result = multiplicand;
+			result *= multiplier;
+			result /= divisor1;
+			result /= divisor2;
+			return static_cast<uint64_t>(result);
+		}
+#endif
+
+		template<typename TAction>
+		void ForEachPartition(size_t numAccounts, thread::IoServiceThreadPool* pPool, TAction action) {
+			auto numWorkerThreads = pPool ? pPool->numWorkerThreads() : 1;
+			auto numPartitions = std::max<size_t>(1, std::min<size_t>(numWorkerThreads, numAccounts / Min_Accounts_Per_Partition));
+			auto partitionSize = numAccounts / numPartitions;
+			auto processPartition = [numAccounts, numPartitions, partitionSize, &action](size_t partitionIndex) {
+				auto startIndex = partitionIndex * partitionSize;
+				auto endIndex = numPartitions == partitionIndex + 1 ? numAccounts : startIndex + partitionSize;
+				action(partitionIndex, startIndex, endIndex);
+			};
+
+			// the calling thread processes partitions too, so small inputs are never handed off to the pool
+			if (pPool)
+				thread::BlockingParallelFor(pPool->service(), numWorkerThreads, numPartitions, processPartition);
+			else
+				processPartition(0);
+		}
+
+		uint64_t CalculateSum(const std::vector<Amount>& balances, thread::IoServiceThreadPool* pPool) {
+			// partial sums are combined with (wrapping) integer addition, so the result is independent of the partitioning
+			std::vector<uint64_t> partialSums(pPool ? std::max<size_t>(1, pPool->numWorkerThreads()) : 1, 0);
+			ForEachPartition(balances.size(), pPool, [&balances, &partialSums](auto partitionIndex, auto startIndex, auto endIndex) {
+				uint64_t sum = 0;
+				for (auto i = startIndex; i < endIndex; ++i)
+					sum += balances[i].unwrap();
+
+				partialSums[partitionIndex] = sum;
+			});
+
+			uint64_t sum = 0;
+			for (auto partialSum : partialSums)
+				sum += partialSum;
+
+			return sum;
+		}
+	}
+
+	void CalculatePosImportances(
+			utils::XemUnit totalChainBalance,
+			const std::vector<Amount>& balances,
+			std::vector<Importance>& importances,
+			thread::IoServiceThreadPool* pPool) {
+		importances.resize(balances.size());
+
+		auto activeBalance = CalculateSum(balances, pPool);
+		if (0 == activeBalance) {
+			std::fill(importances.begin(), importances.end(), Importance());
+			return;
+		}
+
+		auto totalMicroxem = totalChainBalance.microxem().unwrap();
+		auto microxemPerXem = utils::XemUnit(utils::XemAmount(1)).microxem().unwrap();
+		ForEachPartition(balances.size(), pPool, [&balances, &importances, totalMicroxem, activeBalance, microxemPerXem](
+				auto,
+				auto startIndex,
+				auto endIndex) {
+			for (auto i = startIndex; i < endIndex; ++i)
+				importances[i] = Importance(MultiplyDivide(totalMicroxem, balances[i].unwrap(), activeBalance, microxemPerXem));
+		});
+	}
+}}
@@ -0,0 +1,39 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/XemUnit.h"
+#include "catapult/types.h"
+#include <vector>
+
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
+
+namespace catapult { namespace state {
+
+	/// Calculates the proof of stake importances of accounts with \a balances given \a totalChainBalance
+	/// using the worker threads of \a pPool (or only the calling thread when \a pPool is \c nullptr) and stores them in \a importances.
+	/// \note Each importance is proportional to the corresponding balance and is rounded down.
+	/// \note All importances are zero when all balances are zero.
+	void CalculatePosImportances(
+			utils::XemUnit totalChainBalance,
+			const std::vector<Amount>& balances,
+			std::vector<Importance>& importances,
+			thread::IoServiceThreadPool* pPool);
+}}
@@ -29,12 +29,24 @@
 #include "catapult/cache/AggregateUtCache.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/io/AggregateBlockStorage.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PackedBlockStorage.h"
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::unique_ptr<io::PrunableBlockStorage> CreateFileStorage(const config::LocalNodeConfiguration& config) {
+			const auto& dataDirectory = config.User.DataDirectory;
+			if (config.Node.ShouldUsePackedBlockStorage)
+				return std::make_unique<io::PackedBlockStorage>(dataDirectory);
+
+			return std::make_unique<io::FileBlockStorage>(dataDirectory);
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::LocalNodeConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBlockStorage>(m_config.User.DataDirectory)) {
+			, m_pStorage(CreateFileStorage(m_config)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
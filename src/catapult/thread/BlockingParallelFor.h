@@ -0,0 +1,107 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <boost/asio.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace catapult { namespace thread {
+
+	/// Uses \a service and the calling thread to call \a callback for each index in [0, \a numItems) with (at most) \a numWorkers
+	/// additional workers and blocks until all indexes have been processed.
+	/// \note Indexes are claimed dynamically and the calling thread only waits for indexes claimed by other workers,
+	///       so this function can be called by a thread backing \a service and completes even when \a service is not running.
+	/// \note The first exception thrown by \a callback is rethrown on the calling thread.
+	template<typename TWorkCallback>
+	void BlockingParallelFor(boost::asio::io_service& service, size_t numWorkers, size_t numItems, TWorkCallback callback) {
+		// region BlockingParallelContext
+
+		class BlockingParallelContext {
+		public:
+			BlockingParallelContext(size_t numItems, const TWorkCallback& callback)
+					: m_numItems(numItems)
+					, m_callback(callback)
+					, m_nextIndex(0)
+					, m_numProcessedItems(0)
+			{}
+
+		public:
+			void run() {
+				size_t index;
+				while ((index = m_nextIndex++) < m_numItems) {
+					try {
+						m_callback(index);
+					} catch (...) {
+						setException(std::current_exception());
+					}
+
+					if (m_numItems != ++m_numProcessedItems)
+						continue;
+
+					std::lock_guard<std::mutex> guard(m_mutex);
+					m_condition.notify_all();
+				}
+			}
+
+			void wait() {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return m_numItems == m_numProcessedItems; });
+
+				if (m_pException)
+					std::rethrow_exception(m_pException);
+			}
+
+		private:
+			void setException(const std::exception_ptr& pException) {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				if (!m_pException)
+					m_pException = pException;
+			}
+
+		private:
+			size_t m_numItems;
+			TWorkCallback m_callback;
+			std::atomic<size_t> m_nextIndex;
+			std::atomic<size_t> m_numProcessedItems;
+			std::exception_ptr m_pException;
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+		};
+
+		// endregion
+
+		if (0 == numItems)
+			return;
+
+		// each worker captures pContext by value, which keeps that object alive even if the worker starts after all indexes
+		// have been processed (in that case, the worker does not access callback, which might reference destroyed objects)
+		auto pContext = std::make_shared<BlockingParallelContext>(numItems, callback);
+		auto numPostedWorkers = std::min(numWorkers, numItems - 1);
+		for (auto i = 0u; i < numPostedWorkers; ++i)
+			service.post([pContext]() { pContext->run(); });
+
+		pContext->run();
+		pContext->wait();
+	}
+}}
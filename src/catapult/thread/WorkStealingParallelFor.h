@@ -0,0 +1,250 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Future.h"
+#include "catapult/utils/SpinLock.h"
+#include <boost/asio.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace catapult { namespace thread {
+
+	namespace detail {
+		/// Range of chunks owned by a single work stealing worker.
+		/// \note Owner takes chunks from the front and thieves split off the back half.
+		class WorkStealingRange {
+		public:
+			/// Creates an empty range.
+			WorkStealingRange()
+					: m_begin(0)
+					, m_end(0)
+			{}
+
+		public:
+			/// Resets the range to [\a begin, \a end).
+			void reset(size_t begin, size_t end) {
+				utils::SpinLockGuard guard(m_lock);
+				m_begin = begin;
+				m_end = end;
+			}
+
+			/// Tries to take the first chunk from the range and stores its index in \a chunkIndex.
+			bool tryPopFront(size_t& chunkIndex) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_begin == m_end)
+					return false;
+
+				chunkIndex = m_begin++;
+				return true;
+			}
+
+			/// Tries to split off the back half (rounded up) of the range and stores it in [\a begin, \a end).
+			bool trySplit(size_t& begin, size_t& end) {
+				utils::SpinLockGuard guard(m_lock);
+				auto numRemaining = m_end - m_begin;
+				if (0 == numRemaining)
+					return false;
+
+				end = m_end;
+				m_end -= (numRemaining + 1) / 2;
+				begin = m_end;
+				return true;
+			}
+
+		private:
+			size_t m_begin;
+			size_t m_end;
+			utils::SpinLock m_lock;
+		};
+	}
+
+	/// Uses \a service to process \a items with (at most) \a numWorkers work stealing workers and calls \a callback for each chunk
+	/// of (at most) \a chunkSize items.
+	/// Each worker initially owns a contiguous range of chunks; a worker that exhausts its range steals half of the remaining
+	/// chunks of another worker, so a few expensive items do not stall the whole operation.
+	/// \a callback is passed the chunk boundaries, the index of the first item in the chunk and the chunk index.
+	/// A future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> WorkStealingParallelForPartition(
+			boost::asio::io_service& service,
+			TItems& items,
+			size_t numWorkers,
+			size_t chunkSize,
+			TWorkCallback callback) {
+		using IteratorType = decltype(items.begin());
+
+		// region WorkStealingContext
+
+		class WorkStealingContext {
+		public:
+			WorkStealingContext(TItems& items, size_t numWorkers, size_t chunkSize, const TWorkCallback& callback)
+					: m_numItems(items.size())
+					, m_chunkSize(std::max<size_t>(1, chunkSize))
+					, m_callback(callback)
+					, m_numOutstandingWorkers(0) {
+				// precalculate chunk boundaries so that chunks of containers without random access can be located in constant time
+				auto numChunks = (m_numItems + m_chunkSize - 1) / m_chunkSize;
+				m_chunkBoundaries.reserve(numChunks + 1);
+
+				auto iter = items.begin();
+				for (auto i = 0u; i < numChunks; ++i) {
+					m_chunkBoundaries.push_back(iter);
+					std::advance(iter, static_cast<typename IteratorType::difference_type>(chunkItemsCount(i)));
+				}
+
+				m_chunkBoundaries.push_back(iter);
+
+				// distribute chunks evenly across workers
+				m_ranges = std::vector<detail::WorkStealingRange>(std::min(std::max<size_t>(1, numWorkers), numChunks));
+				for (auto i = 0u; i < m_ranges.size(); ++i)
+					m_ranges[i].reset(i * numChunks / m_ranges.size(), (i + 1) * numChunks / m_ranges.size());
+
+				m_numOutstandingWorkers = m_ranges.size();
+			}
+
+		public:
+			size_t numWorkers() const {
+				return m_ranges.size();
+			}
+
+			auto future() {
+				return m_promise.get_future();
+			}
+
+		public:
+			void run(size_t workerIndex) {
+				size_t chunkIndex;
+				auto& range = m_ranges[workerIndex];
+				while (true) {
+					if (!range.tryPopFront(chunkIndex)) {
+						if (!trySteal(workerIndex))
+							break;
+
+						continue;
+					}
+
+					auto startIndex = chunkIndex * m_chunkSize;
+					m_callback(m_chunkBoundaries[chunkIndex], m_chunkBoundaries[chunkIndex + 1], startIndex, chunkIndex);
+				}
+			}
+
+			void complete() {
+				m_promise.set_value(true);
+			}
+
+			void decrementOutstandingWorkers() {
+				if (0 == --m_numOutstandingWorkers)
+					complete();
+			}
+
+		private:
+			size_t chunkItemsCount(size_t chunkIndex) const {
+				return std::min(m_chunkSize, m_numItems - chunkIndex * m_chunkSize);
+			}
+
+			bool trySteal(size_t workerIndex) {
+				for (auto i = 1u; i < m_ranges.size(); ++i) {
+					size_t begin;
+					size_t end;
+					if (!m_ranges[(workerIndex + i) % m_ranges.size()].trySplit(begin, end))
+						continue;
+
+					m_ranges[workerIndex].reset(begin, end);
+					return true;
+				}
+
+				return false;
+			}
+
+		private:
+			size_t m_numItems;
+			size_t m_chunkSize;
+			TWorkCallback m_callback;
+			std::vector<IteratorType> m_chunkBoundaries;
+			std::vector<detail::WorkStealingRange> m_ranges;
+			std::atomic<size_t> m_numOutstandingWorkers;
+			thread::promise<bool> m_promise;
+		};
+
+		// endregion
+
+		// region WorkerGuard
+
+		class WorkerGuard {
+		public:
+			explicit WorkerGuard(WorkStealingContext& context) : m_context(context)
+			{}
+
+			~WorkerGuard() {
+				m_context.decrementOutstandingWorkers();
+			}
+
+		private:
+			WorkStealingContext& m_context;
+		};
+
+		// endregion
+
+		auto pContext = std::make_shared<WorkStealingContext>(items, numWorkers, chunkSize, callback);
+		if (0 == pContext->numWorkers()) {
+			pContext->complete();
+			return pContext->future();
+		}
+
+		for (auto i = 0u; i < pContext->numWorkers(); ++i) {
+			// each worker captures pContext by value, which keeps that object alive
+			service.post([pContext, workerIndex = i]() {
+				WorkerGuard guard(*pContext);
+				pContext->run(workerIndex);
+			});
+		}
+
+		return pContext->future();
+	}
+
+	/// Uses \a service to process \a items with (at most) \a numWorkers work stealing workers and calls \a callback for each item.
+	/// A future is returned that is resolved when all items have been processed.
+	/// \note If \a callback returns \c false, all workers stop and every item that has not yet been passed to \a callback is skipped.
+	///       This differs from ParallelFor, which only stops processing the partition containing the rejected item.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> WorkStealingParallelFor(
+			boost::asio::io_service& service,
+			TItems& items,
+			size_t numWorkers,
+			TWorkCallback callback) {
+		// use multiple chunks per worker so that there is work left to steal when items have skewed costs
+		constexpr size_t Chunks_Per_Worker = 16;
+		auto chunkSize = items.size() / (std::max<size_t>(1, numWorkers) * Chunks_Per_Worker);
+
+		auto pIsAborted = std::make_shared<std::atomic_bool>(false);
+		return WorkStealingParallelForPartition(service, items, numWorkers, chunkSize, [callback, pIsAborted](
+				auto itBegin,
+				auto itEnd,
+				auto startIndex,
+				auto) {
+			auto i = 0u;
+			for (auto iter = itBegin; itEnd != iter && !*pIsAborted; ++iter, ++i) {
+				if (!callback(*iter, startIndex + i))
+					*pIsAborted = true;
+			}
+		});
+	}
+}}
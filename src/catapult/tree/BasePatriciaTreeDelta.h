@@ -35,6 +35,9 @@ namespace catapult { namespace tree {
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
 
+	public:
+		using ChangeSet = PatriciaTreeChangeSet<TEncoder>;
+
 	public:
 		/// Creates a tree around a \a dataSource with root \a rootHash.
 		explicit BasePatriciaTreeDelta(const TDataSource& dataSource, const Hash256& rootHash)
@@ -50,6 +53,13 @@ namespace catapult { namespace tree {
 			return m_tree.root();
 		}
 
+		/// Gets the root hash that uniquely identifies this tree after hashing all in-memory subtrees \a numFanOutLevels
+		/// below the root with \a subtreesHasher.
+		template<typename TSubtreesHasher>
+		Hash256 root(size_t numFanOutLevels, TSubtreesHasher subtreesHasher) const {
+			return m_tree.root(numFanOutLevels, subtreesHasher);
+		}
+
 		/// Gets the base root hash that identifies this tree before any changes are applied.
 		Hash256 baseRoot() const {
 			return m_baseRootHash;
@@ -76,6 +86,11 @@ namespace catapult { namespace tree {
 			return m_tree.unset(key);
 		}
 
+		/// Applies all changes in \a changeSet to the tree.
+		void applyChanges(const ChangeSet& changeSet) {
+			m_tree.applyChanges(changeSet);
+		}
+
 	public:
 		/// Marks all nodes reachable at this point.
 		void setCheckpoint() {
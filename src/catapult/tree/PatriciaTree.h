@@ -20,15 +20,63 @@
 
 #pragma once
 #include "TreeNode.h"
+#include <algorithm>
+#include <iterator>
 
 namespace catapult { namespace tree {
 
+	/// Batch of set and unset operations that can be applied to a patricia tree at once.
+	template<typename TEncoder>
+	class PatriciaTreeChangeSet {
+	public:
+		using KeyType = typename TEncoder::KeyType;
+		using ValueType = typename TEncoder::ValueType;
+
+		/// Change of the value associated with a single (encoded) key path.
+		struct PathChange {
+			/// Key path.
+			TreeNodePath Path;
+
+			/// Encoded value (only valid when IsSet is \c true).
+			Hash256 Value;
+
+			/// \c true if the key should be set, \c false if it should be removed.
+			bool IsSet;
+		};
+
+	public:
+		/// Gets the number of changes.
+		size_t size() const {
+			return m_changes.size();
+		}
+
+		/// Gets all changes in the order they were added.
+		const std::vector<PathChange>& changes() const {
+			return m_changes;
+		}
+
+	public:
+		/// Adds a change setting \a key to \a value.
+		void set(const KeyType& key, const ValueType& value) {
+			m_changes.push_back({ TreeNodePath(TEncoder::EncodeKey(key)), TEncoder::EncodeValue(value), true });
+		}
+
+		/// Adds a change removing the value associated with \a key.
+		void unset(const KeyType& key) {
+			m_changes.push_back({ TreeNodePath(TEncoder::EncodeKey(key)), Hash256(), false });
+		}
+
+	private:
+		std::vector<PathChange> m_changes;
+	};
+
 	/// Represents a compact patricia tree.
 	template<typename TEncoder, typename TDataSource>
 	class PatriciaTree {
 	public:
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
+		using ChangeSet = PatriciaTreeChangeSet<TEncoder>;
 
 	public:
 		/// Creates a tree around a \a dataSource.
@@ -41,6 +89,36 @@ namespace catapult { namespace tree {
 			return m_rootNode.hash();
 		}
 
+		/// Gets the root hash that uniquely identifies this tree after passing all in-memory branch nodes \a numFanOutLevels
+		/// below the root to \a subtreesHasher.
+		/// \note \a subtreesHasher must calculate the hashes of all (independent) subtrees before returning,
+		///       so it can calculate them in parallel; the remaining nodes are hashed on the calling thread.
+		template<typename TSubtreesHasher>
+		Hash256 root(size_t numFanOutLevels, TSubtreesHasher subtreesHasher) const {
+			std::vector<const TreeNode*> subtrees;
+			CollectSubtrees(m_rootNode, numFanOutLevels, subtrees);
+			if (!subtrees.empty())
+				subtreesHasher(subtrees);
+
+			return m_rootNode.hash();
+		}
+
+	private:
+		static void CollectSubtrees(const TreeNode& node, size_t numRemainingLevels, std::vector<const TreeNode*>& subtrees) {
+			// leaf hashes are always calculated eagerly, so only branches need to be collected
+			if (!node.isBranch())
+				return;
+
+			if (0 == numRemainingLevels) {
+				subtrees.push_back(&node);
+				return;
+			}
+
+			node.asBranchNode().forEachLinkedNode([numRemainingLevels, &subtrees](const auto& linkedNode) {
+				CollectSubtrees(linkedNode, numRemainingLevels - 1, subtrees);
+			});
+		}
+
 		// region set
 
 	public:
@@ -53,7 +131,7 @@ namespace catapult { namespace tree {
 
 	private:
 		struct PathValuePairRef {
-			const TreeNodePath& Path;
+			TreeNodePathView Path;
 			const Hash256& Value;
 		};
 
@@ -67,7 +145,7 @@ namespace catapult { namespace tree {
 				const auto& leafNode = node.asLeafNode();
 
 				// if leaf node already points to desired location, just change value
-				if (leafNode.path() == newPair.Path)
+				if (newPair.Path == leafNode.path())
 					return TreeNode(createLeaf(newPair));
 
 				// if the path is different, the leaf node needs to be split into a branch
@@ -79,7 +157,8 @@ namespace catapult { namespace tree {
 		}
 
 		LeafTreeNode createLeaf(const PathValuePairRef& pair) {
-			return LeafTreeNode(pair.Path, pair.Value);
+			// the key path is only viewed during traversal, so it is copied when it is stored in a leaf
+			return LeafTreeNode(TreeNodePath(pair.Path), pair.Value);
 		}
 
 		// this function is called when a branch needs to replace a leaf node
@@ -90,7 +169,7 @@ namespace catapult { namespace tree {
 
 			// create and save the two component nodes
 			auto node1 = LeafTreeNode(leafPath.subpath(differenceIndex + 1), leafNode.value());
-			auto node2 = LeafTreeNode(newPair.Path.subpath(differenceIndex + 1), newPair.Value);
+			auto node2 = LeafTreeNode(TreeNodePath(newPair.Path.subpath(differenceIndex + 1)), newPair.Value);
 
 			// create the branch node with two links
 			auto branchNode = BranchTreeNode(sharedPath);
@@ -125,20 +204,20 @@ namespace catapult { namespace tree {
 			// if it is not completely consumed, a branch is being split
 			auto pNextNode = isBranchPathConsumed ? getLinkedNode(branchNode, newPair.Path.nibbleAt(0)) : nullptr;
 			if (!pNextNode)
-				pNextNode = std::make_unique<TreeNode>();
+				pNextNode = std::make_shared<TreeNode>();
 
 			// attach the new node to the existing node (if there is no existing node, it will be set as a leaf)
 			auto updatedNextNode = set(*pNextNode, { newPair.Path.subpath(differenceIndex + 1), newPair.Value });
 
 			// if the new node is a link, set it directly in the existing branch node
 			if (isBranchPathConsumed) {
-				setLink(branchNode, updatedNextNode, newPair.Path.nibbleAt(0));
+				setLink(branchNode, std::move(updatedNextNode), newPair.Path.nibbleAt(0));
 				return branchNode;
 			}
 
 			// otherwise, create a new branch node at the shared path
 			auto newBranchNode = BranchTreeNode(branchPath.subpath(0, differenceIndex));
-			setLink(newBranchNode, updatedNextNode, newPair.Path.nibbleAt(differenceIndex));
+			setLink(newBranchNode, std::move(updatedNextNode), newPair.Path.nibbleAt(differenceIndex));
 
 			// truncate the path of the original branch node so that it is connected to the new branch node
 			auto branchLinkIndex = branchPath.nibbleAt(differenceIndex);
@@ -162,7 +241,7 @@ namespace catapult { namespace tree {
 		}
 
 	private:
-		bool unset(const TreeNode& node, const TreeNodePath& keyPath, TreeNode& updatedNode, bool& canMerge) {
+		bool unset(const TreeNode& node, const TreeNodePathView& keyPath, TreeNode& updatedNode, bool& canMerge) {
 			// if the node is empty, there is nothing to do
 			if (node.empty())
 				return false;
@@ -203,6 +282,10 @@ namespace catapult { namespace tree {
 			if (1 != branchNode.numLinks())
 				return TreeNode(branchNode);
 
+			return mergeBranch(branchNode);
+		}
+
+		TreeNode mergeBranch(const BranchTreeNode& branchNode) {
 			// merge the branch if it only has a single link (if the tree state is valid, the referenced node must exist)
 			auto lastLinkIndex = branchNode.highestLinkIndex();
 			auto referencedNode = getLinkedNode(branchNode, lastLinkIndex)->copy();
@@ -219,6 +302,172 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region applyChanges
+
+	public:
+		/// Applies all changes in \a changeSet to the tree.
+		/// \note Each affected node is rebuilt once, independent of the number of changed keys below it,
+		///       and branch hashes are calculated lazily when root() is called.
+		/// \note When a key is changed multiple times, only its last change is applied.
+		void applyChanges(const ChangeSet& changeSet) {
+			auto changes = SortChanges(changeSet.changes());
+			if (changes.empty())
+				return;
+
+			m_rootNode = applyChanges(m_rootNode, changes.cbegin(), changes.cend(), 0);
+		}
+
+	private:
+		using PathChange = typename ChangeSet::PathChange;
+		using PathChanges = std::vector<const PathChange*>;
+		using PathChangesIterator = typename PathChanges::const_iterator;
+
+		static bool IsPathLess(const TreeNodePath& lhs, const TreeNodePath& rhs) {
+			auto differenceIndex = FindFirstDifferenceIndex(lhs, rhs);
+			if (differenceIndex == lhs.size() || differenceIndex == rhs.size())
+				return lhs.size() < rhs.size();
+
+			return lhs.nibbleAt(differenceIndex) < rhs.nibbleAt(differenceIndex);
+		}
+
+		static bool IsChangeLess(const PathChange* pLhs, const PathChange* pRhs) {
+			return IsPathLess(pLhs->Path, pRhs->Path);
+		}
+
+		static PathChanges SortChanges(const std::vector<PathChange>& changes) {
+			PathChanges sortedChanges;
+			sortedChanges.reserve(changes.size());
+			for (const auto& change : changes)
+				sortedChanges.push_back(&change);
+
+			// stable sort keeps changes to the same path in insertion order, so the last one wins
+			std::stable_sort(sortedChanges.begin(), sortedChanges.end(), IsChangeLess);
+
+			PathChanges uniqueChanges;
+			uniqueChanges.reserve(sortedChanges.size());
+			for (auto iter = sortedChanges.cbegin(); sortedChanges.cend() != iter; ++iter) {
+				auto nextIter = iter + 1;
+				if (sortedChanges.cend() == nextIter || (*iter)->Path != (*nextIter)->Path)
+					uniqueChanges.push_back(*iter);
+			}
+
+			return uniqueChanges;
+		}
+
+		static size_t FindFirstKeyDifferenceIndex(const TreeNodePath& nodePath, const TreeNodePath& keyPath, size_t keyOffset) {
+			auto maxIndex = std::min(nodePath.size(), keyPath.size() - keyOffset);
+			for (auto i = 0u; i < maxIndex; ++i) {
+				if (nodePath.nibbleAt(i) != keyPath.nibbleAt(keyOffset + i))
+					return i;
+			}
+
+			return maxIndex;
+		}
+
+		template<typename TAction>
+		static void ForEachLinkGroup(PathChangesIterator begin, PathChangesIterator end, size_t nibbleIndex, TAction action) {
+			// changes are sorted, so all changes routed through the same link are adjacent
+			while (begin != end) {
+				auto nibble = (*begin)->Path.nibbleAt(nibbleIndex);
+				auto groupEnd = std::find_if(begin, end, [nibble, nibbleIndex](const auto* pChange) {
+					return nibble != pChange->Path.nibbleAt(nibbleIndex);
+				});
+
+				action(begin, groupEnd, nibble);
+				begin = groupEnd;
+			}
+		}
+
+		// all changes in [begin, end) share the first `offset` nibbles, which have already been consumed by parent nodes
+		TreeNode applyChanges(const TreeNode& node, PathChangesIterator begin, PathChangesIterator end, size_t offset) {
+			if (node.empty()) {
+				PathChanges setChanges;
+				std::copy_if(begin, end, std::back_inserter(setChanges), [](const auto* pChange) { return pChange->IsSet; });
+				return buildSubtree(setChanges.cbegin(), setChanges.cend(), offset);
+			}
+
+			if (node.isLeaf())
+				return applyChangesToLeaf(node.asLeafNode(), begin, end, offset);
+
+			return applyChangesToBranch(BranchTreeNode(node.asBranchNode()), begin, end, offset);
+		}
+
+		TreeNode applyChangesToLeaf(const LeafTreeNode& leafNode, PathChangesIterator begin, PathChangesIterator end, size_t offset) {
+			// treat the existing leaf as an additional set change unless it is explicitly changed
+			PathChange leafChange{ TreeNodePath::Join((*begin)->Path.subpath(0, offset), leafNode.path()), leafNode.value(), true };
+
+			PathChanges setChanges;
+			auto isLeafChanged = false;
+			for (auto iter = begin; end != iter; ++iter) {
+				isLeafChanged = isLeafChanged || leafChange.Path == (*iter)->Path;
+				if ((*iter)->IsSet)
+					setChanges.push_back(*iter);
+			}
+
+			if (!isLeafChanged)
+				setChanges.insert(std::lower_bound(setChanges.cbegin(), setChanges.cend(), &leafChange, IsChangeLess), &leafChange);
+
+			return buildSubtree(setChanges.cbegin(), setChanges.cend(), offset);
+		}
+
+		TreeNode applyChangesToBranch(BranchTreeNode&& branchNode, PathChangesIterator begin, PathChangesIterator end, size_t offset) {
+			auto branchPath = branchNode.path();
+			auto sharedPathSize = branchPath.size();
+			for (auto iter = begin; end != iter; ++iter)
+				sharedPathSize = std::min(sharedPathSize, FindFirstKeyDifferenceIndex(branchPath, (*iter)->Path, offset));
+
+			// if the branch path is not shared by all changes, split the branch at the shared path
+			if (sharedPathSize != branchPath.size()) {
+				auto splitBranchNode = BranchTreeNode(branchPath.subpath(0, sharedPathSize));
+				branchNode.setPath(branchPath.subpath(sharedPathSize + 1));
+				setLink(splitBranchNode, branchNode, branchPath.nibbleAt(sharedPathSize));
+				return applyChangesToBranch(std::move(splitBranchNode), begin, end, offset);
+			}
+
+			// update each affected link exactly once
+			auto nibbleIndex = offset + branchPath.size();
+			ForEachLinkGroup(begin, end, nibbleIndex, [this, &branchNode, nibbleIndex](auto groupBegin, auto groupEnd, auto linkIndex) {
+				TreeNode emptyNode;
+				auto pLinkedNode = branchNode.hasLink(linkIndex) ? getLinkedNode(branchNode, linkIndex) : nullptr;
+				auto updatedLinkedNode = applyChanges(pLinkedNode ? *pLinkedNode : emptyNode, groupBegin, groupEnd, nibbleIndex + 1);
+				if (!updatedLinkedNode.empty())
+					setLink(branchNode, std::move(updatedLinkedNode), linkIndex);
+				else if (branchNode.hasLink(linkIndex))
+					branchNode.clearLink(linkIndex);
+			});
+
+			switch (branchNode.numLinks()) {
+			case 0:
+				return TreeNode();
+
+			case 1:
+				return mergeBranch(branchNode);
+
+			default:
+				return TreeNode(branchNode);
+			}
+		}
+
+		TreeNode buildSubtree(PathChangesIterator begin, PathChangesIterator end, size_t offset) {
+			if (begin == end)
+				return TreeNode();
+
+			const auto& firstPath = (*begin)->Path;
+			if (1 == std::distance(begin, end))
+				return TreeNode(LeafTreeNode(firstPath.subpath(offset), (*begin)->Value));
+
+			// since changes are sorted and unique, the path shared by all changes is the path shared by the first and last changes
+			auto nibbleIndex = FindFirstDifferenceIndex(firstPath, (*(end - 1))->Path);
+			auto branchNode = BranchTreeNode(firstPath.subpath(offset, nibbleIndex - offset));
+			ForEachLinkGroup(begin, end, nibbleIndex, [this, &branchNode, nibbleIndex](auto groupBegin, auto groupEnd, auto linkIndex) {
+				setLink(branchNode, buildSubtree(groupBegin, groupEnd, nibbleIndex + 1), linkIndex);
+			});
+
+			return TreeNode(branchNode);
+		}
+
+		// endregion
+
 		// region lookup
 
 	public:
@@ -229,7 +478,7 @@ namespace catapult { namespace tree {
 		}
 
 	private:
-		std::pair<Hash256, bool> lookup(const TreeNode& node, const TreeNodePath& keyPath, std::vector<TreeNode>& nodePath) const {
+		std::pair<Hash256, bool> lookup(const TreeNode& node, const TreeNodePathView& keyPath, std::vector<TreeNode>& nodePath) const {
 			// if the node is empty, there is nothing to do
 			if (node.empty())
 				return LookupNotFoundResult();
@@ -305,7 +554,7 @@ namespace catapult { namespace tree {
 			// if the node is a branch, save and prune all its links
 			auto branchNode = BranchTreeNode(node.asBranchNode());
 			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
-				auto pLinkedNode = branchNode.linkedNode(i);
+				auto pLinkedNode = branchNode.sharedLinkedNode(i);
 				if (!pLinkedNode)
 					continue;
 
@@ -321,16 +570,20 @@ namespace catapult { namespace tree {
 	private:
 		// region links
 
-		std::unique_ptr<const TreeNode> getLinkedNode(const BranchTreeNode& branchNode, size_t index) const {
-			// copy from memory, if available; otherwise, copy from data source
-			auto pLinkedNode = branchNode.linkedNode(index);
-			return pLinkedNode ? std::move(pLinkedNode) : m_dataSource.get(branchNode.link(index));
+		std::shared_ptr<const TreeNode> getLinkedNode(const BranchTreeNode& branchNode, size_t index) const {
+			// share from memory, if available; otherwise, get from data source (which might share a cached node)
+			auto pLinkedNode = branchNode.sharedLinkedNode(index);
+			return pLinkedNode ? pLinkedNode : m_dataSource.get(branchNode.link(index));
 		}
 
 		void setLink(BranchTreeNode& branchNode, const TreeNode& node, size_t index) {
 			branchNode.setLink(node, index);
 		}
 
+		void setLink(BranchTreeNode& branchNode, TreeNode&& node, size_t index) {
+			branchNode.setLink(std::move(node), index);
+		}
+
 		template<typename TNode>
 		void setLink(BranchTreeNode& branchNode, const TNode& node, size_t index) {
 			branchNode.setLink(TreeNode(node), index);
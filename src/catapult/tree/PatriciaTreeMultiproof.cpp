@@ -0,0 +1,143 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeMultiproof.h"
+#include "PatriciaTreeSerializer.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace tree {
+
+	namespace {
+		constexpr uint8_t Leaf_Marker = 0xFF;
+		constexpr uint8_t Branch_Marker = 0x00;
+
+		size_t CalculateSerializedNodeSize(const uint8_t* pData, size_t remainingSize) {
+			// marker and path size - uint8
+			constexpr auto Header_Size = 2 * sizeof(uint8_t);
+			if (remainingSize < Header_Size)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("serialized node header is truncated", remainingSize);
+
+			auto size = Header_Size + (pData[1] + 1u) / 2;
+			if (Leaf_Marker == pData[0])
+				return size + Hash256_Size;
+
+			if (Branch_Marker != pData[0])
+				CATAPULT_THROW_INVALID_ARGUMENT_1("invalid marker of serialized node", pData[0]);
+
+			// links mask - uint16, links - hashes
+			if (remainingSize < size + sizeof(uint16_t))
+				CATAPULT_THROW_INVALID_ARGUMENT_1("serialized branch node is truncated", remainingSize);
+
+			auto linksMask = static_cast<uint16_t>(pData[size] | pData[size + 1] << 8);
+			auto numLinks = 0u;
+			for (; 0 != linksMask; linksMask &= static_cast<uint16_t>(linksMask - 1))
+				++numLinks;
+
+			return size + sizeof(uint16_t) + numLinks * Hash256_Size;
+		}
+	}
+
+	// region PatriciaTreeMultiproofBuilder
+
+	size_t PatriciaTreeMultiproofBuilder::size() const {
+		return m_nodeHashes.size();
+	}
+
+	void PatriciaTreeMultiproofBuilder::add(const std::vector<TreeNode>& nodePath) {
+		for (const auto& node : nodePath) {
+			if (!m_nodeHashes.insert(node.hash()).second)
+				continue;
+
+			auto serializedNode = PatriciaTreeSerializer::SerializeValue(node);
+			const auto* pData = reinterpret_cast<const uint8_t*>(serializedNode.data());
+			m_serializedNodes.insert(m_serializedNodes.end(), pData, pData + serializedNode.size());
+		}
+	}
+
+	const std::vector<uint8_t>& PatriciaTreeMultiproofBuilder::serializedProof() const {
+		return m_serializedNodes;
+	}
+
+	// endregion
+
+	// region PatriciaTreeMultiproof
+
+	PatriciaTreeMultiproof::PatriciaTreeMultiproof(const RawBuffer& buffer) {
+		size_t offset = 0;
+		while (offset < buffer.Size) {
+			const auto* pData = buffer.pData + offset;
+			auto nodeSize = CalculateSerializedNodeSize(pData, buffer.Size - offset);
+			if (nodeSize > buffer.Size - offset)
+				CATAPULT_THROW_INVALID_ARGUMENT_1("serialized node is truncated", offset);
+
+			// index nodes by their calculated hashes so that only nodes linked from a trusted root are ever visited
+			auto node = PatriciaTreeSerializer::DeserializeValue({ pData, nodeSize });
+			auto nodeHash = node.hash();
+			m_nodes.emplace(nodeHash, std::move(node));
+			offset += nodeSize;
+		}
+	}
+
+	size_t PatriciaTreeMultiproof::size() const {
+		return m_nodes.size();
+	}
+
+	MultiproofLookupResult PatriciaTreeMultiproof::lookup(
+			const Hash256& rootHash,
+			const TreeNodePath& keyPath,
+			Hash256& valueHash) const {
+		// an empty tree cannot contain any key
+		if (Hash256() == rootHash)
+			return MultiproofLookupResult::Not_Found;
+
+		auto nodeHash = rootHash;
+		auto remainingPath = TreeNodePathView(keyPath);
+		for (;;) {
+			auto iter = m_nodes.find(nodeHash);
+			if (m_nodes.cend() == iter)
+				return MultiproofLookupResult::Incomplete;
+
+			const auto& node = iter->second;
+			auto differenceIndex = FindFirstDifferenceIndex(node.path(), remainingPath);
+			if (node.isLeaf()) {
+				// a leaf must fully match the remaining key path
+				if (differenceIndex != remainingPath.size() || node.path().size() != remainingPath.size())
+					return MultiproofLookupResult::Not_Found;
+
+				valueHash = node.asLeafNode().value();
+				return MultiproofLookupResult::Found;
+			}
+
+			// a branch must be a proper prefix of the remaining key path and have a link for the next nibble
+			const auto& branchNode = node.asBranchNode();
+			if (differenceIndex != branchNode.path().size() || differenceIndex == remainingPath.size())
+				return MultiproofLookupResult::Not_Found;
+
+			auto linkIndex = remainingPath.nibbleAt(differenceIndex);
+			if (!branchNode.hasLink(linkIndex))
+				return MultiproofLookupResult::Not_Found;
+
+			nodeHash = branchNode.link(linkIndex);
+			remainingPath = remainingPath.subpath(differenceIndex + 1);
+		}
+	}
+
+	// endregion
+}}
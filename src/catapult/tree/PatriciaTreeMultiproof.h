@@ -0,0 +1,77 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_map>
+#include <unordered_set>
+
+namespace catapult { namespace tree {
+
+	/// Possible results of looking up a key in a patricia tree multiproof.
+	enum class MultiproofLookupResult {
+		/// Proof shows that the key is contained in the tree.
+		Found,
+
+		/// Proof shows that the key is not contained in the tree.
+		Not_Found,
+
+		/// Proof does not contain all nodes needed to prove that the key is or is not contained in the tree.
+		Incomplete
+	};
+
+	/// Builder for a compact patricia tree multiproof that proves the existence or non-existence of multiple keys.
+	/// \note Nodes shared by the paths of multiple keys are only included once.
+	class PatriciaTreeMultiproofBuilder {
+	public:
+		/// Gets the number of (unique) nodes in the proof.
+		size_t size() const;
+
+	public:
+		/// Adds all nodes in \a nodePath that are not already part of the proof.
+		void add(const std::vector<TreeNode>& nodePath);
+
+		/// Gets the serialized proof composed of all added nodes (in the order they were added).
+		const std::vector<uint8_t>& serializedProof() const;
+
+	private:
+		std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> m_nodeHashes;
+		std::vector<uint8_t> m_serializedNodes;
+	};
+
+	/// Patricia tree multiproof that can prove the existence or non-existence of keys relative to a trusted root hash.
+	class PatriciaTreeMultiproof {
+	public:
+		/// Creates a multiproof around the serialized nodes in \a buffer.
+		explicit PatriciaTreeMultiproof(const RawBuffer& buffer);
+
+	public:
+		/// Gets the number of (unique) nodes in the proof.
+		size_t size() const;
+
+		/// Looks up the (encoded) key \a keyPath in the tree with root hash \a rootHash.
+		/// \a valueHash is set to the value associated with the key when the result is MultiproofLookupResult::Found.
+		MultiproofLookupResult lookup(const Hash256& rootHash, const TreeNodePath& keyPath, Hash256& valueHash) const;
+
+	private:
+		std::unordered_map<Hash256, TreeNode, utils::ArrayHasher<Hash256>> m_nodes;
+	};
+}}
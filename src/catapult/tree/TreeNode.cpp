@@ -26,22 +26,34 @@
 namespace catapult { namespace tree {
 
 	namespace {
-		std::vector<uint8_t> EncodeKey(const TreeNodePath& path, bool isLeaf) {
+		void EncodeKey(const TreeNodePath& path, bool isLeaf, uint8_t* pEncodedKey) {
 			auto numPathNibbles = path.size();
-			std::vector<uint8_t> encodedKey(numPathNibbles / 2 + 1);
 
 			auto i = 0u;
-			encodedKey[0] = isLeaf ? 0x20 : 0; // set leaf flag
+			pEncodedKey[0] = isLeaf ? 0x20 : 0; // set leaf flag
 			if (1 == numPathNibbles % 2) {
-				encodedKey[0] |= 0x10; // set odd flag
-				encodedKey[0] |= path.nibbleAt(0); // merge in first nibble
+				pEncodedKey[0] |= 0x10; // set odd flag
+				pEncodedKey[0] |= path.nibbleAt(0); // merge in first nibble
 				++i;
 			}
 
 			for (; i < numPathNibbles; i += 2)
-				encodedKey[i / 2 + 1] = static_cast<uint8_t>((path.nibbleAt(i) << 4) + path.nibbleAt(i + 1));
+				pEncodedKey[i / 2 + 1] = static_cast<uint8_t>((path.nibbleAt(i) << 4) + path.nibbleAt(i + 1));
+		}
 
-			return encodedKey;
+		void UpdateWithEncodedKey(crypto::Sha3_256_Builder& builder, const TreeNodePath& path, bool isLeaf) {
+			// encode keys of paths that are stored inline on the stack to avoid heap allocations
+			constexpr auto Max_Stack_Encoded_Key_Size = TreeNodePath::Max_Inline_Nibbles / 2 + 1;
+			auto encodedKeySize = path.size() / 2 + 1;
+			if (encodedKeySize <= Max_Stack_Encoded_Key_Size) {
+				std::array<uint8_t, Max_Stack_Encoded_Key_Size> encodedKey;
+				EncodeKey(path, isLeaf, encodedKey.data());
+				builder.update({ encodedKey.data(), encodedKeySize });
+			} else {
+				std::vector<uint8_t> encodedKey(encodedKeySize);
+				EncodeKey(path, isLeaf, encodedKey.data());
+				builder.update(encodedKey);
+			}
 		}
 	}
 
@@ -50,7 +62,7 @@ namespace catapult { namespace tree {
 	namespace {
 		Hash256 CalculateLeafTreeNodeHash(const TreeNodePath& path, const Hash256& value) {
 			crypto::Sha3_256_Builder builder;
-			builder.update(EncodeKey(path, true));
+			UpdateWithEncodedKey(builder, path, true);
 			builder.update(value);
 
 			Hash256 hash;
@@ -109,6 +121,10 @@ namespace catapult { namespace tree {
 		return pLinkedNode ? std::make_unique<TreeNode>(pLinkedNode->copy()) : nullptr;
 	}
 
+	std::shared_ptr<const TreeNode> BranchTreeNode::sharedLinkedNode(size_t index) const {
+		return m_linkedNodes[index];
+	}
+
 	uint8_t BranchTreeNode::highestLinkIndex() const {
 		return static_cast<uint8_t>(utils::Log2(m_linkSet.to_ulong()));
 	}
@@ -116,7 +132,7 @@ namespace catapult { namespace tree {
 	const Hash256& BranchTreeNode::hash() const {
 		if (m_isDirty) {
 			crypto::Sha3_256_Builder builder;
-			builder.update(EncodeKey(m_path, false));
+			UpdateWithEncodedKey(builder, m_path, false);
 			for (auto i = 0u; i < Max_Links; ++i)
 				builder.update({ link(i).data(), sizeof(Hash256) });
 
@@ -127,6 +143,13 @@ namespace catapult { namespace tree {
 		return m_hash;
 	}
 
+	void BranchTreeNode::forEachLinkedNode(const consumer<const TreeNode&>& consumer) const {
+		for (const auto& pLinkedNode : m_linkedNodes) {
+			if (pLinkedNode)
+				consumer(*pLinkedNode);
+		}
+	}
+
 	void BranchTreeNode::setPath(const TreeNodePath& path) {
 		m_path = path;
 		m_isDirty = true;
@@ -144,6 +167,11 @@ namespace catapult { namespace tree {
 		setLink(index);
 	}
 
+	void BranchTreeNode::setLink(TreeNode&& node, size_t index) {
+		m_linkedNodes[index] = std::make_shared<const TreeNode>(std::move(node));
+		setLink(index);
+	}
+
 	void BranchTreeNode::clearLink(size_t index) {
 		setLink(Hash256(), index);
 		m_linkSet.reset(index);
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "TreeNodePath.h"
+#include "catapult/functions.h"
 #include "catapult/types.h"
 #include <bitset>
 #include <memory>
@@ -82,12 +83,20 @@ namespace catapult { namespace tree {
 		/// Gets a copy of the linked node at \a index or \c nullptr if no linked node is present.
 		std::unique_ptr<const TreeNode> linkedNode(size_t index) const;
 
+		/// Gets the linked node at \a index or \c nullptr if no linked node is present.
+		/// \note Unlike linkedNode, the returned (immutable) node is shared with this branch instead of copied.
+		std::shared_ptr<const TreeNode> sharedLinkedNode(size_t index) const;
+
 		/// Gets the index of the highest set link.
 		uint8_t highestLinkIndex() const;
 
 		/// Gets the hash representation of this node.
 		const Hash256& hash() const;
 
+		/// Calls \a consumer with each linked node that is held in memory.
+		/// \note Unlike linkedNode, the consumer is passed the linked nodes themselves instead of copies.
+		void forEachLinkedNode(const consumer<const TreeNode&>& consumer) const;
+
 	public:
 		/// Sets the branch node \a path.
 		void setPath(const TreeNodePath& path);
@@ -98,6 +107,9 @@ namespace catapult { namespace tree {
 		/// Sets the branch link at \a index to \a node.
 		void setLink(const TreeNode& node, size_t index);
 
+		/// Sets the branch link at \a index to \a node without copying it.
+		void setLink(TreeNode&& node, size_t index);
+
 		/// Clears the branch link at \a index.
 		void clearLink(size_t index);
 
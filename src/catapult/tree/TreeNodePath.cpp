@@ -27,13 +27,21 @@ namespace catapult { namespace tree {
 	TreeNodePath::TreeNodePath()
 			: m_size(0)
 			, m_adjustment(0)
+			, m_inlinePath()
 	{}
 
-	TreeNodePath::TreeNodePath(const std::vector<uint8_t>& path, size_t offset, size_t size)
+	TreeNodePath::TreeNodePath(const TreeNodePathView& view) : TreeNodePath(view.m_pPath, view.m_offset, view.m_size)
+	{}
+
+	TreeNodePath::TreeNodePath(const uint8_t* pPath, size_t offset, size_t size)
 			: m_size(size)
 			, m_adjustment(offset % 2) // adjustment is needed to correctly handle paths beginning at odd nibbles
-			, m_path(&path[offset / 2], &path[(offset + size) / 2 + (offset + size) % 2])
-	{}
+			, m_inlinePath() {
+		const auto* pPathBegin = pPath + offset / 2;
+		const auto* pPathEnd = pPath + (offset + size) / 2 + (offset + size) % 2;
+		resize(static_cast<size_t>(pPathEnd - pPathBegin));
+		std::copy(pPathBegin, pPathEnd, data());
+	}
 
 	bool TreeNodePath::empty() const {
 		return 0 == m_size;
@@ -45,7 +53,7 @@ namespace catapult { namespace tree {
 
 	uint8_t TreeNodePath::nibbleAt(size_t index) const {
 		index += m_adjustment;
-		auto byte = m_path[index / 2];
+		auto byte = data()[index / 2];
 
 		// return high nibble before low nibble
 		return 0 == index % 2 ? ((byte & 0xF0) >> 4) : (byte & 0x0F);
@@ -64,25 +72,34 @@ namespace catapult { namespace tree {
 	}
 
 	TreeNodePath TreeNodePath::subpath(size_t offset, size_t size) const {
-		return TreeNodePath(m_path, offset + m_adjustment, size);
+		return TreeNodePath(data(), offset + m_adjustment, size);
+	}
+
+	void TreeNodePath::resize(size_t numBytes) {
+		if (numBytes > m_inlinePath.size())
+			m_heapPath.resize(numBytes);
+	}
+
+	const uint8_t* TreeNodePath::data() const {
+		return m_heapPath.empty() ? m_inlinePath.data() : m_heapPath.data();
+	}
+
+	uint8_t* TreeNodePath::data() {
+		return m_heapPath.empty() ? m_inlinePath.data() : m_heapPath.data();
 	}
 
 	namespace {
 		class JoinBuilder {
 		public:
-			explicit JoinBuilder(size_t size)
+			explicit JoinBuilder(uint8_t* pPath, size_t size)
 					: m_index(0)
-					, m_path(size, 0)
-			{}
-
-		public:
-			const std::vector<uint8_t>& path() {
-				return m_path;
+					, m_pPath(pPath) {
+				std::fill(m_pPath, m_pPath + size, static_cast<uint8_t>(0));
 			}
 
 		public:
 			void addNibble(uint8_t nibble) {
-				m_path[m_index / 2] |= 0 != m_index % 2 ? (nibble & 0x0F) : static_cast<uint8_t>(nibble << 4);
+				m_pPath[m_index / 2] |= 0 != m_index % 2 ? (nibble & 0x0F) : static_cast<uint8_t>(nibble << 4);
 				++m_index;
 			}
 
@@ -93,25 +110,72 @@ namespace catapult { namespace tree {
 
 		private:
 			size_t m_index;
-			std::vector<uint8_t> m_path;
+			uint8_t* m_pPath;
 		};
 	}
 
 	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, const TreeNodePath& rhs) {
-		auto joinedPathSize = lhs.size() + rhs.size();
-		JoinBuilder builder((joinedPathSize + 1) / 2);
+		TreeNodePath joinedPath;
+		joinedPath.m_size = lhs.size() + rhs.size();
+		joinedPath.resize((joinedPath.m_size + 1) / 2);
+
+		JoinBuilder builder(joinedPath.data(), (joinedPath.m_size + 1) / 2);
 		builder.addNibbles(lhs);
 		builder.addNibbles(rhs);
-		return TreeNodePath(builder.path(), 0, joinedPathSize);
+		return joinedPath;
 	}
 
 	TreeNodePath TreeNodePath::Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs) {
-		auto joinedPathSize = lhs.size() + 1 + rhs.size();
-		JoinBuilder builder((joinedPathSize + 1) / 2);
+		TreeNodePath joinedPath;
+		joinedPath.m_size = lhs.size() + 1 + rhs.size();
+		joinedPath.resize((joinedPath.m_size + 1) / 2);
+
+		JoinBuilder builder(joinedPath.data(), (joinedPath.m_size + 1) / 2);
 		builder.addNibbles(lhs);
 		builder.addNibble(nibble);
 		builder.addNibbles(rhs);
-		return TreeNodePath(builder.path(), 0, joinedPathSize);
+		return joinedPath;
+	}
+
+	TreeNodePathView::TreeNodePathView(const TreeNodePath& path) : TreeNodePathView(path.data(), path.m_adjustment, path.size())
+	{}
+
+	TreeNodePathView::TreeNodePathView(const uint8_t* pPath, size_t offset, size_t size)
+			: m_pPath(pPath)
+			, m_offset(offset)
+			, m_size(size)
+	{}
+
+	bool TreeNodePathView::empty() const {
+		return 0 == m_size;
+	}
+
+	size_t TreeNodePathView::size() const {
+		return m_size;
+	}
+
+	uint8_t TreeNodePathView::nibbleAt(size_t index) const {
+		index += m_offset;
+		auto byte = m_pPath[index / 2];
+
+		// return high nibble before low nibble
+		return 0 == index % 2 ? ((byte & 0xF0) >> 4) : (byte & 0x0F);
+	}
+
+	bool TreeNodePathView::operator==(const TreeNodePathView& rhs) const {
+		return size() == rhs.size() && size() == FindFirstDifferenceIndex(*this, rhs);
+	}
+
+	bool TreeNodePathView::operator!=(const TreeNodePathView& rhs) const {
+		return !(*this == rhs);
+	}
+
+	TreeNodePathView TreeNodePathView::subpath(size_t offset) const {
+		return subpath(offset, size() - offset);
+	}
+
+	TreeNodePathView TreeNodePathView::subpath(size_t offset, size_t size) const {
+		return TreeNodePathView(m_pPath, m_offset + offset, size);
 	}
 
 	std::ostream& operator<<(std::ostream& out, const TreeNodePath& path) {
@@ -123,7 +187,7 @@ namespace catapult { namespace tree {
 		return out;
 	}
 
-	size_t FindFirstDifferenceIndex(const TreeNodePath& lhs, const TreeNodePath& rhs) {
+	size_t FindFirstDifferenceIndex(const TreeNodePathView& lhs, const TreeNodePathView& rhs) {
 		size_t index = 0;
 		for (; index < lhs.size() && index < rhs.size() && lhs.nibbleAt(index) == rhs.nibbleAt(index); ++index);
 		return index;
@@ -21,14 +21,22 @@
 #pragma once
 #include "catapult/utils/traits/Traits.h"
 #include <algorithm>
+#include <array>
 #include <iosfwd>
 #include <vector>
 #include <stdint.h>
 
+namespace catapult { namespace tree { class TreeNodePathView; } }
+
 namespace catapult { namespace tree {
 
 	/// Represents a path in a tree.
+	/// \note Paths composed of up to Max_Inline_Nibbles nibbles are stored inline without any heap allocations.
 	class TreeNodePath {
+	public:
+		/// Maximum number of nibbles that can be stored without a heap allocation.
+		static constexpr size_t Max_Inline_Nibbles = 64;
+
 	public:
 		/// Creates a default path.
 		TreeNodePath();
@@ -37,25 +45,30 @@ namespace catapult { namespace tree {
 		template<typename TKey, typename X = typename std::enable_if<utils::traits::is_scalar<TKey>::value>::type>
 		explicit TreeNodePath(TKey key)
 				: m_size(2 * sizeof(TKey))
-				, m_adjustment(0) {
-			m_path.resize(sizeof(TKey));
+				, m_adjustment(0)
+				, m_inlinePath() {
+			resize(sizeof(TKey));
 
 			// copy in big endian byte order
 			const auto* pKeyData = reinterpret_cast<const uint8_t*>(&key);
-			std::reverse_copy(pKeyData, pKeyData + sizeof(TKey), m_path.begin());
+			std::reverse_copy(pKeyData, pKeyData + sizeof(TKey), data());
 		}
 
 		/// Creates a path from \a key.
 		template<typename TKey, typename X = typename std::enable_if<!utils::traits::is_scalar<TKey>::value>::type>
 		explicit TreeNodePath(const TKey& key)
 				: m_size(2 * key.size())
-				, m_adjustment(0) {
-			m_path.resize(key.size());
-			std::copy(key.cbegin(), key.cend(), m_path.begin());
+				, m_adjustment(0)
+				, m_inlinePath() {
+			resize(key.size());
+			std::copy(key.cbegin(), key.cend(), data());
 		}
 
+		/// Creates a path by copying the nibbles viewed by \a view.
+		explicit TreeNodePath(const TreeNodePathView& view);
+
 	private:
-		TreeNodePath(const std::vector<uint8_t>& path, size_t offset, size_t size);
+		TreeNodePath(const uint8_t* pPath, size_t offset, size_t size);
 
 	public:
 		/// Returns \c true if this path is empty.
@@ -89,15 +102,70 @@ namespace catapult { namespace tree {
 		/// Joins \a lhs, \a nibble and \a rhs into a new path.
 		static TreeNodePath Join(const TreeNodePath& lhs, uint8_t nibble, const TreeNodePath& rhs);
 
+	private:
+		void resize(size_t numBytes);
+
+		const uint8_t* data() const;
+
+		uint8_t* data();
+
 	private:
 		size_t m_size;
 		size_t m_adjustment; // used to track odd / even starting nibble
-		std::vector<uint8_t> m_path;
+		std::array<uint8_t, Max_Inline_Nibbles / 2> m_inlinePath;
+		std::vector<uint8_t> m_heapPath; // only used when path is too large to be stored inline
+
+	private:
+		friend class TreeNodePathView;
+	};
+
+	/// Non-owning view of a path in a tree that can be traversed without copying any nibbles.
+	/// \note The viewed path must outlive the view.
+	class TreeNodePathView {
+	public:
+		/// Creates a view of the entire \a path.
+		TreeNodePathView(const TreeNodePath& path);
+
+	private:
+		TreeNodePathView(const uint8_t* pPath, size_t offset, size_t size);
+
+	public:
+		/// Returns \c true if the viewed path is empty.
+		bool empty() const;
+
+		/// Gets the number of nibbles in the viewed path.
+		size_t size() const;
+
+	public:
+		/// Gets the nibble at \a index.
+		uint8_t nibbleAt(size_t index) const;
+
+	public:
+		/// Returns \c true if the viewed path is equal to \a rhs.
+		bool operator==(const TreeNodePathView& rhs) const;
+
+		/// Returns \c true if the viewed path is not equal to \a rhs.
+		bool operator!=(const TreeNodePathView& rhs) const;
+
+	public:
+		/// Creates a view of the subpath starting at nibble \a offset.
+		TreeNodePathView subpath(size_t offset) const;
+
+		/// Creates a view of the subpath starting at nibble \a offset composed of \a size nibbles.
+		TreeNodePathView subpath(size_t offset, size_t size) const;
+
+	private:
+		const uint8_t* m_pPath;
+		size_t m_offset; // offset (in nibbles) of the first viewed nibble relative to m_pPath
+		size_t m_size;
+
+	private:
+		friend class TreeNodePath;
 	};
 
 	/// Insertion operator for outputting \a path to \a out.
 	std::ostream& operator<<(std::ostream& out, const TreeNodePath& path);
 
 	/// Compares two paths (\a lhs and \a rhs) and returns the index of the first non-equal nibble.
-	size_t FindFirstDifferenceIndex(const TreeNodePath& lhs, const TreeNodePath& rhs);
+	size_t FindFirstDifferenceIndex(const TreeNodePathView& lhs, const TreeNodePathView& rhs);
 }}
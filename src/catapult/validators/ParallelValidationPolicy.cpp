@@ -22,7 +22,7 @@
 #include "AggregateValidationResult.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/thread/IoServiceThreadPool.h"
-#include "catapult/thread/ParallelFor.h"
+#include "catapult/thread/WorkStealingParallelFor.h"
 #include "catapult/utils/Logging.h"
 #include <boost/asio/io_service.hpp>
 #include <algorithm>
@@ -157,7 +157,7 @@ namespace catapult { namespace validators {
 			auto validateT(const model::WeakEntityInfos& entityInfos, const ValidationFunctions& validationFunctions) const {
 				auto pWork = std::make_shared<ValidationWork<TTraits>>(shared_from_this(), validationFunctions, entityInfos);
 				return thread::compose(
-						thread::ParallelFor(m_service, pWork->entityInfos(), m_pPool->numWorkerThreads(), [pWork](
+						thread::WorkStealingParallelFor(m_service, pWork->entityInfos(), m_pPool->numWorkerThreads(), [pWork](
 								const auto& entityInfo,
 								auto index) {
 							return pWork->validateEntity(entityInfo, index);
@@ -34,6 +34,8 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
 		EXPECT_EQ(utils::FileSize(), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(!!config.TreeNodeCache);
+		EXPECT_FALSE(!!config.DatabaseTuning);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathButNotPatriciaTreeStorage) {
@@ -45,6 +47,8 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(!!config.TreeNodeCache);
+		EXPECT_FALSE(!!config.DatabaseTuning);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathAndPatriciaTreeStorage) {
@@ -56,5 +60,7 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_TRUE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(!!config.TreeNodeCache);
+		EXPECT_FALSE(!!config.DatabaseTuning);
 	}
 }}
@@ -23,6 +23,7 @@
 #include "tests/catapult/cache/test/CacheSerializationTestUtils.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -36,12 +37,7 @@ namespace catapult { namespace cache {
 		constexpr auto GenerateRandomEntries = test::GenerateRandomCacheSerializationTestEntries;
 		constexpr auto CopyEntriesToStreamBuffer = test::CopyCacheSerializationTestEntriesToStreamBuffer;
 
-		void AssertAreEqual(const std::vector<TestEntry>& entries, const std::vector<uint8_t>& buffer) {
-			// Assert:
-			ASSERT_EQ(sizeof(uint64_t) + entries.size() * sizeof(TestEntry), buffer.size());
-			EXPECT_EQ(entries.size(), reinterpret_cast<const uint64_t&>(*buffer.data()));
-			EXPECT_TRUE(0 == memcmp(entries.data(), buffer.data() + sizeof(uint64_t), entries.size() * sizeof(TestEntry)));
-		}
+		constexpr auto CopyEntriesToChunkedStreamBuffer = test::CopyCacheSerializationTestEntriesToChunkedStreamBuffer;
 
 		// region VectorToCacheAdapter
 
@@ -128,11 +124,11 @@ namespace catapult { namespace cache {
 	}
 
 	namespace {
-		void AssertCanSaveViaCacheStorageAdapter(uint64_t numEntries) {
+		void AssertCanSaveViaCacheStorageAdapter(uint64_t numEntries, size_t numEntriesPerChunk, size_t numExpectedChunks) {
 			// Arrange:
 			auto seed = GenerateRandomEntries(numEntries);
 			VectorToCacheAdapter cache(seed);
-			CacheStorageAdapter<VectorToCacheAdapter, TestEntryStorageTraits> storage(cache);
+			CacheStorageAdapter<VectorToCacheAdapter, TestEntryStorageTraits> storage(cache, numEntriesPerChunk);
 
 			std::vector<uint8_t> buffer;
 			mocks::MockMemoryStream stream("", buffer);
@@ -145,20 +141,57 @@ namespace catapult { namespace cache {
 			EXPECT_EQ(0u, cache.counts().NumCreateDeltaCalls);
 			EXPECT_EQ(0u, cache.counts().NumCommitCalls);
 
-			AssertAreEqual(seed, buffer);
-			EXPECT_EQ(numEntries, reinterpret_cast<uint64_t&>(*buffer.data()));
+			EXPECT_EQ(numExpectedChunks, reinterpret_cast<const uint64_t*>(buffer.data())[2]);
+			EXPECT_EQ(CopyEntriesToChunkedStreamBuffer(seed, numEntriesPerChunk), buffer);
 			EXPECT_EQ(1u, stream.numFlushes());
 		}
 	}
 
 	TEST(TEST_CLASS, CanSaveEmptyDataViaCacheStorageAdapter) {
 		// Assert:
-		AssertCanSaveViaCacheStorageAdapter(0);
+		AssertCanSaveViaCacheStorageAdapter(0, 3, 0);
+	}
+
+	TEST(TEST_CLASS, CanSaveNonEmptyDataViaCacheStorageAdapter_SingleChunk) {
+		// Assert:
+		AssertCanSaveViaCacheStorageAdapter(8, 10, 1);
 	}
 
-	TEST(TEST_CLASS, CanSaveNonEmptyDataViaCacheStorageAdapter) {
+	TEST(TEST_CLASS, CanSaveNonEmptyDataViaCacheStorageAdapter_MultipleChunks) {
 		// Assert:
-		AssertCanSaveViaCacheStorageAdapter(8);
+		AssertCanSaveViaCacheStorageAdapter(8, 3, 3);
+		AssertCanSaveViaCacheStorageAdapter(9, 3, 3);
+	}
+
+	namespace {
+		struct CountingTestEntryStorageTraits : public TestEntryStorageTraits {
+			static size_t NumSaveCalls;
+
+			static void Save(const TestEntry& entry, io::OutputStream& output) {
+				++NumSaveCalls;
+				TestEntryStorageTraits::Save(entry, output);
+			}
+		};
+
+		size_t CountingTestEntryStorageTraits::NumSaveCalls;
+	}
+
+	TEST(TEST_CLASS, SaveSerializesEachEntryOnce) {
+		// Arrange:
+		CountingTestEntryStorageTraits::NumSaveCalls = 0;
+		auto seed = GenerateRandomEntries(8);
+		VectorToCacheAdapter cache(seed);
+		CacheStorageAdapter<VectorToCacheAdapter, CountingTestEntryStorageTraits> storage(cache, 3);
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		storage.saveAll(stream);
+
+		// Assert:
+		EXPECT_EQ(8u, CountingTestEntryStorageTraits::NumSaveCalls);
+		EXPECT_EQ(CopyEntriesToChunkedStreamBuffer(seed, 3), buffer);
 	}
 
 	namespace {
@@ -194,4 +227,59 @@ namespace catapult { namespace cache {
 		// Assert:
 		AssertCanLoadViaCacheStorageAdapter(7, 2, 4);
 	}
+
+	namespace {
+		void AssertCanLoadInParallelViaCacheStorageAdapter(const std::vector<TestEntry>& seed, std::vector<uint8_t>& buffer) {
+			// Arrange:
+			std::vector<TestEntry> loadedEntries;
+			VectorToCacheAdapter cache(loadedEntries);
+			CacheStorageAdapter<VectorToCacheAdapter, TestEntryStorageTraits> storage(cache);
+
+			auto pPool = test::CreateStartedIoServiceThreadPool(4);
+			mocks::MockMemoryStream stream("", buffer);
+
+			// Act:
+			storage.loadAllParallel(stream, *pPool);
+
+			// Assert: all entries are committed at once
+			EXPECT_EQ(0u, cache.counts().NumCreateViewCalls);
+			EXPECT_EQ(1u, cache.counts().NumCreateDeltaCalls);
+			EXPECT_EQ(1u, cache.counts().NumCommitCalls);
+
+			EXPECT_EQ(seed, loadedEntries);
+			EXPECT_EQ(0u, stream.numFlushes());
+		}
+	}
+
+	TEST(TEST_CLASS, CanLoadInParallelViaCacheStorageAdapter_WithoutChunks) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(7);
+		auto buffer = CopyEntriesToStreamBuffer(seed);
+
+		// Assert:
+		AssertCanLoadInParallelViaCacheStorageAdapter(seed, buffer);
+	}
+
+	TEST(TEST_CLASS, CanLoadInParallelViaCacheStorageAdapter_WithChunks) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(25);
+		auto buffer = CopyEntriesToChunkedStreamBuffer(seed, 2);
+
+		// Assert:
+		AssertCanLoadInParallelViaCacheStorageAdapter(seed, buffer);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripDataViaCacheStorageAdapter) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(25);
+		VectorToCacheAdapter sourceCache(seed);
+		CacheStorageAdapter<VectorToCacheAdapter, TestEntryStorageTraits> sourceStorage(sourceCache, 4);
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+		sourceStorage.saveAll(stream);
+
+		// Assert:
+		AssertCanLoadInParallelViaCacheStorageAdapter(seed, buffer);
+	}
 }}
@@ -22,10 +22,13 @@
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/cache/SubCacheMerkleRootTimings.h"
 #include "catapult/crypto/Hashes.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -227,6 +230,133 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(hashes, subCacheMerkleRoots);
 	}
 
+	TEST(TEST_CLASS, StateHashCalculationIsDeterministic_Delta) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		auto view = cache.createDelta();
+		view.setSubCacheMerkleRoots(test::GenerateRandomDataVector<Hash256>(2));
+		auto expectedStateHashInfo = view.calculateStateHash(Height(123));
+
+		// Act + Assert: merkle roots are always collected in sub cache id order
+		for (auto i = 0u; i < 20; ++i) {
+			auto stateHashInfo = view.calculateStateHash(Height(123));
+			EXPECT_EQ(expectedStateHashInfo.StateHash, stateHashInfo.StateHash) << i;
+			EXPECT_EQ(expectedStateHashInfo.SubCacheMerkleRoots, stateHashInfo.SubCacheMerkleRoots) << i;
+		}
+	}
+
+	// endregion
+
+	// region merkle root timings
+
+	TEST(TEST_CLASS, MerkleRootTimingsOnlyNameSubCachesSupportingMerkleRoots) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+
+		// Act:
+		const auto& timings = cache.merkleRootTimings();
+
+		// Assert:
+		ASSERT_EQ(9u, timings.size());
+		for (auto id = 0u; id < timings.size(); ++id) {
+			auto expectedName = 2 == id || 6 == id ? "SimpleCache (id = " + std::to_string(id) + ")" : std::string();
+			EXPECT_EQ(expectedName, timings.name(id)) << id;
+			EXPECT_EQ(0u, timings.elapsedMicros(id)) << id;
+		}
+	}
+
+	namespace {
+		constexpr uint64_t Sentinel_Elapsed_Micros = std::numeric_limits<uint64_t>::max();
+
+		void SeedMerkleRootTimings(const CatapultCache& cache) {
+			auto& timings = const_cast<SubCacheMerkleRootTimings&>(cache.merkleRootTimings());
+			for (auto id = 0u; id < timings.size(); ++id)
+				timings.setElapsedMicros(id, Sentinel_Elapsed_Micros);
+		}
+	}
+
+	TEST(TEST_CLASS, StateHashCalculationOfDeltaUpdatesMerkleRootTimings) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		SeedMerkleRootTimings(cache);
+
+		// Act:
+		cache.createDelta().calculateStateHash(Height(123));
+
+		// Assert: only timings of sub caches supporting merkle roots were updated
+		const auto& timings = cache.merkleRootTimings();
+		for (auto id = 0u; id < timings.size(); ++id) {
+			if (2 == id || 6 == id)
+				EXPECT_NE(Sentinel_Elapsed_Micros, timings.elapsedMicros(id)) << id;
+			else
+				EXPECT_EQ(Sentinel_Elapsed_Micros, timings.elapsedMicros(id)) << id;
+		}
+	}
+
+	TEST(TEST_CLASS, StateHashCalculationOfDeltaUpdatesMerkleRootTimingsWhenMerkleRootUpdatePoolIsSet) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		auto pPool = std::shared_ptr<thread::IoServiceThreadPool>(test::CreateStartedIoServiceThreadPool());
+		cache.setMerkleRootUpdatePool(pPool);
+		SeedMerkleRootTimings(cache);
+
+		// Act:
+		cache.createDelta().calculateStateHash(Height(123));
+
+		// Assert: only timings of sub caches supporting merkle roots were updated
+		const auto& timings = cache.merkleRootTimings();
+		for (auto id = 0u; id < timings.size(); ++id) {
+			if (2 == id || 6 == id)
+				EXPECT_NE(Sentinel_Elapsed_Micros, timings.elapsedMicros(id)) << id;
+			else
+				EXPECT_EQ(Sentinel_Elapsed_Micros, timings.elapsedMicros(id)) << id;
+		}
+	}
+
+	namespace {
+		StateHashInfo CalculateDeltaStateHash(const std::weak_ptr<thread::IoServiceThreadPool>& pMerkleRootUpdatePool) {
+			auto cache = CreateSimpleCatapultCacheForStateHashTests();
+			cache.setMerkleRootUpdatePool(pMerkleRootUpdatePool);
+
+			auto delta = cache.createDelta();
+			delta.setSubCacheMerkleRoots({ { { 1, 2, 3 } }, { { 4, 5, 6 } } });
+			return delta.calculateStateHash(Height(123));
+		}
+	}
+
+	TEST(TEST_CLASS, StateHashCalculationOfDeltaIsIndependentOfMerkleRootUpdatePool) {
+		// Arrange:
+		auto pPool = std::shared_ptr<thread::IoServiceThreadPool>(test::CreateStartedIoServiceThreadPool());
+		auto pDestroyedPool = std::shared_ptr<thread::IoServiceThreadPool>(test::CreateStartedIoServiceThreadPool());
+		std::weak_ptr<thread::IoServiceThreadPool> pDestroyedPoolWeak = pDestroyedPool;
+		pDestroyedPool.reset();
+
+		// Act:
+		auto expectedStateHashInfo = CalculateDeltaStateHash(std::weak_ptr<thread::IoServiceThreadPool>());
+		auto stateHashInfo = CalculateDeltaStateHash(pPool);
+		auto destroyedPoolStateHashInfo = CalculateDeltaStateHash(pDestroyedPoolWeak);
+
+		// Assert: merkle roots are updated on the calling thread when the pool is destroyed
+		EXPECT_EQ(expectedStateHashInfo.StateHash, stateHashInfo.StateHash);
+		EXPECT_EQ(expectedStateHashInfo.SubCacheMerkleRoots, stateHashInfo.SubCacheMerkleRoots);
+		EXPECT_EQ(expectedStateHashInfo.StateHash, destroyedPoolStateHashInfo.StateHash);
+		EXPECT_EQ(expectedStateHashInfo.SubCacheMerkleRoots, destroyedPoolStateHashInfo.SubCacheMerkleRoots);
+	}
+
+	TEST(TEST_CLASS, StateHashCalculationOfViewDoesNotUpdateMerkleRootTimings) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCacheForStateHashTests();
+		SeedMerkleRootTimings(cache);
+
+		// Act:
+		cache.createView().calculateStateHash();
+
+		// Assert:
+		const auto& timings = cache.merkleRootTimings();
+		for (auto id = 0u; id < timings.size(); ++id)
+			EXPECT_EQ(Sentinel_Elapsed_Micros, timings.elapsedMicros(id)) << id;
+	}
+
 	// endregion
 
 	// region commit
@@ -0,0 +1,357 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/cache/ChunkedDataHeader.h"
+#include "catapult/io/PodIoUtils.h"
+#include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS ChunkedDataHeaderTests
+
+	namespace {
+		std::vector<uint8_t> ToBuffer(const std::vector<uint64_t>& values) {
+			std::vector<uint8_t> buffer(values.size() * sizeof(uint64_t));
+			std::memcpy(buffer.data(), values.data(), buffer.size());
+			return buffer;
+		}
+
+		ChunkedDataHeader ReadHeader(const std::vector<uint64_t>& values) {
+			auto buffer = ToBuffer(values);
+			mocks::MockMemoryStream stream("", buffer);
+			return ReadChunkedDataHeader(stream);
+		}
+
+		ChunkInfo ReadInfo(const std::vector<uint64_t>& values, uint64_t numRemainingEntries) {
+			auto buffer = ToBuffer(values);
+			mocks::MockMemoryStream stream("", buffer);
+			return ReadChunkInfo(stream, numRemainingEntries);
+		}
+
+		void AssertHeader(uint64_t expectedNumEntries, uint64_t expectedNumChunks, const ChunkedDataHeader& header) {
+			EXPECT_EQ(expectedNumEntries, header.NumEntries);
+			EXPECT_EQ(expectedNumChunks, header.NumChunks);
+		}
+	}
+
+	// region CreateChunkedDataHeader
+
+	TEST(TEST_CLASS, CanCreateHeaderWithoutEntries) {
+		// Act + Assert:
+		AssertHeader(0, 0, CreateChunkedDataHeader(0, 5));
+	}
+
+	TEST(TEST_CLASS, CanCreateHeaderWithFullChunks) {
+		// Act + Assert:
+		AssertHeader(5, 1, CreateChunkedDataHeader(5, 5));
+		AssertHeader(10, 2, CreateChunkedDataHeader(10, 5));
+	}
+
+	TEST(TEST_CLASS, CanCreateHeaderWithPartialChunk) {
+		// Act + Assert:
+		AssertHeader(3, 1, CreateChunkedDataHeader(3, 5));
+		AssertHeader(12, 3, CreateChunkedDataHeader(12, 5));
+	}
+
+	// endregion
+
+	// region WriteChunkedDataHeader / ReadChunkedDataHeader
+
+	TEST(TEST_CLASS, CanWriteHeader) {
+		// Arrange:
+		ChunkedDataHeader header;
+		header.NumEntries = 12;
+		header.NumChunks = 3;
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		WriteChunkedDataHeader(stream, header);
+
+		// Assert:
+		EXPECT_EQ(ToBuffer({ Chunk_Index_Marker, 12, 3 }), buffer);
+		EXPECT_EQ(0u, stream.numFlushes());
+	}
+
+	TEST(TEST_CLASS, CanReadHeaderWithChunks) {
+		// Act + Assert:
+		AssertHeader(12, 3, ReadHeader({ Chunk_Index_Marker, 12, 3 }));
+	}
+
+	TEST(TEST_CLASS, CanReadHeaderWithoutEntries) {
+		// Act + Assert:
+		AssertHeader(0, 0, ReadHeader({ Chunk_Index_Marker, 0, 0 }));
+	}
+
+	TEST(TEST_CLASS, CanReadHeaderWithoutChunks) {
+		// Act + Assert:
+		AssertHeader(12, 0, ReadHeader({ 12 }));
+	}
+
+	TEST(TEST_CLASS, CanRoundtripHeader) {
+		// Arrange:
+		auto originalHeader = CreateChunkedDataHeader(7, 4);
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		WriteChunkedDataHeader(stream, originalHeader);
+		auto header = ReadChunkedDataHeader(stream);
+
+		// Assert:
+		AssertHeader(7, 2, header);
+	}
+
+	TEST(TEST_CLASS, CannotReadHeaderWithMoreChunksThanEntries) {
+		// Act + Assert:
+		EXPECT_THROW(ReadHeader({ Chunk_Index_Marker, 1, 2 }), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadHeaderWithEntriesButNoChunks) {
+		// Act + Assert:
+		EXPECT_THROW(ReadHeader({ Chunk_Index_Marker, 12, 0 }), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadTruncatedHeader) {
+		// Act + Assert:
+		EXPECT_THROW(ReadHeader({ Chunk_Index_Marker, 12 }), catapult_file_io_error);
+	}
+
+	// endregion
+
+	// region ReadChunkInfo
+
+	TEST(TEST_CLASS, CanReadChunkInfo) {
+		// Act:
+		auto chunk = ReadInfo({ 5, 100 }, 12);
+
+		// Assert:
+		EXPECT_EQ(5u, chunk.NumEntries);
+		EXPECT_EQ(100u, chunk.Size);
+	}
+
+	TEST(TEST_CLASS, CanReadChunkInfoWithAllRemainingEntriesAndMinimumSize) {
+		// Act:
+		auto chunk = ReadInfo({ 12, 12 }, 12);
+
+		// Assert:
+		EXPECT_EQ(12u, chunk.NumEntries);
+		EXPECT_EQ(12u, chunk.Size);
+	}
+
+	TEST(TEST_CLASS, CannotReadChunkInfoWithoutEntries) {
+		// Act + Assert:
+		EXPECT_THROW(ReadInfo({ 0, 100 }, 12), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadChunkInfoWithMoreEntriesThanRemaining) {
+		// Act + Assert:
+		EXPECT_THROW(ReadInfo({ 13, 100 }, 12), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadChunkInfoWithSizeSmallerThanNumberOfEntries) {
+		// Act + Assert:
+		EXPECT_THROW(ReadInfo({ 5, 4 }, 12), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region ReadChunkData
+
+	namespace {
+		void AssertCanReadChunkData(uint64_t size) {
+			// Arrange: append some data following the chunk
+			auto buffer = test::GenerateRandomVector(size + 10);
+			auto bufferCopy = buffer;
+			mocks::MockMemoryStream stream("", bufferCopy);
+
+			// Act:
+			auto chunkData = ReadChunkData(stream, { 1, size });
+
+			// Assert:
+			EXPECT_EQ(std::vector<uint8_t>(buffer.cbegin(), buffer.cbegin() + static_cast<long>(size)), chunkData) << size;
+			EXPECT_EQ(size, stream.position()) << size;
+		}
+	}
+
+	TEST(TEST_CLASS, CanReadSmallChunkData) {
+		// Assert:
+		AssertCanReadChunkData(123);
+	}
+
+	TEST(TEST_CLASS, CanReadChunkDataLargerThanMaxReadSize) {
+		// Assert:
+		AssertCanReadChunkData(Max_Chunk_Read_Size);
+		AssertCanReadChunkData(2 * Max_Chunk_Read_Size + 123);
+	}
+
+	TEST(TEST_CLASS, CannotReadChunkDataLargerThanStream) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(123);
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act + Assert: a corrupt size fails when the stream is exhausted
+		EXPECT_THROW(ReadChunkData(stream, { 1, 1ull << 50 }), catapult_file_io_error);
+	}
+
+	// endregion
+
+	// region ChunkedDataWriter
+
+	namespace {
+		void AddEntries(ChunkedDataWriter& writer, std::initializer_list<uint64_t> values) {
+			for (auto value : values)
+				writer.add([value](auto& output) { io::Write64(output, value); });
+		}
+	}
+
+	TEST(TEST_CLASS, WriterInitiallyHasEmptyHeader) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		ChunkedDataWriter writer(stream, 3);
+
+		// Assert:
+		AssertHeader(0, 0, writer.header());
+		EXPECT_TRUE(buffer.empty());
+	}
+
+	TEST(TEST_CLASS, WriterWritesPartialChunkOnlyWhenFlushed) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataWriter writer(stream, 3);
+
+		// Act:
+		AddEntries(writer, { 11, 12 });
+
+		// Sanity:
+		EXPECT_TRUE(buffer.empty());
+
+		// Act:
+		writer.flush();
+
+		// Assert:
+		AssertHeader(2, 1, writer.header());
+		EXPECT_EQ(ToBuffer({ 2, 16, 11, 12 }), buffer);
+		EXPECT_EQ(0u, stream.numFlushes());
+	}
+
+	TEST(TEST_CLASS, WriterWritesFullChunksImmediately) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataWriter writer(stream, 2);
+
+		// Act:
+		AddEntries(writer, { 11, 12, 13, 14, 15 });
+
+		// Assert: only the full chunks were written
+		AssertHeader(5, 2, writer.header());
+		EXPECT_EQ(ToBuffer({ 2, 16, 11, 12, 2, 16, 13, 14 }), buffer);
+
+		// Act:
+		writer.flush();
+
+		// Assert:
+		AssertHeader(5, 3, writer.header());
+		EXPECT_EQ(ToBuffer({ 2, 16, 11, 12, 2, 16, 13, 14, 1, 8, 15 }), buffer);
+	}
+
+	TEST(TEST_CLASS, WriterFlushHasNoEffectWithoutPendingEntries) {
+		// Arrange:
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataWriter writer(stream, 2);
+		AddEntries(writer, { 11, 12 });
+
+		// Act:
+		writer.flush();
+
+		// Assert:
+		AssertHeader(2, 1, writer.header());
+		EXPECT_EQ(ToBuffer({ 2, 16, 11, 12 }), buffer);
+	}
+
+	// endregion
+
+	// region ChunkedDataReader
+
+	namespace {
+		std::vector<uint64_t> ReadAll(const std::vector<uint64_t>& values) {
+			auto buffer = ToBuffer(values);
+			mocks::MockMemoryStream stream("", buffer);
+			ChunkedDataReader reader(stream);
+
+			std::vector<uint64_t> entries;
+			while (0 != reader.numRemainingEntries())
+				entries.push_back(io::Read64(reader.next()));
+
+			EXPECT_EQ(buffer.size(), stream.position());
+			return entries;
+		}
+	}
+
+	TEST(TEST_CLASS, ReaderCanReadEntriesWithoutChunks) {
+		// Act:
+		auto entries = ReadAll({ 3, 11, 12, 13 });
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint64_t>({ 11, 12, 13 }), entries);
+	}
+
+	TEST(TEST_CLASS, ReaderCanReadEntriesWithChunks) {
+		// Act:
+		auto entries = ReadAll({ Chunk_Index_Marker, 3, 2, 2, 16, 11, 12, 1, 8, 13 });
+
+		// Assert: chunk infos are skipped
+		EXPECT_EQ(std::vector<uint64_t>({ 11, 12, 13 }), entries);
+	}
+
+	TEST(TEST_CLASS, ReaderCannotReadPastEnd) {
+		// Arrange:
+		auto buffer = ToBuffer({ 0 });
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataReader reader(stream);
+
+		// Act + Assert:
+		EXPECT_THROW(reader.next(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, ReaderCannotReadEntriesWithInvalidChunkInfo) {
+		// Act + Assert:
+		EXPECT_THROW(ReadAll({ Chunk_Index_Marker, 3, 2, 0, 16, 11, 12, 1, 8, 13 }), catapult_runtime_error);
+		EXPECT_THROW(ReadAll({ Chunk_Index_Marker, 3, 2, 4, 16, 11, 12, 1, 8, 13 }), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, ReaderCannotReadEntriesWithMoreChunksThanExpected) {
+		// Act + Assert:
+		EXPECT_THROW(ReadAll({ Chunk_Index_Marker, 3, 1, 2, 16, 11, 12, 1, 8, 13 }), catapult_runtime_error);
+	}
+
+	// endregion
+}}
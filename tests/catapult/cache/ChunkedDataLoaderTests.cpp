@@ -21,7 +21,10 @@
 #include "catapult/cache/ChunkedDataLoader.h"
 #include "tests/catapult/cache/test/CacheSerializationTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
 #include "tests/TestHarness.h"
+#include <atomic>
 
 namespace catapult { namespace cache {
 
@@ -33,6 +36,7 @@ namespace catapult { namespace cache {
 
 		constexpr auto GenerateRandomEntries = test::GenerateRandomCacheSerializationTestEntries;
 		constexpr auto CopyEntriesToStreamBuffer = test::CopyCacheSerializationTestEntriesToStreamBuffer;
+		constexpr auto CopyEntriesToChunkedStreamBuffer = test::CopyCacheSerializationTestEntriesToChunkedStreamBuffer;
 	}
 
 	// region valid stream
@@ -106,6 +110,23 @@ namespace catapult { namespace cache {
 		EXPECT_FALSE(loader.hasNext());
 	}
 
+	TEST(TEST_CLASS, CanLoadStorageFromNonEmptyStreamWithChunks) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(7);
+		auto buffer = CopyEntriesToChunkedStreamBuffer(seed, 3);
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataLoader<TestEntryLoaderTraits> loader(stream);
+
+		// Act: chunk infos should be skipped
+		std::vector<TestEntry> loadedEntries;
+		loader.next(5, loadedEntries);
+		loader.next(5, loadedEntries);
+
+		// Assert:
+		EXPECT_FALSE(loader.hasNext());
+		EXPECT_EQ(seed, loadedEntries);
+	}
+
 	TEST(TEST_CLASS, ReadingFromEndOfStreamHasNoEffect) {
 		// Arrange:
 		auto buffer = CopyEntriesToStreamBuffer({});
@@ -156,5 +177,236 @@ namespace catapult { namespace cache {
 		AssertCannotLoadMalformedStream([](auto& buffer) { buffer.pop_back(); });
 	}
 
+	namespace {
+		void ModifyChunkInfo(std::vector<uint8_t>& buffer, size_t chunkIndex, const consumer<ChunkInfo&>& modify) {
+			// chunks are composed of three entries and preceded by a header composed of three values
+			auto offset = 3 * sizeof(uint64_t) + chunkIndex * (sizeof(ChunkInfo) + 3 * sizeof(TestEntry));
+
+			ChunkInfo chunkInfo;
+			std::memcpy(&chunkInfo, buffer.data() + offset, sizeof(ChunkInfo));
+			modify(chunkInfo);
+			std::memcpy(buffer.data() + offset, &chunkInfo, sizeof(ChunkInfo));
+		}
+	}
+
+	TEST(TEST_CLASS, CannotLoadFromStreamWithEmptyChunk) {
+		// Arrange: indicate that the second chunk does not contain any entries
+		auto buffer = CopyEntriesToChunkedStreamBuffer(GenerateRandomEntries(7), 3);
+		ModifyChunkInfo(buffer, 1, [](auto& chunkInfo) { chunkInfo.NumEntries = 0; });
+
+		mocks::MockMemoryStream stream("", buffer);
+		ChunkedDataLoader<TestEntryLoaderTraits> loader(stream);
+
+		// Act + Assert:
+		std::vector<TestEntry> loadedEntries;
+		EXPECT_THROW(loader.next(7, loadedEntries), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region ParallelChunkedDataLoader
+
+	namespace {
+		void AssertCanLoadInParallel(const std::vector<uint8_t>& buffer, const std::vector<TestEntry>& seed, uint32_t numThreads) {
+			// Arrange:
+			auto pPool = test::CreateStartedIoServiceThreadPool(numThreads);
+			auto bufferCopy = buffer;
+			mocks::MockMemoryStream stream("", bufferCopy);
+			ParallelChunkedDataLoader<TestEntryLoaderTraits> loader(stream, *pPool);
+
+			// Sanity:
+			EXPECT_EQ(seed.size(), loader.numEntries());
+
+			// Act:
+			std::vector<TestEntry> loadedEntries;
+			loader.loadAll(loadedEntries);
+
+			// Assert: entries are loaded in order
+			EXPECT_EQ(seed, loadedEntries) << "num threads " << numThreads;
+			EXPECT_EQ(bufferCopy.size(), stream.position());
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCanLoadFromEmptyStream) {
+		// Assert:
+		AssertCanLoadInParallel(CopyEntriesToChunkedStreamBuffer({}, 3), {}, 4);
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCanLoadFromStreamWithoutChunkIndex) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(7);
+
+		// Assert:
+		AssertCanLoadInParallel(CopyEntriesToStreamBuffer(seed), seed, 4);
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCanLoadFromStreamWithSingleChunk) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(7);
+
+		// Assert:
+		AssertCanLoadInParallel(CopyEntriesToChunkedStreamBuffer(seed, 10), seed, 4);
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCanLoadFromStreamWithMultipleChunks) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(100);
+		auto buffer = CopyEntriesToChunkedStreamBuffer(seed, 3);
+
+		// Assert: more chunks than can be decoded at once
+		for (auto numThreads : { 0u, 1u, 2u, 8u, 64u })
+			AssertCanLoadInParallel(buffer, seed, numThreads);
+	}
+
+	namespace {
+		void AssertCanLoadFilteredEntriesInParallel(const std::vector<uint8_t>& buffer, const std::vector<TestEntry>& seed) {
+			// Arrange:
+			auto pPool = test::CreateStartedIoServiceThreadPool(4);
+			auto bufferCopy = buffer;
+			mocks::MockMemoryStream stream("", bufferCopy);
+			ParallelChunkedDataLoader<TestEntryLoaderTraits> loader(stream, *pPool);
+
+			// Act: only load entries with even alpha values
+			std::vector<TestEntry> loadedEntries;
+			loader.loadAll(loadedEntries, [](const auto& entry) { return 0 == entry.Alpha % 2; });
+
+			// Assert: matching entries are loaded in order
+			std::vector<TestEntry> expectedEntries;
+			std::copy_if(seed.cbegin(), seed.cend(), std::back_inserter(expectedEntries), [](const auto& entry) {
+				return 0 == entry.Alpha % 2;
+			});
+
+			EXPECT_EQ(expectedEntries, loadedEntries);
+			EXPECT_EQ(bufferCopy.size(), stream.position());
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCanFilterEntriesFromStreamWithoutChunkIndex) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(20);
+
+		// Assert:
+		AssertCanLoadFilteredEntriesInParallel(CopyEntriesToStreamBuffer(seed), seed);
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCanFilterEntriesFromStreamWithMultipleChunks) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(100);
+
+		// Assert:
+		AssertCanLoadFilteredEntriesInParallel(CopyEntriesToChunkedStreamBuffer(seed, 3), seed);
+	}
+
+	namespace {
+		// tracks the maximum number of entries that are decoded concurrently
+		struct ConcurrencyTrackingEntryLoaderTraits {
+			using DestinationType = TestEntryLoaderTraits::DestinationType;
+
+			static std::atomic<uint32_t> NumActiveLoads;
+			static std::atomic<uint32_t> MaxActiveLoads;
+
+			static TestEntry Load(io::InputStream& input) {
+				auto numActiveLoads = ++NumActiveLoads;
+				auto maxActiveLoads = MaxActiveLoads.load();
+				while (maxActiveLoads < numActiveLoads && !MaxActiveLoads.compare_exchange_weak(maxActiveLoads, numActiveLoads))
+				{}
+
+				test::Sleep(1);
+				auto entry = TestEntryLoaderTraits::Load(input);
+				--NumActiveLoads;
+				return entry;
+			}
+
+			static void LoadInto(const TestEntry& entry, DestinationType& destination) {
+				TestEntryLoaderTraits::LoadInto(entry, destination);
+			}
+		};
+
+		std::atomic<uint32_t> ConcurrencyTrackingEntryLoaderTraits::NumActiveLoads;
+		std::atomic<uint32_t> ConcurrencyTrackingEntryLoaderTraits::MaxActiveLoads;
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderDecodesAtMostOneChunkPerThreadConcurrently) {
+		// Arrange:
+		ConcurrencyTrackingEntryLoaderTraits::MaxActiveLoads = 0;
+		auto seed = GenerateRandomEntries(100);
+		auto buffer = CopyEntriesToChunkedStreamBuffer(seed, 3);
+
+		auto pPool = test::CreateStartedIoServiceThreadPool(2);
+		mocks::MockMemoryStream stream("", buffer);
+		ParallelChunkedDataLoader<ConcurrencyTrackingEntryLoaderTraits> loader(stream, *pPool);
+
+		// Act:
+		std::vector<TestEntry> loadedEntries;
+		loader.loadAll(loadedEntries);
+
+		// Assert: chunks are decoded by (at most) the pool threads and the calling thread
+		EXPECT_EQ(seed, loadedEntries);
+		EXPECT_GE(3u, ConcurrencyTrackingEntryLoaderTraits::MaxActiveLoads);
+	}
+
+	namespace {
+		template<typename TException>
+		void AssertParallelLoaderCannotLoadMalformedStream(const consumer<std::vector<uint8_t>&>& malformBuffer) {
+			// Arrange:
+			auto seed = GenerateRandomEntries(7);
+			auto buffer = CopyEntriesToChunkedStreamBuffer(seed, 3);
+			malformBuffer(buffer);
+
+			auto pPool = test::CreateStartedIoServiceThreadPool(2);
+			mocks::MockMemoryStream stream("", buffer);
+			ParallelChunkedDataLoader<TestEntryLoaderTraits> loader(stream, *pPool);
+
+			// Act + Assert:
+			std::vector<TestEntry> loadedEntries;
+			EXPECT_THROW(loader.loadAll(loadedEntries), TException);
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCannotLoadFromStreamWithTruncatedEntries) {
+		// Arrange: corrupt the stream by dropping a byte
+		AssertParallelLoaderCannotLoadMalformedStream<catapult_file_io_error>([](auto& buffer) { buffer.pop_back(); });
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCannotLoadFromStreamWithTooSmallChunk) {
+		// Arrange: indicate that the second chunk is smaller than its entries
+		AssertParallelLoaderCannotLoadMalformedStream<catapult_file_io_error>([](auto& buffer) {
+			ModifyChunkInfo(buffer, 1, [](auto& chunkInfo) { --chunkInfo.Size; });
+		});
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCannotLoadFromStreamWithTooLargeChunk) {
+		// Arrange: indicate that the second chunk is larger than its entries
+		AssertParallelLoaderCannotLoadMalformedStream<catapult_runtime_error>([](auto& buffer) {
+			ModifyChunkInfo(buffer, 1, [](auto& chunkInfo) { ++chunkInfo.Size; });
+		});
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCannotLoadFromStreamWithChunkLargerThanStream) {
+		// Arrange: indicate that the second chunk is much larger than the stream
+		//          (the chunk buffer is only grown as data is read, so this fails when the stream is exhausted)
+		AssertParallelLoaderCannotLoadMalformedStream<catapult_file_io_error>([](auto& buffer) {
+			ModifyChunkInfo(buffer, 1, [](auto& chunkInfo) { chunkInfo.Size = 1ull << 50; });
+		});
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCannotLoadFromStreamWithChunkContainingInvalidNumberOfEntries) {
+		// Arrange: indicate that the second chunk contains no entries or more entries than remaining
+		for (auto numEntries : { 0ull, 5ull }) {
+			AssertParallelLoaderCannotLoadMalformedStream<catapult_runtime_error>([numEntries](auto& buffer) {
+				ModifyChunkInfo(buffer, 1, [numEntries](auto& chunkInfo) { chunkInfo.NumEntries = numEntries; });
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelLoaderCannotLoadFromStreamWithUnexpectedNumberOfChunks) {
+		// Arrange: indicate that the stream contains fewer or more chunks than it really does
+		for (auto numChunks : { 2ull, 4ull }) {
+			AssertParallelLoaderCannotLoadMalformedStream<catapult_runtime_error>([numChunks](auto& buffer) {
+				reinterpret_cast<uint64_t*>(buffer.data())[2] = numChunks;
+			});
+		}
+	}
+
 	// endregion
 }}
@@ -515,6 +515,205 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEachByPriority
+
+	namespace {
+		struct TransactionDescriptor {
+			uint8_t SignerId;
+			Amount::ValueType Fee;
+			uint32_t Size;
+		};
+
+		model::TransactionInfo CreateTransactionInfo(const TransactionDescriptor& descriptor, size_t deadline) {
+			auto pTransaction = test::GenerateRandomTransaction(descriptor.Size);
+			pTransaction->Signer = Key{ { descriptor.SignerId } };
+			pTransaction->Fee = Amount(descriptor.Fee);
+			pTransaction->Deadline = Timestamp(deadline);
+
+			auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+			test::FillWithRandomData(transactionInfo.EntityHash);
+			return transactionInfo;
+		}
+
+		std::vector<model::TransactionInfo> CreateTransactionInfos(const std::vector<TransactionDescriptor>& descriptors) {
+			// use (one-based) insertion index as deadline so that transactions can be identified
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (const auto& descriptor : descriptors)
+				transactionInfos.push_back(CreateTransactionInfo(descriptor, transactionInfos.size() + 1));
+
+			return transactionInfos;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractRawDeadlinesByPriority(const MemoryUtCache& cache, size_t numRequested = 1000) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEachByPriority([numRequested, &rawDeadlines](const auto& info) {
+				rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+				return numRequested != rawDeadlines.size();
+			});
+			return rawDeadlines;
+		}
+
+		auto PrepareCache(const std::vector<TransactionDescriptor>& descriptors) {
+			auto pCache = std::make_unique<MemoryUtCache>(Default_Options);
+			test::AddAll(*pCache, CreateTransactionInfos(descriptors));
+			return pCache;
+		}
+
+		constexpr uint32_t Base_Size = sizeof(model::Transaction) + 100;
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsNoTransactionInfosIfCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(cache);
+
+		// Assert:
+		EXPECT_TRUE(rawDeadlines.empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsTransactionsOrderedByFeePerByte) {
+		// Arrange: all transactions have different signers
+		auto pCache = PrepareCache({
+			{ 1, 100, Base_Size },
+			{ 2, 300, Base_Size },
+			{ 3, 250, 2 * Base_Size },
+			{ 4, 1000, Base_Size },
+			{ 5, 0, Base_Size },
+			{ 6, 350, Base_Size }
+		});
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(*pCache);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 4, 6, 2, 3, 1, 5 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsTransactionsWithSameFeePerByteInInsertionOrder) {
+		// Arrange: all transactions have different signers and same fee per byte
+		auto pCache = PrepareCache({
+			{ 1, 200, 2 * Base_Size },
+			{ 2, 100, Base_Size },
+			{ 3, 300, 3 * Base_Size },
+			{ 4, 100, Base_Size }
+		});
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(*pCache);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3, 4 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityNeverForwardsTransactionBeforeOlderTransactionWithSameSigner) {
+		// Arrange: the second transaction of signer 1 has the highest fee but depends on the first transaction of signer 1
+		auto pCache = PrepareCache({
+			{ 1, 500, Base_Size },
+			{ 2, 100, Base_Size },
+			{ 1, 1000, Base_Size },
+			{ 3, 700, Base_Size }
+		});
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(*pCache);
+
+		// Assert: deferred transaction 3 is forwarded as soon as it is unblocked because it has a higher priority than transaction 2
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 4, 1, 3, 2 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityPreservesOrderOfLongSameSignerChains) {
+		// Arrange: fees of signer 1 are decreasing, fees of signer 2 are increasing
+		auto pCache = PrepareCache({
+			{ 1, 900, Base_Size },
+			{ 2, 100, Base_Size },
+			{ 1, 800, Base_Size },
+			{ 2, 200, Base_Size },
+			{ 1, 700, Base_Size },
+			{ 2, 1000, Base_Size }
+		});
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(*pCache);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3, 5, 2, 4, 6 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsSubsetOfTransactionsIfShortCircuited) {
+		// Arrange:
+		auto pCache = PrepareCache({
+			{ 1, 100, Base_Size },
+			{ 2, 300, Base_Size },
+			{ 3, 200, Base_Size },
+			{ 4, 400, Base_Size }
+		});
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(*pCache, 2);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 4, 2 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityDoesNotForwardRemovedTransactions) {
+		// Arrange:
+		auto transactionInfos = CreateTransactionInfos({
+			{ 1, 500, Base_Size },
+			{ 2, 100, Base_Size },
+			{ 1, 1000, Base_Size },
+			{ 3, 700, Base_Size }
+		});
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, transactionInfos);
+
+		// Act: remove the first transaction of signer 1, which unblocks the second transaction of signer 1
+		cache.modifier().remove(transactionInfos[0].EntityHash);
+		cache.modifier().remove(transactionInfos[3].EntityHash);
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(cache);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 3, 2 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsNoTransactionInfosAfterRemoveAll) {
+		// Arrange:
+		auto pCache = PrepareCache({
+			{ 1, 100, Base_Size },
+			{ 1, 300, Base_Size },
+			{ 2, 200, Base_Size }
+		});
+
+		// Act:
+		pCache->modifier().removeAll();
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(*pCache);
+
+		// Assert:
+		EXPECT_TRUE(rawDeadlines.empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByPriorityForwardsAllTransactionsAddedAfterRemoval) {
+		// Arrange:
+		auto transactionInfos = CreateTransactionInfos({
+			{ 1, 100, Base_Size },
+			{ 2, 300, Base_Size },
+			{ 1, 200, Base_Size }
+		});
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, transactionInfos);
+		cache.modifier().remove(transactionInfos[1].EntityHash);
+
+		// Act: re-add the removed transaction
+		cache.modifier().add(transactionInfos[1]);
+		auto rawDeadlines = ExtractRawDeadlinesByPriority(cache);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 1, 3 }), rawDeadlines);
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsAllShortHashes) {
@@ -19,7 +19,9 @@
 **/
 
 #include "catapult/cache/PatriciaTreeCacheMixins.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/catapult/cache/test/PatriciaTreeTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/other/DeltaElementsTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -306,6 +308,54 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(expectedRoot, pDeltaTree->root());
 	}
 
+	namespace {
+		void AssertTryGetReturnsRootWhenTreeIsValidAndHasManyModifications(thread::IoServiceThreadPool* pPool) {
+			// Arrange: add enough values to trigger parallel subtree hashing
+			tree::MemoryDataSource dataSource;
+			test::MemoryBasePatriciaTree tree(dataSource);
+			test::SeedTreeWithFourNodes(tree);
+
+			DeltasWrapper deltaset;
+			std::vector<std::pair<uint32_t, std::string>> expectedPairs{
+				{ 0x64'6F'00'00, "verb" },
+				{ 0x64'6F'67'00, "puppy" },
+				{ 0x64'6F'67'65, "coin" },
+				{ 0x68'6F'72'73, "stallion" }
+			};
+			for (auto i = 0u; i < 2000; ++i) {
+				auto key = 0x10'00'00'00 + i * 0x01'23'45;
+				deltaset.Added.emplace(key, std::to_string(i));
+				expectedPairs.emplace_back(key, std::to_string(i));
+			}
+
+			auto pDeltaTree = tree.rebase();
+			auto mixin = PatriciaTreeDeltaMixin<DeltasWrapper, test::MemoryBasePatriciaTree::DeltaType>(deltaset, pDeltaTree);
+			mixin.updateMerkleRoot(Height(123), pPool);
+
+			// Act:
+			auto result = mixin.tryGetMerkleRoot();
+
+			// Assert:
+			auto expectedRoot = test::CalculateRootHash(expectedPairs);
+
+			EXPECT_TRUE(result.second);
+			EXPECT_EQ(expectedRoot, result.first);
+		}
+	}
+
+	TEST(TEST_CLASS, DeltaMixin_TryGetReturnsRootWhenTreeIsValidAndHasManyModifications_WithoutPool) {
+		// Assert:
+		AssertTryGetReturnsRootWhenTreeIsValidAndHasManyModifications(nullptr);
+	}
+
+	TEST(TEST_CLASS, DeltaMixin_TryGetReturnsRootWhenTreeIsValidAndHasManyModifications_WithPool) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+
+		// Assert:
+		AssertTryGetReturnsRootWhenTreeIsValidAndHasManyModifications(pPool.get());
+	}
+
 	TEST(TEST_CLASS, DeltaMixin_UpdatePreservesGenerationalRootHashes) {
 		// Arrange:
 		tree::MemoryDataSource dataSource;
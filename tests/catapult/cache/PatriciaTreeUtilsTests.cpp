@@ -19,7 +19,9 @@
 **/
 
 #include "catapult/cache/PatriciaTreeUtils.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/catapult/cache/test/PatriciaTreeTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/other/DeltaElementsTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -311,7 +313,7 @@ namespace catapult { namespace cache {
 		deltaset.Copied.emplace(0x64'6F'00'00, "noun");
 
 		// Act:
-		ApplyDeltasToTree(tree, deltaset, 1, Height(1));
+		auto numChanges = ApplyDeltasToTree(tree, deltaset, 1, Height(1));
 
 		// Assert:
 		auto expectedRoot = test::CalculateRootHash({
@@ -321,6 +323,7 @@ namespace catapult { namespace cache {
 			{ 0x26'54'32'10, "alpha" }
 		});
 
+		EXPECT_EQ(3u, numChanges);
 		EXPECT_EQ(expectedRoot, tree.root());
 	}
 
@@ -467,4 +470,44 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region HashSubtreesInParallel
+
+	namespace {
+		void AssertCanHashSubtreesInParallel(uint32_t numThreads) {
+			// Arrange:
+			tree::MemoryDataSource dataSource;
+			MemoryPatriciaTree tree(dataSource);
+			std::vector<std::pair<uint32_t, std::string>> pairs;
+			for (auto i = 0u; i < 500; ++i) {
+				pairs.emplace_back(0x10'00'00'00 + i * 0x01'23'45, std::to_string(i));
+				tree.set(pairs.back().first, pairs.back().second);
+			}
+
+			auto pPool = test::CreateStartedIoServiceThreadPool(numThreads);
+
+			// Act:
+			size_t numSubtrees = 0;
+			auto rootHash = tree.root(2, [&pool = *pPool, &numSubtrees](const auto& subtrees) {
+				numSubtrees = subtrees.size();
+				HashSubtreesInParallel(subtrees, pool);
+			});
+
+			// Assert:
+			EXPECT_LT(1u, numSubtrees);
+			EXPECT_EQ(test::CalculateRootHash(pairs), rootHash);
+		}
+	}
+
+	TEST(TEST_CLASS, CanHashSubtreesInParallel_SingleThread) {
+		// Assert:
+		AssertCanHashSubtreesInParallel(1);
+	}
+
+	TEST(TEST_CLASS, CanHashSubtreesInParallel_MultipleThreads) {
+		// Assert:
+		AssertCanHashSubtreesInParallel(4);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,66 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/SubCacheMerkleRootTimings.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS SubCacheMerkleRootTimingsTests
+
+	TEST(TEST_CLASS, CanCreateTimings) {
+		// Act:
+		SubCacheMerkleRootTimings timings({ "alpha", "", "gamma" });
+
+		// Assert:
+		ASSERT_EQ(3u, timings.size());
+		EXPECT_EQ("alpha", timings.name(0));
+		EXPECT_EQ("", timings.name(1));
+		EXPECT_EQ("gamma", timings.name(2));
+
+		for (auto id = 0u; id < timings.size(); ++id)
+			EXPECT_EQ(0u, timings.elapsedMicros(id)) << id;
+	}
+
+	TEST(TEST_CLASS, CanSetElapsedMicros) {
+		// Arrange:
+		SubCacheMerkleRootTimings timings({ "alpha", "", "gamma" });
+
+		// Act:
+		timings.setElapsedMicros(0, 123);
+		timings.setElapsedMicros(2, 987);
+		timings.setElapsedMicros(0, 222);
+
+		// Assert:
+		EXPECT_EQ(222u, timings.elapsedMicros(0));
+		EXPECT_EQ(0u, timings.elapsedMicros(1));
+		EXPECT_EQ(987u, timings.elapsedMicros(2));
+	}
+
+	TEST(TEST_CLASS, CannotAccessOutOfRangeId) {
+		// Arrange:
+		SubCacheMerkleRootTimings timings({ "alpha", "", "gamma" });
+
+		// Act + Assert:
+		EXPECT_THROW(timings.name(3), catapult_out_of_range);
+		EXPECT_THROW(timings.elapsedMicros(3), catapult_out_of_range);
+		EXPECT_THROW(timings.setElapsedMicros(3, 123), catapult_out_of_range);
+	}
+}}
@@ -360,7 +360,7 @@ namespace catapult { namespace cache {
 		// Arrange:
 		RunTestForMerkleRootSupportedButDisabled([](auto& view) {
 			// Act:
-			view.updateMerkleRoot(Height(3));
+			view.updateMerkleRoot(Height(3), nullptr);
 
 			// Assert:
 			Hash256 merkleRoot;
@@ -375,7 +375,7 @@ namespace catapult { namespace cache {
 			expectedUpdatedMerkleRoot[0] = 3;
 
 			// Act:
-			view.updateMerkleRoot(Height(3));
+			view.updateMerkleRoot(Height(3), nullptr);
 
 			// Assert:
 			Hash256 merkleRoot;
@@ -388,7 +388,7 @@ namespace catapult { namespace cache {
 		// Arrange:
 		RunTestForMerkleRootSupportedAndEnabledView([](auto& view, const auto& expectedMerkleRoot) {
 			// Act: even if const is improperly casted away, operation should fail on const view
-			const_cast<SubCacheView&>(view).updateMerkleRoot(Height(3));
+			const_cast<SubCacheView&>(view).updateMerkleRoot(Height(3), nullptr);
 
 			// Assert:
 			Hash256 merkleRoot;
@@ -401,7 +401,7 @@ namespace catapult { namespace cache {
 		// Arrange:
 		RunTestForMerkleRootNotSupported([](auto& view) {
 			// Act:
-			view.updateMerkleRoot(Height(3));
+			view.updateMerkleRoot(Height(3), nullptr);
 
 			// Assert:
 			Hash256 merkleRoot;
@@ -532,13 +532,17 @@ namespace catapult { namespace cache {
 		pCacheStorage->saveAll(stream);
 
 		// Assert:
-		ASSERT_EQ(6 * sizeof(uint64_t), buffer.size());
+		ASSERT_EQ(10 * sizeof(uint64_t), buffer.size());
 
 		const auto* pData64 = reinterpret_cast<const uint64_t*>(buffer.data());
-		EXPECT_EQ(5u, pData64[0]); // size;
+		EXPECT_EQ(Chunk_Index_Marker, pData64[0]);
+		EXPECT_EQ(5u, pData64[1]); // size
+		EXPECT_EQ(1u, pData64[2]); // number of chunks
+		EXPECT_EQ(5u, pData64[3]); // number of entries in chunk
+		EXPECT_EQ(5 * sizeof(uint64_t), pData64[4]); // size of chunk
 
 		for (auto i = 1u; i <= 5; ++i)
-			EXPECT_EQ(i ^ 0xFFFFFFFF'FFFFFFFF, pData64[i]) << "value at " << i;
+			EXPECT_EQ(i ^ 0xFFFFFFFF'FFFFFFFF, pData64[4 + i]) << "value at " << i;
 	}
 
 	TEST(TEST_CLASS, CanDeserializeCacheFromStorage) {
@@ -566,6 +570,21 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region createDeltaStorage
+
+	TEST(TEST_CLASS, CannotAccessDeltaStorageWhenCacheDeltaDoesNotSupportDeltaElements) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(0, test::SimpleCacheViewMode::Iterable));
+
+		// Act:
+		auto pCacheDeltaStorage = adapter.createDeltaStorage();
+
+		// Assert:
+		ASSERT_FALSE(!!pCacheDeltaStorage);
+	}
+
+	// endregion
+
 	// region general cache synchronization tests
 
 	namespace {
@@ -19,7 +19,9 @@
 **/
 
 #include "catapult/cache/SummaryAwareSubCachePluginAdapter.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -36,9 +38,17 @@ namespace catapult { namespace cache {
 				// do nothing
 			}
 
-			void loadAll(io::InputStream&, size_t) override {
-				// do nothing
+			void loadAll(io::InputStream&, size_t batchSize) override {
+				m_batchSizes.push_back(batchSize);
+			}
+
+		public:
+			const std::vector<size_t>& batchSizes() const {
+				return m_batchSizes;
 			}
+
+		private:
+			std::vector<size_t> m_batchSizes;
 		};
 
 		void AssertCanCreateStorageViaPlugin(test::SimpleCacheViewMode mode, const std::string& expectedStorageName) {
@@ -67,4 +77,21 @@ namespace catapult { namespace cache {
 		// Assert:
 		AssertCanCreateStorageViaPlugin(test::SimpleCacheViewMode::Basic, "SimpleCache_summary");
 	}
+
+	TEST(TEST_CLASS, SummaryCacheStorageLoadsAllDataInSingleBatchWhenLoadingInParallel) {
+		// Arrange:
+		test::SimpleCache cache;
+		SimpleCacheSummaryCacheStorage storage(cache);
+
+		// - summary data is loaded on the calling thread, so the pool does not need to be started
+		auto pPool = thread::CreateIoServiceThreadPool(4);
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		storage.loadAllParallel(stream, *pPool);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ std::numeric_limits<size_t>::max() }), storage.batchSizes());
+	}
 }}
@@ -19,8 +19,10 @@
 **/
 
 #include "CacheSerializationTestUtils.h"
+#include "catapult/cache/ChunkedDataHeader.h"
 #include "catapult/io/Stream.h"
 #include "tests/test/nodeps/Random.h"
+#include <algorithm>
 #include <cstring>
 
 namespace catapult { namespace test {
@@ -51,4 +53,25 @@ namespace catapult { namespace test {
 		std::memcpy(buffer.data() + numHeaderBytes, entries.data(), numBytes - numHeaderBytes);
 		return buffer;
 	}
+
+	std::vector<uint8_t> CopyCacheSerializationTestEntriesToChunkedStreamBuffer(
+			const std::vector<CacheSerializationTestEntry>& entries,
+			size_t numEntriesPerChunk) {
+		auto numChunks = (entries.size() + numEntriesPerChunk - 1) / numEntriesPerChunk;
+		std::vector<uint64_t> header{ cache::Chunk_Index_Marker, entries.size(), numChunks };
+		std::vector<uint8_t> buffer(header.size() * sizeof(uint64_t));
+		std::memcpy(buffer.data(), header.data(), buffer.size());
+
+		for (auto i = 0u; i < entries.size(); i += numEntriesPerChunk) {
+			auto numChunkEntries = std::min<uint64_t>(numEntriesPerChunk, entries.size() - i);
+			uint64_t chunkInfo[] = { numChunkEntries, numChunkEntries * sizeof(CacheSerializationTestEntry) };
+
+			auto offset = buffer.size();
+			buffer.resize(offset + sizeof(chunkInfo) + chunkInfo[1]);
+			std::memcpy(buffer.data() + offset, chunkInfo, sizeof(chunkInfo));
+			std::memcpy(buffer.data() + offset + sizeof(chunkInfo), &entries[i], chunkInfo[1]);
+		}
+
+		return buffer;
+	}
 }}
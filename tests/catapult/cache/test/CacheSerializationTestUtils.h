@@ -20,6 +20,7 @@
 
 #pragma once
 #include <vector>
+#include <stddef.h>
 #include <stdint.h>
 
 namespace catapult {
@@ -61,4 +62,9 @@ namespace catapult { namespace test {
 
 	/// Copies cache serialization test \a entries to a buffer.
 	std::vector<uint8_t> CopyCacheSerializationTestEntriesToStreamBuffer(const std::vector<CacheSerializationTestEntry>& entries);
+
+	/// Copies cache serialization test \a entries to a buffer in chunks of \a numEntriesPerChunk entries each preceded by its chunk info.
+	std::vector<uint8_t> CopyCacheSerializationTestEntriesToChunkedStreamBuffer(
+			const std::vector<CacheSerializationTestEntry>& entries,
+			size_t numEntriesPerChunk);
 }}
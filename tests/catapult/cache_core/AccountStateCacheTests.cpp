@@ -1099,6 +1099,131 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	namespace {
+		template<typename TAction>
+		void RunHighValueAddressChangesTest(TAction action) {
+			// Arrange: add 3/5 accounts with sufficient balance [3 match]
+			auto balances = std::vector<Amount>{ Amount(1'100'000), Amount(900'000), Amount(1'000'000), Amount(800'000), Amount(1'200'000) };
+			RunHighValueAddressesTest(balances, [action](const auto& addresses, auto& delta, const auto& view) {
+				// - add 2/3 accounts with sufficient balance (uncommitted) [5 match]
+				auto uncommittedAddresses = AddAccountsWithBalances(*delta, { Amount(1'100'000), Amount(900'000), Amount(1'000'000) });
+
+				// - modify two (one becomes high value and one loses high value) [5 match]
+				delta->find(addresses[1]).get().Balances.credit(Xem_Id, Amount(100'000));
+				delta->find(addresses[4]).get().Balances.debit(Xem_Id, Amount(200'001));
+
+				// - modify one without affecting high value status [5 match]
+				delta->find(addresses[3]).get().Balances.credit(Xem_Id, Amount(1));
+
+				// - delete two [3 match]
+				delta->queueRemove(addresses[2], Height(1));
+				delta->queueRemove(uncommittedAddresses[0], Height(1));
+				delta->commitRemovals();
+
+				// Act + Assert:
+				action(addresses, uncommittedAddresses, delta, view);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, HighValueAddressChangesReturnsOnlyChangedAccounts) {
+		// Arrange:
+		RunHighValueAddressChangesTest([](const auto& addresses, const auto& uncommittedAddresses, const auto& delta, const auto&) {
+			// Act:
+			auto changes = delta->highValueAddressChanges();
+
+			// Assert:
+			EXPECT_EQ(model::AddressSet({ addresses[1], uncommittedAddresses[2] }), changes.Added);
+			EXPECT_EQ(model::AddressSet({ addresses[2], addresses[4] }), changes.Removed);
+		});
+	}
+
+	TEST(TEST_CLASS, HighValueAddressChangesIsEmptyWhenThereAreNoChanges) {
+		// Arrange: add 2/3 accounts with sufficient balance
+		auto balances = std::vector<Amount>{ Amount(1'100'000), Amount(900'000), Amount(1'000'000) };
+		RunHighValueAddressesTest(balances, [](const auto&, const auto& delta, const auto&) {
+			// Act:
+			auto changes = delta->highValueAddressChanges();
+
+			// Assert:
+			EXPECT_TRUE(changes.Added.empty());
+			EXPECT_TRUE(changes.Removed.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, ForEachHighValueAddressVisitsAllAccountsMeetingCriteria) {
+		// Arrange:
+		RunHighValueAddressChangesTest([](const auto& addresses, const auto& uncommittedAddresses, const auto& delta, const auto&) {
+			// Act:
+			std::vector<Address> visitedAddresses;
+			delta->forEachHighValueAddress([&visitedAddresses](const auto& address) {
+				visitedAddresses.push_back(address);
+			});
+
+			// Assert: each address is visited exactly once
+			EXPECT_EQ(3u, visitedAddresses.size());
+			EXPECT_EQ(
+					model::AddressSet({ addresses[0], addresses[1], uncommittedAddresses[2] }),
+					model::AddressSet(visitedAddresses.cbegin(), visitedAddresses.cend()));
+		});
+	}
+
+	TEST(TEST_CLASS, HighValueAccountsReturnsMutableAccountStatesOfAllAccountsMeetingCriteria) {
+		// Arrange:
+		RunHighValueAddressChangesTest([](const auto& addresses, const auto& uncommittedAddresses, auto& delta, const auto&) {
+			// Act:
+			auto highValueAccounts = delta->highValueAccounts();
+
+			// Assert:
+			model::AddressSet highValueAddresses;
+			for (auto* pAccountState : highValueAccounts) {
+				highValueAddresses.insert(pAccountState->Address);
+				EXPECT_EQ(pAccountState, &delta->find(pAccountState->Address).get());
+			}
+
+			EXPECT_EQ(3u, highValueAccounts.size());
+			EXPECT_EQ(model::AddressSet({ addresses[0], addresses[1], uncommittedAddresses[2] }), highValueAddresses);
+		});
+	}
+
+	TEST(TEST_CLASS, CommitAppliesHighValueAddressChanges) {
+		// Arrange: set min balance to 1M
+		auto options = Default_Cache_Options;
+		options.MinHighValueAccountBalance = Amount(1'000'000);
+		AccountStateCache cache(CacheConfiguration(), options);
+
+		// - add 3/5 accounts with sufficient balance [3 match]
+		auto delta = cache.createDelta();
+		auto addresses = AddAccountsWithBalances(*delta, {
+			Amount(1'100'000), Amount(900'000), Amount(1'000'000), Amount(800'000), Amount(1'200'000)
+		});
+		cache.commit();
+
+		// - add 2/3 accounts with sufficient balance [5 match]
+		auto uncommittedAddresses = AddAccountsWithBalances(*delta, { Amount(1'100'000), Amount(900'000), Amount(1'000'000) });
+
+		// - modify two [5 match]
+		delta->find(addresses[1]).get().Balances.credit(Xem_Id, Amount(100'000));
+		delta->find(addresses[4]).get().Balances.debit(Xem_Id, Amount(200'001));
+
+		// - delete two [3 match]
+		delta->queueRemove(addresses[2], Height(1));
+		delta->queueRemove(uncommittedAddresses[0], Height(1));
+		delta->commitRemovals();
+
+		// Act:
+		cache.commit();
+
+		// Assert:
+		auto expectedAddresses = model::AddressSet({ addresses[0], addresses[1], uncommittedAddresses[2] });
+		EXPECT_EQ(expectedAddresses, delta->highValueAddresses());
+		EXPECT_EQ(expectedAddresses, cache.createView()->highValueAddresses());
+
+		auto changes = delta->highValueAddressChanges();
+		EXPECT_TRUE(changes.Added.empty());
+		EXPECT_TRUE(changes.Removed.empty());
+	}
+
 	// endregion
 
 	// region cache init
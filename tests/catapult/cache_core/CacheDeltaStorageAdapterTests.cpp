@@ -0,0 +1,391 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CacheDeltaStorageAdapter.h"
+#include "catapult/cache/CacheStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/cache_core/BlockDifficultyCacheStorage.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/constants.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS CacheDeltaStorageAdapterTests
+
+	namespace {
+		constexpr size_t Num_Seed_Entries = 10;
+
+		using Buffers = std::vector<std::vector<uint8_t>>;
+
+		CatapultCache CreateCache() {
+			return test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		}
+
+		Address CreateAddress(uint8_t id) {
+			Address address{};
+			address[0] = id;
+			return address;
+		}
+
+		void Seed(CatapultCache& cache) {
+			auto delta = cache.createDelta();
+			for (auto i = 1u; i <= Num_Seed_Entries; ++i) {
+				delta.sub<AccountStateCache>().addAccount(CreateAddress(static_cast<uint8_t>(i)), Height(1));
+				delta.sub<BlockDifficultyCache>().insert(Height(i), Timestamp(i), Difficulty(i));
+			}
+
+			cache.commit(Height(Num_Seed_Entries));
+		}
+
+		Buffers SaveAll(const CatapultCache& cache) {
+			Buffers buffers;
+			for (const auto& pStorage : cache.storages()) {
+				buffers.emplace_back();
+				mocks::MockMemoryStream stream("", buffers.back());
+				pStorage->saveAll(stream);
+			}
+
+			return buffers;
+		}
+
+		// applies \a action to a delta of \a cache, saves the delta to \a deltaBuffers and commits it
+		template<typename TAction>
+		void SaveDeltaAndCommit(CatapultCache& cache, Height height, Buffers& deltaBuffers, TAction action) {
+			auto delta = cache.createDelta();
+			action(delta);
+
+			auto deltaStorages = cache.deltaStorages();
+			deltaBuffers.resize(deltaStorages.size());
+			for (auto i = 0u; i < deltaStorages.size(); ++i) {
+				mocks::MockMemoryStream stream("", deltaBuffers[i]);
+				deltaStorages[i]->saveDelta(delta, stream);
+			}
+
+			cache.commit(height);
+		}
+
+		CatapultCache LoadAll(const Buffers& snapshotBuffers, const Buffers& deltaBuffers, size_t numDeltas) {
+			auto cache = CreateCache();
+			auto pPool = test::CreateStartedIoServiceThreadPool(2);
+			auto deltaStorages = cache.deltaStorages();
+			for (auto i = 0u; i < deltaStorages.size(); ++i) {
+				auto snapshotBuffer = snapshotBuffers[i];
+				auto deltaBuffer = deltaBuffers[i];
+				mocks::MockMemoryStream snapshotStream("", snapshotBuffer);
+				mocks::MockMemoryStream deltaStream("", deltaBuffer);
+				deltaStorages[i]->loadAllParallel(snapshotStream, { { deltaStream, numDeltas } }, *pPool);
+			}
+
+			return cache;
+		}
+
+		void AssertEqual(const CatapultCache& expectedCache, const CatapultCache& cache) {
+			auto expectedView = expectedCache.createView();
+			auto view = cache.createView();
+
+			const auto& expectedAccountStateCacheView = expectedView.sub<AccountStateCache>();
+			const auto& accountStateCacheView = view.sub<AccountStateCache>();
+			ASSERT_EQ(expectedAccountStateCacheView.size(), accountStateCacheView.size());
+			for (const auto& pair : *expectedAccountStateCacheView.tryMakeIterableView()) {
+				auto accountStateIter = accountStateCacheView.find(pair.first);
+				ASSERT_TRUE(!!accountStateIter.tryGet());
+				EXPECT_EQ(pair.second.Balances.get(Xem_Id), accountStateIter.get().Balances.get(Xem_Id));
+			}
+
+			const auto& expectedBlockDifficultyCacheView = expectedView.sub<BlockDifficultyCache>();
+			const auto& blockDifficultyCacheView = view.sub<BlockDifficultyCache>();
+			ASSERT_EQ(expectedBlockDifficultyCacheView.size(), blockDifficultyCacheView.size());
+			for (const auto& info : *expectedBlockDifficultyCacheView.tryMakeIterableView())
+				EXPECT_TRUE(blockDifficultyCacheView.contains(info)) << info.BlockHeight;
+		}
+
+		void AddBlock(CatapultCacheDelta& delta, Height height) {
+			delta.sub<AccountStateCache>().addAccount(CreateAddress(static_cast<uint8_t>(100 + height.unwrap())), height);
+			delta.sub<BlockDifficultyCache>().insert(height, Timestamp(height.unwrap()), Difficulty(height.unwrap()));
+		}
+	}
+
+	// region name
+
+	TEST(TEST_CLASS, CatapultCacheExposesDeltaStoragesForAllCoreCaches) {
+		// Arrange:
+		auto cache = CreateCache();
+
+		// Act:
+		auto deltaStorages = cache.deltaStorages();
+
+		// Assert:
+		ASSERT_EQ(2u, deltaStorages.size());
+		EXPECT_EQ("AccountStateCache", deltaStorages[0]->name());
+		EXPECT_EQ("BlockDifficultyCache", deltaStorages[1]->name());
+	}
+
+	// endregion
+
+	// region loadAllParallel
+
+	TEST(TEST_CLASS, CanLoadSnapshotWithoutDeltas) {
+		// Arrange:
+		auto originalCache = CreateCache();
+		Seed(originalCache);
+		auto snapshotBuffers = SaveAll(originalCache);
+
+		// Act:
+		auto cache = LoadAll(snapshotBuffers, Buffers(2), 0);
+
+		// Assert:
+		AssertEqual(originalCache, cache);
+	}
+
+	TEST(TEST_CLASS, CanLoadSnapshotWithAddedModifiedAndRemovedValues) {
+		// Arrange:
+		auto originalCache = CreateCache();
+		Seed(originalCache);
+		auto snapshotBuffers = SaveAll(originalCache);
+
+		Buffers deltaBuffers;
+		SaveDeltaAndCommit(originalCache, Height(11), deltaBuffers, [](auto& delta) {
+			AddBlock(delta, Height(11));
+			delta.template sub<AccountStateCache>().find(CreateAddress(2)).get().Balances.credit(Xem_Id, Amount(222));
+			delta.template sub<AccountStateCache>().queueRemove(CreateAddress(3), Height(1));
+			delta.template sub<AccountStateCache>().commitRemovals();
+		});
+
+		// Act:
+		auto cache = LoadAll(snapshotBuffers, deltaBuffers, 1);
+
+		// Assert:
+		AssertEqual(originalCache, cache);
+		EXPECT_EQ(Num_Seed_Entries, cache.createView().sub<AccountStateCache>().size());
+		EXPECT_EQ(Num_Seed_Entries + 1, cache.createView().sub<BlockDifficultyCache>().size());
+	}
+
+	TEST(TEST_CLASS, LaterDeltasSupersedeEarlierDeltas) {
+		// Arrange:
+		auto originalCache = CreateCache();
+		Seed(originalCache);
+		auto snapshotBuffers = SaveAll(originalCache);
+
+		// - add, modify and remove values across multiple deltas (including a rollback)
+		Buffers deltaBuffers;
+		SaveDeltaAndCommit(originalCache, Height(11), deltaBuffers, [](auto& delta) {
+			AddBlock(delta, Height(11));
+			delta.template sub<AccountStateCache>().queueRemove(CreateAddress(3), Height(1));
+			delta.template sub<AccountStateCache>().commitRemovals();
+			delta.template sub<AccountStateCache>().find(CreateAddress(4)).get().Balances.credit(Xem_Id, Amount(10));
+		});
+		SaveDeltaAndCommit(originalCache, Height(11), deltaBuffers, [](auto& delta) {
+			delta.template sub<AccountStateCache>().queueRemove(CreateAddress(111), Height(11));
+			delta.template sub<AccountStateCache>().commitRemovals();
+			delta.template sub<AccountStateCache>().addAccount(CreateAddress(3), Height(1));
+			delta.template sub<AccountStateCache>().find(CreateAddress(4)).get().Balances.credit(Xem_Id, Amount(5));
+			delta.template sub<BlockDifficultyCache>().remove(Height(11));
+		});
+
+		// Act:
+		auto cache = LoadAll(snapshotBuffers, deltaBuffers, 2);
+
+		// Assert:
+		AssertEqual(originalCache, cache);
+		EXPECT_EQ(Amount(15), cache.createView().sub<AccountStateCache>().find(CreateAddress(4)).get().Balances.get(Xem_Id));
+	}
+
+	TEST(TEST_CLASS, CanLoadSnapshotWithPrunedValues) {
+		// Arrange:
+		auto originalCache = CreateCache();
+		Seed(originalCache);
+		auto snapshotBuffers = SaveAll(originalCache);
+
+		Buffers deltaBuffers;
+		SaveDeltaAndCommit(originalCache, Height(11), deltaBuffers, [](auto& delta) {
+			AddBlock(delta, Height(11));
+			delta.template sub<BlockDifficultyCache>().prune(Height(5));
+		});
+
+		// Sanity: the difficulties below the pruning height were pruned
+		EXPECT_EQ(Num_Seed_Entries + 1 - 4, originalCache.createView().sub<BlockDifficultyCache>().size());
+
+		// Act:
+		auto cache = LoadAll(snapshotBuffers, deltaBuffers, 1);
+
+		// Assert:
+		AssertEqual(originalCache, cache);
+	}
+
+	TEST(TEST_CLASS, LoadAllParallelIgnoresTrailingDeltas) {
+		// Arrange:
+		auto originalCache = CreateCache();
+		Seed(originalCache);
+		auto snapshotBuffers = SaveAll(originalCache);
+
+		Buffers deltaBuffers;
+		SaveDeltaAndCommit(originalCache, Height(11), deltaBuffers, [](auto& delta) { AddBlock(delta, Height(11)); });
+		auto expectedSnapshotBuffers = SaveAll(originalCache);
+		SaveDeltaAndCommit(originalCache, Height(12), deltaBuffers, [](auto& delta) { AddBlock(delta, Height(12)); });
+
+		// Act: only load the first delta
+		auto cache = LoadAll(snapshotBuffers, deltaBuffers, 1);
+
+		// Assert:
+		AssertEqual(LoadAll(expectedSnapshotBuffers, Buffers(2), 0), cache);
+		EXPECT_EQ(Num_Seed_Entries + 1, cache.createView().sub<BlockDifficultyCache>().size());
+	}
+
+	// endregion
+
+	// region mergeAll
+
+	namespace {
+		std::vector<uint8_t> PrependHeader(const ChunkedDataHeader& header, const std::vector<uint8_t>& valuesBuffer) {
+			std::vector<uint8_t> buffer;
+			mocks::MockMemoryStream stream("", buffer);
+			WriteChunkedDataHeader(stream, header);
+			buffer.insert(buffer.end(), valuesBuffer.cbegin(), valuesBuffer.cend());
+			return buffer;
+		}
+
+		void SaveTwoDeltasAndCommit(CatapultCache& cache, Buffers& deltaBuffers) {
+			SaveDeltaAndCommit(cache, Height(11), deltaBuffers, [](auto& delta) {
+				AddBlock(delta, Height(11));
+				delta.template sub<AccountStateCache>().queueRemove(CreateAddress(3), Height(1));
+				delta.template sub<AccountStateCache>().commitRemovals();
+			});
+			SaveDeltaAndCommit(cache, Height(12), deltaBuffers, [](auto& delta) {
+				AddBlock(delta, Height(12));
+				delta.template sub<BlockDifficultyCache>().prune(Height(3));
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, MergeAllProducesSnapshotIncludingAllDeltas) {
+		// Arrange:
+		auto originalCache = CreateCache();
+		Seed(originalCache);
+		auto snapshotBuffers = SaveAll(originalCache);
+
+		Buffers deltaBuffers;
+		SaveTwoDeltasAndCommit(originalCache, deltaBuffers);
+
+		// Act: merge the snapshot and deltas and prepend the merged headers
+		Buffers mergedBuffers;
+		auto deltaStorages = originalCache.deltaStorages();
+		std::vector<uint64_t> counts;
+		for (auto i = 0u; i < deltaStorages.size(); ++i) {
+			mocks::MockMemoryStream snapshotStream("", snapshotBuffers[i]);
+			mocks::MockMemoryStream deltaStream("", deltaBuffers[i]);
+
+			std::vector<uint8_t> valuesBuffer;
+			mocks::MockMemoryStream valuesStream("", valuesBuffer);
+			auto header = deltaStorages[i]->mergeAll(snapshotStream, { { deltaStream, 2 } }, valuesStream);
+
+			counts.push_back(header.NumEntries);
+			mergedBuffers.push_back(PrependHeader(header, valuesBuffer));
+		}
+
+		// Assert: the merged snapshot is equivalent to a full snapshot
+		EXPECT_EQ(std::vector<uint64_t>({ Num_Seed_Entries + 1, Num_Seed_Entries + 2 - 2 }), counts);
+		AssertEqual(originalCache, LoadAll(mergedBuffers, Buffers(2), 0));
+	}
+
+	TEST(TEST_CLASS, MergeAllProducesChunkedSnapshotThatCanBeLoadedInParallel) {
+		// Arrange:
+		auto originalCache = CreateCache();
+		Seed(originalCache);
+		auto snapshotBuffers = SaveAll(originalCache);
+
+		Buffers deltaBuffers;
+		SaveTwoDeltasAndCommit(originalCache, deltaBuffers);
+
+		// - merge block difficulties into chunks of (at most) three entries
+		BlockDifficultyCache unusedCache(0);
+		CacheDeltaStorageAdapter<BlockDifficultyCache, BlockDifficultyCacheStorage> deltaStorage(unusedCache, 3);
+		mocks::MockMemoryStream snapshotStream("", snapshotBuffers[1]);
+		mocks::MockMemoryStream deltaStream("", deltaBuffers[1]);
+
+		std::vector<uint8_t> valuesBuffer;
+		mocks::MockMemoryStream valuesStream("", valuesBuffer);
+		auto header = deltaStorage.mergeAll(snapshotStream, { { deltaStream, 2 } }, valuesStream);
+		auto mergedBuffer = PrependHeader(header, valuesBuffer);
+
+		// Act: load the merged snapshot in parallel
+		auto cache = CreateCache();
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+		mocks::MockMemoryStream mergedStream("", mergedBuffer);
+		cache.storages()[1]->loadAllParallel(mergedStream, *pPool);
+
+		// Assert: the merged values were split into independently loadable chunks
+		EXPECT_EQ(Num_Seed_Entries, header.NumEntries);
+		ASSERT_EQ(4u, header.NumChunks);
+		mocks::MockMemoryStream chunksStream("", valuesBuffer);
+		auto numRemainingEntries = header.NumEntries;
+		for (auto i = 0u; i < header.NumChunks; ++i) {
+			auto chunk = ReadChunkInfo(chunksStream, numRemainingEntries);
+			ReadChunkData(chunksStream, chunk);
+			numRemainingEntries -= chunk.NumEntries;
+			EXPECT_EQ(3 == i ? 1u : 3u, chunk.NumEntries) << i;
+		}
+
+		EXPECT_EQ(valuesBuffer.size(), chunksStream.position());
+
+		// - all merged values were loaded
+		auto expectedView = originalCache.createView();
+		auto view = cache.createView();
+		const auto& expectedBlockDifficultyCacheView = expectedView.sub<BlockDifficultyCache>();
+		const auto& blockDifficultyCacheView = view.sub<BlockDifficultyCache>();
+		ASSERT_EQ(expectedBlockDifficultyCacheView.size(), blockDifficultyCacheView.size());
+		for (const auto& info : *expectedBlockDifficultyCacheView.tryMakeIterableView())
+			EXPECT_TRUE(blockDifficultyCacheView.contains(info)) << info.BlockHeight;
+	}
+
+	TEST(TEST_CLASS, CanLoadChunkedSnapshotWithDeltasInParallel) {
+		// Arrange:
+		auto originalCache = CreateCache();
+		Seed(originalCache);
+		auto snapshotBuffers = SaveAll(originalCache);
+
+		// - split the block difficulty snapshot into chunks of (at most) three entries
+		BlockDifficultyCache unusedCache(0);
+		CacheDeltaStorageAdapter<BlockDifficultyCache, BlockDifficultyCacheStorage> deltaStorage(unusedCache, 3);
+		mocks::MockMemoryStream snapshotStream("", snapshotBuffers[1]);
+
+		std::vector<uint8_t> valuesBuffer;
+		mocks::MockMemoryStream valuesStream("", valuesBuffer);
+		auto header = deltaStorage.mergeAll(snapshotStream, std::vector<SerializedCacheDeltas>(), valuesStream);
+		snapshotBuffers[1] = PrependHeader(header, valuesBuffer);
+
+		Buffers deltaBuffers;
+		SaveTwoDeltasAndCommit(originalCache, deltaBuffers);
+
+		// Act:
+		auto cache = LoadAll(snapshotBuffers, deltaBuffers, 2);
+
+		// Assert: the snapshot chunks were merged with the deltas
+		EXPECT_EQ(4u, header.NumChunks);
+		AssertEqual(originalCache, cache);
+	}
+
+	// endregion
+}}
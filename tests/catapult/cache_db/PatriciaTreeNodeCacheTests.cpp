@@ -0,0 +1,197 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "catapult/tree/TreeNode.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS PatriciaTreeNodeCacheTests
+
+	namespace {
+		std::shared_ptr<const tree::TreeNode> CreateLeafNode(uint64_t path) {
+			return std::make_shared<const tree::TreeNode>(tree::LeafTreeNode(
+					tree::TreeNodePath(path),
+					test::GenerateRandomData<Hash256_Size>()));
+		}
+
+		Hash256 CreateHashForShard(uint8_t shardKey) {
+			// shard is determined by the last two bytes of the hash
+			auto hash = test::GenerateRandomData<Hash256_Size>();
+			hash[Hash256_Size - 2] = 0;
+			hash[Hash256_Size - 1] = shardKey;
+			return hash;
+		}
+
+		void AssertStatistics(const PatriciaTreeNodeCache& nodeCache, uint64_t size, uint64_t hits, uint64_t misses) {
+			auto statistics = nodeCache.statistics();
+			EXPECT_EQ(size, statistics.Size);
+			EXPECT_EQ(hits, statistics.Hits);
+			EXPECT_EQ(misses, statistics.Misses);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateCacheWithZeroMaxSize) {
+		EXPECT_THROW(PatriciaTreeNodeCache(0, 4), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotCreateCacheWithZeroShards) {
+		EXPECT_THROW(PatriciaTreeNodeCache(10, 0), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		PatriciaTreeNodeCache nodeCache(10, 4);
+
+		// Assert:
+		EXPECT_EQ(0u, nodeCache.size());
+		AssertStatistics(nodeCache, 0, 0, 0);
+	}
+
+	// endregion
+
+	// region find / insert
+
+	TEST(TEST_CLASS, FindReturnsNullptrWhenNodeIsUnknown) {
+		// Arrange:
+		PatriciaTreeNodeCache nodeCache(10, 4);
+		nodeCache.insert(test::GenerateRandomData<Hash256_Size>(), CreateLeafNode(0x12));
+
+		// Act:
+		auto pNode = nodeCache.find(test::GenerateRandomData<Hash256_Size>());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+		AssertStatistics(nodeCache, 1, 0, 1);
+	}
+
+	TEST(TEST_CLASS, FindReturnsSharedNodeWhenNodeIsKnown) {
+		// Arrange:
+		PatriciaTreeNodeCache nodeCache(10, 4);
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		auto pNode = CreateLeafNode(0x12);
+		nodeCache.insert(hash, pNode);
+
+		// Act:
+		auto pFoundNode1 = nodeCache.find(hash);
+		auto pFoundNode2 = nodeCache.find(hash);
+
+		// Assert: the cached node is shared and not copied
+		EXPECT_EQ(pNode.get(), pFoundNode1.get());
+		EXPECT_EQ(pNode.get(), pFoundNode2.get());
+		AssertStatistics(nodeCache, 1, 2, 0);
+	}
+
+	TEST(TEST_CLASS, InsertOfKnownNodeDoesNotChangeCachedNode) {
+		// Arrange:
+		PatriciaTreeNodeCache nodeCache(10, 4);
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		auto pNode = CreateLeafNode(0x12);
+		nodeCache.insert(hash, pNode);
+
+		// Act:
+		nodeCache.insert(hash, CreateLeafNode(0x34));
+		auto pFoundNode = nodeCache.find(hash);
+
+		// Assert:
+		EXPECT_EQ(pNode.get(), pFoundNode.get());
+		AssertStatistics(nodeCache, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, CanCacheNodesAcrossAllShards) {
+		// Arrange:
+		PatriciaTreeNodeCache nodeCache(8, 4);
+		std::vector<Hash256> hashes;
+		for (auto i = 0u; i < 8; ++i) {
+			hashes.push_back(CreateHashForShard(static_cast<uint8_t>(i)));
+			nodeCache.insert(hashes.back(), CreateLeafNode(i));
+		}
+
+		// Act + Assert:
+		EXPECT_EQ(8u, nodeCache.size());
+		for (const auto& hash : hashes)
+			EXPECT_TRUE(!!nodeCache.find(hash));
+
+		AssertStatistics(nodeCache, 8, 8, 0);
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, InsertEvictsLeastRecentlyUsedNodeInFullShard) {
+		// Arrange: two shards with capacity two each
+		PatriciaTreeNodeCache nodeCache(4, 2);
+		auto hash1 = CreateHashForShard(0);
+		auto hash2 = CreateHashForShard(2);
+		auto hash3 = CreateHashForShard(4);
+		auto hashOther = CreateHashForShard(1);
+		nodeCache.insert(hash1, CreateLeafNode(1));
+		nodeCache.insert(hash2, CreateLeafNode(2));
+		nodeCache.insert(hashOther, CreateLeafNode(3));
+
+		// - touch the first node so that the second node is least recently used
+		nodeCache.find(hash1);
+
+		// Act:
+		nodeCache.insert(hash3, CreateLeafNode(4));
+
+		// Assert: only the least recently used node in the affected shard was evicted
+		EXPECT_EQ(3u, nodeCache.size());
+		EXPECT_TRUE(!!nodeCache.find(hash1));
+		EXPECT_FALSE(!!nodeCache.find(hash2));
+		EXPECT_TRUE(!!nodeCache.find(hash3));
+		EXPECT_TRUE(!!nodeCache.find(hashOther));
+	}
+
+	TEST(TEST_CLASS, SizeNeverExceedsMaxSize) {
+		// Arrange:
+		PatriciaTreeNodeCache nodeCache(10, 3);
+
+		// Act:
+		for (auto i = 0u; i < 100; ++i)
+			nodeCache.insert(test::GenerateRandomData<Hash256_Size>(), CreateLeafNode(i));
+
+		// Assert:
+		EXPECT_GE(10u, nodeCache.size());
+	}
+
+	TEST(TEST_CLASS, EvictedNodesRemainValidWhileReferenced) {
+		// Arrange:
+		PatriciaTreeNodeCache nodeCache(1, 1);
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		nodeCache.insert(hash, CreateLeafNode(0x12));
+		auto pNode = nodeCache.find(hash);
+		auto expectedHash = pNode->hash();
+
+		// Act:
+		nodeCache.insert(test::GenerateRandomData<Hash256_Size>(), CreateLeafNode(0x34));
+
+		// Assert:
+		EXPECT_FALSE(!!nodeCache.find(hash));
+		EXPECT_EQ(expectedHash, pNode->hash());
+	}
+
+	// endregion
+}}
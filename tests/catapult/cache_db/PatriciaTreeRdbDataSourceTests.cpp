@@ -34,11 +34,11 @@ namespace catapult { namespace cache {
 
 		class RocksDataSourceWrapper {
 		public:
-			RocksDataSourceWrapper()
+			explicit RocksDataSourceWrapper(const std::shared_ptr<PatriciaTreeNodeCache>& pNodeCache = nullptr)
 					: m_dbDirGuard("dbdir")
 					, m_db(DefaultSettings(m_dbDirGuard.name()))
 					, m_container(m_db, 0)
-					, m_dataSource(m_container) {
+					, m_dataSource(m_container, pNodeCache) {
 				m_container.setSize(0);
 			}
 
@@ -47,7 +47,7 @@ namespace catapult { namespace cache {
 				return m_dataSource.size();
 			}
 
-			std::unique_ptr<const tree::TreeNode> get(const Hash256& hash) {
+			std::shared_ptr<const tree::TreeNode> get(const Hash256& hash) {
 				return m_dataSource.get(hash);
 			}
 
@@ -71,7 +71,89 @@ namespace catapult { namespace cache {
 		struct RocksDataSourceTraits {
 			using DataSourceType = RocksDataSourceWrapper;
 		};
+
+		class CachingRocksDataSourceWrapper : public RocksDataSourceWrapper {
+		public:
+			CachingRocksDataSourceWrapper() : RocksDataSourceWrapper(std::make_shared<PatriciaTreeNodeCache>(100, 4))
+			{}
+		};
+
+		struct CachingRocksDataSourceTraits {
+			using DataSourceType = CachingRocksDataSourceWrapper;
+		};
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region node cache
+
+#define MAKE_CACHING_DATA_SOURCE_TEST(TEST_NAME) \
+	TEST(TEST_CLASS, TEST_NAME##_NodeCache) { test::PatriciaTreeDataSourceTests<CachingRocksDataSourceTraits>::Assert##TEST_NAME(); }
+
+	MAKE_CACHING_DATA_SOURCE_TEST(CannotGetUnknownNode)
+	MAKE_CACHING_DATA_SOURCE_TEST(CanGetLeafNode)
+	MAKE_CACHING_DATA_SOURCE_TEST(CanGetBranchNode)
+
+	namespace {
+		auto CreateBranchNode() {
+			auto branchNode = tree::BranchTreeNode(tree::TreeNodePath(0x64'6F'67'01));
+			branchNode.setLink(test::GenerateRandomData<Hash256_Size>(), 4);
+			branchNode.setLink(test::GenerateRandomData<Hash256_Size>(), 11);
+			return branchNode;
+		}
+	}
+
+	TEST(TEST_CLASS, GetWithoutNodeCacheReturnsDistinctNodes) {
+		// Arrange:
+		RocksDataSourceWrapper dataSource;
+		auto branchNode = CreateBranchNode();
+		dataSource.set(branchNode);
+
+		// Act:
+		auto pNode1 = dataSource.get(branchNode.hash());
+		auto pNode2 = dataSource.get(branchNode.hash());
+
+		// Assert:
+		ASSERT_TRUE(!!pNode1);
+		ASSERT_TRUE(!!pNode2);
+		EXPECT_NE(pNode1.get(), pNode2.get());
+		EXPECT_EQ(branchNode.hash(), pNode2->hash());
+	}
+
+	TEST(TEST_CLASS, GetWithNodeCacheReturnsSharedDecodedNode) {
+		// Arrange:
+		auto pNodeCache = std::make_shared<PatriciaTreeNodeCache>(100, 4);
+		RocksDataSourceWrapper dataSource(pNodeCache);
+		auto branchNode = CreateBranchNode();
+		dataSource.set(branchNode);
+
+		// Act:
+		auto pNode1 = dataSource.get(branchNode.hash());
+		auto pNode2 = dataSource.get(branchNode.hash());
+
+		// Assert: the node was only decoded once
+		ASSERT_TRUE(!!pNode1);
+		EXPECT_EQ(pNode1.get(), pNode2.get());
+		EXPECT_EQ(branchNode.hash(), pNode2->hash());
+
+		auto statistics = pNodeCache->statistics();
+		EXPECT_EQ(1u, statistics.Size);
+		EXPECT_EQ(1u, statistics.Hits);
+		EXPECT_EQ(1u, statistics.Misses);
+	}
+
+	TEST(TEST_CLASS, GetWithNodeCacheDoesNotCacheUnknownNodes) {
+		// Arrange:
+		auto pNodeCache = std::make_shared<PatriciaTreeNodeCache>(100, 4);
+		RocksDataSourceWrapper dataSource(pNodeCache);
+
+		// Act:
+		auto pNode = dataSource.get(test::GenerateRandomData<Hash256_Size>());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+		EXPECT_EQ(0u, pNodeCache->size());
+	}
+
+	// endregion
 }}
@@ -114,6 +114,13 @@ namespace catapult { namespace cache {
 				iterator.setFound(IsKeyFound);
 			}
 
+			void findAll(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				FindAllKeys = keys;
+				iterators.resize(keys.size());
+				for (auto i = 0u; i < keys.size(); ++i)
+					iterators[i].setFound(0 == i % 2);
+			}
+
 			auto prune(uint64_t pruningBoundary) {
 				PruneParams.push(pruningBoundary);
 				return NumPruned;
@@ -128,6 +135,7 @@ namespace catapult { namespace cache {
 
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			mutable test::ParamsCapture<FindParamsType> FindParams;
+			mutable std::vector<RawBuffer> FindAllKeys;
 			test::ParamsCapture<PruneParamsType> PruneParams;
 			test::ParamsCapture<RemoveParamsType> RemoveParams;
 		};
@@ -151,6 +159,10 @@ namespace catapult { namespace cache {
 				m_db.find(key, iterator);
 			}
 
+			void findAll(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				m_db.findAll(keys, iterators);
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return m_db.prune(pruningBoundary);
 			}
@@ -235,6 +247,29 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(&iter.dbIterator(), params.pIterator);
 	}
 
+	TEST(TEST_CLASS, FindAllSerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<test::StringKey> keys{ test::StringKey("alpha"), test::StringKey("beta"), test::StringKey("gamma") };
+		auto iters = container.findAll(keys);
+
+		// Assert:
+		ASSERT_EQ(3u, db.FindAllKeys.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			EXPECT_EQ(test::AsBytePointer(keys[i].data()), db.FindAllKeys[i].pData) << i;
+			EXPECT_EQ(keys[i].size(), db.FindAllKeys[i].Size) << i;
+		}
+
+		// - only even keys are found by the mock
+		ASSERT_EQ(3u, iters.size());
+		EXPECT_NE(container.cend(), iters[0]);
+		EXPECT_EQ(container.cend(), iters[1]);
+		EXPECT_NE(container.cend(), iters[2]);
+	}
+
 	TEST(TEST_CLASS, PruneExtractsBoundaryFromKeyAndForwardsToContainer) {
 		// Arrange:
 		MockDb db;
@@ -113,6 +113,46 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(database.canPrune());
 	}
 
+	TEST(TEST_CLASS, CanOpenDatabaseWithTuning) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+
+		RocksTuningSettings tuningSettings;
+		tuningSettings.BlockCacheSize = utils::FileSize::FromMegabytes(1);
+		tuningSettings.BloomFilterBitsPerKey = 10;
+		tuningSettings.ShouldPinIndexAndFilterBlocks = true;
+		tuningSettings.KeyPrefixSize = 4;
+		tuningSettings.ShouldUseUniversalCompaction = true;
+		tuningSettings.PatriciaTreeWriteBufferSize = utils::FileSize::FromMegabytes(1);
+		tuningSettings.ShouldSyncWrites = false;
+		tuningSettings.ShouldEnableStatistics = true;
+		auto pTuning = std::make_shared<RocksTuning>(tuningSettings);
+
+		// Act:
+		RocksDatabase database(RocksDatabaseSettings(
+				"testdb",
+				{ "default", Patricia_Tree_Column_Family_Name },
+				utils::FileSize(),
+				FilterPruningMode::Disabled,
+				pTuning));
+
+		database.put(0, "hello", "world");
+		database.put(1, "alpha", "beta");
+		database.flush();
+
+		RdbDataIterator iter;
+		database.get(1, "alpha", iter);
+
+		// Assert:
+		EXPECT_EQ((std::vector<std::string>{ "default", "patricia_tree" }), database.columnFamilyNames());
+		test::AssertIteratorValue("beta", iter);
+
+		auto statistics = pTuning->statistics();
+		EXPECT_LT(0u, statistics.BytesWritten);
+		EXPECT_LT(0u, statistics.MemtableHits);
+		EXPECT_EQ(0u, statistics.WalSyncs);
+	}
+
 	TEST(TEST_CLASS, CanCreatePlaceholderDatabase) {
 		// Act:
 		RocksDatabase database;
@@ -383,6 +423,61 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region multiGet
+
+	TEST(TEST_CLASS, CanReadMultipleValuesFromDbAtOnce) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "world", "apple", "hello" }, iters);
+
+		// Assert: iterators are in key order
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CanReadMultipleValuesFromDbAtOnce_DifferentColumns) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(1, { "hello", "world" }, iters);
+
+		// Assert: only values from the requested column are returned
+		ASSERT_EQ(2u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+	}
+
+	TEST(TEST_CLASS, MultiGetWithNoKeysReturnsNoValues) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	// endregion
+
 	// region iterators
 
 	namespace {
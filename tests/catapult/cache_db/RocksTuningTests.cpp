@@ -0,0 +1,174 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksTuning.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "tests/TestHarness.h"
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/statistics.h>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RocksTuningTests
+
+	// region settings
+
+	TEST(TEST_CLASS, CanCreateDefaultSettings) {
+		// Act:
+		RocksTuningSettings settings;
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize(), settings.BlockCacheSize);
+		EXPECT_EQ(0u, settings.BloomFilterBitsPerKey);
+		EXPECT_FALSE(settings.ShouldPinIndexAndFilterBlocks);
+		EXPECT_EQ(0u, settings.KeyPrefixSize);
+		EXPECT_FALSE(settings.ShouldUseUniversalCompaction);
+		EXPECT_EQ(utils::FileSize(), settings.WriteBufferSize);
+		EXPECT_EQ(utils::FileSize(), settings.PatriciaTreeWriteBufferSize);
+		EXPECT_EQ(0u, settings.MaxWriteBufferNumber);
+		EXPECT_TRUE(settings.ShouldSyncWrites);
+		EXPECT_FALSE(settings.ShouldEnableStatistics);
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateTuningWithoutSharedResources) {
+		// Act:
+		RocksTuning tuning((RocksTuningSettings()));
+
+		// Assert:
+		EXPECT_EQ(0u, tuning.settings().BloomFilterBitsPerKey);
+		EXPECT_FALSE(tuning.hasSharedBlockCache());
+		EXPECT_EQ(0u, tuning.blockCacheUsage());
+		EXPECT_FALSE(tuning.hasStatistics());
+
+		auto statistics = tuning.statistics();
+		EXPECT_EQ(0u, statistics.BlockCacheHits);
+		EXPECT_EQ(0u, statistics.BytesWritten);
+	}
+
+	TEST(TEST_CLASS, CanCreateTuningWithSharedResources) {
+		// Arrange:
+		RocksTuningSettings settings;
+		settings.BlockCacheSize = utils::FileSize::FromMegabytes(1);
+		settings.BloomFilterBitsPerKey = 12;
+		settings.ShouldEnableStatistics = true;
+
+		// Act:
+		RocksTuning tuning(settings);
+
+		// Assert:
+		EXPECT_EQ(12u, tuning.settings().BloomFilterBitsPerKey);
+		EXPECT_TRUE(tuning.hasSharedBlockCache());
+		EXPECT_EQ(0u, tuning.blockCacheUsage());
+		EXPECT_TRUE(tuning.hasStatistics());
+	}
+
+	// endregion
+
+	// region apply
+
+	TEST(TEST_CLASS, ApplyToDatabaseOptionsSetsStatisticsOnlyWhenEnabled) {
+		// Arrange:
+		RocksTuningSettings settings;
+		settings.ShouldEnableStatistics = true;
+		RocksTuning tuning1((RocksTuningSettings()));
+		RocksTuning tuning2(settings);
+
+		// Act:
+		rocksdb::DBOptions dbOptions1;
+		tuning1.apply(dbOptions1);
+
+		rocksdb::DBOptions dbOptions2;
+		tuning2.apply(dbOptions2);
+
+		// Assert:
+		EXPECT_FALSE(!!dbOptions1.statistics);
+		EXPECT_TRUE(!!dbOptions2.statistics);
+	}
+
+	TEST(TEST_CLASS, ApplyToColumnOptionsPreservesDefaultsWhenSettingsAreZero) {
+		// Arrange:
+		RocksTuning tuning((RocksTuningSettings()));
+		rocksdb::ColumnFamilyOptions defaultOptions;
+
+		// Act:
+		rocksdb::ColumnFamilyOptions columnOptions;
+		tuning.apply(columnOptions, "default");
+
+		// Assert:
+		EXPECT_FALSE(!!columnOptions.prefix_extractor);
+		EXPECT_EQ(rocksdb::kCompactionStyleLevel, columnOptions.compaction_style);
+		EXPECT_EQ(defaultOptions.write_buffer_size, columnOptions.write_buffer_size);
+		EXPECT_EQ(defaultOptions.max_write_buffer_number, columnOptions.max_write_buffer_number);
+	}
+
+	TEST(TEST_CLASS, ApplyToColumnOptionsUsesColumnSpecificWriteBufferSize) {
+		// Arrange:
+		RocksTuningSettings settings;
+		settings.KeyPrefixSize = 8;
+		settings.ShouldUseUniversalCompaction = true;
+		settings.WriteBufferSize = utils::FileSize::FromMegabytes(32);
+		settings.PatriciaTreeWriteBufferSize = utils::FileSize::FromMegabytes(16);
+		settings.MaxWriteBufferNumber = 5;
+		RocksTuning tuning(settings);
+
+		// Act:
+		rocksdb::ColumnFamilyOptions primaryOptions;
+		tuning.apply(primaryOptions, "default");
+
+		rocksdb::ColumnFamilyOptions patriciaTreeOptions;
+		tuning.apply(patriciaTreeOptions, Patricia_Tree_Column_Family_Name);
+
+		// Assert:
+		for (const auto* pOptions : { &primaryOptions, &patriciaTreeOptions }) {
+			EXPECT_TRUE(!!pOptions->prefix_extractor);
+			EXPECT_EQ(rocksdb::kCompactionStyleUniversal, pOptions->compaction_style);
+			EXPECT_EQ(5, pOptions->max_write_buffer_number);
+		}
+
+		EXPECT_EQ(utils::FileSize::FromMegabytes(32).bytes(), primaryOptions.write_buffer_size);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(16).bytes(), patriciaTreeOptions.write_buffer_size);
+	}
+
+	TEST(TEST_CLASS, ApplyToWriteOptionsSetsSync) {
+		// Arrange:
+		RocksTuningSettings settings;
+		settings.ShouldSyncWrites = false;
+		RocksTuning tuning1((RocksTuningSettings()));
+		RocksTuning tuning2(settings);
+
+		// Act:
+		rocksdb::WriteOptions writeOptions1;
+		tuning1.apply(writeOptions1);
+
+		rocksdb::WriteOptions writeOptions2;
+		writeOptions2.sync = true;
+		tuning2.apply(writeOptions2);
+
+		// Assert:
+		EXPECT_TRUE(writeOptions1.sync);
+		EXPECT_FALSE(writeOptions2.sync);
+	}
+
+	// endregion
+}}
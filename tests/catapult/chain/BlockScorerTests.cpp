@@ -629,5 +629,57 @@ namespace catapult { namespace chain {
 		EXPECT_EQ(hitContext.Height, context.ImportanceLookupParams[0].second);
 	}
 
+	namespace {
+		BlockHitContext CreateBlockHitContext() {
+			BlockHitContext hitContext;
+			hitContext.GenerationHash = { { 0xF7, 0xF6, 0xF5, 0xF4 } };
+			hitContext.ElapsedTime = utils::TimeSpan::FromSeconds(100);
+			hitContext.Signer = test::GenerateRandomData<Hash256_Size>();
+			hitContext.Difficulty = Difficulty(50 * 1'000'000'000'000);
+			hitContext.Height = Height(11);
+			return hitContext;
+		}
+
+		void AssertBlockHitPredicateWithPrecomputedImportance(Importance signerImportance, bool expectedIsHit) {
+			// Arrange: importance passed to the predicate should take precedence over the lookup importance
+			auto hitContext = CreateBlockHitContext();
+			BlockHitPredicateContext context(Importance(1));
+
+			// Act:
+			auto isHit = context.Predicate(hitContext, signerImportance);
+
+			// Assert:
+			auto hit = CalculateHit(hitContext.GenerationHash);
+			auto target = CalculateTarget(hitContext.ElapsedTime, hitContext.Difficulty, signerImportance, context.Config);
+			EXPECT_EQ(expectedIsHit, hit < target);
+			EXPECT_EQ(expectedIsHit, isHit);
+
+			EXPECT_TRUE(context.ImportanceLookupParams.empty());
+		}
+	}
+
+	TEST(TEST_CLASS, BlockHitPredicateReturnsTrueWhenHitIsLessThanTarget_PrecomputedImportance) {
+		AssertBlockHitPredicateWithPrecomputedImportance(Importance(20000000), true);
+	}
+
+	TEST(TEST_CLASS, BlockHitPredicateReturnsFalseWhenHitIsGreaterThanTarget_PrecomputedImportance) {
+		AssertBlockHitPredicateWithPrecomputedImportance(Importance(1000), false);
+	}
+
+	TEST(TEST_CLASS, BlockHitPredicateReturnsFalseWhenImportanceIsZero_PrecomputedImportance) {
+		AssertBlockHitPredicateWithPrecomputedImportance(Importance(0), false);
+	}
+
+	TEST(TEST_CLASS, BlockHitPredicateWithoutImportanceLookupCanEvaluatePrecomputedImportance) {
+		// Arrange:
+		auto config = CreateConfiguration();
+		BlockHitPredicate predicate(config);
+		auto hitContext = CreateBlockHitContext();
+
+		// Act + Assert:
+		EXPECT_TRUE(predicate(hitContext, Importance(20000000)));
+		EXPECT_FALSE(predicate(hitContext, Importance(1000)));
+	}
+
 	// endregion
 }}
@@ -23,6 +23,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/model/EntityRange.h"
 #include "tests/catapult/chain/test/MockChainApi.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -581,6 +582,364 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region parallel pulling
+
+	namespace {
+		using RemoteChainApis = std::vector<std::shared_ptr<MockChainApi>>;
+
+		std::vector<std::shared_ptr<const Block>> CreateLinkedBlocks(Height startHeight, size_t numBlocks) {
+			std::vector<std::shared_ptr<const Block>> blocks;
+			Hash256 previousBlockHash;
+			for (auto i = 0u; i < numBlocks; ++i) {
+				std::shared_ptr<Block> pBlock = test::GenerateVerifiableBlockAtHeight(startHeight + Height(i));
+				if (0 != i)
+					pBlock->PreviousBlockHash = previousBlockHash;
+
+				previousBlockHash = CalculateHash(*pBlock);
+				blocks.push_back(pBlock);
+			}
+
+			return blocks;
+		}
+
+		struct ParallelTestContext {
+		public:
+			explicit ParallelTestContext(size_t numAdditionalPeers)
+					: Context(CreateDefaultTestContext(9, 10))
+					, ChainBlocks(CreateLinkedBlocks(Default_Height, 100))
+					, ShouldConsumerThrow(false) {
+				Context.Config.MaxParallelSyncPeers = static_cast<uint32_t>(numAdditionalPeers + 1);
+				Context.pChainApi->setNumBlocksPerBlocksFromRequest({ 5 });
+				Context.pChainApi->setChainBlocks(ChainBlocks);
+
+				for (auto i = 0u; i < numAdditionalPeers; ++i) {
+					auto pChainApi = std::make_shared<MockChainApi>(ChainScore(11), Default_Height, 0);
+					pChainApi->setNumBlocksPerBlocksFromRequest({ 5 });
+					pChainApi->setChainBlocks(ChainBlocks);
+					AdditionalChainApis.push_back(pChainApi);
+				}
+			}
+
+		public:
+			RemoteNodeSynchronizer<api::RemoteChainApi> createSynchronizer() {
+				auto pVerifiableBlock = test::GenerateVerifiableBlockAtHeight(Default_Height);
+				auto pLocal = std::make_shared<MockChainApi>(Context.LocalScore, std::move(pVerifiableBlock), Context.LocalHashes);
+
+				auto remoteChainApisSupplier = [this](auto numRequested) {
+					NumRequestedPeers.push_back(numRequested);
+					InteractionResults = std::vector<NodeInteractionResult>(AdditionalChainApis.size(), NodeInteractionResult::None);
+
+					std::vector<AdditionalPeerChainApi> additionalPeerChainApis;
+					for (auto i = 0u; i < AdditionalChainApis.size(); ++i) {
+						additionalPeerChainApis.push_back({ AdditionalChainApis[i], [this, i](auto result) {
+							std::lock_guard<std::mutex> lock(m_mutex);
+							InteractionResults[i] = result;
+						} });
+					}
+
+					return additionalPeerChainApis;
+				};
+				auto blockRangeConsumer = [this](const auto& range, const auto&) {
+					if (ShouldConsumerThrow)
+						CATAPULT_THROW_INVALID_ARGUMENT("block range consumer error");
+
+					std::lock_guard<std::mutex> lock(m_mutex);
+					ForwardedHeights.emplace_back(range.cbegin()->Height, (--range.cend())->Height);
+					return ForwardedHeights.size();
+				};
+
+				return CreateChainSynchronizer(pLocal, Context.Config, remoteChainApisSupplier, blockRangeConsumer);
+			}
+
+		public:
+			TestContext Context;
+			std::vector<std::shared_ptr<const Block>> ChainBlocks;
+			RemoteChainApis AdditionalChainApis;
+			std::vector<size_t> NumRequestedPeers;
+			std::vector<std::pair<Height, Height>> ForwardedHeights;
+			std::vector<NodeInteractionResult> InteractionResults;
+			bool ShouldConsumerThrow;
+
+		private:
+			std::mutex m_mutex;
+		};
+
+		void AssertBlocksFromRequests(
+				const MockChainApi& chainApi,
+				const std::vector<std::pair<Height, uint32_t>>& expectedRequests,
+				const std::string& message) {
+			ASSERT_EQ(expectedRequests.size(), chainApi.blocksFromRequests().size()) << message;
+
+			auto i = 0u;
+			for (const auto& params : chainApi.blocksFromRequests()) {
+				EXPECT_EQ(expectedRequests[i].first, params.first) << message << " height of request " << i;
+				EXPECT_EQ(expectedRequests[i].second, params.second.NumBlocks) << message << " NumBlocks of request " << i;
+				EXPECT_EQ(23u, params.second.NumBytes) << message << " NumBytes of request " << i;
+				++i;
+			}
+		}
+
+		std::vector<std::pair<Height, Height>> ToHeightPairs(const std::vector<std::pair<uint64_t, uint64_t>>& rawHeightPairs) {
+			std::vector<std::pair<Height, Height>> heightPairs;
+			for (const auto& rawHeightPair : rawHeightPairs)
+				heightPairs.emplace_back(Height(rawHeightPair.first), Height(rawHeightPair.second));
+
+			return heightPairs;
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelPullingIsBypassedWhenNoAdditionalPeersAreAvailable) {
+		// Arrange:
+		ParallelTestContext context(0);
+		context.Context.Config.MaxParallelSyncPeers = 3;
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: the supplier was queried but only a single window was pulled from the compared peer
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(std::vector<size_t>({ 2 }), context.NumRequestedPeers);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 } }), context.ForwardedHeights);
+		AssertBlocksFromRequests(*context.Context.pChainApi, { { Default_Height, 5 } }, "primary");
+	}
+
+	TEST(TEST_CLASS, ParallelPullingIsBypassedWhenRollbackIsRequired) {
+		// Arrange: fork depth 6
+		ParallelTestContext context(2);
+		context.Context = CreateDefaultTestContext(4, 10, 6);
+		context.Context.Config.MaxParallelSyncPeers = 3;
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: all blocks were pulled from the compared peer
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_TRUE(context.NumRequestedPeers.empty());
+		EXPECT_EQ(1u, context.ForwardedHeights.size());
+		AssertDefaultMultiplePullRequest(*context.Context.pChainApi, { Height(15), Height(17), Height(19) });
+		for (const auto& pChainApi : context.AdditionalChainApis)
+			EXPECT_TRUE(pChainApi->blocksFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, ParallelPullingPullsConsecutiveWindowsFromAllPeers) {
+		// Arrange:
+		ParallelTestContext context(2);
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: each peer supplied one window and all windows were forwarded in height order
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(std::vector<size_t>({ 2 }), context.NumRequestedPeers);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 29 }, { 30, 34 } }), context.ForwardedHeights);
+
+		AssertBlocksFromRequests(*context.Context.pChainApi, { { Default_Height, 5 } }, "primary");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[0], { { Height(25), 5 } }, "peer 1");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[1], { { Height(30), 5 } }, "peer 2");
+		EXPECT_EQ(
+				std::vector<NodeInteractionResult>({ NodeInteractionResult::Success, NodeInteractionResult::Success }),
+				context.InteractionResults);
+	}
+
+	TEST(TEST_CLASS, ParallelPullingOnlyPullsWindowsThatFitIntoByteBudget) {
+		// Arrange: the budget (3 * 23 bytes) allows at most three concurrent requests when no blocks are buffered
+		ParallelTestContext context(4);
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: all windows were forwarded in height order
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 29 }, { 30, 34 }, { 35, 39 }, { 40, 44 } }), context.ForwardedHeights);
+
+		// - windows that did not fit into the budget were only pulled once they were blocking forwarding,
+		//   so they were pulled from peers that already supplied blocks instead of the remaining peers
+		AssertBlocksFromRequests(*context.AdditionalChainApis[0], { { Height(25), 5 } }, "peer 1");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[1], { { Height(30), 5 } }, "peer 2");
+		EXPECT_TRUE(context.AdditionalChainApis[2]->blocksFromRequests().empty());
+		EXPECT_TRUE(context.AdditionalChainApis[3]->blocksFromRequests().empty());
+		EXPECT_EQ(NodeInteractionResult::Neutral, context.InteractionResults[2]);
+		EXPECT_EQ(NodeInteractionResult::Neutral, context.InteractionResults[3]);
+	}
+
+	TEST(TEST_CLASS, ParallelPullingForwardsWindowsInHeightOrderWhenLaterWindowsCompleteFirst) {
+		// Arrange: delay the compared peer so that all other windows complete first
+		ParallelTestContext context(2);
+		context.Context.pChainApi->setDelay(utils::TimeSpan::FromMilliseconds(50));
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 29 }, { 30, 34 } }), context.ForwardedHeights);
+	}
+
+	TEST(TEST_CLASS, ParallelPullingContinuesWindowWhenPeerReturnsPartialRange) {
+		// Arrange: peer 1 returns at most 2 blocks per request (e.g. due to byte limit)
+		ParallelTestContext context(2);
+		context.AdditionalChainApis[0]->setNumBlocksPerBlocksFromRequest({ 2 });
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: peer 1 was asked for the remainder of its window until it was complete
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 29 }, { 30, 34 } }), context.ForwardedHeights);
+		AssertBlocksFromRequests(*context.AdditionalChainApis[0], { { Height(25), 5 }, { Height(27), 3 }, { Height(29), 1 } }, "peer 1");
+	}
+
+	TEST(TEST_CLASS, ParallelPullingReassignsWindowOfFailedPeer) {
+		// Arrange: peer 1 fails
+		ParallelTestContext context(2);
+		context.AdditionalChainApis[0]->setError(MockChainApi::EntryPoint::Blocks_From);
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: the window of peer 1 was pulled from the compared peer, which was the first idle peer
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 29 }, { 30, 34 } }), context.ForwardedHeights);
+
+		AssertBlocksFromRequests(*context.Context.pChainApi, { { Default_Height, 5 }, { Height(25), 5 } }, "primary");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[0], { { Height(25), 5 } }, "peer 1");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[1], { { Height(30), 5 } }, "peer 2");
+		EXPECT_EQ(
+				std::vector<NodeInteractionResult>({ NodeInteractionResult::Failure, NodeInteractionResult::Success }),
+				context.InteractionResults);
+	}
+
+	TEST(TEST_CLASS, ParallelPullingReassignsWindowOfPeerThatRunsOutOfBlocks) {
+		// Arrange: peer 1 only knows blocks up to height 26
+		ParallelTestContext context(2);
+		context.AdditionalChainApis[0]->setChainBlocks({ context.ChainBlocks.cbegin(), context.ChainBlocks.cbegin() + 7 });
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: the end of the chain of an additional peer did not end the round and the window was pulled from the compared peer
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 29 }, { 30, 34 } }), context.ForwardedHeights);
+
+		AssertBlocksFromRequests(*context.Context.pChainApi, { { Default_Height, 5 }, { Height(25), 5 } }, "primary");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[0], { { Height(25), 5 }, { Height(27), 3 } }, "peer 1");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[1], { { Height(30), 5 } }, "peer 2");
+
+		// - peer 1 did not return blocks that were forwarded from the compared peer
+		EXPECT_EQ(
+				std::vector<NodeInteractionResult>({ NodeInteractionResult::Failure, NodeInteractionResult::Success }),
+				context.InteractionResults);
+	}
+
+	TEST(TEST_CLASS, ParallelPullingFailsWhenComparedPeerFailsAndNoBlocksAreForwarded) {
+		// Arrange: the compared peer fails and all other peers do not have the first window
+		ParallelTestContext context(1);
+		context.Context.pChainApi->setError(MockChainApi::EntryPoint::Blocks_From);
+		context.AdditionalChainApis[0]->setChainBlocks(CreateLinkedBlocks(Height(25), 10));
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_TRUE(context.ForwardedHeights.empty());
+		AssertBlocksFromRequests(*context.AdditionalChainApis[0], { { Height(25), 5 }, { Default_Height, 5 } }, "peer 1");
+		EXPECT_EQ(std::vector<NodeInteractionResult>({ NodeInteractionResult::Neutral }), context.InteractionResults);
+	}
+
+	TEST(TEST_CLASS, ParallelPullingFailsWhenForwardingThrowsUnexpectedException) {
+		// Arrange: forwarding blocks throws an exception that is not a runtime error
+		ParallelTestContext context(2);
+		context.ShouldConsumerThrow = true;
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: the round completed with a failure
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_TRUE(context.ForwardedHeights.empty());
+	}
+
+	TEST(TEST_CLASS, ParallelPullingStopsAtFirstWindowThatRemoteCannotFill) {
+		// Arrange: peers only know blocks up to height 27
+		ParallelTestContext context(2);
+		auto chainBlocks = CreateLinkedBlocks(Default_Height, 8);
+		context.Context.pChainApi->setChainBlocks(chainBlocks);
+		for (const auto& pChainApi : context.AdditionalChainApis)
+			pChainApi->setChainBlocks(chainBlocks);
+
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: the partial second window was forwarded but nothing after it
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 27 } }), context.ForwardedHeights);
+
+		// - only the compared peer ended the chain, so the second window was pulled from it again
+		AssertBlocksFromRequests(
+				*context.Context.pChainApi,
+				{ { Default_Height, 5 }, { Height(25), 5 }, { Height(28), 2 } },
+				"primary");
+
+		// - the additional peers did not hide any forwarded blocks
+		EXPECT_EQ(
+				std::vector<NodeInteractionResult>({ NodeInteractionResult::Neutral, NodeInteractionResult::Neutral }),
+				context.InteractionResults);
+	}
+
+	TEST(TEST_CLASS, ParallelPullingRejectsWindowThatDoesNotLinkToPreviousWindow) {
+		// Arrange: peer 1 is on a different chain
+		ParallelTestContext context(2);
+		context.AdditionalChainApis[0]->setChainBlocks(CreateLinkedBlocks(Default_Height, 100));
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: the window of peer 1 was pulled again from another peer
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 29 }, { 30, 34 } }), context.ForwardedHeights);
+		AssertBlocksFromRequests(*context.AdditionalChainApis[0], { { Height(25), 5 } }, "peer 1");
+
+		AssertBlocksFromRequests(*context.Context.pChainApi, { { Default_Height, 5 }, { Height(25), 5 } }, "primary");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[1], { { Height(30), 5 } }, "peer 2");
+		EXPECT_EQ(
+				std::vector<NodeInteractionResult>({ NodeInteractionResult::Failure, NodeInteractionResult::Success }),
+				context.InteractionResults);
+	}
+
+	TEST(TEST_CLASS, ParallelPullingReassignsSlowWindowToIdlePeer) {
+		// Arrange: peer 1 is much slower than peer 2
+		ParallelTestContext context(2);
+		context.AdditionalChainApis[0]->setDelay(utils::TimeSpan::FromMilliseconds(500));
+		context.AdditionalChainApis[1]->setDelay(utils::TimeSpan::FromMilliseconds(20));
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.Context.pChainApi).get();
+
+		// Assert: after peer 2 completed its window, the window of peer 1 was additionally pulled from the fastest idle peer
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(ToHeightPairs({ { 20, 24 }, { 25, 29 }, { 30, 34 } }), context.ForwardedHeights);
+		AssertBlocksFromRequests(*context.Context.pChainApi, { { Default_Height, 5 }, { Height(25), 5 } }, "primary");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[0], { { Height(25), 5 } }, "peer 1");
+		AssertBlocksFromRequests(*context.AdditionalChainApis[1], { { Height(30), 5 } }, "peer 2");
+	}
+
+	// endregion
+
 	// region recoverability
 
 	namespace {
@@ -100,6 +100,12 @@ namespace catapult { namespace mocks {
 			return m_blocksFromRequests;
 		}
 
+		/// Sets the chain of \a blocks from which blocks-from requests are served instead of generating random blocks.
+		/// \note Blocks-from requests will return at most the requested number of blocks.
+		void setChainBlocks(const std::vector<std::shared_ptr<const model::Block>>& blocks) {
+			m_chainBlocks = blocks;
+		}
+
 		/// Sets the number of blocks (\a numBlocksPerBlocksFromRequest) to return for multiple blocks-from requests.
 		/// \note The last value will be repeated indefinitely.
 		void setNumBlocksPerBlocksFromRequest(const std::vector<uint32_t>& numBlocksPerBlocksFromRequest) {
@@ -163,6 +169,9 @@ namespace catapult { namespace mocks {
 			if (m_numBlocksPerBlocksFromRequest.size() > 1)
 				m_numBlocksPerBlocksFromRequest.pop_front();
 
+			if (!m_chainBlocks.empty())
+				return CreateFutureResponse(createChainRange(height, std::min<uint32_t>(numBlocks, options.NumBlocks)));
+
 			return CreateFutureResponse(createRange(height, numBlocks));
 		}
 
@@ -192,6 +201,16 @@ namespace catapult { namespace mocks {
 			return test::CreateEntityRange(rawBlocks);
 		}
 
+		model::BlockRange createChainRange(Height startHeight, size_t numBlocks) const {
+			std::vector<const model::Block*> rawBlocks;
+			for (const auto& pBlock : m_chainBlocks) {
+				if (startHeight + Height(rawBlocks.size()) == pBlock->Height && rawBlocks.size() < numBlocks)
+					rawBlocks.push_back(pBlock.get());
+			}
+
+			return test::CreateEntityRange(rawBlocks);
+		}
+
 		template<typename T>
 		thread::future<T> CreateFutureResponse(T&& value) const {
 			// if no delay is specified, resolve the future immediately
@@ -213,6 +232,7 @@ namespace catapult { namespace mocks {
 		EntryPoint m_errorEntryPoint;
 		model::HashRange m_hashes;
 		std::map<Height, std::shared_ptr<model::Block>> m_blocks;
+		std::vector<std::shared_ptr<const model::Block>> m_chainBlocks;
 
 		mutable std::vector<Height> m_blockAtRequests;
 		mutable std::vector<std::pair<Height, uint32_t>> m_hashesFromRequests;
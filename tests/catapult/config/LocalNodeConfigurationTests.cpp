@@ -74,12 +74,15 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.ShouldAllowAddressReuse);
 			EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 			EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+			EXPECT_FALSE(config.ShouldUsePackedBlockStorage);
+			EXPECT_EQ(360u, config.StateCheckpointInterval);
 
 			EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
 			EXPECT_EQ(400u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(1u, config.MaxParallelSyncPeers);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -89,6 +92,9 @@ namespace catapult { namespace config {
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(1'000'000u, config.UnconfirmedTransactionsCacheMaxSize);
 
+			EXPECT_EQ(100u, config.BlockStorageCacheMaxBlocks);
+			EXPECT_EQ(10'000u, config.BlockStorageCacheMaxHashes);
+
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
 
@@ -100,6 +106,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
 			EXPECT_EQ(16384u, config.TransactionDisruptorSize);
 			EXPECT_EQ(10u, config.TransactionElementTraceInterval);
+			EXPECT_EQ(2u, config.NumParallelTransactionConsumerWorkers);
 
 			EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 			EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
@@ -109,6 +116,8 @@ namespace catapult { namespace config {
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.IncomingSecurityModes);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.MaxCacheDatabaseWriteBatchSize);
+			EXPECT_EQ(100'000u, config.PatriciaTreeNodeCacheMaxSize);
+			EXPECT_EQ(100u, config.MaxStateMultiproofKeys);
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
 			EXPECT_EQ("", config.Local.Host);
@@ -127,6 +136,17 @@ namespace catapult { namespace config {
 			EXPECT_EQ(3u, config.IncomingConnections.NumConsecutiveFailuresBeforeBanning);
 			EXPECT_EQ(512u, config.IncomingConnections.BacklogSize);
 
+			EXPECT_EQ(utils::FileSize::FromMegabytes(256), config.CacheDatabase.BlockCacheSize);
+			EXPECT_EQ(10u, config.CacheDatabase.BloomFilterBitsPerKey);
+			EXPECT_TRUE(config.CacheDatabase.ShouldPinIndexAndFilterBlocks);
+			EXPECT_EQ(0u, config.CacheDatabase.KeyPrefixSize);
+			EXPECT_FALSE(config.CacheDatabase.ShouldUseUniversalCompaction);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.WriteBufferSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.PatriciaTreeWriteBufferSize);
+			EXPECT_EQ(0u, config.CacheDatabase.MaxWriteBufferNumber);
+			EXPECT_TRUE(config.CacheDatabase.ShouldSyncWrites);
+			EXPECT_FALSE(config.CacheDatabase.ShouldEnableStatistics);
+
 			auto expectedExtensions = std::vector<std::string>{
 				"extension.eventsource", "extension.harvesting", "extension.syncsource",
 				"extension.diagnostics", "extension.filechain", "extension.hashcache", "extension.networkheight",
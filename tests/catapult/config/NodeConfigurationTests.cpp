@@ -38,12 +38,15 @@ namespace catapult { namespace config {
 							{ "shouldAllowAddressReuse", "true" },
 							{ "shouldUseSingleThreadPool", "true" },
 							{ "shouldUseCacheDatabaseStorage", "true" },
+							{ "shouldUsePackedBlockStorage", "true" },
+							{ "stateCheckpointInterval", "123" },
 
 							{ "shouldEnableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxParallelSyncPeers", "7" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -53,6 +56,9 @@ namespace catapult { namespace config {
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98'763" },
 
+							{ "blockStorageCacheMaxBlocks", "321" },
+							{ "blockStorageCacheMaxHashes", "12'345" },
+
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
 
@@ -64,6 +70,7 @@ namespace catapult { namespace config {
 							{ "blockElementTraceInterval", "34" },
 							{ "transactionDisruptorSize", "9876" },
 							{ "transactionElementTraceInterval", "98" },
+							{ "numParallelTransactionConsumerWorkers", "7" },
 
 							{ "shouldAbortWhenDispatcherIsFull", "true" },
 							{ "shouldAuditDispatcherInputs", "true" },
@@ -73,6 +80,8 @@ namespace catapult { namespace config {
 							{ "incomingSecurityModes", "None, Signed" },
 
 							{ "maxCacheDatabaseWriteBatchSize", "17KB" },
+							{ "patriciaTreeNodeCacheMaxSize", "4'321" },
+							{ "maxStateMultiproofKeys", "87" },
 							{ "maxTrackedNodes", "222" }
 						}
 					},
@@ -104,6 +113,21 @@ namespace catapult { namespace config {
 							{ "backlogSize", "21" }
 						}
 					},
+					{
+						"cache_database",
+						{
+							{ "blockCacheSize", "64MB" },
+							{ "bloomFilterBitsPerKey", "12" },
+							{ "shouldPinIndexAndFilterBlocks", "true" },
+							{ "keyPrefixSize", "8" },
+							{ "shouldUseUniversalCompaction", "true" },
+							{ "writeBufferSize", "32MB" },
+							{ "patriciaTreeWriteBufferSize", "16MB" },
+							{ "maxWriteBufferNumber", "4" },
+							{ "shouldSyncWrites", "true" },
+							{ "shouldEnableStatistics", "true" }
+						}
+					},
 					{
 						"extensions",
 						{
@@ -126,12 +150,15 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.ShouldAllowAddressReuse);
 				EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 				EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_FALSE(config.ShouldUsePackedBlockStorage);
+				EXPECT_EQ(0u, config.StateCheckpointInterval);
 
 				EXPECT_FALSE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxParallelSyncPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -141,6 +168,9 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(0u, config.UnconfirmedTransactionsCacheMaxSize);
 
+				EXPECT_EQ(0u, config.BlockStorageCacheMaxBlocks);
+				EXPECT_EQ(0u, config.BlockStorageCacheMaxHashes);
+
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
 
@@ -152,6 +182,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
 				EXPECT_EQ(0u, config.TransactionDisruptorSize);
 				EXPECT_EQ(0u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(0u, config.NumParallelTransactionConsumerWorkers);
 
 				EXPECT_FALSE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
@@ -161,6 +192,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.IncomingSecurityModes);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(0u, config.PatriciaTreeNodeCacheMaxSize);
+				EXPECT_EQ(0u, config.MaxStateMultiproofKeys);
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
 				EXPECT_EQ("", config.Local.Host);
@@ -179,6 +212,17 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.IncomingConnections.NumConsecutiveFailuresBeforeBanning);
 				EXPECT_EQ(0u, config.IncomingConnections.BacklogSize);
 
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.BlockCacheSize);
+				EXPECT_EQ(0u, config.CacheDatabase.BloomFilterBitsPerKey);
+				EXPECT_FALSE(config.CacheDatabase.ShouldPinIndexAndFilterBlocks);
+				EXPECT_EQ(0u, config.CacheDatabase.KeyPrefixSize);
+				EXPECT_FALSE(config.CacheDatabase.ShouldUseUniversalCompaction);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.WriteBufferSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.PatriciaTreeWriteBufferSize);
+				EXPECT_EQ(0u, config.CacheDatabase.MaxWriteBufferNumber);
+				EXPECT_FALSE(config.CacheDatabase.ShouldSyncWrites);
+				EXPECT_FALSE(config.CacheDatabase.ShouldEnableStatistics);
+
 				EXPECT_TRUE(config.Extensions.empty());
 			}
 
@@ -189,12 +233,15 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.ShouldAllowAddressReuse);
 				EXPECT_TRUE(config.ShouldUseSingleThreadPool);
 				EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_TRUE(config.ShouldUsePackedBlockStorage);
+				EXPECT_EQ(123u, config.StateCheckpointInterval);
 
 				EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(7u, config.MaxParallelSyncPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -204,6 +251,9 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(98'763u, config.UnconfirmedTransactionsCacheMaxSize);
 
+				EXPECT_EQ(321u, config.BlockStorageCacheMaxBlocks);
+				EXPECT_EQ(12'345u, config.BlockStorageCacheMaxHashes);
+
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
 
@@ -215,6 +265,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
 				EXPECT_EQ(9876u, config.TransactionDisruptorSize);
 				EXPECT_EQ(98u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(7u, config.NumParallelTransactionConsumerWorkers);
 
 				EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_TRUE(config.ShouldAuditDispatcherInputs);
@@ -224,6 +275,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(ionet::ConnectionSecurityMode::None | ionet::ConnectionSecurityMode::Signed, config.IncomingSecurityModes);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(4'321u, config.PatriciaTreeNodeCacheMaxSize);
+				EXPECT_EQ(87u, config.MaxStateMultiproofKeys);
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
 				EXPECT_EQ("alice.com", config.Local.Host);
@@ -242,10 +295,33 @@ namespace catapult { namespace config {
 				EXPECT_EQ(19u, config.IncomingConnections.NumConsecutiveFailuresBeforeBanning);
 				EXPECT_EQ(21u, config.IncomingConnections.BacklogSize);
 
+				EXPECT_EQ(utils::FileSize::FromMegabytes(64), config.CacheDatabase.BlockCacheSize);
+				EXPECT_EQ(12u, config.CacheDatabase.BloomFilterBitsPerKey);
+				EXPECT_TRUE(config.CacheDatabase.ShouldPinIndexAndFilterBlocks);
+				EXPECT_EQ(8u, config.CacheDatabase.KeyPrefixSize);
+				EXPECT_TRUE(config.CacheDatabase.ShouldUseUniversalCompaction);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(32), config.CacheDatabase.WriteBufferSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(16), config.CacheDatabase.PatriciaTreeWriteBufferSize);
+				EXPECT_EQ(4u, config.CacheDatabase.MaxWriteBufferNumber);
+				EXPECT_TRUE(config.CacheDatabase.ShouldSyncWrites);
+				EXPECT_TRUE(config.CacheDatabase.ShouldEnableStatistics);
+
 				EXPECT_EQ(std::vector<std::string>({ "Alpha", "gamma" }), config.Extensions);
 			}
 		};
 	}
 
 	DEFINE_CONFIGURATION_TESTS(NodeConfigurationTests, Node)
+
+	TEST(NodeConfigurationTests, CanLoadNodeConfigurationFromResourcesFile) {
+		// Arrange: use the "real" node configuration file, which contains all supported properties
+		auto bag = utils::ConfigurationBag::FromPath("../resources/config-node.properties");
+
+		// Act:
+		auto config = NodeConfiguration::LoadFromBag(bag);
+
+		// Assert:
+		EXPECT_EQ(100u, config.MaxStateMultiproofKeys);
+		EXPECT_EQ(1u, config.MaxParallelSyncPeers);
+	}
 }}
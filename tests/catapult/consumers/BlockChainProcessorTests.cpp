@@ -184,14 +184,16 @@ namespace catapult { namespace consumers {
 
 		struct ProcessorTestContext {
 		public:
-			ProcessorTestContext() : BlockHitPredicateFactory(BlockHitPredicate) {
+			explicit ProcessorTestContext(const BlockChainPrefetcher& prefetcher = BlockChainPrefetcher())
+					: BlockHitPredicateFactory(BlockHitPredicate) {
 				Processor = CreateBlockChainProcessor(
 						[this](const auto& cache) {
 							return BlockHitPredicateFactory(cache);
 						},
 						[this](auto height, auto timestamp, const auto& entities, const auto& state) {
 							return BatchEntityProcessor(height, timestamp, entities, state);
-						});
+						},
+						prefetcher);
 			}
 
 		public:
@@ -582,4 +584,68 @@ namespace catapult { namespace consumers {
 	}
 
 	// endregion
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetcherIsCalledOnceBeforeAnyBlockIsProcessed) {
+		// Arrange:
+		std::vector<size_t> numPrefetchedElements;
+		std::vector<size_t> numProcessorCallsAtPrefetch;
+		ProcessorTestContext* pContext = nullptr;
+		ProcessorTestContext context([&](const auto& elements, const auto&) {
+			numPrefetchedElements.push_back(elements.size());
+			numProcessorCallsAtPrefetch.push_back(pContext->BatchEntityProcessor.params().size());
+		});
+		pContext = &context;
+
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(3);
+		PrepareChain(Height(11), *pParentBlock, elements);
+
+		// Act:
+		auto result = context.Process(*pParentBlock, elements);
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, result);
+		ASSERT_EQ(1u, numPrefetchedElements.size());
+		EXPECT_EQ(3u, numPrefetchedElements[0]);
+		EXPECT_EQ(0u, numProcessorCallsAtPrefetch[0]);
+		EXPECT_EQ(3u, context.BatchEntityProcessor.params().size());
+	}
+
+	TEST(TEST_CLASS, PrefetcherIsNotCalledForUnlinkedChain) {
+		// Arrange:
+		auto numPrefetches = 0u;
+		ProcessorTestContext context([&numPrefetches](const auto&, const auto&) { ++numPrefetches; });
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(1);
+		PrepareChain(Height(11), *pParentBlock, elements);
+		++const_cast<model::Block&>(elements[0].Block).PreviousBlockHash[0];
+
+		// Act:
+		auto result = context.Process(*pParentBlock, elements);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Unlinked, result);
+		EXPECT_EQ(0u, numPrefetches);
+	}
+
+	TEST(TEST_CLASS, AccountStatePrefetcherDoesNotModifyCacheContents) {
+		// Arrange:
+		auto cache = test::CreateCatapultCacheWithMarkerAccount();
+		auto delta = cache.createDelta();
+		auto numAccounts = delta.sub<cache::AccountStateCache>().size();
+
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(3, 12);
+		auto elements = test::CreateBlockElements({ pBlock.get() });
+		auto prefetcher = CreateAccountStatePrefetcher();
+
+		// Act:
+		prefetcher(elements, delta);
+
+		// Assert: prefetching only warms (storage backed) caches and never adds accounts
+		EXPECT_EQ(numAccounts, delta.sub<cache::AccountStateCache>().size());
+	}
+
+	// endregion
 }}
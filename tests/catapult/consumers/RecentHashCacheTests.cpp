@@ -348,4 +348,73 @@ namespace catapult { namespace consumers {
 	}
 
 	// endregion
+
+	// region buckets
+
+	TEST(TEST_CLASS, CanAddAndRefreshManyHashes) {
+		// Arrange: use enough hashes to require multiple bucket resizes
+		constexpr auto Num_Hashes = 10'000u;
+		std::vector<Timestamp::ValueType> times(1 + 2 * Num_Hashes, 10);
+		std::fill(times.begin() + 1 + Num_Hashes, times.end(), 500);
+		RecentHashCache cache(CreateTimeSupplier(times), HashCheckOptions(600'000, 60'000, Num_Hashes));
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Num_Hashes);
+
+		// Act: add all hashes (t10) and then refresh all hashes (t500)
+		auto numAdded = 0u;
+		for (const auto& hash : hashes)
+			numAdded += cache.add(hash) ? 1 : 0;
+
+		auto numRefreshed = 0u;
+		for (const auto& hash : hashes)
+			numRefreshed += cache.add(hash) ? 0 : 1;
+
+		// Assert:
+		EXPECT_EQ(Num_Hashes, numAdded);
+		EXPECT_EQ(Num_Hashes, numRefreshed);
+		EXPECT_EQ(Num_Hashes, cache.size());
+		for (const auto& hash : hashes)
+			EXPECT_TRUE(cache.contains(hash));
+	}
+
+	TEST(TEST_CLASS, RefreshedHashesAreNotEvictedWithOriginalBucket) {
+		// Arrange:
+		RecentHashCache cache(CreateTimeSupplier({ 10, 11, 12, 13, 500, 1000 }), Default_Options);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		FillCache(cache, hashes); // t11..t13
+
+		// Act:
+		cache.add(hashes[1]); // t500 - refreshes hashes[1]
+		cache.add(hashes[2]); // t1000 - triggers a prune that evicts hashes[0] but keeps hashes[1] and refreshes hashes[2]
+
+		// Assert:
+		EXPECT_EQ(2u, cache.size());
+		EXPECT_FALSE(cache.contains(hashes[0]));
+		EXPECT_TRUE(cache.contains(hashes[1]));
+		EXPECT_TRUE(cache.contains(hashes[2]));
+	}
+
+	TEST(TEST_CLASS, PruneEvictsExactlyExpiredHashesAcrossBuckets) {
+		// Arrange: add a hash every 30s (t11, t41, ..., t581), which spreads hashes across multiple 75s buckets
+		constexpr auto Num_Hashes = 20u;
+		std::vector<Timestamp::ValueType> times{ 10 };
+		for (auto i = 0u; i < Num_Hashes; ++i)
+			times.push_back(11 + 30 * i);
+
+		times.push_back(710);
+		RecentHashCache cache(CreateTimeSupplier(times), Default_Options);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(Num_Hashes);
+		FillCache(cache, hashes);
+
+		// Act: t710 - triggers a prune that evicts all hashes added before t110 (t11, t41, t71, t101)
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		cache.add(hash);
+
+		// Assert:
+		EXPECT_EQ(Num_Hashes - 4 + 1, cache.size());
+		EXPECT_TRUE(cache.contains(hash));
+		for (auto i = 0u; i < Num_Hashes; ++i)
+			EXPECT_EQ(i >= 4, cache.contains(hashes[i])) << "hash at index " << i;
+	}
+
+	// endregion
 }}
@@ -21,6 +21,7 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/types.h"
 #include "tests/TestHarness.h"
+#include <random>
 #include <sstream>
 #include <string>
 
@@ -240,4 +241,126 @@ namespace catapult { namespace crypto {
 		// Assert:
 		EXPECT_EQ(expected1, nonAlignedResult);
 	}
+
+	// region Sha3_256_Multi
+
+	namespace {
+		std::vector<Hash256> CalculateHashesSingle(const std::vector<std::vector<uint8_t>>& messages) {
+			std::vector<Hash256> hashes(messages.size());
+			for (auto i = 0u; i < messages.size(); ++i)
+				Sha3_256(messages[i], hashes[i]);
+
+			return hashes;
+		}
+
+		std::vector<Hash256> CalculateHashesMulti(const std::vector<std::vector<uint8_t>>& messages) {
+			std::vector<RawBuffer> buffers;
+			for (const auto& message : messages)
+				buffers.push_back(message);
+
+			std::vector<Hash256> hashes(messages.size());
+			Sha3_256_Multi(buffers.data(), hashes.data(), hashes.size());
+			return hashes;
+		}
+
+		void AssertMultiMatchesSingleCallVariant(const std::vector<std::vector<uint8_t>>& messages) {
+			// Act:
+			auto expectedHashes = CalculateHashesSingle(messages);
+			auto hashes = CalculateHashesMulti(messages);
+
+			// Assert:
+			ASSERT_EQ(expectedHashes.size(), hashes.size());
+			for (auto i = 0u; i < hashes.size(); ++i)
+				EXPECT_EQ(expectedHashes[i], hashes[i]) << "message " << i << " with size " << messages[i].size();
+		}
+	}
+
+	SHA3_256_TEST(MultiCanProcessZeroMessages) {
+		// Arrange:
+		Hash256 hash{};
+
+		// Act:
+		Sha3_256_Multi(nullptr, &hash, 0);
+
+		// Assert: the output was not touched
+		EXPECT_EQ(Hash256(), hash);
+	}
+
+	SHA3_256_TEST(MultiMatchesSingleCallVariantForSampleTestVectors) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> messages;
+		for (const auto& dataStr : Data_Set_Shorter)
+			messages.push_back(test::ToVector(dataStr));
+
+		for (const auto& dataStr : Data_Sets_Long)
+			messages.push_back(test::ToVector(dataStr));
+
+		// Assert:
+		AssertMultiMatchesSingleCallVariant(messages);
+	}
+
+	SHA3_256_TEST(MultiMatchesSingleCallVariantForMessagesWithSameSize) {
+		// Arrange: merkle pair sized messages
+		for (auto count : { 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 16u, 17u, 64u, 65u, 200u }) {
+			std::vector<std::vector<uint8_t>> messages;
+			for (auto i = 0u; i < count; ++i)
+				messages.push_back(test::GenerateRandomVector(2 * Hash256_Size));
+
+			// Assert:
+			AssertMultiMatchesSingleCallVariant(messages);
+		}
+	}
+
+	SHA3_256_TEST(MultiMatchesSingleCallVariantForMessagesWithDifferentSizes) {
+		// Arrange: cover all sizes around multiples of the sha3-256 rate (136 bytes)
+		std::vector<std::vector<uint8_t>> messages;
+		for (auto size = 0u; size < 3 * 136 + 2; ++size)
+			messages.push_back(test::GenerateRandomVector(size));
+
+		// - randomize the order of the messages
+		std::shuffle(messages.begin(), messages.end(), std::mt19937_64(test::Random()));
+
+		// Assert:
+		AssertMultiMatchesSingleCallVariant(messages);
+	}
+
+	SHA3_256_TEST(MultiMatchesSingleCallVariantForLargeMessages) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> messages;
+		for (auto size : { 10000u, 1u, 20000u, 136u, 5000u })
+			messages.push_back(test::GenerateRandomVector(size));
+
+		// Assert:
+		AssertMultiMatchesSingleCallVariant(messages);
+	}
+
+	SHA3_256_TEST(MultiMatchesBuilderForMultiPartMessages) {
+		// Arrange: split each message into three parts (including some empty ones)
+		constexpr auto Num_Messages = 50u;
+		std::vector<std::vector<uint8_t>> messages;
+		std::vector<RawBuffer> buffers;
+		std::vector<Hash256> expectedHashes(Num_Messages);
+		for (auto i = 0u; i < Num_Messages; ++i)
+			messages.push_back(test::GenerateRandomVector(i * 7));
+
+		for (auto i = 0u; i < Num_Messages; ++i) {
+			const auto& message = messages[i];
+			auto firstSplit = message.size() / 3;
+			auto secondSplit = 0 == i % 2 ? firstSplit : message.size() - i % 5;
+			buffers.push_back({ message.data(), firstSplit });
+			buffers.push_back({ message.data() + firstSplit, secondSplit - firstSplit });
+			buffers.push_back({ message.data() + secondSplit, message.size() - secondSplit });
+
+			Sha3_256(message, expectedHashes[i]);
+		}
+
+		// Act:
+		std::vector<Hash256> hashes(Num_Messages);
+		Sha3_256_Multi(buffers.data(), 3, hashes.data(), hashes.size());
+
+		// Assert:
+		EXPECT_EQ(expectedHashes, hashes);
+	}
+
+	// endregion
 }}
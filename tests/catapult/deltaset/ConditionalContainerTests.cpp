@@ -268,6 +268,52 @@ namespace catapult { namespace deltaset {
 		EXPECT_EQ(container.cend(), iter);
 	}
 
+	TRAITS_BASED_TEST(FindAllReturnsIteratorsInKeyOrder) {
+		// Arrange:
+		auto container = TTraits::CreateContainer(Mode);
+
+		typename TTraits::DeltaElementsWrapper wrapper;
+		TTraits::AddElement(wrapper.Added, "alpha", 5);
+		TTraits::AddElement(wrapper.Added, "gamma", 7);
+		container.update(wrapper.deltas());
+
+		// Act:
+		auto iters = container.findAll({
+			TTraits::MakeKey("gamma", 7), TTraits::MakeKey("zeta", 5), TTraits::MakeKey("alpha", 5)
+		});
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+
+		ASSERT_NE(container.cend(), iters[0]);
+		EXPECT_EQ("gamma", TTraits::GetValue(*iters[0]).Name);
+
+		EXPECT_EQ(container.cend(), iters[1]);
+
+		ASSERT_NE(container.cend(), iters[2]);
+		EXPECT_EQ("alpha", TTraits::GetValue(*iters[2]).Name);
+	}
+
+	TRAITS_BASED_TEST(FindAllViaFreeFunctionReturnsSameIteratorsAsFind) {
+		// Arrange:
+		auto container = TTraits::CreateContainer(Mode);
+
+		typename TTraits::DeltaElementsWrapper wrapper;
+		TTraits::AddElement(wrapper.Added, "alpha", 5);
+		TTraits::AddElement(wrapper.Added, "gamma", 7);
+		container.update(wrapper.deltas());
+
+		auto keys = std::vector<decltype(TTraits::MakeKey("", 0))>{ TTraits::MakeKey("alpha", 5), TTraits::MakeKey("zeta", 5) };
+
+		// Act:
+		auto iters = BatchFind(container, keys);
+
+		// Assert:
+		ASSERT_EQ(2u, iters.size());
+		EXPECT_EQ(container.find(keys[0]), iters[0]);
+		EXPECT_EQ(container.find(keys[1]), iters[1]);
+	}
+
 	// endregion
 
 	// region set traits based pruning test
@@ -383,4 +429,24 @@ namespace catapult { namespace deltaset {
 	}
 
 	// endregion
+
+	// region batch find
+
+	TEST(TEST_CLASS, StorageBasedCacheShouldBatchFind) {
+		// Act:
+		MapTraits::DiffUnderlying::ContainerType container(ConditionalContainerMode::Storage);
+
+		// Assert:
+		EXPECT_TRUE(ShouldBatchFind(container));
+	}
+
+	TEST(TEST_CLASS, MemoryBasedCacheShouldNotBatchFind) {
+		// Act:
+		MapTraits::DiffUnderlying::ContainerType container(ConditionalContainerMode::Memory);
+
+		// Assert:
+		EXPECT_FALSE(ShouldBatchFind(container));
+	}
+
+	// endregion
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/deltaset/DeltaElementsMixin.h"
+#include "catapult/deltaset/OrderedSet.h"
 #include "tests/catapult/deltaset/test/BaseSetTestsInclude.h"
 #include "tests/test/cache/DeltaElementsMixinTests.h"
 #include "tests/TestHarness.h"
@@ -115,4 +116,44 @@ namespace catapult { namespace deltaset {
 
 	DEFINE_DELTA_ELEMENTS_MIXIN_TESTS(MutableTraits, _Mutable)
 	DEFINE_DELTA_ELEMENTS_MIXIN_TESTS(MutablePointerTraits, _MutablePointer)
+
+	// region ordered set
+
+	namespace {
+		using OrderedSetImmutableTraits = test::BaseSetTraits<
+			test::ImmutableElementValueTraits,
+			test::OrderedSetTraits<test::SetElementType<test::ImmutableElementValueTraits>>>;
+
+		template<typename TElementContainer>
+		std::set<unsigned int> CollectValues(const TElementContainer& elements) {
+			std::set<unsigned int> values;
+			for (const auto* pElement : elements)
+				values.insert(pElement->Value);
+
+			return values;
+		}
+	}
+
+	TEST(TEST_CLASS, MarkedElementsCanBeTrackedForSetBasedDelta) {
+		// Arrange:
+		auto pSet = OrderedSetImmutableTraits::Create();
+		auto pDelta = pSet->rebase();
+		for (auto i = 100u; i < 105; ++i)
+			pDelta->insert(test::ImmutableTestElement("TestElement", i));
+
+		pSet->commit();
+		DeltaElementsMixin<OrderedSetImmutableTraits::DeltaType> mixin(*pDelta);
+
+		// Act:
+		pDelta->insert(test::ImmutableTestElement("TestElement", 123));
+		pDelta->remove(test::ImmutableTestElement("TestElement", 101));
+		pDelta->remove(test::ImmutableTestElement("TestElement", 103));
+
+		// Assert:
+		EXPECT_EQ(std::set<unsigned int>({ 123 }), CollectValues(mixin.addedElements()));
+		EXPECT_EQ(std::set<unsigned int>(), CollectValues(mixin.modifiedElements()));
+		EXPECT_EQ(std::set<unsigned int>({ 101, 103 }), CollectValues(mixin.removedElements()));
+	}
+
+	// endregion
 }}
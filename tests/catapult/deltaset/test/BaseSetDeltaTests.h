@@ -313,6 +313,22 @@ namespace catapult { namespace test {
 			AssertDeltaSizes(pDelta, 4, 2, 1, TTraits::IsElementMutable() ? 1 : 0);
 		}
 
+		static void AssertBaseSetDeltaCanAccessAllElementsThroughFindConstAfterPrefetch() {
+			// Arrange:
+			auto pDelta = CreateSetForBatchFindTests();
+
+			std::vector<decltype(TTraits::CreateKey("", 0))> keys;
+			for (auto i = 0u; i < 10; ++i)
+				keys.push_back(TTraits::CreateKey("TestElement", i));
+
+			// Act:
+			pDelta->prefetch(keys);
+
+			// Assert: prefetching does not change any pending modifications
+			AssertBatchFind<const typename decltype(pDelta)::DeltaType>(*pDelta);
+			AssertDeltaSizes(pDelta, 4, 2, 1, TTraits::IsElementMutable() ? 1 : 0);
+		}
+
 		// endregion
 
 		// region insert
@@ -896,6 +912,7 @@ namespace catapult { namespace test {
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, BaseSetDeltaFindConstReturnsConstCopy) \
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, BaseSetDeltaCanAccessAllElementsThroughFind) \
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, BaseSetDeltaCanAccessAllElementsThroughFindConst) \
+	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, BaseSetDeltaCanAccessAllElementsThroughFindConstAfterPrefetch) \
 	\
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, CanInsertElement) \
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, CanInsertWithSuppliedParameters) \
@@ -25,6 +25,7 @@
 #include "tests/test/nodeps/Functional.h"
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -430,6 +431,55 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
 	}
 
+	namespace {
+		void AssertCanConsumeAllElementsWithWaitStrategy(WaitStrategyType waitStrategy) {
+			// Arrange:
+			auto ranges = test::PrepareRanges(5);
+			auto expectedHeights = GetExpectedHeights(ranges);
+			std::vector<Heights> collectedHeights[2];
+			std::vector<Heights> inspectedHeights;
+			std::vector<CompletionStatus> inspectedStatuses;
+
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+
+			// Act:
+			ConsumerDispatcher dispatcher(
+					options,
+					{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+					CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+			// - push multiple elements
+			ProcessAll(dispatcher, std::move(ranges));
+			WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+			dispatcher.shutdown();
+
+			// Assert:
+			EXPECT_EQ(expectedHeights, collectedHeights[0]);
+			EXPECT_EQ(expectedHeights, collectedHeights[1]);
+			EXPECT_EQ(expectedHeights, inspectedHeights);
+			EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
+			EXPECT_FALSE(dispatcher.isRunning());
+		}
+	}
+
+	TEST(TEST_CLASS, CanConsumeAllElementsWithSleepWaitStrategy) {
+		AssertCanConsumeAllElementsWithWaitStrategy(WaitStrategyType::Sleep);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAllElementsWithBusySpinWaitStrategy) {
+		AssertCanConsumeAllElementsWithWaitStrategy(WaitStrategyType::Busy_Spin);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAllElementsWithSpinThenYieldWaitStrategy) {
+		AssertCanConsumeAllElementsWithWaitStrategy(WaitStrategyType::Spin_Then_Yield);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAllElementsWithBlockingWaitStrategy) {
+		AssertCanConsumeAllElementsWithWaitStrategy(WaitStrategyType::Blocking);
+	}
+
 	// endregion
 
 	// region element marking
@@ -507,6 +557,181 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region parallel consumers
+
+	namespace {
+		auto CreateNoOpInspector() {
+			return [](const auto&, const auto&) {};
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithMismatchedNumberOfConsumerWorkers) {
+		// Act + Assert:
+		EXPECT_THROW(
+				ConsumerDispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() }, { 2 }, CreateNoOpInspector()),
+				catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithZeroConsumerWorkers) {
+		// Act + Assert:
+		EXPECT_THROW(
+				ConsumerDispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() }, { 2, 0 }, CreateNoOpInspector()),
+				catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateDispatcherWithParallelConsumers) {
+		// Arrange + Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() }, { 3, 1 }, CreateNoOpInspector());
+
+		// Assert: size is the number of consumers, not the number of workers
+		EXPECT_EQ(Test_Dispatcher_Options.DispatcherName, dispatcher.name());
+		EXPECT_EQ(2u, dispatcher.size());
+		AssertHasProcessedNoElements(dispatcher);
+	}
+
+	TEST(TEST_CLASS, ParallelConsumerProcessesElementsConcurrently) {
+		// Arrange: each of the first four elements waits (for a bounded time) until all four are being processed
+		constexpr auto Num_Workers = 4u;
+		std::atomic<size_t> numEntered(0);
+		std::atomic<size_t> numConcurrentObservations(0);
+		std::vector<Heights> collectedHeights;
+		auto ranges = test::PrepareRanges(8);
+		auto expectedHeights = GetExpectedHeights(ranges);
+
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					[&numEntered, &numConcurrentObservations](const auto&) {
+						if (++numEntered > Num_Workers)
+							return ConsumerResult::Continue();
+
+						for (auto i = 0u; i < 1000 && numEntered < Num_Workers; ++i)
+							std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+						if (numEntered >= Num_Workers)
+							++numConcurrentObservations;
+
+						return ConsumerResult::Continue();
+					},
+					CreateConsumer(collectedHeights)
+				},
+				{ Num_Workers, 1 },
+				CreateNoOpInspector());
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(8u, collectedHeights.size());
+
+		// Assert:
+		EXPECT_EQ(Num_Workers, numConcurrentObservations);
+		EXPECT_EQ(expectedHeights, collectedHeights);
+	}
+
+	TEST(TEST_CLASS, ParallelConsumerPreservesElementOrderForSubsequentConsumersAndInspector) {
+		// Arrange: earlier elements take longer to process, so they are completed out of order
+		std::vector<Heights> collectedHeights;
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		auto ranges = test::PrepareRanges(10);
+		auto height = 0u;
+		for (auto& range : ranges)
+			range.begin()->Height = Height(++height);
+
+		auto expectedHeights = GetExpectedHeights(ranges);
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					[](const auto& consumerInput) {
+						auto firstHeight = consumerInput.blocks()[0].Block.Height.unwrap();
+						std::this_thread::sleep_for(std::chrono::milliseconds(2 * (10 - firstHeight)));
+						return ConsumerResult::Continue();
+					},
+					CreateConsumer(collectedHeights)
+				},
+				{ 4, 1 },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(10u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(expectedHeights, collectedHeights);
+		EXPECT_EQ(expectedHeights, inspectedHeights);
+		EXPECT_EQ(std::vector<CompletionStatus>(10, CompletionStatus::Normal), inspectedStatuses);
+	}
+
+	TEST(TEST_CLASS, ParallelConsumerCanMarkElementsSkippedByHigherConsumers) {
+		// Arrange:
+		std::vector<Heights> collectedHeights;
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		auto ranges = test::PrepareRanges(5);
+		auto height = 0u;
+		for (auto& range : ranges)
+			range.begin()->Height = Height(++height);
+
+		auto allHeights = GetExpectedHeights(ranges);
+		auto expectedHeights = test::Filter(allHeights, [](const auto& heights) {
+			return 1 == heights[0].unwrap() % 2;
+		});
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{ CreateSkipIfFirstBlockIsEvenConsumer(), CreateConsumer(collectedHeights) },
+				{ 3, 1 },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+
+		// Assert:
+		EXPECT_EQ(expectedHeights, collectedHeights);
+		EXPECT_EQ(allHeights, inspectedHeights);
+
+		auto expectedStatuses = std::vector<CompletionStatus>(5, CompletionStatus::Normal);
+		expectedStatuses[1] = CompletionStatus::Aborted;
+		expectedStatuses[3] = CompletionStatus::Aborted;
+		EXPECT_EQ(expectedStatuses, inspectedStatuses);
+	}
+
+	TEST(TEST_CLASS, ParallelConsumerCanProcessMoreElementsThanDisruptorCapacity) {
+		// Arrange:
+		std::atomic<size_t> numConsumed(0);
+		auto options = Test_Dispatcher_Options;
+		options.DisruptorSize = 8;
+		options.ShouldThrowIfFull = false;
+
+		ConsumerDispatcher dispatcher(
+				options,
+				{
+					[&numConsumed](const auto&) {
+						++numConsumed;
+						return ConsumerResult::Continue();
+					},
+					CreateNoOpConsumer()
+				},
+				{ 3, 1 },
+				CreateNoOpInspector());
+
+		// Act: push elements one by one so that the disruptor wraps around multiple times
+		for (auto i = 0u; i < 50; ++i) {
+			auto ranges = test::PrepareRanges(1);
+			dispatcher.processElement(ConsumerInput(std::move(ranges[0])));
+			WAIT_FOR_VALUE_EXPR(i + 1, numConsumed.load());
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+		}
+
+		// Assert:
+		EXPECT_EQ(50u, dispatcher.numAddedElements());
+		EXPECT_EQ(50u, numConsumed);
+	}
+
+	// endregion
+
 	// region exception + space exhaution
 
 #ifdef __clang__
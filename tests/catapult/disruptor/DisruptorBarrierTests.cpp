@@ -45,4 +45,45 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	namespace {
+		class CountingWaitStrategy : public DisruptorWaitStrategy {
+		public:
+			size_t numSignals = 0;
+
+		public:
+			void wait(const DisruptorBarrier&, PositionType) override
+			{}
+
+			void signalAll() override {
+				++numSignals;
+			}
+		};
+	}
+
+	TEST(TEST_CLASS, CanCreateBarrierWithWaitStrategy) {
+		// Arrange:
+		CountingWaitStrategy waitStrategy;
+		DisruptorBarrier barrier(100, 1, &waitStrategy);
+
+		// Assert:
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(1u, barrier.position());
+		EXPECT_EQ(0u, waitStrategy.numSignals);
+	}
+
+	TEST(TEST_CLASS, AdvancingBarrierSignalsWaitStrategy) {
+		// Arrange:
+		CountingWaitStrategy waitStrategy;
+		DisruptorBarrier barrier(100, 1, &waitStrategy);
+
+		// Act:
+		barrier.advance();
+		barrier.advance();
+
+		// Assert:
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(3u, barrier.position());
+		EXPECT_EQ(2u, waitStrategy.numSignals);
+	}
 }}
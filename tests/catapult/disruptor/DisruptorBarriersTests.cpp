@@ -67,4 +67,34 @@ namespace catapult { namespace disruptor {
 			EXPECT_EQ(i, barriers[i].level());
 		}
 	}
+	TEST(TEST_CLASS, AdvancingAnyBarrierSignalsWaitStrategy) {
+		// Arrange:
+		class CountingWaitStrategy : public DisruptorWaitStrategy {
+		public:
+			size_t numSignals = 0;
+
+		public:
+			void wait(const DisruptorBarrier&, PositionType) override
+			{}
+
+			void signalAll() override {
+				++numSignals;
+			}
+		};
+
+		CountingWaitStrategy waitStrategy;
+		DisruptorBarriers barriers(3, waitStrategy);
+
+		// Act:
+		barriers[0].advance();
+		barriers[2].advance();
+		barriers[0].advance();
+
+		// Assert:
+		EXPECT_EQ(3u, barriers.size());
+		EXPECT_EQ(2u, barriers[0].position());
+		EXPECT_EQ(0u, barriers[1].position());
+		EXPECT_EQ(1u, barriers[2].position());
+		EXPECT_EQ(3u, waitStrategy.numSignals);
+	}
 }}
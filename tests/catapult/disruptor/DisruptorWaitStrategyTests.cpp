@@ -0,0 +1,140 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/DisruptorWaitStrategy.h"
+#include "catapult/disruptor/DisruptorBarrier.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS DisruptorWaitStrategyTests
+
+	namespace {
+		struct SleepTraits {
+			static constexpr auto Type = WaitStrategyType::Sleep;
+		};
+
+		struct BusySpinTraits {
+			static constexpr auto Type = WaitStrategyType::Busy_Spin;
+		};
+
+		struct SpinThenYieldTraits {
+			static constexpr auto Type = WaitStrategyType::Spin_Then_Yield;
+		};
+
+		struct BlockingTraits {
+			static constexpr auto Type = WaitStrategyType::Blocking;
+		};
+	}
+
+#define WAIT_STRATEGY_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sleep) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SleepTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BusySpin) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BusySpinTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_SpinThenYield) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SpinThenYieldTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Blocking) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockingTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region all strategies
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(CanCreateStrategy) {
+		// Act:
+		auto pWaitStrategy = CreateDisruptorWaitStrategy(TTraits::Type);
+
+		// Assert:
+		EXPECT_TRUE(!!pWaitStrategy);
+	}
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(WaitReturnsWhenBarrierHasAlreadyAdvanced) {
+		// Arrange:
+		auto pWaitStrategy = CreateDisruptorWaitStrategy(TTraits::Type);
+		DisruptorBarrier barrier(0, 5, pWaitStrategy.get());
+
+		// Act + Assert: wait returns (strategies are allowed to return early)
+		pWaitStrategy->wait(barrier, 4);
+	}
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(WaitEventuallyReturnsWhenBarrierDoesNotAdvance) {
+		// Arrange:
+		auto pWaitStrategy = CreateDisruptorWaitStrategy(TTraits::Type);
+		DisruptorBarrier barrier(0, 5, pWaitStrategy.get());
+
+		// Act + Assert: wait returns even though barrier is not advanced
+		pWaitStrategy->wait(barrier, 5);
+	}
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(CanSignalWithoutWaiters) {
+		// Arrange:
+		auto pWaitStrategy = CreateDisruptorWaitStrategy(TTraits::Type);
+
+		// Act + Assert: no exception
+		pWaitStrategy->signalAll();
+	}
+
+	// endregion
+
+	// region blocking
+
+	TEST(TEST_CLASS, BlockingStrategyWaitsForBoundedDuration) {
+		// Arrange:
+		auto pWaitStrategy = CreateDisruptorWaitStrategy(WaitStrategyType::Blocking);
+		DisruptorBarrier barrier(0, 5, pWaitStrategy.get());
+
+		// Act:
+		auto start = std::chrono::steady_clock::now();
+		pWaitStrategy->wait(barrier, 5);
+		auto elapsed = std::chrono::steady_clock::now() - start;
+
+		// Assert: the wait timed out (after roughly 10ms)
+		EXPECT_LE(std::chrono::milliseconds(5), elapsed);
+		EXPECT_GT(std::chrono::seconds(1), elapsed);
+	}
+
+	TEST(TEST_CLASS, BlockingStrategyWakesWaiterWhenBarrierIsAdvanced) {
+		// Arrange:
+		auto pWaitStrategy = CreateDisruptorWaitStrategy(WaitStrategyType::Blocking);
+		DisruptorBarrier barrier(0, 5, pWaitStrategy.get());
+
+		// - wait on a separate thread until the barrier is advanced
+		std::atomic<size_t> numWaits(0);
+		std::atomic_bool isDone(false);
+		std::thread waiter([&pWaitStrategy, &barrier, &numWaits, &isDone]() {
+			while (5 == barrier.position()) {
+				pWaitStrategy->wait(barrier, 5);
+				++numWaits;
+			}
+
+			isDone = true;
+		});
+
+		// Act:
+		WAIT_FOR_EXPR(numWaits > 0);
+		barrier.advance();
+		WAIT_FOR(isDone);
+		waiter.join();
+
+		// Assert:
+		EXPECT_EQ(6u, barrier.position());
+	}
+
+	// endregion
+}}
@@ -0,0 +1,121 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ParallelConsumerEntry.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS ParallelConsumerEntryTests
+
+	namespace {
+		std::vector<PositionType> Complete(ParallelConsumerEntry& entry, PositionType position) {
+			std::vector<PositionType> publishedPositions;
+			entry.complete(position, [&publishedPositions](auto publishedPosition) {
+				publishedPositions.push_back(publishedPosition);
+			});
+			return publishedPositions;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateAnEntry) {
+		// Arrange:
+		ParallelConsumerEntry entry(123, 10);
+
+		// Assert:
+		EXPECT_EQ(123u, entry.level());
+		EXPECT_EQ(0u, entry.claimPosition());
+		EXPECT_EQ(0u, entry.position());
+	}
+
+	TEST(TEST_CLASS, CannotClaimPositionAtBarrier) {
+		// Arrange:
+		ParallelConsumerEntry entry(1, 10);
+		DisruptorBarrier barrier(1, 0);
+
+		// Act:
+		PositionType position = 100;
+		auto result = entry.tryClaim(barrier, position);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(100u, position);
+		EXPECT_EQ(0u, entry.claimPosition());
+	}
+
+	TEST(TEST_CLASS, CanClaimConsecutivePositionsBelowBarrier) {
+		// Arrange:
+		ParallelConsumerEntry entry(1, 10);
+		DisruptorBarrier barrier(1, 3);
+
+		// Act:
+		std::vector<PositionType> claimedPositions;
+		PositionType position;
+		while (entry.tryClaim(barrier, position))
+			claimedPositions.push_back(position);
+
+		// Assert:
+		EXPECT_EQ(std::vector<PositionType>({ 0, 1, 2 }), claimedPositions);
+		EXPECT_EQ(3u, entry.claimPosition());
+		EXPECT_EQ(0u, entry.position());
+	}
+
+	TEST(TEST_CLASS, CompletingPositionsInOrderPublishesEachPosition) {
+		// Arrange:
+		ParallelConsumerEntry entry(1, 10);
+
+		// Act + Assert:
+		for (auto i = 0u; i < 5; ++i) {
+			EXPECT_EQ(std::vector<PositionType>({ i }), Complete(entry, i)) << i;
+			EXPECT_EQ(i + 1, entry.position());
+		}
+	}
+
+	TEST(TEST_CLASS, CompletingPositionsOutOfOrderPublishesOnlyContiguousPositions) {
+		// Arrange:
+		ParallelConsumerEntry entry(1, 10);
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<PositionType>(), Complete(entry, 2));
+		EXPECT_EQ(std::vector<PositionType>(), Complete(entry, 1));
+		EXPECT_EQ(0u, entry.position());
+
+		EXPECT_EQ(std::vector<PositionType>({ 0, 1, 2 }), Complete(entry, 0));
+		EXPECT_EQ(3u, entry.position());
+
+		EXPECT_EQ(std::vector<PositionType>(), Complete(entry, 4));
+		EXPECT_EQ(std::vector<PositionType>({ 3, 4 }), Complete(entry, 3));
+		EXPECT_EQ(5u, entry.position());
+	}
+
+	TEST(TEST_CLASS, CompletingPositionsSupportsWrapAround) {
+		// Arrange:
+		ParallelConsumerEntry entry(1, 4);
+		for (auto i = 0u; i < 3; ++i)
+			Complete(entry, i);
+
+		// Act + Assert: positions 3-6 map to indexes 3, 0, 1, 2
+		EXPECT_EQ(std::vector<PositionType>(), Complete(entry, 6));
+		EXPECT_EQ(std::vector<PositionType>(), Complete(entry, 4));
+		EXPECT_EQ(std::vector<PositionType>(), Complete(entry, 5));
+		EXPECT_EQ(std::vector<PositionType>({ 3, 4, 5, 6 }), Complete(entry, 3));
+		EXPECT_EQ(7u, entry.position());
+	}
+}}
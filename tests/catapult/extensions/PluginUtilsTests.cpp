@@ -32,6 +32,18 @@ namespace catapult { namespace extensions {
 		auto nodeConfig = config::NodeConfiguration::Uninitialized();
 		nodeConfig.ShouldUseCacheDatabaseStorage = true;
 		nodeConfig.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromKilobytes(123);
+		nodeConfig.PatriciaTreeNodeCacheMaxSize = 456;
+		nodeConfig.MaxStateMultiproofKeys = 78;
+		nodeConfig.CacheDatabase.BlockCacheSize = utils::FileSize::FromMegabytes(64);
+		nodeConfig.CacheDatabase.BloomFilterBitsPerKey = 12;
+		nodeConfig.CacheDatabase.ShouldPinIndexAndFilterBlocks = true;
+		nodeConfig.CacheDatabase.KeyPrefixSize = 8;
+		nodeConfig.CacheDatabase.ShouldUseUniversalCompaction = true;
+		nodeConfig.CacheDatabase.WriteBufferSize = utils::FileSize::FromMegabytes(32);
+		nodeConfig.CacheDatabase.PatriciaTreeWriteBufferSize = utils::FileSize::FromMegabytes(16);
+		nodeConfig.CacheDatabase.MaxWriteBufferNumber = 5;
+		nodeConfig.CacheDatabase.ShouldSyncWrites = false;
+		nodeConfig.CacheDatabase.ShouldEnableStatistics = true;
 
 		auto userConfig = config::UserConfiguration::Uninitialized();
 		userConfig.DataDirectory = "foo_bar";
@@ -49,6 +61,20 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(storageConfig.PreferCacheDatabase);
 		EXPECT_EQ("foo_bar/statedb", storageConfig.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(123), storageConfig.MaxCacheDatabaseWriteBatchSize);
+		EXPECT_EQ(456u, storageConfig.PatriciaTreeNodeCacheMaxSize);
+		EXPECT_EQ(78u, storageConfig.MaxStateMultiproofKeys);
+
+		const auto& tuningSettings = storageConfig.CacheDatabaseTuning;
+		EXPECT_EQ(utils::FileSize::FromMegabytes(64), tuningSettings.BlockCacheSize);
+		EXPECT_EQ(12u, tuningSettings.BloomFilterBitsPerKey);
+		EXPECT_TRUE(tuningSettings.ShouldPinIndexAndFilterBlocks);
+		EXPECT_EQ(8u, tuningSettings.KeyPrefixSize);
+		EXPECT_TRUE(tuningSettings.ShouldUseUniversalCompaction);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(32), tuningSettings.WriteBufferSize);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(16), tuningSettings.PatriciaTreeWriteBufferSize);
+		EXPECT_EQ(5u, tuningSettings.MaxWriteBufferNumber);
+		EXPECT_FALSE(tuningSettings.ShouldSyncWrites);
+		EXPECT_TRUE(tuningSettings.ShouldEnableStatistics);
 	}
 
 	TEST(TEST_CLASS, CanCreateStatelessValidator) {
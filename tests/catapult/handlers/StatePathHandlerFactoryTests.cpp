@@ -20,7 +20,10 @@
 
 #include "catapult/handlers/StatePathHandlerFactory.h"
 #include "catapult/cache/SynchronizedCache.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
+#include "tests/catapult/tree/test/PassThroughEncoder.h"
 #include "tests/test/plugins/BasicBatchHandlerTests.h"
 #include "tests/TestHarness.h"
 #include <unordered_map>
@@ -247,4 +250,187 @@ namespace catapult { namespace handlers {
 					AssertReturnedValue(expectedResponse, context.response());
 				});
 	}
+
+	// region multiproof
+
+	namespace {
+		using MemoryPatriciaTree = tree::PatriciaTree<test::PassThroughEncoder, tree::MemoryDataSource>;
+		using MultiproofKeyType = test::PassThroughEncoder::KeyType;
+		using MockMultiproofPacket = StateMultiproofRequestPacket<Mock_Packet_Type, MultiproofKeyType>;
+
+		class MockTreeCacheView {
+		public:
+			explicit MockTreeCacheView(const MemoryPatriciaTree& tree) : m_tree(tree)
+			{}
+
+		public:
+			auto tryGetMerkleRoot() const {
+				return std::make_pair(m_tree.root(), true);
+			}
+
+			auto tryLookup(const MultiproofKeyType& key, StatePath& path) const {
+				return m_tree.lookup(key, path);
+			}
+
+		private:
+			const MemoryPatriciaTree& m_tree;
+		};
+
+		class MockTreeCache {
+		public:
+			MockTreeCache() : m_tree(m_dataSource) {
+				m_tree.set(0x64'6F'72'73, "alpha");
+				m_tree.set(0x64'6F'67'67, "beta");
+				m_tree.set(0x64'6F'67'00, "gamma");
+				m_tree.set(0x68'6F'72'73, "delta");
+			}
+
+		public:
+			auto createView() const {
+				auto readerLock = m_lock.acquireReader();
+				return cache::LockedCacheView<MockTreeCacheView>(MockTreeCacheView(m_tree), std::move(readerLock));
+			}
+
+			auto root() const {
+				return m_tree.root();
+			}
+
+		private:
+			mutable utils::SpinReaderWriterLock m_lock;
+			tree::MemoryDataSource m_dataSource;
+			MemoryPatriciaTree m_tree;
+		};
+
+		constexpr uint32_t Max_Multiproof_Keys = 3;
+
+		struct StateMultiproofHandlerFactoryTraits {
+		public:
+			static constexpr auto Packet_Type = Mock_Packet_Type;
+			static constexpr auto Valid_Request_Payload_Size = sizeof(MultiproofKeyType);
+
+		public:
+			class TestContext {
+			public:
+				const auto& getCache() const {
+					return m_cache;
+				}
+
+			public:
+				void assertRejected() const {
+					// nothing to check
+				}
+
+			private:
+				MockTreeCache m_cache;
+			};
+
+		public:
+			static void RegisterHandler(ionet::ServerPacketHandlers& handlers, const MockTreeCache& cache) {
+				RegisterStateMultiproofHandler<MockMultiproofPacket>(handlers, cache, Max_Multiproof_Keys);
+			}
+		};
+
+		using BasicMultiproofHandlerTests = test::BasicBatchHandlerTests<
+			StateMultiproofHandlerFactoryTraits,
+			CacheHandlerTraits<StateMultiproofHandlerFactoryTraits>>;
+
+		std::shared_ptr<ionet::Packet> CreateMultiproofRequestPacket(const std::vector<MultiproofKeyType>& keys) {
+			auto payloadSize = static_cast<uint32_t>(keys.size() * sizeof(MultiproofKeyType));
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+			pPacket->Type = Mock_Packet_Type;
+			std::memcpy(pPacket->Data(), keys.data(), payloadSize);
+			return pPacket;
+		}
+
+		template<typename TAssertProof>
+		void AssertMultiproofResponse(const std::vector<MultiproofKeyType>& keys, TAssertProof assertProof) {
+			// Arrange:
+			MockTreeCache cache;
+			ionet::ServerPacketHandlers handlers;
+			RegisterStateMultiproofHandler<MockMultiproofPacket>(handlers, cache, Max_Multiproof_Keys);
+			auto pPacket = CreateMultiproofRequestPacket(keys);
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(*pPacket, context));
+
+			// Assert: response is composed of a header and merkle root followed by the serialized proof
+			ASSERT_TRUE(context.hasResponse());
+			const auto& buffers = context.response().buffers();
+			ASSERT_EQ(1u, buffers.size());
+			ASSERT_LE(Hash256_Size, buffers[0].Size);
+			test::AssertPacketHeader(context, sizeof(ionet::PacketHeader) + buffers[0].Size, Mock_Packet_Type);
+
+			const auto& merkleRoot = reinterpret_cast<const Hash256&>(*buffers[0].pData);
+			EXPECT_EQ(cache.root(), merkleRoot);
+
+			tree::PatriciaTreeMultiproof proof({ buffers[0].pData + Hash256_Size, buffers[0].Size - Hash256_Size });
+			assertProof(proof, merkleRoot);
+		}
+
+		void AssertLookupResult(
+				tree::MultiproofLookupResult expectedResult,
+				const tree::PatriciaTreeMultiproof& proof,
+				const Hash256& root,
+				MultiproofKeyType key) {
+			Hash256 valueHash;
+			EXPECT_EQ(expectedResult, proof.lookup(root, tree::TreeNodePath(key), valueHash)) << utils::HexFormat(key);
+		}
+	}
+
+#define MAKE_BASIC_STATE_MULTIPROOF_HANDLER_TEST(NAME) TEST(TEST_CLASS, Multiproof##NAME) { BasicMultiproofHandlerTests::Assert##NAME(); }
+
+	MAKE_BASIC_STATE_MULTIPROOF_HANDLER_TEST(TooSmallPacketIsRejected)
+	MAKE_BASIC_STATE_MULTIPROOF_HANDLER_TEST(PacketWithWrongTypeIsRejected)
+	MAKE_BASIC_STATE_MULTIPROOF_HANDLER_TEST(PacketWithInvalidPayloadIsRejected)
+	MAKE_BASIC_STATE_MULTIPROOF_HANDLER_TEST(PacketWithTooSmallPayloadIsRejected)
+	MAKE_BASIC_STATE_MULTIPROOF_HANDLER_TEST(PacketWithNoPayloadIsRejected)
+
+	TEST(TEST_CLASS, MultiproofPacketWithTooManyKeysIsRejected) {
+		// Arrange:
+		MockTreeCache cache;
+		ionet::ServerPacketHandlers handlers;
+		RegisterStateMultiproofHandler<MockMultiproofPacket>(handlers, cache, Max_Multiproof_Keys);
+		auto pPacket = CreateMultiproofRequestPacket({ 0x64'6F'72'73, 0x68'6F'72'73, 0x64'6F'67'67, 0x64'6F'67'00 });
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		EXPECT_TRUE(handlers.process(*pPacket, context));
+
+		// Assert:
+		test::AssertNoResponse(context);
+	}
+
+	TEST(TEST_CLASS, MultiproofProvesKeysInState) {
+		// Act:
+		AssertMultiproofResponse({ 0x64'6F'72'73, 0x68'6F'72'73 }, [](const auto& proof, const auto& root) {
+			// Assert: root branch, nested branch (6F) and two leaves
+			EXPECT_EQ(4u, proof.size());
+			AssertLookupResult(tree::MultiproofLookupResult::Found, proof, root, 0x64'6F'72'73);
+			AssertLookupResult(tree::MultiproofLookupResult::Found, proof, root, 0x68'6F'72'73);
+		});
+	}
+
+	TEST(TEST_CLASS, MultiproofProvesKeysNotInState) {
+		// Act:
+		AssertMultiproofResponse({ 0x64'6F'12'73, 0x60'6F'72'73 }, [](const auto& proof, const auto& root) {
+			// Assert: root branch and nested branch (6F)
+			EXPECT_EQ(2u, proof.size());
+			AssertLookupResult(tree::MultiproofLookupResult::Not_Found, proof, root, 0x64'6F'12'73);
+			AssertLookupResult(tree::MultiproofLookupResult::Not_Found, proof, root, 0x60'6F'72'73);
+		});
+	}
+
+	TEST(TEST_CLASS, MultiproofIncludesSharedNodesOnlyOnce) {
+		// Act:
+		AssertMultiproofResponse({ 0x64'6F'67'67, 0x64'6F'67'00, 0x64'6F'67'67 }, [](const auto& proof, const auto& root) {
+			// Assert: root branch, nested branches (6F and 7) and two leaves
+			EXPECT_EQ(5u, proof.size());
+			AssertLookupResult(tree::MultiproofLookupResult::Found, proof, root, 0x64'6F'67'67);
+			AssertLookupResult(tree::MultiproofLookupResult::Found, proof, root, 0x64'6F'67'00);
+			AssertLookupResult(tree::MultiproofLookupResult::Incomplete, proof, root, 0x64'6F'72'73);
+		});
+	}
+
+	// endregion
 }}
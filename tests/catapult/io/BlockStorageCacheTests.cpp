@@ -37,6 +37,10 @@ namespace catapult { namespace io {
 					: m_cache(std::move(pStorage))
 			{}
 
+			BlockStorageCacheToBlockStorageAdapter(std::unique_ptr<BlockStorage>&& pStorage, const BlockStorageCacheOptions& options)
+					: m_cache(std::move(pStorage), options)
+			{}
+
 		public:
 			Height chainHeight() const override {
 				return m_cache.view().chainHeight();
@@ -72,6 +76,18 @@ namespace catapult { namespace io {
 			}
 		};
 
+		std::unique_ptr<BlockStorageCacheToBlockStorageAdapter> PrepareAdapter(
+				std::unique_ptr<BlockStorageCacheToBlockStorageAdapter>&& pStorage,
+				Height height) {
+			if (Height() != height)
+				// abuse drop blocks to fake current height...
+				// note: since we will want to save next block at height, we need to drop all
+				// after `height-1` due to check in saveBlock()
+				pStorage->dropBlocksAfter(Height(height.unwrap() - 1));
+
+			return std::move(pStorage);
+		}
+
 		struct MemoryTraits {
 			using Guard = MemoryBasedGuard;
 			using StorageType = BlockStorageCacheToBlockStorageAdapter;
@@ -81,21 +97,34 @@ namespace catapult { namespace io {
 			}
 
 			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
-				auto pStorage = OpenStorage(destination);
+				return PrepareAdapter(OpenStorage(destination), height);
+			}
+		};
 
-				if (Height() != height)
-					// abuse drop blocks to fake current height...
-					// note: since we will want to save next block at height, we need to drop all
-					// after `height-1` due to check in saveBlock()
-					pStorage->dropBlocksAfter(Height(height.unwrap() - 1));
+		struct CachingMemoryTraits {
+			using Guard = MemoryBasedGuard;
+			using StorageType = BlockStorageCacheToBlockStorageAdapter;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string&) {
+				return std::make_unique<StorageType>(std::make_unique<mocks::MockMemoryBlockStorage>(), BlockStorageCacheOptions{ 5, 7 });
+			}
 
-				return pStorage;
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				return PrepareAdapter(OpenStorage(destination), height);
 			}
 		};
 	}
 
 	DEFINE_BLOCK_STORAGE_TESTS(MemoryTraits)
 
+#undef TEST_CLASS
+#define TEST_CLASS BlockStorageCacheCachingTests
+
+	DEFINE_BLOCK_STORAGE_TESTS(CachingMemoryTraits)
+
+#undef TEST_CLASS
+#define TEST_CLASS BlockStorageCacheTests
+
 	// note that these aren't really pure delegation tests because they call a member on the cache
 	// and compare its behavior with that of the same call on the underlying storage
 
@@ -322,6 +351,160 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region caching
+
+	namespace {
+		void AssertStatistics(
+				const BlockStorageCache& cache,
+				uint64_t blockHits,
+				uint64_t blockMisses,
+				uint64_t hashHits,
+				uint64_t hashMisses) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(blockHits, statistics.BlockHits);
+			EXPECT_EQ(blockMisses, statistics.BlockMisses);
+			EXPECT_EQ(hashHits, statistics.HashHits);
+			EXPECT_EQ(hashMisses, statistics.HashMisses);
+		}
+
+		std::vector<Hash256> ToVector(const model::HashRange& hashes) {
+			return std::vector<Hash256>(hashes.cbegin(), hashes.cend());
+		}
+
+		void SaveRandomBlocks(BlockStorageCache& cache, Height startHeight, Height endHeight) {
+			auto modifier = cache.modifier();
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
+				auto pBlock = test::GenerateVerifiableBlockAtHeight(height);
+				modifier.saveBlock(test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>()));
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyZero) {
+		// Act:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), { 5, 10 });
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, SavedBlocksAreServedFromCache) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), { 5, 0 });
+		SaveRandomBlocks(cache, Height(Delegation_Chain_Size + 1), Height(Delegation_Chain_Size + 3));
+
+		// Act:
+		for (auto i = 1u; i <= 3; ++i) {
+			cache.view().loadBlockElement(Height(Delegation_Chain_Size + i));
+			cache.view().loadBlock(Height(Delegation_Chain_Size + i));
+		}
+
+		// Assert:
+		AssertStatistics(cache, 6, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockElementsAreAddedToCache) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), { 5, 0 });
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(7));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(7));
+
+		// Assert: the second load is served from the cache
+		AssertStatistics(cache, 1, 1, 0, 0);
+		EXPECT_EQ(pBlockElement1, pBlockElement2);
+		test::AssertEqual(*pStorageRaw->loadBlockElement(Height(7)), *pBlockElement2);
+	}
+
+	TEST(TEST_CLASS, LeastRecentlyUsedBlockElementsAreEvicted) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), { 2, 0 });
+		for (auto height : { Height(1), Height(2), Height(1), Height(3) })
+			cache.view().loadBlockElement(height);
+
+		// Sanity: only the third load was a hit
+		AssertStatistics(cache, 1, 3, 0, 0);
+
+		// Act: 2 was evicted when 3 was loaded, but 1 and 3 are still cached
+		for (auto height : { Height(1), Height(3), Height(2) })
+			cache.view().loadBlockElement(height);
+
+		// Assert:
+		AssertStatistics(cache, 3, 4, 0, 0);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterInvalidatesCachedBlockElements) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), { 5, 0 });
+		SaveRandomBlocks(cache, Height(Delegation_Chain_Size + 1), Height(Delegation_Chain_Size + 3));
+
+		// Act: replace the last two blocks
+		cache.modifier().dropBlocksAfter(Height(Delegation_Chain_Size + 1));
+		auto pBlock = test::GenerateVerifiableBlockAtHeight(Height(Delegation_Chain_Size + 2));
+		auto blockHash = test::GenerateRandomData<Hash256_Size>();
+		cache.modifier().saveBlock(test::BlockToBlockElement(*pBlock, blockHash));
+
+		// Assert: the new block is cached and the dropped block is not
+		auto pBlockElement = cache.view().loadBlockElement(Height(Delegation_Chain_Size + 2));
+		EXPECT_EQ(*pBlock, pBlockElement->Block);
+		EXPECT_EQ(blockHash, pBlockElement->EntityHash);
+		EXPECT_THROW(cache.view().loadBlockElement(Height(Delegation_Chain_Size + 3)), catapult_invalid_argument);
+		AssertStatistics(cache, 1, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, RecentHashesAreServedFromCache) {
+		// Arrange: cache the last five hashes
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), { 0, 5 });
+
+		// Act:
+		auto hashes = cache.view().loadHashesFrom(Height(Delegation_Chain_Size - 4), 10);
+		auto partialHashes = cache.view().loadHashesFrom(Height(Delegation_Chain_Size - 2), 2);
+
+		// Assert:
+		EXPECT_EQ(ToVector(pStorageRaw->loadHashesFrom(Height(Delegation_Chain_Size - 4), 10)), ToVector(hashes));
+		EXPECT_EQ(ToVector(pStorageRaw->loadHashesFrom(Height(Delegation_Chain_Size - 2), 2)), ToVector(partialHashes));
+		AssertStatistics(cache, 0, 0, 2, 0);
+	}
+
+	TEST(TEST_CLASS, OlderHashesAreLoadedFromStorage) {
+		// Arrange: cache the last five hashes
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), { 0, 5 });
+
+		// Act:
+		auto hashes = cache.view().loadHashesFrom(Height(Delegation_Chain_Size - 5), 10);
+
+		// Assert:
+		EXPECT_EQ(ToVector(pStorageRaw->loadHashesFrom(Height(Delegation_Chain_Size - 5), 10)), ToVector(hashes));
+		AssertStatistics(cache, 0, 0, 0, 1);
+	}
+
+	TEST(TEST_CLASS, CachedHashesAreUpdatedBySaveAndDrop) {
+		// Arrange: cache the last five hashes
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), { 0, 5 });
+
+		// Act: save three blocks, drop two and save four more
+		SaveRandomBlocks(cache, Height(Delegation_Chain_Size + 1), Height(Delegation_Chain_Size + 3));
+		cache.modifier().dropBlocksAfter(Height(Delegation_Chain_Size + 1));
+		SaveRandomBlocks(cache, Height(Delegation_Chain_Size + 2), Height(Delegation_Chain_Size + 5));
+		auto hashes = cache.view().loadHashesFrom(Height(Delegation_Chain_Size + 1), 10);
+
+		// Assert:
+		EXPECT_EQ(5u, hashes.size());
+		EXPECT_EQ(ToVector(pStorageRaw->loadHashesFrom(Height(Delegation_Chain_Size + 1), 10)), ToVector(hashes));
+		AssertStatistics(cache, 0, 0, 1, 0);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
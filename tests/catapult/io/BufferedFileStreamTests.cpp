@@ -312,6 +312,24 @@ namespace catapult { namespace io {
 		test.assertRead(Expected_File_Size, { Expected_File_Size });
 	}
 
+	TEST(TEST_CLASS, SyncFlushesTheData) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto data = test::GenerateRandomVector(100);
+		BufferedOutputFileStream output(RawFile(guard.name(), OpenMode::Read_Write, LockMode::None), Default_Test_Buffer_Size);
+		output.write(data);
+
+		// Act:
+		output.sync();
+
+		// Assert:
+		RawFile file(guard.name(), OpenMode::Read_Only, LockMode::None);
+		std::vector<uint8_t> result(data.size());
+		file.read(result);
+		EXPECT_EQ(data.size(), file.size());
+		EXPECT_EQ(data, result);
+	}
+
 	// endregion
 
 	DEFINE_STREAM_TESTS(BufferedFileStreamContext)
@@ -0,0 +1,416 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/PackedBlockStorage.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PodIoUtils.h"
+#include "tests/catapult/io/test/BlockStorageTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+using catapult::test::TempDirectoryGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS PackedBlockStorageTests
+
+	namespace {
+		void SetChainHeight(const std::string& destination, Height height) {
+			RawFile file(destination + "/packed_index.dat", OpenMode::Read_Write);
+			Write(file, height);
+		}
+
+		struct PackedTraits {
+			using Guard = TempDirectoryGuard;
+			using StorageType = PackedBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(destination);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				// convert the (file-based) seed storage into packed storage
+				auto seedDirectory = destination + "/seed";
+				test::PrepareStorage(seedDirectory);
+				{
+					FileBlockStorage seedStorage(seedDirectory);
+					PackedBlockStorage storage(destination);
+					CopyBlocks(seedStorage, storage);
+				}
+
+				if (Height() != height)
+					SetChainHeight(destination, height - Height(1));
+
+				return OpenStorage(destination);
+			}
+		};
+	}
+
+	// the seed test is replaced by CanConvertSeedStorageContainingNemesisBlock because the seed is stored in the file layout
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, SavingBlockWithHeightHigherThanChainHeightAltersChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CanLoadNewlySavedBlock)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CanOverwriteBlockWithSameData)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CanOverwriteBlockWithDifferentData)
+
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CannotSaveBlockWithHeightLessThanChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CannotSaveBlockAtChainHeight)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CannotSaveBlockMoreThanOneHeightBeyondChainHeight)
+
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackedTraits, CanLoadAtHeightLessThanChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackedTraits, CanLoadAtChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackedTraits, CannotLoadAtHeightGreaterThanChainHeight)
+	DEFINE_BLOCK_STORAGE_LOAD_TESTS(PackedTraits, CanLoadMultipleSaved)
+
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, CanDropBlocksAfterHeight)
+
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsZeroHashesWhenRequestHeightIsZero)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsZeroHashesWhenRequestHeightIsLargerThanLocalHeight)
+
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_CanLoadASingleHash)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_CanLoadLastHash)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsAtMostMaxHashes)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsAreBoundedByLastBlock)
+	MAKE_BLOCK_STORAGE_TEST(PackedTraits, LoadHashesFrom_LoadsCanCrossIndexFileBoundary)
+
+	// region constructor
+
+	TEST(TEST_CLASS, EmptyStorageHasZeroChainHeight) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		boost::filesystem::create_directories(tempDir.name());
+
+		// Act:
+		PackedBlockStorage storage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(0), storage.chainHeight());
+	}
+
+	TEST(TEST_CLASS, CanConvertSeedStorageContainingNemesisBlock) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		const auto* pNemesisBlock = reinterpret_cast<const model::Block*>(&mocks::MemoryBlockStorage_NemesisBlockData);
+		auto nemesisBlockElement = test::BlockToBlockElement(*pNemesisBlock);
+		nemesisBlockElement.GenerationHash = test::GetNemesisGenerationHash();
+
+		// Act:
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+		auto pBlockElement = pStorage->loadBlockElement(Height(1));
+
+		// Assert:
+		EXPECT_EQ(Height(1), pStorage->chainHeight());
+		test::AssertEqual(nemesisBlockElement, *pBlockElement);
+		EXPECT_TRUE(model::VerifyBlockHeaderSignature(pBlockElement->Block));
+	}
+
+	TEST(TEST_CLASS, CannotOpenDirectoryContainingFileBasedStorage) {
+		// Arrange: seed the directory with the file layout
+		TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		// Act + Assert:
+		EXPECT_THROW(PackedBlockStorage(tempDir.name()), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, IndexFileDoesNotCollideWithFileBasedStorage) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+
+		// Act:
+		pStorage->saveBlock(test::CreateBlockElementForSaveTests(*test::GenerateBlockWithTransactionsAtHeight(Height(2))));
+
+		// Assert:
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name() + "/packed_index.dat"));
+		EXPECT_FALSE(boost::filesystem::exists(tempDir.name() + "/index.dat"));
+	}
+
+	// endregion
+
+	// region persistence
+
+	// these tests do not make sense for memory-based storage because blocks stored in memory-based storage
+	// do not persist across instances
+
+	TEST(TEST_CLASS, CanReadSavedBlocksAcrossDifferentStorageInstances) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pBlock1 = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto pBlock2 = test::GenerateBlockWithTransactionsAtHeight(Height(3));
+		auto element1 = test::CreateBlockElementForSaveTests(*pBlock1);
+		auto element2 = test::CreateBlockElementForSaveTests(*pBlock2);
+		element2.SubCacheMerkleRoots = test::GenerateRandomDataVector<Hash256>(3);
+		{
+			auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element1);
+			pStorage->saveBlock(element2);
+		}
+
+		// Act:
+		PackedBlockStorage storage(tempDir.name());
+		auto pBlockElement1 = storage.loadBlockElement(Height(2));
+		auto pBlockElement2 = storage.loadBlockElement(Height(3));
+
+		// Assert:
+		EXPECT_EQ(Height(3), storage.chainHeight());
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+	}
+
+	TEST(TEST_CLASS, CanAppendBlocksAcrossDifferentStorageInstances) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		PackedTraits::PrepareStorage(tempDir.name());
+		std::vector<model::BlockElement> elements;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		for (auto height = 2u; height <= 5; ++height) {
+			blocks.push_back(test::GenerateBlockWithTransactionsAtHeight(Height(height)));
+			elements.push_back(test::CreateBlockElementForSaveTests(*blocks.back()));
+		}
+
+		// Act: save each block with a new storage instance
+		for (const auto& element : elements)
+			PackedBlockStorage(tempDir.name()).saveBlock(element);
+
+		// Assert: later blocks were appended after (and did not overwrite) earlier blocks
+		PackedBlockStorage storage(tempDir.name());
+		EXPECT_EQ(Height(5), storage.chainHeight());
+		for (auto height = 2u; height <= 5; ++height)
+			test::AssertEqual(elements[height - 2], *storage.loadBlockElement(Height(height)));
+	}
+
+	TEST(TEST_CLASS, BlocksFileIsPreallocatedInExtents) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+		auto blocksPath = tempDir.name() + "/00000.blocks";
+		auto initialSize = boost::filesystem::file_size(blocksPath);
+
+		// Act:
+		test::SeedBlocks(*pStorage, Height(2), Height(20));
+
+		// Assert: the blocks file was not resized for each block
+		EXPECT_LE(1024u * 1024, initialSize);
+		EXPECT_EQ(initialSize, boost::filesystem::file_size(blocksPath));
+		for (auto height = 2u; height <= 20; ++height)
+			EXPECT_EQ(Height(height), pStorage->loadBlock(Height(height))->Height) << height;
+	}
+
+	TEST(TEST_CLASS, LoadedBlocksOutliveStorage) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto element = test::CreateBlockElementForSaveTests(*pBlock);
+		std::shared_ptr<const model::Block> pLoadedBlock;
+		std::shared_ptr<const model::BlockElement> pLoadedBlockElement;
+		{
+			auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element);
+
+			// Act:
+			pLoadedBlock = pStorage->loadBlock(Height(2));
+			pLoadedBlockElement = pStorage->loadBlockElement(Height(2));
+		}
+
+		// Assert: the mapped segment is kept alive by the loaded block and block element
+		EXPECT_EQ(*pBlock, *pLoadedBlock);
+		test::AssertEqual(element, *pLoadedBlockElement);
+	}
+
+	TEST(TEST_CLASS, OverwritingBlockDoesNotAffectPreviouslyLoadedBlock) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<PackedTraits>(10);
+		auto pOriginalBlock = pStorage->loadBlock(Height(10));
+		auto originalBlockCopy = test::CopyBlock(*pOriginalBlock);
+
+		auto pNewBlock = test::GenerateBlockWithTransactionsAtHeight(Height(10));
+		auto newElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(9));
+		pStorage->saveBlock(newElement);
+		auto pBlockElement = pStorage->loadBlockElement(Height(10));
+
+		// Assert:
+		test::AssertEqual(newElement, *pBlockElement);
+		EXPECT_EQ(*originalBlockCopy, *pOriginalBlock);
+	}
+
+	TEST(TEST_CLASS, CanLoadBlocksAcrossSegmentBoundary) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name(), Height(65530));
+		test::SeedBlocks(*pStorage, Height(65530), Height(65540));
+
+		// Act + Assert:
+		for (auto height : { Height(65530), Height(65535), Height(65536), Height(65540) }) {
+			auto pBlockElement = pStorage->loadBlockElement(height);
+			EXPECT_EQ(height, pBlockElement->Block.Height) << height;
+			EXPECT_EQ(static_cast<uint8_t>(height.unwrap()), pBlockElement->EntityHash[Hash256_Size - 1]) << height;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotLoadMissingBlockAtHeightLessThanChainHeight) {
+		// Arrange: only heights 1 and 65530 are present
+		TempDirectoryGuard tempDir;
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name(), Height(65530));
+		test::SeedBlocks(*pStorage, Height(65530), Height(65530));
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->loadBlock(Height(1234)), catapult_runtime_error);
+		EXPECT_THROW(pStorage->loadBlockElement(Height(1234)), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region pruneBlocksBefore
+
+	namespace {
+		test::StorageContext<PackedTraits> PrepareStorageSpanningThreeSegments() {
+			// Arrange: seed blocks in segments 0 and 1
+			test::StorageContext<PackedTraits> context;
+			context.pTempDirectoryGuard = std::make_unique<TempDirectoryGuard>();
+			const auto& directory = context.pTempDirectoryGuard->name();
+			{
+				auto pStorage = PackedTraits::PrepareStorage(directory, Height(65530));
+				test::SeedBlocks(*pStorage, Height(65530), Height(65540));
+			}
+
+			// - skip to segment 2 and seed more blocks
+			SetChainHeight(directory, Height(131079));
+			context.pStorage = PackedTraits::OpenStorage(directory);
+			test::SeedBlocks(*context.pStorage, Height(131080), Height(131085));
+			return context;
+		}
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_ThrowsAtHeightAfterChainHeight) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<PackedTraits>(5);
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->pruneBlocksBefore(Height(10)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_DoesNotPruneSegmentContainingNemesisBlock) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<PackedTraits>(10);
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(10));
+
+		// Assert:
+		EXPECT_EQ(Height(10), pStorage->chainHeight());
+		for (auto height = Height(1); height <= Height(10); height = height + Height(1))
+			EXPECT_EQ(height, pStorage->loadBlock(height)->Height) << height;
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_DoesNotPruneSegmentContainingPruneHeight) {
+		// Arrange:
+		auto pStorage = PrepareStorageSpanningThreeSegments();
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(131071));
+
+		// Assert:
+		EXPECT_EQ(Height(65540), pStorage->loadBlock(Height(65540))->Height);
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_PrunesWholeSegmentsBeforePruneHeight) {
+		// Arrange:
+		auto pStorage = PrepareStorageSpanningThreeSegments();
+		pStorage->loadBlock(Height(65540));
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(131082));
+
+		// Assert: segment 1 was pruned
+		EXPECT_EQ(Height(131085), pStorage->chainHeight());
+		EXPECT_THROW(pStorage->loadBlock(Height(65536)), catapult_runtime_error);
+		EXPECT_THROW(pStorage->loadBlockElement(Height(65540)), catapult_runtime_error);
+
+		// - segments 0 and 2 are preserved
+		EXPECT_EQ(Height(65535), pStorage->loadBlock(Height(65535))->Height);
+		EXPECT_EQ(Height(131080), pStorage->loadBlock(Height(131080))->Height);
+
+		// - hashes of pruned blocks are preserved
+		auto hashes = pStorage->loadHashesFrom(Height(65540), 1);
+		ASSERT_EQ(1u, hashes.size());
+		EXPECT_EQ(static_cast<uint8_t>(65540), (*hashes.cbegin())[Hash256_Size - 1]);
+	}
+
+	// endregion
+
+	// region CopyBlocks
+
+	TEST(TEST_CLASS, CopyBlocksCopiesAllBlocksFromFileStorage) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto sourceDirectory = tempDir.name() + "/source";
+		auto destinationDirectory = tempDir.name() + "/destination";
+		test::PrepareStorage(sourceDirectory);
+		boost::filesystem::create_directories(destinationDirectory);
+
+		FileBlockStorage source(sourceDirectory);
+		test::SeedBlocks(source, 10);
+
+		// Act:
+		PackedBlockStorage destination(destinationDirectory);
+		CopyBlocks(source, destination);
+
+		// Assert:
+		ASSERT_EQ(Height(10), destination.chainHeight());
+		for (auto height = Height(1); height <= Height(10); height = height + Height(1))
+			test::AssertEqual(*source.loadBlockElement(height), *destination.loadBlockElement(height));
+
+		auto expectedHashes = source.loadHashesFrom(Height(1), 10);
+		auto hashes = destination.loadHashesFrom(Height(1), 10);
+		EXPECT_EQ(
+				std::vector<Hash256>(expectedHashes.cbegin(), expectedHashes.cend()),
+				std::vector<Hash256>(hashes.cbegin(), hashes.cend()));
+	}
+
+	TEST(TEST_CLASS, CopyBlocksCopiesOnlyBlocksAboveDestinationChainHeight) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto sourceDirectory = tempDir.name() + "/source";
+		test::PrepareStorage(sourceDirectory);
+
+		FileBlockStorage source(sourceDirectory);
+		test::SeedBlocks(source, 10);
+
+		auto pDestination = PackedTraits::PrepareStorage(tempDir.name() + "/destination");
+		test::SeedBlocks(*pDestination, 5);
+		auto pDestinationBlock5 = pDestination->loadBlockElement(Height(5));
+
+		// Act:
+		CopyBlocks(source, *pDestination);
+
+		// Assert: existing blocks are unchanged
+		ASSERT_EQ(Height(10), pDestination->chainHeight());
+		test::AssertEqual(*pDestinationBlock5, *pDestination->loadBlockElement(Height(5)));
+		for (auto height = Height(6); height <= Height(10); height = height + Height(1))
+			test::AssertEqual(*source.loadBlockElement(height), *pDestination->loadBlockElement(height));
+	}
+
+	// endregion
+}}
@@ -93,6 +93,21 @@ namespace catapult { namespace io {
 		EXPECT_EQ(inputData.size(), r.position());
 	}
 
+	WRITING_TRAITS_BASED_TEST(SyncDoesNotAlterSizeAndPosition) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		RawFile r(guard.name(), TTraits::Mode);
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		r.write(inputData);
+
+		// Act:
+		r.sync();
+
+		// Assert:
+		EXPECT_EQ(inputData.size(), r.size());
+		EXPECT_EQ(inputData.size(), r.position());
+	}
+
 	TEST(TEST_CLASS, WriteOnReadOnlyFileThrowsException) {
 		// Arrange:
 		TempFileGuard guard("test.dat");
@@ -651,4 +666,24 @@ namespace catapult { namespace io {
 		EXPECT_EQ(inputData2.size(), r.position());
 
 	}
+
+	// region SyncDirectory
+
+	TEST(TEST_CLASS, CanSyncDirectory) {
+		// Arrange:
+		test::TempDirectoryGuard guard;
+		{
+			RawFile r(guard.name() + "/test.dat", OpenMode::Read_Write);
+		}
+
+		// Act + Assert:
+		EXPECT_NO_THROW(SyncDirectory(guard.name()));
+	}
+
+	TEST(TEST_CLASS, CannotSyncNonExistingDirectory) {
+		// Act + Assert:
+		EXPECT_THROW(SyncDirectory("abcdefghijklmnopqrstuvwxyz"), catapult_file_io_error);
+	}
+
+	// endregion
 }}
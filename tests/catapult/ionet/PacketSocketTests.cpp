@@ -22,6 +22,7 @@
 #include "catapult/ionet/IoTypes.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/WorkingBuffer.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
@@ -120,6 +121,29 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload) {
+		// Arrange: set up a payload composed of more buffers than are written by a single gathered system call
+		PacketPayloadBuilder builder(test::Default_Packet_Type);
+		for (auto i = 0u; i < 100; ++i)
+			builder.appendEntity(test::CreateRandomPacket(i * 10, test::Default_Packet_Type));
+
+		auto payload = builder.build();
+
+		ByteBuffer packetBytes(payload.header().Size);
+		std::memcpy(packetBytes.data(), &payload.header(), sizeof(PacketHeader));
+		auto offset = sizeof(PacketHeader);
+		for (const auto& buffer : payload.buffers()) {
+			std::memcpy(packetBytes.data() + offset, buffer.pData, buffer.Size);
+			offset += buffer.Size;
+		}
+
+		// Sanity:
+		EXPECT_EQ(100u, payload.buffers().size());
+
+		// Assert:
+		AssertWriteSuccess(payload, packetBytes);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
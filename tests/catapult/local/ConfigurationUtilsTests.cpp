@@ -39,4 +39,18 @@ namespace catapult { namespace local {
 		EXPECT_EQ(4096u, options.MaxResponseSize);
 		EXPECT_EQ(234u, options.MaxCacheSize);
 	}
+
+	TEST(TEST_CLASS, CanExtractBlockStorageCacheOptionsFromNodeConfiguration) {
+		// Arrange:
+		auto config = config::NodeConfiguration::Uninitialized();
+		config.BlockStorageCacheMaxBlocks = 123;
+		config.BlockStorageCacheMaxHashes = 4567;
+
+		// Act:
+		auto options = GetBlockStorageCacheOptions(config);
+
+		// Assert:
+		EXPECT_EQ(123u, options.MaxCachedBlocks);
+		EXPECT_EQ(4567u, options.MaxCachedHashes);
+	}
 }}
@@ -361,4 +361,73 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region UpdateHashes (transaction elements)
+
+	namespace {
+		void AssertBatchUpdateHashesMatchesIndividualUpdates(
+				const TransactionRegistry& registry,
+				size_t numTransactions) {
+			// Arrange:
+			std::vector<std::unique_ptr<Transaction>> transactions;
+			std::vector<TransactionElement> expectedTransactionElements;
+			std::vector<TransactionElement> transactionElements;
+			for (auto i = 0u; i < numTransactions; ++i) {
+				transactions.push_back(test::GenerateRandomTransaction());
+				expectedTransactionElements.push_back(TransactionElement(*transactions.back()));
+				transactionElements.push_back(TransactionElement(*transactions.back()));
+			}
+
+			for (auto& expectedTransactionElement : expectedTransactionElements)
+				UpdateHashes(registry, expectedTransactionElement);
+
+			std::vector<TransactionElement*> transactionElementPointers;
+			for (auto& transactionElement : transactionElements)
+				transactionElementPointers.push_back(&transactionElement);
+
+			// Act:
+			UpdateHashes(registry, transactionElementPointers);
+
+			// Assert:
+			for (auto i = 0u; i < numTransactions; ++i) {
+				EXPECT_EQ(expectedTransactionElements[i].EntityHash, transactionElements[i].EntityHash) << "element " << i;
+				EXPECT_EQ(expectedTransactionElements[i].MerkleComponentHash, transactionElements[i].MerkleComponentHash)
+						<< "element " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateZeroTransactionElements) {
+		// Arrange:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+
+		// Act + Assert: no exception
+		UpdateHashes(registry, std::vector<TransactionElement*>());
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_MultipleTransactionElementsHaveSameHashesAsIndividuallyUpdatedElements) {
+		// Arrange:
+		auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(mocks::OffsetRange{ 5, 15 }, {});
+		auto registry = TransactionRegistry();
+		registry.registerPlugin(std::move(pPlugin));
+
+		// Assert:
+		for (auto numTransactions : { 1u, 3u, 10u, 25u })
+			AssertBatchUpdateHashesMatchesIndividualUpdates(registry, numTransactions);
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_MultipleTransactionElementsWithSupplementaryBuffersHaveSameHashesAsIndividuallyUpdatedElements) {
+		// Arrange:
+		auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(
+				mocks::OffsetRange{ 6, 10 },
+				std::vector<mocks::OffsetRange>{ { 7, 11 }, { 4, 7 }, { 12, 20 } });
+		auto registry = TransactionRegistry();
+		registry.registerPlugin(std::move(pPlugin));
+
+		// Assert:
+		for (auto numTransactions : { 1u, 3u, 10u, 25u })
+			AssertBatchUpdateHashesMatchesIndividualUpdates(registry, numTransactions);
+	}
+
+	// endregion
 }}
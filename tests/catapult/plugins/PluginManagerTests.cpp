@@ -25,6 +25,7 @@
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/NumericTestUtils.h"
 #include "tests/test/plugins/ValidatorTestUtils.h"
 #include "tests/TestHarness.h"
@@ -42,6 +43,10 @@ namespace catapult { namespace plugins {
 		// Assert:
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
+		EXPECT_EQ(0u, config.PatriciaTreeNodeCacheMaxSize);
+		EXPECT_EQ(0u, config.MaxStateMultiproofKeys);
+		EXPECT_TRUE(config.CacheDatabaseTuning.ShouldSyncWrites);
+		EXPECT_FALSE(config.CacheDatabaseTuning.ShouldEnableStatistics);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
@@ -66,22 +71,114 @@ namespace catapult { namespace plugins {
 		storageConfig.PreferCacheDatabase = true;
 		storageConfig.CacheDatabaseDirectory = "abc";
 		storageConfig.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromKilobytes(23);
+		storageConfig.CacheDatabaseTuning.BloomFilterBitsPerKey = 12;
 
-		auto assertCacheConfiguration = [](const auto& cacheConfig, const auto& expectedDirectory) {
+		// Act:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
+
+		const auto* pTuning = manager.cacheDatabaseTuning();
+		auto assertCacheConfiguration = [pTuning](const auto& cacheConfig, const auto& expectedDirectory) {
 			EXPECT_TRUE(cacheConfig.ShouldUseCacheDatabase);
 			EXPECT_EQ(expectedDirectory, cacheConfig.CacheDatabaseDirectory);
 			EXPECT_EQ(utils::FileSize::FromKilobytes(23), cacheConfig.MaxCacheDatabaseWriteBatchSize);
 			EXPECT_FALSE(cacheConfig.ShouldStorePatriciaTrees);
+			EXPECT_FALSE(!!cacheConfig.TreeNodeCache);
+			EXPECT_EQ(pTuning, cacheConfig.DatabaseTuning.get());
 		};
 
-		// Act:
-		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
+		// Assert: a single tuning is shared by all cache configurations
+		ASSERT_TRUE(!!pTuning);
+		EXPECT_EQ(12u, pTuning->settings().BloomFilterBitsPerKey);
 
 		// Assert: cache configuration is constructed appropriately
 		assertCacheConfiguration(manager.cacheConfig("foo"), "abc/foo");
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
 	}
 
+	TEST(TEST_CLASS, CacheDatabaseTuningIsNotCreatedWhenCacheDatabaseIsNotPreferred) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.CacheDatabaseDirectory = "abc";
+
+		// Act:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
+		auto cacheConfig = manager.cacheConfig("foo");
+
+		// Assert:
+		EXPECT_FALSE(!!manager.cacheDatabaseTuning());
+		EXPECT_FALSE(!!cacheConfig.DatabaseTuning);
+	}
+
+	namespace {
+		void AssertPatriciaTreeNodeCacheCreation(
+				bool shouldEnableVerifiableState,
+				bool preferCacheDatabase,
+				uint32_t patriciaTreeNodeCacheMaxSize,
+				bool shouldCreateCache) {
+			// Arrange:
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.ShouldEnableVerifiableState = shouldEnableVerifiableState;
+
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = preferCacheDatabase;
+			storageConfig.CacheDatabaseDirectory = "abc";
+			storageConfig.PatriciaTreeNodeCacheMaxSize = patriciaTreeNodeCacheMaxSize;
+
+			// Act:
+			PluginManager manager(config, storageConfig);
+			auto cacheConfig1 = manager.cacheConfig("foo");
+			auto cacheConfig2 = manager.cacheConfig("bar");
+
+			// Assert: a single cache is shared by all cache configurations
+			const auto* pNodeCache = manager.patriciaTreeNodeCache();
+			EXPECT_EQ(shouldCreateCache, !!pNodeCache);
+			EXPECT_EQ(pNodeCache, cacheConfig1.TreeNodeCache.get());
+			EXPECT_EQ(pNodeCache, cacheConfig2.TreeNodeCache.get());
+		}
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeNodeCacheIsCreatedWhenPatriciaTreesAreStoredAndMaxSizeIsNonzero) {
+		AssertPatriciaTreeNodeCacheCreation(true, true, 100, true);
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeNodeCacheIsNotCreatedWhenPatriciaTreesAreNotStoredOrMaxSizeIsZero) {
+		AssertPatriciaTreeNodeCacheCreation(false, true, 100, false);
+		AssertPatriciaTreeNodeCacheCreation(true, false, 100, false);
+		AssertPatriciaTreeNodeCacheCreation(true, true, 0, false);
+	}
+
+	// endregion
+
+	// region pool
+
+	TEST(TEST_CLASS, ComputationPoolIsInitiallyUnavailable) {
+		// Arrange:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), StorageConfiguration());
+
+		// Act + Assert:
+		EXPECT_FALSE(!!manager.computationPool());
+	}
+
+	TEST(TEST_CLASS, ComputationPoolIsAvailableOnlyWhileAlive) {
+		// Arrange:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), StorageConfiguration());
+		std::shared_ptr<thread::IoServiceThreadPool> pPool = test::CreateStartedIoServiceThreadPool(2);
+
+		// Act:
+		manager.setComputationPool(pPool);
+		auto pComputationPool = manager.computationPool();
+
+		// Assert:
+		EXPECT_EQ(pPool.get(), pComputationPool.get());
+
+		// Act: destroy the pool
+		pComputationPool.reset();
+		pPool.reset();
+
+		// Assert:
+		EXPECT_FALSE(!!manager.computationPool());
+	}
+
 	// endregion
 
 	// region tx plugins
@@ -0,0 +1,160 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/state/PosImportances.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <boost/multiprecision/cpp_int.hpp>
+
+namespace catapult { namespace state {
+
+#define TEST_CLASS PosImportancesTests
+
+	namespace {
+		constexpr auto Total_Chain_Balance = utils::XemUnit(utils::XemAmount(9'000'000'000));
+
+		std::vector<Importance> CalculateExpectedImportances(utils::XemUnit totalChainBalance, const std::vector<Amount>& balances) {
+			// mirror the original (serial) importance calculation
+			Amount activeXem;
+			for (auto balance : balances)
+				activeXem = activeXem + balance;
+
+			std::vector<Importance> importances;
+			for (auto balance : balances) {
+				boost::multiprecision::uint128_t importance = totalChainBalance.microxem().unwrap();
+				importance *= balance.unwrap();
+				importance /= activeXem.unwrap();
+				importance /= utils::XemUnit(utils::XemAmount(1)).microxem().unwrap();
+				importances.push_back(Importance(static_cast<Importance::ValueType>(importance)));
+			}
+
+			return importances;
+		}
+
+		std::vector<Amount> GenerateRandomBalances(size_t count) {
+			std::vector<Amount> balances;
+			for (auto i = 0u; i < count; ++i)
+				balances.push_back(Amount(test::Random() % (Total_Chain_Balance.microxem().unwrap() / count)));
+
+			return balances;
+		}
+
+		void AssertImportancesMatchOriginalCalculation(size_t numAccounts, uint32_t numThreads) {
+			// Arrange:
+			auto balances = GenerateRandomBalances(numAccounts);
+			auto pPool = test::CreateStartedIoServiceThreadPool(numThreads);
+
+			// Act:
+			std::vector<Importance> importances;
+			CalculatePosImportances(Total_Chain_Balance, balances, importances, pPool.get());
+
+			// Assert:
+			EXPECT_EQ(CalculateExpectedImportances(Total_Chain_Balance, balances), importances)
+					<< "num accounts " << numAccounts << ", num threads " << numThreads;
+		}
+	}
+
+	TEST(TEST_CLASS, NoImportancesAreCalculatedWhenThereAreNoBalances) {
+		// Arrange:
+		std::vector<Importance> importances{ Importance(1), Importance(2) };
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+
+		// Act:
+		CalculatePosImportances(Total_Chain_Balance, {}, importances, pPool.get());
+
+		// Assert:
+		EXPECT_TRUE(importances.empty());
+	}
+
+	TEST(TEST_CLASS, AllImportancesAreZeroWhenAllBalancesAreZero) {
+		// Arrange:
+		std::vector<Importance> importances;
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+
+		// Act:
+		CalculatePosImportances(Total_Chain_Balance, { Amount(), Amount(), Amount() }, importances, pPool.get());
+
+		// Assert:
+		EXPECT_EQ(std::vector<Importance>(3, Importance()), importances);
+	}
+
+	TEST(TEST_CLASS, ImportancesAreProportionalToBalances) {
+		// Arrange:
+		auto balances = std::vector<Amount>{ Amount(1'000'000), Amount(2'000'000), Amount(3'000'000), Amount(4'000'000) };
+
+		auto pPool = test::CreateStartedIoServiceThreadPool(1);
+
+		// Act:
+		std::vector<Importance> importances;
+		CalculatePosImportances(Total_Chain_Balance, balances, importances, pPool.get());
+
+		// Assert:
+		auto expectedImportances = std::vector<Importance>{
+			Importance(900'000'000), Importance(1'800'000'000), Importance(2'700'000'000), Importance(3'600'000'000)
+		};
+		EXPECT_EQ(expectedImportances, importances);
+	}
+
+	TEST(TEST_CLASS, ImportancesAreRoundedDown) {
+		// Arrange:
+		auto balances = std::vector<Amount>{ Amount(1), Amount(1), Amount(1) };
+
+		auto pPool = test::CreateStartedIoServiceThreadPool(1);
+
+		// Act:
+		std::vector<Importance> importances;
+		CalculatePosImportances(Total_Chain_Balance, balances, importances, pPool.get());
+
+		// Assert:
+		EXPECT_EQ(std::vector<Importance>(3, Importance(3'000'000'000)), importances);
+	}
+
+	TEST(TEST_CLASS, ImportancesMatchOriginalCalculationWithoutPool) {
+		for (auto numAccounts : { 1u, 10u, 1000u, 25'000u }) {
+			// Arrange:
+			auto balances = GenerateRandomBalances(numAccounts);
+
+			// Act: importances are calculated on the calling thread
+			std::vector<Importance> importances;
+			CalculatePosImportances(Total_Chain_Balance, balances, importances, nullptr);
+
+			// Assert:
+			EXPECT_EQ(CalculateExpectedImportances(Total_Chain_Balance, balances), importances) << "num accounts " << numAccounts;
+		}
+	}
+
+	TEST(TEST_CLASS, ImportancesMatchOriginalCalculationWhenSingleThreaded) {
+		// Assert:
+		for (auto numAccounts : { 1u, 10u, 1000u, 25'000u })
+			AssertImportancesMatchOriginalCalculation(numAccounts, 1);
+	}
+
+	TEST(TEST_CLASS, ImportancesMatchOriginalCalculationWhenMultiThreaded) {
+		// Assert: small inputs are processed by a single thread and large inputs are partitioned
+		for (auto numAccounts : { 1u, 10u, 1000u, 25'000u, 100'003u })
+			AssertImportancesMatchOriginalCalculation(numAccounts, 4);
+	}
+
+	TEST(TEST_CLASS, ImportancesMatchOriginalCalculationWhenThereAreMoreThreadsThanPartitions) {
+		// Assert:
+		AssertImportancesMatchOriginalCalculation(25'000, 64);
+	}
+}}
@@ -21,6 +21,7 @@
 #include "catapult/subscribers/AggregateStateChangeSubscriber.h"
 #include "catapult/consumers/StateChangeInfo.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/state/CatapultState.h"
 #include "tests/catapult/subscribers/test/AggregateSubscriberTestContext.h"
 #include "tests/catapult/subscribers/test/UnsupportedSubscribers.h"
 #include "tests/test/cache/CacheTestUtils.h"
@@ -86,7 +87,8 @@ namespace catapult { namespace subscribers {
 		auto cache = test::CreateEmptyCatapultCache();
 		auto cacheDelta = cache.createDelta();
 		model::ChainScore scoreDelta;
-		consumers::StateChangeInfo stateChangeInfo(cacheDelta, scoreDelta, Height(444));
+		state::CatapultState state;
+		consumers::StateChangeInfo stateChangeInfo(cacheDelta, scoreDelta, state, Height(444));
 
 		// Sanity:
 		EXPECT_EQ(3u, context.subscribers().size());
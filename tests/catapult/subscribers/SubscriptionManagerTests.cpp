@@ -20,6 +20,8 @@
 
 #include "catapult/subscribers/SubscriptionManager.h"
 #include "catapult/config/LocalNodeConfiguration.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PackedBlockStorage.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/model/ChainScore.h"
 #include "tests/catapult/subscribers/test/UnsupportedSubscribers.h"
@@ -149,6 +151,27 @@ namespace catapult { namespace subscribers {
 		manager.fileStorage();
 	}
 
+	TEST(TEST_CLASS, ManagerUsesFileBlockStorageByDefault) {
+		// Act:
+		auto config = CreateConfiguration();
+		SubscriptionManager manager(config);
+
+		// Assert:
+		EXPECT_TRUE(!!dynamic_cast<io::FileBlockStorage*>(&manager.fileStorage()));
+	}
+
+	TEST(TEST_CLASS, ManagerUsesPackedBlockStorageWhenEnabled) {
+		// Arrange:
+		auto config = CreateConfiguration();
+		const_cast<bool&>(config.Node.ShouldUsePackedBlockStorage) = true;
+
+		// Act:
+		SubscriptionManager manager(config);
+
+		// Assert:
+		EXPECT_TRUE(!!dynamic_cast<io::PackedBlockStorage*>(&manager.fileStorage()));
+	}
+
 	// endregion
 
 	// region single aggregate creation
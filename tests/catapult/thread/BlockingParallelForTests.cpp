@@ -0,0 +1,149 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/BlockingParallelFor.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/exceptions.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+#include <future>
+#include <set>
+#include <thread>
+
+namespace catapult { namespace thread {
+
+#define TEST_CLASS BlockingParallelForTests
+
+	namespace {
+		struct IndexCapture {
+		public:
+			explicit IndexCapture(size_t numItems) : IndexFlags(numItems, 0)
+			{}
+
+		public:
+			// use vector of uint8_t instead of bool because latter does not guarantee that
+			// different elements in the same container can be modified concurrently by different threads
+			std::vector<uint8_t> IndexFlags;
+			std::mutex Mutex;
+			std::set<std::thread::id> ThreadIds;
+		};
+
+		auto CreateIndexCaptureCallback(IndexCapture& capture) {
+			return [&capture](auto index) {
+				++capture.IndexFlags[index];
+
+				std::lock_guard<std::mutex> guard(capture.Mutex);
+				capture.ThreadIds.insert(std::this_thread::get_id());
+			};
+		}
+
+		void AssertAllIndexesProcessedOnce(const IndexCapture& capture) {
+			for (auto i = 0u; i < capture.IndexFlags.size(); ++i)
+				EXPECT_EQ(1u, capture.IndexFlags[i]) << "index " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CallbackIsNotCalledWhenThereAreNoItems) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+
+		// Act:
+		auto numCalls = 0u;
+		BlockingParallelFor(pPool->service(), pPool->numWorkerThreads(), 0, [&numCalls](auto) { ++numCalls; });
+
+		// Assert:
+		EXPECT_EQ(0u, numCalls);
+	}
+
+	TEST(TEST_CLASS, CallbackIsCalledOnceForEachIndex) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+		IndexCapture capture(1000);
+
+		// Act:
+		BlockingParallelFor(pPool->service(), pPool->numWorkerThreads(), 1000, CreateIndexCaptureCallback(capture));
+
+		// Assert:
+		AssertAllIndexesProcessedOnce(capture);
+	}
+
+	TEST(TEST_CLASS, IndexesCanBeProcessedByMultipleThreads) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+		IndexCapture capture(100);
+		auto callback = CreateIndexCaptureCallback(capture);
+
+		// Act: make each call slow so that workers are able to claim indexes
+		BlockingParallelFor(pPool->service(), 4, 100, [&callback](auto index) {
+			test::Sleep(1);
+			callback(index);
+		});
+
+		// Assert:
+		AssertAllIndexesProcessedOnce(capture);
+		EXPECT_LT(1u, capture.ThreadIds.size());
+	}
+
+	TEST(TEST_CLASS, CallingThreadProcessesAllIndexesWhenServiceIsNotRunning) {
+		// Arrange:
+		boost::asio::io_service service;
+		IndexCapture capture(100);
+
+		// Act:
+		BlockingParallelFor(service, 4, 100, CreateIndexCaptureCallback(capture));
+
+		// Assert:
+		AssertAllIndexesProcessedOnce(capture);
+		EXPECT_EQ(std::set<std::thread::id>({ std::this_thread::get_id() }), capture.ThreadIds);
+	}
+
+	TEST(TEST_CLASS, CanBeCalledFromThreadBackingService) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool(1);
+		IndexCapture capture(100);
+
+		// Act: all pool threads are busy, so the nested call needs to complete without any help from the pool
+		std::promise<void> promise;
+		pPool->service().post([&service = pPool->service(), &capture, &promise]() {
+			BlockingParallelFor(service, 1, 100, CreateIndexCaptureCallback(capture));
+			promise.set_value();
+		});
+		promise.get_future().get();
+
+		// Assert:
+		AssertAllIndexesProcessedOnce(capture);
+	}
+
+	TEST(TEST_CLASS, CallbackExceptionIsRethrownAfterAllIndexesAreProcessed) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+		IndexCapture capture(100);
+		auto callback = CreateIndexCaptureCallback(capture);
+
+		// Act + Assert:
+		EXPECT_THROW(BlockingParallelFor(pPool->service(), pPool->numWorkerThreads(), 100, [&callback](auto index) {
+			callback(index);
+			if (50 == index)
+				CATAPULT_THROW_RUNTIME_ERROR("callback exception");
+		}), catapult_runtime_error);
+
+		AssertAllIndexesProcessedOnce(capture);
+	}
+}}
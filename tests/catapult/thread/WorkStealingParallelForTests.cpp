@@ -0,0 +1,365 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/WorkStealingParallelFor.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+#include <list>
+#include <numeric>
+#include <thread>
+
+namespace catapult { namespace thread {
+
+#define TEST_CLASS WorkStealingParallelForTests
+
+	namespace {
+		using ItemType = uint32_t;
+
+		std::vector<ItemType> CreateIncrementingValues(size_t size) {
+			auto items = std::vector<ItemType>(size);
+			std::iota(items.begin(), items.end(), static_cast<ItemType>(1));
+			return items;
+		}
+
+		template<typename TContainer>
+		struct BasicTestContext {
+		public:
+			explicit BasicTestContext(size_t numItemsAdjustment = 0)
+					: pPool(test::CreateStartedIoServiceThreadPool())
+					, NumThreads(pPool->numWorkerThreads())
+					, NumItems(NumThreads * 5 + numItemsAdjustment)
+					, ItemsSum((NumItems * (NumItems + 1)) / 2) {
+				auto seedItems = CreateIncrementingValues(NumItems);
+				std::copy(seedItems.cbegin(), seedItems.cend(), std::back_inserter(Items));
+			}
+
+		public:
+			std::unique_ptr<thread::IoServiceThreadPool> pPool;
+			size_t NumThreads;
+			size_t NumItems;
+			size_t ItemsSum;
+			TContainer Items;
+		};
+
+		struct VectorTraits {
+			using ContainerType = std::vector<ItemType>;
+		};
+
+		struct ListTraits {
+			using ContainerType = std::list<ItemType>;
+		};
+	}
+
+#define CONTAINER_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Vector) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<VectorTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_List) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ListTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region WorkStealingParallelForPartition
+
+	CONTAINER_TEST(CanProcessChunksConcurrently_ZeroItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelForPartition(context.pPool->service(), items, context.NumThreads, 3, [&counter](auto, auto, auto, auto) {
+			++counter;
+		}).get();
+
+		// Assert: the chunk callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	namespace {
+		struct ChunkAggregateCapture {
+		public:
+			explicit ChunkAggregateCapture(size_t numItems, size_t numChunks)
+					: Sum(0)
+					, IndexFlags(numItems, 0)
+					, ChunkIndexFlags(numChunks, 0)
+					, ChunkSizes(numChunks, 0)
+			{}
+
+		public:
+			std::atomic<size_t> Sum;
+
+			// use vector of uint8_t instead of bool because latter does not guarantee that
+			// different elements in the same container can be modified concurrently by different threads
+			std::vector<uint8_t> IndexFlags;
+			std::vector<uint8_t> ChunkIndexFlags;
+			std::vector<size_t> ChunkSizes;
+		};
+
+		auto CreateChunkAggregate(ChunkAggregateCapture& capture) {
+			return [&capture](auto itBegin, auto itEnd, auto startIndex, auto chunkIndex) {
+				// Sanity: fail if any index is too large
+				ASSERT_GT(capture.IndexFlags.size(), startIndex) << "unexpected start index " << startIndex;
+				ASSERT_GT(capture.ChunkIndexFlags.size(), chunkIndex) << "unexpected chunk index " << chunkIndex;
+
+				// Act:
+				++capture.ChunkIndexFlags[chunkIndex];
+				for (auto iter = itBegin; itEnd != iter; ++iter) {
+					++capture.ChunkSizes[chunkIndex];
+					++capture.IndexFlags[startIndex++]; // use start index to visit all items
+					capture.Sum += *iter;
+				}
+			};
+		}
+
+		template<typename TTraits>
+		void AssertCanProcessChunksConcurrently(int numItemsAdjustment, size_t chunkSize) {
+			// Arrange:
+			BasicTestContext<typename TTraits::ContainerType> context(static_cast<size_t>(numItemsAdjustment));
+			auto numChunks = (context.NumItems + chunkSize - 1) / chunkSize;
+
+			// Act:
+			ChunkAggregateCapture capture(context.NumItems, numChunks);
+			WorkStealingParallelForPartition(
+					context.pPool->service(),
+					context.Items,
+					context.NumThreads,
+					chunkSize,
+					CreateChunkAggregate(capture)).get();
+
+			// Assert: all items and chunks were visited exactly once
+			EXPECT_EQ(context.ItemsSum, capture.Sum);
+			EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), capture.IndexFlags);
+			EXPECT_EQ(std::vector<uint8_t>(numChunks, 1), capture.ChunkIndexFlags);
+
+			// - all chunks except for the last one are full
+			for (auto i = 0u; i < numChunks - 1; ++i)
+				EXPECT_EQ(chunkSize, capture.ChunkSizes[i]) << "chunk " << i;
+
+			EXPECT_EQ(context.NumItems - (numChunks - 1) * chunkSize, capture.ChunkSizes.back());
+		}
+	}
+
+	CONTAINER_TEST(CanProcessChunksConcurrently_OneItem) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType{ 7 };
+
+		// Act:
+		ChunkAggregateCapture capture(1, 1);
+		WorkStealingParallelForPartition(context.pPool->service(), items, context.NumThreads, 3, CreateChunkAggregate(capture)).get();
+
+		// Assert: the callback was only called once (since there is only one item)
+		EXPECT_EQ(7u, capture.Sum);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), capture.IndexFlags);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), capture.ChunkIndexFlags);
+	}
+
+	CONTAINER_TEST(CanProcessChunksConcurrently_SingleItemChunks) {
+		// Assert:
+		AssertCanProcessChunksConcurrently<TTraits>(0, 1);
+	}
+
+	CONTAINER_TEST(CanProcessChunksConcurrently_MultiItemChunks_MinusOne) {
+		// Assert:
+		AssertCanProcessChunksConcurrently<TTraits>(-1, 3);
+	}
+
+	CONTAINER_TEST(CanProcessChunksConcurrently_MultiItemChunks) {
+		// Assert:
+		AssertCanProcessChunksConcurrently<TTraits>(0, 3);
+	}
+
+	CONTAINER_TEST(CanProcessChunksConcurrently_MultiItemChunks_PlusOne) {
+		// Assert:
+		AssertCanProcessChunksConcurrently<TTraits>(1, 3);
+	}
+
+	CONTAINER_TEST(CanProcessChunksConcurrently_SingleChunk) {
+		// Assert:
+		AssertCanProcessChunksConcurrently<TTraits>(0, 10000);
+	}
+
+	CONTAINER_TEST(CanProcessChunksWithZeroWorkers) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		ChunkAggregateCapture capture(context.NumItems, context.NumItems);
+		WorkStealingParallelForPartition(context.pPool->service(), context.Items, 0, 1, CreateChunkAggregate(capture)).get();
+
+		// Assert: zero workers is treated as a single worker
+		EXPECT_EQ(context.ItemsSum, capture.Sum);
+		EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), capture.IndexFlags);
+	}
+
+	TEST(TEST_CLASS, IdleWorkersStealChunksFromBusyWorkers) {
+		// Arrange: the first worker initially owns chunks [0, 8) and blocks on the first chunk
+		BasicTestContext<std::vector<ItemType>> context;
+		if (context.NumThreads < 2)
+			return;
+
+		auto numChunks = 8 * context.NumThreads;
+		auto items = CreateIncrementingValues(numChunks);
+		std::atomic_bool isBlocked(true);
+		std::atomic<size_t> numProcessedChunks(0);
+
+		// Act:
+		auto future = WorkStealingParallelForPartition(context.pPool->service(), items, context.NumThreads, 1, [&](
+				auto,
+				auto,
+				auto,
+				auto chunkIndex) {
+			if (0 == chunkIndex) {
+				while (isBlocked)
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			++numProcessedChunks;
+		});
+
+		// - all other chunks (including ones originally owned by the blocked worker) should be processed while it is blocked
+		WAIT_FOR_VALUE_EXPR(numChunks - 1, numProcessedChunks.load());
+		isBlocked = false;
+		future.get();
+
+		// Assert:
+		EXPECT_EQ(numChunks, numProcessedChunks);
+	}
+
+	// endregion
+
+	// region WorkStealingParallelFor
+
+	namespace {
+		auto CreateItemAggregate(std::atomic<size_t>& sum, std::vector<uint8_t>& indexFlags) {
+			return [&sum, &indexFlags](auto value, auto index) {
+				// Sanity: fail if any index is too large
+				EXPECT_GT(indexFlags.size(), index) << "unexpected index " << index;
+				if (indexFlags.size() <= index)
+					return false;
+
+				sum += value;
+				++indexFlags[index];
+				return true;
+			};
+		}
+
+		template<typename TTraits>
+		void AssertCanProcessMultipleItemsConcurrently(int numItemsAdjustment) {
+			// Arrange:
+			BasicTestContext<typename TTraits::ContainerType> context(static_cast<size_t>(numItemsAdjustment));
+
+			// Act:
+			std::atomic<size_t> sum(0);
+			std::vector<uint8_t> indexFlags(context.NumItems, 0);
+			WorkStealingParallelFor(context.pPool->service(), context.Items, context.NumThreads, CreateItemAggregate(sum, indexFlags)).get();
+
+			// Assert:
+			EXPECT_EQ(context.ItemsSum, sum);
+			EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+		}
+	}
+
+	CONTAINER_TEST(CanProcessMultipleItemsConcurrently_ZeroItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelFor(context.pPool->service(), items, context.NumThreads, [&counter](auto, auto) {
+			++counter;
+			return true;
+		}).get();
+
+		// Assert: the item callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	CONTAINER_TEST(CanProcessMultipleItemsConcurrently_MinusOne) {
+		// Assert:
+		AssertCanProcessMultipleItemsConcurrently<TTraits>(-1);
+	}
+
+	CONTAINER_TEST(CanProcessMultipleItemsConcurrently) {
+		// Assert:
+		AssertCanProcessMultipleItemsConcurrently<TTraits>(0);
+	}
+
+	CONTAINER_TEST(CanProcessMultipleItemsConcurrently_PlusOne) {
+		// Assert:
+		AssertCanProcessMultipleItemsConcurrently<TTraits>(1);
+	}
+
+	CONTAINER_TEST(CanShortCircuitItemProcessing) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: abort after the first item
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelFor(context.pPool->service(), context.Items, context.NumThreads, [&counter](auto, auto) {
+			++counter;
+			return false;
+		}).get();
+
+		// Assert: each worker processes at most one item before noticing the abort
+		EXPECT_LE(1u, counter);
+		EXPECT_GE(context.NumThreads, counter);
+	}
+
+	CONTAINER_TEST(CanModifyMultipleItemsConcurrently) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		WorkStealingParallelFor(context.pPool->service(), context.Items, context.NumThreads, [](auto& value, auto) {
+			value = value * value + 1;
+			return true;
+		}).get();
+
+		// Assert: all values should have been modified
+		auto i = 1u;
+		for (auto value : context.Items) {
+			EXPECT_EQ(i * i + 1u, value) << "item at " << i;
+			++i;
+		}
+	}
+
+	CONTAINER_TEST(CorrectIndexesAreAssociatedWithItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: capture all values by their index
+		std::vector<uint32_t> capturedValues(context.NumItems, 0);
+		WorkStealingParallelFor(context.pPool->service(), context.Items, context.NumThreads, [&capturedValues](auto value, auto index) {
+			// Sanity: fail if any index is too large
+			EXPECT_GT(capturedValues.size(), index) << "unexpected index " << index;
+			if (capturedValues.size() <= index)
+				return false;
+
+			capturedValues[index] = value;
+			return true;
+		}).get();
+
+		// Assert: values start at 1
+		for (auto i = 0u; i < capturedValues.size(); ++i)
+			EXPECT_EQ(i + 1, capturedValues[i]) << "i " << i;
+	}
+
+	// endregion
+}}
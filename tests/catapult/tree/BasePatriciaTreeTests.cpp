@@ -622,6 +622,33 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(expectedRoot, pDeltaTree->root());
 	}
 
+	TEST(TEST_CLASS, CanApplyChangeSet) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		auto pDeltaTree = tree.rebase();
+		MemoryBasePatriciaTree::DeltaType::ChangeSet changeSet;
+		changeSet.set(0x64'6F'67'00, "kitten");
+		changeSet.unset(0x64'6F'67'65);
+		changeSet.set(0x68'6F'72'00, "pony");
+		pDeltaTree->applyChanges(changeSet);
+		tree.commit();
+
+		// Assert:
+		auto expectedRoot = CalculateRootHash({
+			{ 0x64'6F'00'00, "verb" },
+			{ 0x64'6F'67'00, "kitten" },
+			{ 0x68'6F'72'00, "pony" },
+			{ 0x68'6F'72'73, "stallion" }
+		});
+
+		EXPECT_EQ(expectedRoot, tree.root());
+		EXPECT_EQ(expectedRoot, pDeltaTree->root());
+	}
+
 	// endregion
 
 	// region custom hasher
@@ -0,0 +1,267 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/PatriciaTreeMultiproof.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "catapult/tree/PatriciaTreeSerializer.h"
+#include "tests/catapult/tree/test/PassThroughEncoder.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS PatriciaTreeMultiproofTests
+
+	namespace {
+		using MemoryPatriciaTree = PatriciaTree<test::PassThroughEncoder, MemoryDataSource>;
+
+		class TestContext {
+		public:
+			TestContext() : m_tree(m_dataSource) {
+				// root branch (6) links to nested branch (6F) [alpha, beta, gamma] and delta leaf
+				// nested branch (6F) links to alpha leaf and nested branch (7) [beta, gamma]
+				m_tree.set(0x64'6F'72'73, "alpha");
+				m_tree.set(0x64'6F'67'67, "beta");
+				m_tree.set(0x64'6F'67'00, "gamma");
+				m_tree.set(0x68'6F'72'73, "delta");
+			}
+
+		public:
+			Hash256 root() const {
+				return m_tree.root();
+			}
+
+			std::vector<TreeNode> lookup(uint32_t key) const {
+				std::vector<TreeNode> nodePath;
+				m_tree.lookup(key, nodePath);
+				return nodePath;
+			}
+
+			std::vector<uint8_t> buildProof(const std::vector<uint32_t>& keys) const {
+				PatriciaTreeMultiproofBuilder builder;
+				for (auto key : keys)
+					builder.add(lookup(key));
+
+				return builder.serializedProof();
+			}
+
+		private:
+			MemoryDataSource m_dataSource;
+			MemoryPatriciaTree m_tree;
+		};
+
+		size_t CalculateSerializedSize(const TreeNode& node) {
+			return PatriciaTreeSerializer::SerializeValue(node).size();
+		}
+
+		size_t CalculateSerializedSize(const std::vector<TreeNode>& nodes) {
+			size_t size = 0;
+			for (const auto& node : nodes)
+				size += CalculateSerializedSize(node);
+
+			return size;
+		}
+
+		Hash256 HashValue(const std::string& value) {
+			return test::PassThroughEncoder::EncodeValue(value);
+		}
+
+		void AssertFound(const PatriciaTreeMultiproof& proof, const Hash256& root, uint32_t key, const std::string& value) {
+			Hash256 valueHash;
+			auto result = proof.lookup(root, TreeNodePath(key), valueHash);
+			EXPECT_EQ(MultiproofLookupResult::Found, result) << utils::HexFormat(key);
+			EXPECT_EQ(HashValue(value), valueHash) << utils::HexFormat(key);
+		}
+
+		void AssertLookupResult(
+				MultiproofLookupResult expectedResult,
+				const PatriciaTreeMultiproof& proof,
+				const Hash256& root,
+				uint32_t key) {
+			Hash256 valueHash;
+			auto result = proof.lookup(root, TreeNodePath(key), valueHash);
+			EXPECT_EQ(expectedResult, result) << utils::HexFormat(key);
+		}
+	}
+
+	// region PatriciaTreeMultiproofBuilder
+
+	TEST(TEST_CLASS, BuilderIsInitiallyEmpty) {
+		// Act:
+		PatriciaTreeMultiproofBuilder builder;
+
+		// Assert:
+		EXPECT_EQ(0u, builder.size());
+		EXPECT_TRUE(builder.serializedProof().empty());
+	}
+
+	TEST(TEST_CLASS, BuilderSerializesAllNodesOfSinglePath) {
+		// Arrange:
+		TestContext context;
+		auto nodePath = context.lookup(0x64'6F'67'67);
+		PatriciaTreeMultiproofBuilder builder;
+
+		// Act:
+		builder.add(nodePath);
+
+		// Assert: root branch, two nested branches and leaf
+		ASSERT_EQ(4u, nodePath.size());
+		EXPECT_EQ(4u, builder.size());
+
+		std::vector<uint8_t> expectedProof;
+		for (const auto& node : nodePath) {
+			auto serializedNode = PatriciaTreeSerializer::SerializeValue(node);
+			expectedProof.insert(expectedProof.end(), serializedNode.cbegin(), serializedNode.cend());
+		}
+
+		EXPECT_EQ(expectedProof, builder.serializedProof());
+	}
+
+	TEST(TEST_CLASS, BuilderIncludesSharedNodesOnlyOnce) {
+		// Arrange:
+		TestContext context;
+		auto betaPath = context.lookup(0x64'6F'67'67);
+		auto gammaPath = context.lookup(0x64'6F'67'00);
+		PatriciaTreeMultiproofBuilder builder;
+
+		// Act:
+		builder.add(betaPath);
+		builder.add(gammaPath);
+		builder.add(betaPath);
+
+		// Assert: beta and gamma share all nodes except for their leaves
+		ASSERT_EQ(betaPath.size(), gammaPath.size());
+		EXPECT_EQ(betaPath.size() + 1, builder.size());
+		EXPECT_EQ(CalculateSerializedSize(betaPath) + CalculateSerializedSize(gammaPath.back()), builder.serializedProof().size());
+	}
+
+	// endregion
+
+	// region PatriciaTreeMultiproof - parsing
+
+	TEST(TEST_CLASS, CanParseEmptyProof) {
+		// Act:
+		PatriciaTreeMultiproof proof(RawBuffer{});
+
+		// Assert:
+		EXPECT_EQ(0u, proof.size());
+	}
+
+	TEST(TEST_CLASS, CanParseProofWithMultipleNodes) {
+		// Arrange:
+		TestContext context;
+		auto serializedProof = context.buildProof({ 0x64'6F'67'67, 0x64'6F'67'00, 0x68'6F'72'73 });
+
+		// Act:
+		PatriciaTreeMultiproof proof(serializedProof);
+
+		// Assert: root branch, two nested branches and three leaves
+		EXPECT_EQ(6u, proof.size());
+	}
+
+	TEST(TEST_CLASS, CannotParseTruncatedProof) {
+		// Arrange:
+		TestContext context;
+		auto serializedProof = context.buildProof({ 0x64'6F'67'67 });
+
+		// Act + Assert: check truncation within every part of the last (leaf) node
+		for (auto size : { 1u, 2u, 10u, 33u, 34u }) {
+			auto truncatedProof = serializedProof;
+			truncatedProof.resize(truncatedProof.size() - size);
+			EXPECT_THROW(PatriciaTreeMultiproof proof(truncatedProof), catapult_invalid_argument) << size;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotParseProofWithInvalidNodeMarker) {
+		// Arrange:
+		TestContext context;
+		auto serializedProof = context.buildProof({ 0x64'6F'67'67 });
+		serializedProof[0] = 0x12;
+
+		// Act + Assert:
+		EXPECT_THROW(PatriciaTreeMultiproof proof(serializedProof), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region PatriciaTreeMultiproof - lookup
+
+	TEST(TEST_CLASS, LookupProvesKeysInTree) {
+		// Arrange:
+		TestContext context;
+		PatriciaTreeMultiproof proof(context.buildProof({ 0x64'6F'72'73, 0x64'6F'67'67, 0x68'6F'72'73 }));
+
+		// Act + Assert:
+		AssertFound(proof, context.root(), 0x64'6F'72'73, "alpha");
+		AssertFound(proof, context.root(), 0x64'6F'67'67, "beta");
+		AssertFound(proof, context.root(), 0x68'6F'72'73, "delta");
+	}
+
+	TEST(TEST_CLASS, LookupProvesKeysNotInTree) {
+		// Arrange: keys diverging at root path, root link, nested branch path, nested branch link and leaf path
+		TestContext context;
+		std::vector<uint32_t> keys{ 0x74'6F'72'73, 0x60'6F'72'73, 0x64'6E'72'73, 0x64'6F'12'73, 0x64'6F'67'68 };
+		PatriciaTreeMultiproof proof(context.buildProof(keys));
+
+		// Act + Assert:
+		for (auto key : keys)
+			AssertLookupResult(MultiproofLookupResult::Not_Found, proof, context.root(), key);
+	}
+
+	TEST(TEST_CLASS, LookupProvesNoKeysInEmptyTree) {
+		// Arrange:
+		PatriciaTreeMultiproof proof(RawBuffer{});
+
+		// Act + Assert:
+		AssertLookupResult(MultiproofLookupResult::Not_Found, proof, Hash256(), 0x64'6F'72'73);
+	}
+
+	TEST(TEST_CLASS, LookupIsIncompleteWhenProofDoesNotContainAllNodesOnKeyPath) {
+		// Arrange: gamma shares branches with beta but not the leaf; delta shares only the root
+		TestContext context;
+		PatriciaTreeMultiproof proof(context.buildProof({ 0x64'6F'67'67 }));
+
+		// Act + Assert:
+		AssertLookupResult(MultiproofLookupResult::Incomplete, proof, context.root(), 0x64'6F'67'00);
+		AssertLookupResult(MultiproofLookupResult::Incomplete, proof, context.root(), 0x68'6F'72'73);
+	}
+
+	TEST(TEST_CLASS, LookupIsIncompleteWhenRootHashIsNotInProof) {
+		// Arrange:
+		TestContext context;
+		PatriciaTreeMultiproof proof(context.buildProof({ 0x64'6F'67'67 }));
+
+		// Act + Assert: proof nodes are only trusted when they are linked from the root hash
+		AssertLookupResult(MultiproofLookupResult::Incomplete, proof, test::GenerateRandomData<Hash256_Size>(), 0x64'6F'67'67);
+	}
+
+	TEST(TEST_CLASS, LookupIsIncompleteWhenProofNodeIsModified) {
+		// Arrange: modify the value of the beta leaf (last node in proof)
+		TestContext context;
+		auto serializedProof = context.buildProof({ 0x64'6F'67'67 });
+		serializedProof.back() ^= 0xFF;
+		PatriciaTreeMultiproof proof(serializedProof);
+
+		// Act + Assert: modified node hash is not linked from its parent
+		AssertLookupResult(MultiproofLookupResult::Incomplete, proof, context.root(), 0x64'6F'67'67);
+	}
+
+	// endregion
+}}
@@ -27,7 +27,8 @@ namespace catapult { namespace tree {
 #define TEST_CLASS TreeNodePathTests
 
 	namespace {
-		void AssertPath(const TreeNodePath& path, size_t expectedSize, std::initializer_list<uint8_t> expectedNibbles) {
+		template<typename TPath>
+		void AssertPath(const TPath& path, size_t expectedSize, std::initializer_list<uint8_t> expectedNibbles) {
 			// Assert:
 			EXPECT_EQ(0 == expectedSize, path.empty());
 			ASSERT_EQ(expectedSize, path.size());
@@ -74,6 +75,49 @@ namespace catapult { namespace tree {
 		AssertPath(path, 8, { 1, 2, 0xC, 0, 5, 4, 3, 7 });
 	}
 
+	namespace {
+		std::vector<uint8_t> GenerateLargeKey() {
+			// generate a key that is too large to be stored inline
+			std::vector<uint8_t> key(TreeNodePath::Max_Inline_Nibbles / 2 + 3);
+			for (auto i = 0u; i < key.size(); ++i)
+				key[i] = static_cast<uint8_t>(0x10 * (i % 16) + (15 - i % 16));
+
+			return key;
+		}
+
+		void AssertLargeKeyNibbles(const TreeNodePath& path, size_t offset) {
+			for (auto i = 0u; i < path.size(); ++i) {
+				auto keyIndex = (offset + i) / 2;
+				auto expectedNibble = 0 == (offset + i) % 2 ? keyIndex % 16 : 15 - keyIndex % 16;
+				EXPECT_EQ(expectedNibble, path.nibbleAt(i)) << "nibble at index " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreatePathAroundKeyLargerThanInlinePath) {
+		// Act:
+		auto key = GenerateLargeKey();
+		TreeNodePath path(key);
+
+		// Assert:
+		ASSERT_EQ(2 * key.size(), path.size());
+		AssertLargeKeyNibbles(path, 0);
+	}
+
+	TEST(TEST_CLASS, CanCopyPathLargerThanInlinePath) {
+		// Arrange:
+		auto key = GenerateLargeKey();
+		TreeNodePath path(key);
+
+		// Act:
+		auto pathCopy = path;
+
+		// Assert:
+		EXPECT_EQ(path, pathCopy);
+		ASSERT_EQ(2 * key.size(), pathCopy.size());
+		AssertLargeKeyNibbles(pathCopy, 0);
+	}
+
 	// endregion
 
 	// region equality
@@ -180,6 +224,23 @@ namespace catapult { namespace tree {
 		AssertPath(subpath, 4, { 2, 0xC, 0, 5 });
 	}
 
+	TEST(TEST_CLASS, CanCreateSubpathsOfPathLargerThanInlinePath) {
+		// Arrange:
+		auto key = GenerateLargeKey();
+		TreeNodePath path(key);
+
+		// Act: create a subpath that fits inline and one that does not
+		auto inlineSubpath = path.subpath(7, TreeNodePath::Max_Inline_Nibbles - 1);
+		auto largeSubpath = path.subpath(3);
+
+		// Assert:
+		ASSERT_EQ(TreeNodePath::Max_Inline_Nibbles - 1, inlineSubpath.size());
+		AssertLargeKeyNibbles(inlineSubpath, 7);
+
+		ASSERT_EQ(2 * key.size() - 3, largeSubpath.size());
+		AssertLargeKeyNibbles(largeSubpath, 3);
+	}
+
 	TEST(TEST_CLASS, CanTakeMultipleSubpaths) {
 		// Act:
 		TreeNodePath path(static_cast<uint32_t>(0x01234596));
@@ -198,6 +259,92 @@ namespace catapult { namespace tree {
 
 	// endregion
 
+	// region TreeNodePathView
+
+	TEST(TEST_CLASS, CanCreateViewOfEmptyPath) {
+		// Act:
+		TreeNodePath path;
+		TreeNodePathView view(path);
+
+		// Assert:
+		AssertPath(view, 0, {});
+	}
+
+	TEST(TEST_CLASS, CanCreateViewOfPath) {
+		// Act:
+		TreeNodePath path(static_cast<uint32_t>(0x12C05437));
+		TreeNodePathView view(path);
+
+		// Assert:
+		AssertPath(view, 8, { 1, 2, 0xC, 0, 5, 4, 3, 7 });
+	}
+
+	TEST(TEST_CLASS, CanCreateViewOfPathWithOddOffset) {
+		// Act:
+		TreeNodePath path(static_cast<uint32_t>(0x12C05437));
+		auto subpath = path.subpath(3, 4);
+		TreeNodePathView view(subpath);
+
+		// Assert:
+		AssertPath(view, 4, { 0, 5, 4, 3 });
+	}
+
+	TEST(TEST_CLASS, CanTakeMultipleSubpathViews) {
+		// Act:
+		TreeNodePath path(static_cast<uint32_t>(0x01234596));
+		auto view1 = TreeNodePathView(path).subpath(1);
+		auto view2 = view1.subpath(1);
+		auto view3 = view2.subpath(1, 3);
+		auto view4 = view3.subpath(1);
+
+		// Assert:
+		AssertPath(view1, 7, { 1, 2, 3, 4, 5, 9, 6 });
+		AssertPath(view2, 6, { 2, 3, 4, 5, 9, 6 });
+		AssertPath(view3, 3, { 3, 4, 5 });
+		AssertPath(view4, 2, { 4, 5 });
+	}
+
+	TEST(TEST_CLASS, CanTakeSubpathViewsOfPathLargerThanInlinePath) {
+		// Act:
+		std::vector<uint8_t> key{ 0x12, 0x34, 0x56, 0x78 };
+		key.resize(TreeNodePath::Max_Inline_Nibbles);
+		key.back() = 0x9A;
+		TreeNodePath path(key);
+		auto view = TreeNodePathView(path).subpath(2 * TreeNodePath::Max_Inline_Nibbles - 3);
+
+		// Assert:
+		AssertPath(view, 3, { 0, 9, 0xA });
+	}
+
+	TEST(TEST_CLASS, ViewsAreEqualWhenViewedNibblesAreEqual) {
+		// Arrange:
+		TreeNodePath path1(static_cast<uint32_t>(0x12345634));
+		TreeNodePath path2(static_cast<uint16_t>(0x3456));
+		auto view = TreeNodePathView(path1).subpath(2, 4);
+
+		// Act + Assert:
+		EXPECT_TRUE(view == path2);
+		EXPECT_FALSE(view != path2);
+		EXPECT_TRUE(view.subpath(2) == TreeNodePathView(path1).subpath(4, 2));
+		EXPECT_FALSE(view == TreeNodePathView(path1).subpath(3, 4));
+		EXPECT_TRUE(view != TreeNodePathView(path1).subpath(2, 3));
+	}
+
+	TEST(TEST_CLASS, CanCreatePathFromView) {
+		// Arrange:
+		TreeNodePath path(static_cast<uint32_t>(0x12C05437));
+		auto view = TreeNodePathView(path).subpath(1).subpath(2, 5);
+
+		// Act:
+		TreeNodePath copy(view);
+
+		// Assert:
+		AssertPath(copy, 5, { 0, 5, 4, 3, 7 });
+		EXPECT_EQ(path.subpath(3), copy);
+	}
+
+	// endregion
+
 	// region Join
 
 	TEST(TEST_CLASS, CanJoinTwoEvenLengthPaths) {
@@ -284,6 +431,19 @@ namespace catapult { namespace tree {
 		AssertPath(joinedPath2, 12, { 4, 3, 7, 0xE, 0, 1, 2, 3, 4, 5, 9, 6 });
 	}
 
+	TEST(TEST_CLASS, CanJoinPathsIntoPathLargerThanInlinePath) {
+		// Arrange:
+		auto key = GenerateLargeKey();
+		TreeNodePath path(key);
+
+		// Act:
+		auto joinedPath = TreeNodePath::Join(path.subpath(0, 40), path.nibbleAt(40), path.subpath(41));
+
+		// Assert:
+		ASSERT_EQ(2 * key.size(), joinedPath.size());
+		AssertLargeKeyNibbles(joinedPath, 0);
+	}
+
 	// endregion
 
 	// region insertion operator
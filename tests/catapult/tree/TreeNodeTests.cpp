@@ -81,6 +81,23 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(expectedHash, node.hash());
 	}
 
+	TEST(TEST_CLASS, CanCreateLeafNodeWithPathLargerThanInlinePath) {
+		// Act:
+		auto key = test::GenerateRandomData<TreeNodePath::Max_Inline_Nibbles / 2 + 3>();
+		auto path = TreeNodePath(key);
+		auto value = test::GenerateRandomData<Hash256_Size>();
+		auto node = LeafTreeNode(path, value);
+
+		// Assert:
+		EXPECT_EQ(path, node.path());
+		EXPECT_EQ(value, node.value());
+
+		std::vector<uint8_t> encodedPath{ 0x20 };
+		encodedPath.insert(encodedPath.end(), key.cbegin(), key.cend());
+		auto expectedHash = CalculateLeafNodeHash(encodedPath, value);
+		EXPECT_EQ(expectedHash, node.hash());
+	}
+
 	// endregion
 
 	// region BranchTreeNode - helpers
@@ -105,6 +122,7 @@ namespace catapult { namespace tree {
 			EXPECT_TRUE(node.hasLink(index)) << message;
 			EXPECT_EQ(expectedLink, node.link(index)) << message;
 			EXPECT_FALSE(!!node.linkedNode(index)) << message;
+			EXPECT_FALSE(!!node.sharedLinkedNode(index)) << message;
 		}
 
 		void AssertNodeLink(const BranchTreeNode& node, size_t index, const Hash256& expectedLink) {
@@ -113,6 +131,8 @@ namespace catapult { namespace tree {
 			EXPECT_EQ(expectedLink, node.link(index)) << message;
 			ASSERT_TRUE(!!node.linkedNode(index)) << message;
 			EXPECT_EQ(expectedLink, node.linkedNode(index)->hash()) << message;
+			ASSERT_TRUE(!!node.sharedLinkedNode(index)) << message;
+			EXPECT_EQ(expectedLink, node.sharedLinkedNode(index)->hash()) << message;
 		}
 
 		void AssertEmptyLinks(const BranchTreeNode& node, size_t start, size_t end) {
@@ -121,6 +141,7 @@ namespace catapult { namespace tree {
 				EXPECT_FALSE(node.hasLink(i)) << message;
 				EXPECT_EQ(Hash256(), node.link(i)) << message;
 				EXPECT_FALSE(!!node.linkedNode(i)) << message;
+				EXPECT_FALSE(!!node.sharedLinkedNode(i)) << message;
 			}
 		}
 
@@ -432,6 +453,86 @@ namespace catapult { namespace tree {
 		AssertHighestLinkIndex(15, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 });
 	}
 
+	TEST(TEST_CLASS, BranchTreeNodeForEachLinkedNodeVisitsOnlyNodeLinks) {
+		// Arrange:
+		auto nodeLinks = NodeLinkTraits::GenerateLinks(2);
+		auto hashLinks = HashLinkTraits::GenerateLinks(1);
+		auto node = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+		node.setLink(nodeLinks[0], 3);
+		node.setLink(hashLinks[0], 7);
+		node.setLink(nodeLinks[1], 11);
+
+		// Act:
+		std::vector<Hash256> linkedNodeHashes;
+		node.forEachLinkedNode([&linkedNodeHashes](const auto& linkedNode) {
+			linkedNodeHashes.push_back(linkedNode.hash());
+		});
+
+		// Assert: linked nodes are visited in link order
+		EXPECT_EQ(std::vector<Hash256>({ nodeLinks[0].hash(), nodeLinks[1].hash() }), linkedNodeHashes);
+	}
+
+	TEST(TEST_CLASS, BranchTreeNodeForEachLinkedNodeVisitsLinkedNodesInPlace) {
+		// Arrange:
+		auto childNode = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+		childNode.setLink(test::GenerateRandomData<Hash256_Size>(), 2);
+
+		auto node = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+		node.setLink(TreeNode(childNode), 3);
+
+		// Act:
+		std::vector<const TreeNode*> linkedNodes;
+		node.forEachLinkedNode([&linkedNodes](const auto& linkedNode) {
+			linkedNodes.push_back(&linkedNode);
+		});
+
+		// Assert: the visited node is the linked node (and not a copy)
+		ASSERT_EQ(1u, linkedNodes.size());
+		auto pLinkedNodeCopy = node.linkedNode(3);
+		EXPECT_NE(pLinkedNodeCopy.get(), linkedNodes[0]);
+		EXPECT_EQ(pLinkedNodeCopy->hash(), linkedNodes[0]->hash());
+
+		node.forEachLinkedNode([&linkedNodes](const auto& linkedNode) {
+			EXPECT_EQ(linkedNodes[0], &linkedNode);
+		});
+	}
+
+	TEST(TEST_CLASS, BranchTreeNodeSharedLinkedNodeReturnsLinkedNodeWithoutCopying) {
+		// Arrange:
+		auto links = NodeLinkTraits::GenerateLinks(1);
+		auto node = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+		node.setLink(links[0], 3);
+
+		// Act:
+		auto pSharedNode1 = node.sharedLinkedNode(3);
+		auto pSharedNode2 = node.sharedLinkedNode(3);
+		auto pNodeCopy = node.linkedNode(3);
+
+		// Assert:
+		ASSERT_TRUE(!!pSharedNode1);
+		EXPECT_EQ(pSharedNode1.get(), pSharedNode2.get());
+		EXPECT_NE(pSharedNode1.get(), pNodeCopy.get());
+		EXPECT_EQ(links[0].hash(), pSharedNode1->hash());
+	}
+
+	TEST(TEST_CLASS, BranchTreeNodeSetLinkCanMoveNode) {
+		// Arrange:
+		auto childNode = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+		childNode.setLink(test::GenerateRandomData<Hash256_Size>(), 2);
+		auto linkedNode = TreeNode(childNode);
+		const auto* pLinkedBranchNode = &linkedNode.asBranchNode();
+
+		auto node = BranchTreeNode(TreeNodePath(0x64'6F'67'00));
+
+		// Act:
+		node.setLink(std::move(linkedNode), 3);
+
+		// Assert: the linked node was moved (and not copied)
+		ASSERT_TRUE(!!node.sharedLinkedNode(3));
+		EXPECT_EQ(pLinkedBranchNode, &node.sharedLinkedNode(3)->asBranchNode());
+		EXPECT_EQ(childNode.hash(), node.link(3));
+	}
+
 	// endregion
 
 	// region BranchTreeNode - hash optimization
@@ -1484,6 +1484,256 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region applyChanges
+
+	private:
+		using ChangeSet = typename tree::PatriciaTree<PassThroughEncoder, DataSource>::ChangeSet;
+
+		static Hash256 CalculateExpectedHashForPairs(const std::vector<std::pair<uint32_t, std::string>>& pairs) {
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pair : pairs)
+				context.tree().set(pair.first, pair.second);
+
+			return context.tree().root();
+		}
+
+	public:
+		static void AssertApplyEmptyChangeSetHasNoEffect() {
+			// Arrange:
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pair : GetPuppyTreeWithRootExtensionNodePairs())
+				context.tree().set(pair.first, pair.second);
+
+			auto expectedHash = context.tree().root();
+
+			// Act:
+			context.tree().applyChanges(ChangeSet());
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+		static void AssertCanApplySetChangesToEmptyTree_AnyOrder() {
+			// Arrange:
+			size_t i = 0u;
+			auto pairs = GetPuppyTreeWithRootExtensionNodePairs();
+			auto expectedHash = CalculateExpectedHashForPairs(pairs);
+			for (; 0 == i || std::next_permutation(pairs.begin(), pairs.end());) {
+				TestContext context(tree::DataSourceVerbosity::Off);
+
+				ChangeSet changeSet;
+				for (const auto& pair : pairs)
+					changeSet.set(pair.first, pair.second);
+
+				// Act:
+				context.tree().applyChanges(changeSet);
+
+				// Assert:
+				EXPECT_EQ(expectedHash, context.tree().root()) << "permutation " << i;
+				++i;
+			};
+
+			// Sanity: 4!
+			EXPECT_EQ(24u, i);
+		}
+
+		static void AssertCanApplyUnsetChangesToTree() {
+			// Arrange:
+			auto pairs = GetPuppyTreeWithRootExtensionNodePairs();
+			for (auto i = 0u; i < pairs.size(); ++i) {
+				for (auto j = i + 1; j < pairs.size(); ++j) {
+					// - calculate the expected hash by applying all values not at indexes i and j to a tree
+					auto expectedPairs = pairs;
+					expectedPairs.erase(expectedPairs.begin() + j);
+					expectedPairs.erase(expectedPairs.begin() + i);
+					auto expectedHash = CalculateExpectedHashForPairs(expectedPairs);
+
+					TestContext context(tree::DataSourceVerbosity::Off);
+					for (const auto& pair : pairs)
+						context.tree().set(pair.first, pair.second);
+
+					ChangeSet changeSet;
+					changeSet.unset(pairs[i].first);
+					changeSet.unset(pairs[j].first);
+
+					// Act:
+					context.tree().applyChanges(changeSet);
+
+					// Assert:
+					EXPECT_EQ(expectedHash, context.tree().root()) << "unset (" << i << ", " << j << ")";
+				}
+			}
+		}
+
+		static void AssertCanApplyUnsetChangesForAllKeysInTree() {
+			// Arrange:
+			TestContext context(tree::DataSourceVerbosity::Off);
+			ChangeSet changeSet;
+			for (const auto& pair : GetPuppyTreeWithRootExtensionNodePairs()) {
+				context.tree().set(pair.first, pair.second);
+				changeSet.unset(pair.first);
+			}
+
+			// Act:
+			context.tree().applyChanges(changeSet);
+
+			// Assert:
+			EXPECT_EQ(Hash256(), context.tree().root());
+		}
+
+		static void AssertApplyUnsetChangesForKeysNotInTreeHasNoEffect() {
+			// Arrange:
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pair : GetPuppyTreeWithRootExtensionNodePairs())
+				context.tree().set(pair.first, pair.second);
+
+			auto expectedHash = context.tree().root();
+
+			// - unset keys diverging from the root extension path, from a branch and from a leaf
+			ChangeSet changeSet;
+			changeSet.unset(0x26'6F'00'00);
+			changeSet.unset(0x64'6F'6F'00);
+			changeSet.unset(0x64'6F'67'66);
+
+			// Act:
+			context.tree().applyChanges(changeSet);
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+		static void AssertOnlyLastChangeToKeyIsApplied() {
+			// Arrange:
+			auto pairs = GetPuppyTreeWithRootExtensionNodePairs();
+			auto expectedPairs = pairs;
+			expectedPairs[1].second = "kitten";
+			expectedPairs.erase(expectedPairs.begin() + 2);
+			auto expectedHash = CalculateExpectedHashForPairs(expectedPairs);
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+			ChangeSet changeSet;
+			changeSet.unset(pairs[1].first);
+			for (const auto& pair : pairs)
+				changeSet.set(pair.first, pair.second);
+
+			changeSet.set(pairs[1].first, "kitten");
+			changeSet.unset(pairs[2].first);
+
+			// Act:
+			context.tree().applyChanges(changeSet);
+
+			// Assert:
+			EXPECT_EQ(expectedHash, context.tree().root());
+		}
+
+		static void AssertApplyChangesIsEquivalentToSequentialChanges() {
+			// Arrange: use masked keys in order to create deep shared paths
+			std::vector<uint32_t> keys;
+			for (auto i = 0u; i < 500; ++i)
+				keys.push_back(static_cast<uint32_t>(test::Random()) & 0xF0'FF'0F'0F);
+
+			TestContext batchContext(tree::DataSourceVerbosity::Off);
+			TestContext sequentialContext(tree::DataSourceVerbosity::Off);
+			for (auto i = 0u; i < keys.size() / 2; ++i) {
+				batchContext.tree().set(keys[i], std::to_string(i));
+				sequentialContext.tree().set(keys[i], std::to_string(i));
+			}
+
+			// - update and remove some existing keys and add some new keys
+			ChangeSet changeSet;
+			for (auto i = 0u; i < keys.size(); ++i) {
+				auto key = keys[(i * 7) % keys.size()];
+				if (0 == i % 3) {
+					changeSet.unset(key);
+					sequentialContext.tree().unset(key);
+				} else {
+					changeSet.set(key, std::to_string(i + 1000));
+					sequentialContext.tree().set(key, std::to_string(i + 1000));
+				}
+			}
+
+			// Act:
+			batchContext.tree().applyChanges(changeSet);
+
+			// Assert:
+			EXPECT_EQ(sequentialContext.tree().root(), batchContext.tree().root());
+		}
+
+		// endregion
+
+		// region root (subtrees hasher)
+
+	private:
+		template<typename TTree>
+		static std::pair<Hash256, size_t> CalculateRootWithSubtreesHasher(const TTree& tree, size_t numFanOutLevels) {
+			size_t numSubtrees = 0;
+			auto rootHash = tree.root(numFanOutLevels, [&numSubtrees](const auto& subtrees) {
+				// hash subtrees in reverse order to ensure subtree hashes are independent of each other
+				for (auto iter = subtrees.crbegin(); subtrees.crend() != iter; ++iter) {
+					EXPECT_TRUE((*iter)->isBranch());
+					(*iter)->hash();
+				}
+
+				numSubtrees = subtrees.size();
+			});
+
+			return std::make_pair(rootHash, numSubtrees);
+		}
+
+	public:
+		static void AssertRootWithSubtreesHasherDoesNotHashSubtreesWhenTreeIsEmpty() {
+			// Arrange:
+			TestContext context(tree::DataSourceVerbosity::Off);
+
+			// Act:
+			auto result = CalculateRootWithSubtreesHasher(context.tree(), 2);
+
+			// Assert:
+			EXPECT_EQ(Hash256(), result.first);
+			EXPECT_EQ(0u, result.second);
+		}
+
+		static void AssertRootWithSubtreesHasherDoesNotHashSubtreesWhenRootIsLeaf() {
+			// Arrange:
+			TestContext context(tree::DataSourceVerbosity::Off);
+			context.tree().set(0x64'6F'00'00, "verb");
+			auto expectedHash = context.tree().root();
+
+			// Act:
+			auto result = CalculateRootWithSubtreesHasher(context.tree(), 2);
+
+			// Assert:
+			EXPECT_EQ(expectedHash, result.first);
+			EXPECT_EQ(0u, result.second);
+		}
+
+		static void AssertRootWithSubtreesHasherIsEqualToRoot() {
+			// Arrange:
+			std::vector<uint32_t> keys;
+			for (auto i = 0u; i < 500; ++i)
+				keys.push_back(static_cast<uint32_t>(test::Random()));
+
+			TestContext expectedContext(tree::DataSourceVerbosity::Off);
+			for (auto i = 0u; i < keys.size(); ++i)
+				expectedContext.tree().set(keys[i], std::to_string(i));
+
+			for (auto numFanOutLevels : { 0u, 1u, 2u }) {
+				// - use a fresh tree for each level because node hashes are cached after the first root calculation
+				TestContext context(tree::DataSourceVerbosity::Off);
+				for (auto i = 0u; i < keys.size(); ++i)
+					context.tree().set(keys[i], std::to_string(i));
+
+				// Act:
+				auto result = CalculateRootWithSubtreesHasher(context.tree(), numFanOutLevels);
+
+				// Assert:
+				EXPECT_EQ(expectedContext.tree().root(), result.first) << numFanOutLevels;
+				EXPECT_LT(0u, result.second) << numFanOutLevels;
+			}
+		}
+
+		// endregion
+
 		// region tryLoad
 
 	private:
@@ -1704,6 +1954,18 @@ namespace catapult { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanUndoPuppyTreeWithRootExtensionNode_AnyOrder) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyEmptyChangeSetHasNoEffect) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanApplySetChangesToEmptyTree_AnyOrder) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanApplyUnsetChangesToTree) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanApplyUnsetChangesForAllKeysInTree) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyUnsetChangesForKeysNotInTreeHasNoEffect) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, OnlyLastChangeToKeyIsApplied) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, ApplyChangesIsEquivalentToSequentialChanges) \
+	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, RootWithSubtreesHasherDoesNotHashSubtreesWhenTreeIsEmpty) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, RootWithSubtreesHasherDoesNotHashSubtreesWhenRootIsLeaf) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, RootWithSubtreesHasherIsEqualToRoot) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundLatestRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundPreviousRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundNonRootHash) \
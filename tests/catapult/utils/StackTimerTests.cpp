@@ -54,6 +54,19 @@ namespace catapult { namespace utils {
 		EXPECT_LE(elapsedMillis1, elapsedMillis2);
 	}
 
+	TEST(TEST_CLASS, ElapsedMicrosIsConsistentWithElapsedMillis) {
+		// Arrange:
+		StackTimer stackTimer;
+
+		// Act:
+		test::Sleep(5);
+		auto elapsedMillis = stackTimer.millis();
+		auto elapsedMicros = stackTimer.micros();
+
+		// Assert:
+		EXPECT_LE(elapsedMillis * 1000, elapsedMicros);
+	}
+
 	namespace {
 		constexpr auto Sleep_Millis = 5u;
 		constexpr auto Epsilon_Millis = 1u;
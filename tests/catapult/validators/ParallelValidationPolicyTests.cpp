@@ -22,6 +22,7 @@
 #include "tests/catapult/validators/test/ValidationPolicyTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/BasicMultiThreadedState.h"
+#include <numeric>
 
 namespace catapult { namespace validators {
 
@@ -557,28 +558,30 @@ namespace catapult { namespace validators {
 		}
 
 		template<typename TTraits>
-		void AssertCanDistributeWorkEvenly(size_t numValidators, size_t numEntities) {
+		void AssertCanDistributeWorkAcrossThreads(size_t numValidators, size_t numEntities) {
 			// Arrange:
 			auto states = CreateMultithreadedStates(numValidators);
 
 			// Act:
 			ValidateMany<TTraits>(states, numValidators, numEntities);
+			if (0 == numEntities)
+				return;
 
 			// Assert: each validator was called numEntities times (with a unique entity)
-			auto minWorkPerThread = numEntities / Num_Default_Threads;
 			for (auto i = 0u; i < numValidators; ++i) {
 				const auto& state = *states[i];
 				EXPECT_EQ(numEntities, state.counter()) << "validator " << i;
 				EXPECT_EQ(numEntities, state.numUniqueItems()) << "validator " << i;
 
-				// - the work was distributed evenly across threads
-				//   (a thread can do more than the min amount of work if the number of entities is not divisible by
-				//    the number of threads)
-				for (auto counter : state.threadCounters())
-					EXPECT_LE(minWorkPerThread, counter) << "validator " << i;
+				// - the work was distributed across all pool threads
+				//   (work stealing allows threads that finish early to do more than an even share of work, but the validation
+				//    function blocks until every thread has started an entity, so each thread processes at least one entity)
+				auto threadCounters = state.threadCounters();
+				for (auto counter : threadCounters)
+					EXPECT_LE(1u, counter) << "validator " << i;
 
-				EXPECT_EQ(Num_Default_Threads, state.threadCounters().size());
-				EXPECT_EQ(Num_Default_Threads, state.sortedAndReducedThreadIds().size());
+				EXPECT_EQ(Num_Default_Threads, threadCounters.size()) << "validator " << i;
+				EXPECT_EQ(numEntities, std::accumulate(threadCounters.cbegin(), threadCounters.cend(), static_cast<size_t>(0)));
 			}
 		}
 	}
@@ -593,14 +596,14 @@ namespace catapult { namespace validators {
 		AssertCanHandleManyValidatorsAndEntities<TTraits>(100, Num_Default_Threads / 4 * 81);
 	}
 
-	PARALLEL_POLICY_TEST(CanDistributeWorkEvenlyWhenEntitiesAreMultipleOfThreads) {
+	PARALLEL_POLICY_TEST(CanDistributeWorkAcrossThreadsWhenEntitiesAreMultipleOfThreads) {
 		// Assert:
-		AssertCanDistributeWorkEvenly<TTraits>(100, Num_Default_Threads * 20);
+		AssertCanDistributeWorkAcrossThreads<TTraits>(100, Num_Default_Threads * 20);
 	}
 
-	PARALLEL_POLICY_TEST(CanDistributeWorkEvenlyWhenEntitiesAreNotMultipleOfThreads) {
+	PARALLEL_POLICY_TEST(CanDistributeWorkAcrossThreadsWhenEntitiesAreNotMultipleOfThreads) {
 		// Assert:
-		AssertCanDistributeWorkEvenly<TTraits>(100, Num_Default_Threads / 4 * 81);
+		AssertCanDistributeWorkAcrossThreads<TTraits>(100, Num_Default_Threads / 4 * 81);
 	}
 
 	// endregion
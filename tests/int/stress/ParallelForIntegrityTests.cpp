@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/ParallelFor.h"
+#include "catapult/thread/WorkStealingParallelFor.h"
+#include "catapult/utils/StackTimer.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace thread {
+
+#define TEST_CLASS ParallelForIntegrityTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Iterations = 50u;
+#else
+		constexpr size_t Num_Iterations = 5u;
+#endif
+
+		constexpr size_t Num_Items_Per_Thread = 32;
+
+		// all expensive items are adjacent, so they are all assigned to the same partition by static partitioning
+		bool IsExpensiveItem(size_t index) {
+			return index < Num_Items_Per_Thread;
+		}
+
+		template<typename TParallelFor>
+		uint64_t MeasureMaxLatency(IoServiceThreadPool& pool, TParallelFor parallelFor) {
+			std::vector<uint32_t> items(pool.numWorkerThreads() * Num_Items_Per_Thread);
+
+			uint64_t maxElapsedMillis = 0;
+			for (auto i = 0u; i < Num_Iterations; ++i) {
+				utils::StackTimer stopwatch;
+				parallelFor(pool.service(), items, pool.numWorkerThreads(), [](auto, auto index) {
+					if (IsExpensiveItem(index))
+						std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+					return true;
+				}).get();
+
+				maxElapsedMillis = std::max(maxElapsedMillis, stopwatch.millis());
+			}
+
+			return maxElapsedMillis;
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, WorkStealingParallelForHasLowerTailLatencyForSkewedItemCosts) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+
+		// Act:
+		auto staticMaxLatency = MeasureMaxLatency(*pPool, [](auto& service, auto& items, auto numPartitions, auto callback) {
+			return ParallelFor(service, items, numPartitions, callback);
+		});
+		auto workStealingMaxLatency = MeasureMaxLatency(*pPool, [](auto& service, auto& items, auto numPartitions, auto callback) {
+			return WorkStealingParallelFor(service, items, numPartitions, callback);
+		});
+
+		// Assert: static partitioning processes all expensive items serially while work stealing spreads them across threads
+		CATAPULT_LOG(info) << "max latency (static partitioning): " << staticMaxLatency << "ms";
+		CATAPULT_LOG(info) << "max latency (work stealing): " << workStealingMaxLatency << "ms";
+		EXPECT_GT(staticMaxLatency, workStealingMaxLatency);
+	}
+}}
@@ -36,6 +36,7 @@ namespace catapult {
 		template<typename TViewExtension, typename TDeltaExtension>
 		class BasicSimpleCacheViewExtension;
 	}
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace test {
@@ -158,7 +159,7 @@ namespace catapult { namespace test {
 
 	public:
 		/// Recalculates the merkle root given the specified chain \a height if supported.
-		void updateMerkleRoot(Height height) {
+		void updateMerkleRoot(Height height, thread::IoServiceThreadPool*) {
 			// change the first byte
 			(*m_pMerkleRoot)[0] = static_cast<uint8_t>(height.unwrap());
 		}
@@ -68,6 +68,8 @@ namespace catapult { namespace test {
 			config.IncomingSecurityModes = ionet::ConnectionSecurityMode::None;
 
 			config.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromMegabytes(5);
+			config.PatriciaTreeNodeCacheMaxSize = 100'000;
+			config.MaxStateMultiproofKeys = 100;
 			config.MaxTrackedNodes = 5'000;
 
 			config.Local.Host = "127.0.0.1";
@@ -78,6 +80,8 @@ namespace catapult { namespace test {
 
 			SetConnectionsSubConfiguration(config.IncomingConnections);
 			config.IncomingConnections.BacklogSize = 100;
+
+			config.CacheDatabase.ShouldSyncWrites = true;
 			return config;
 		}
 
@@ -21,10 +21,40 @@
 #include "tools/ToolMain.h"
 #include "tools/ToolKeys.h"
 #include "tools/ToolThreadUtils.h"
+#include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/Signer.h"
+#include "catapult/state/PosImportances.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/multiprecision/cpp_int.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	// counts all heap allocations so that benchmarks can report allocation pressure
+	std::atomic<uint64_t> g_numAllocations(0);
+}
+
+void* operator new(size_t size) {
+	++g_numAllocations;
+	auto* pMemory = std::malloc(0 == size ? 1 : size);
+	if (!pMemory)
+		throw std::bad_alloc();
+
+	return pMemory;
+}
+
+void operator delete(void* pMemory) noexcept {
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept {
+	std::free(pMemory);
+}
 
 namespace catapult { namespace tools { namespace benchmark {
 
@@ -35,6 +65,38 @@ namespace catapult { namespace tools { namespace benchmark {
 			bool IsVerified = false;
 		};
 
+		struct HashBenchmarkEntry {
+			std::vector<uint8_t> Data;
+			Hash256 Hash;
+		};
+
+		// message sizes used by the sha3 benchmark (merkle pair, typical transaction sizes and larger payloads)
+		constexpr uint32_t Sha3_Message_Sizes[] = { 64, 148, 256, 512, 1024, 4096 };
+
+		// number of tree levels below the root at which the tree benchmark fans out subtree hashing
+		constexpr size_t Num_Subtree_Fan_Out_Levels = 2;
+
+		// numbers of eligible accounts used by the importance benchmark
+		constexpr size_t Importance_Account_Counts[] = { 100'000, 1'000'000, 10'000'000 };
+
+		// total chain balance used by the importance benchmark
+		constexpr auto Importance_Total_Chain_Balance = utils::XemUnit(utils::XemAmount(9'000'000'000));
+
+		struct HashTreeEncoder {
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using BenchmarkTree = tree::PatriciaTree<HashTreeEncoder, tree::MemoryDataSource>;
+
 		class BenchmarkTool : public Tool {
 		public:
 			std::string name() const override {
@@ -54,12 +116,38 @@ namespace catapult { namespace tools { namespace benchmark {
 				optionsBuilder("data size,s",
 						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
 						"the size of the data to generate");
+				optionsBuilder("num leaves,l",
+						OptionsValue<uint32_t>(m_numLeaves)->default_value(1'000'000),
+						"the number of tree leaves to generate");
+				optionsBuilder("mode,m",
+						OptionsValue<std::string>(m_mode)->default_value("signature"),
+						"the benchmark to run (signature, sha3, tree, importance)");
 			}
 
 			int run(const Options&) override {
 				m_numThreads = 0 != m_numThreads ? m_numThreads : std::thread::hardware_concurrency();
 				m_numPartitions = 0 != m_numPartitions ? m_numPartitions : m_numThreads;
 
+				if ("signature" != m_mode && "sha3" != m_mode && "tree" != m_mode && "importance" != m_mode) {
+					CATAPULT_LOG(error) << "unknown benchmark mode: " << m_mode;
+					return -1;
+				}
+
+				auto pPool = CreateStartedThreadPool(m_numThreads);
+				if ("sha3" == m_mode)
+					runSha3Benchmark(*pPool);
+				else if ("tree" == m_mode)
+					runTreeBenchmark(*pPool);
+				else if ("importance" == m_mode)
+					runImportanceBenchmark(*pPool);
+				else
+					runSignatureBenchmark(*pPool);
+
+				return 0;
+			}
+
+		private:
+			void runSignatureBenchmark(thread::IoServiceThreadPool& pool) const {
 				CATAPULT_LOG(info)
 						<< "num threads (" << m_numThreads
 						<< "), num partitions (" << m_numPartitions
@@ -68,40 +156,185 @@ namespace catapult { namespace tools { namespace benchmark {
 
 				auto keyPair = GenerateRandomKeyPair();
 				auto entries = std::vector<BenchmarkEntry>(m_numPartitions * m_opsPerPartition);
-				auto pPool = CreateStartedThreadPool(m_numThreads);
 
 				CATAPULT_LOG(info) << "num operations (" << entries.size() << ")";
 
-				RunParallel("Data Generation", *pPool, entries, [dataSize = m_dataSize](auto& entry) {
+				RunParallel("Data Generation", pool, entries, [dataSize = m_dataSize](auto& entry) {
 					entry.Data.resize(dataSize);
 					std::generate_n(entry.Data.begin(), entry.Data.size(), []() { return static_cast<uint8_t>(std::rand()); });
 				});
 
-				RunParallel("Signature", *pPool, entries, [&keyPair](auto& entry) {
+				RunParallel("Signature", pool, entries, [&keyPair](auto& entry) {
 					crypto::Sign(keyPair, entry.Data, entry.Signature);
 				});
 
-				RunParallel("Verify", *pPool, entries, [&keyPair](auto& entry) {
+				RunParallel("Verify", pool, entries, [&keyPair](auto& entry) {
 					entry.IsVerified = crypto::Verify(keyPair.publicKey(), entry.Data, entry.Signature);
 					if (!entry.IsVerified)
 						CATAPULT_LOG(warning) << "could not verify data!";
 				});
+			}
 
-				return 0;
+			void runSha3Benchmark(thread::IoServiceThreadPool& pool) const {
+				CATAPULT_LOG(info)
+						<< "num threads (" << m_numThreads
+						<< "), num partitions (" << m_numPartitions
+						<< "), ops / partition (" << m_opsPerPartition << ")";
+
+				for (auto messageSize : Sha3_Message_Sizes) {
+					CATAPULT_LOG(info) << "*** message size (" << messageSize << ") ***";
+					auto entries = std::vector<HashBenchmarkEntry>(m_numPartitions * m_opsPerPartition);
+					RunParallel("Data Generation", pool, entries, [messageSize](auto& entry) {
+						entry.Data.resize(messageSize);
+						std::generate_n(entry.Data.begin(), entry.Data.size(), []() { return static_cast<uint8_t>(std::rand()); });
+					});
+
+					RunParallel("Sha3 Single", pool, entries, [](auto& entry) {
+						crypto::Sha3_256(entry.Data, entry.Hash);
+					});
+
+					RunParallelPartitioned("Sha3 Multi", pool, entries, [](auto itBegin, auto itEnd) {
+						std::vector<RawBuffer> buffers;
+						std::vector<Hash256> hashes(static_cast<size_t>(std::distance(itBegin, itEnd)));
+						for (auto iter = itBegin; itEnd != iter; ++iter)
+							buffers.push_back(iter->Data);
+
+						crypto::Sha3_256_Multi(buffers.data(), hashes.data(), hashes.size());
+
+						auto i = 0u;
+						for (auto iter = itBegin; itEnd != iter; ++iter) {
+							if (iter->Hash != hashes[i++])
+								CATAPULT_LOG(warning) << "multi-buffer hash does not match single hash!";
+						}
+					});
+				}
 			}
 
-		private:
-			template<typename TAction>
+			void runTreeBenchmark(thread::IoServiceThreadPool& pool) const {
+				CATAPULT_LOG(info) << "num threads (" << m_numThreads << "), num leaves (" << m_numLeaves << ")";
+
+				auto entries = std::vector<HashBenchmarkEntry>(m_numLeaves);
+				RunParallel("Data Generation", pool, entries, [](auto& entry) {
+					entry.Data.resize(Hash256_Size);
+					std::generate_n(entry.Data.begin(), entry.Data.size(), []() { return static_cast<uint8_t>(std::rand()); });
+					crypto::Sha3_256(entry.Data, entry.Hash);
+				});
+
+				auto serialRootHash = BuildAndHashTree("Tree Hash Serial", entries, [](const auto& tree) {
+					return tree.root();
+				});
+
+				auto parallelRootHash = BuildAndHashTree("Tree Hash Parallel", entries, [&pool](const auto& tree) {
+					return tree.root(Num_Subtree_Fan_Out_Levels, [&pool](const auto& subtrees) {
+						CATAPULT_LOG(info) << "hashing " << subtrees.size() << " subtrees in parallel";
+						thread::ParallelFor(pool.service(), subtrees, pool.numWorkerThreads(), [](const auto* pSubtree, auto) {
+							pSubtree->hash();
+							return true;
+						}).get();
+					});
+				});
+
+				if (serialRootHash != parallelRootHash)
+					CATAPULT_LOG(warning) << "parallel tree root hash does not match serial tree root hash!";
+			}
+
+			void runImportanceBenchmark(thread::IoServiceThreadPool& pool) const {
+				CATAPULT_LOG(info) << "num threads (" << m_numThreads << ")";
+
+				for (auto numAccounts : Importance_Account_Counts) {
+					CATAPULT_LOG(info) << "*** num accounts (" << numAccounts << ") ***";
+					auto balances = std::vector<Amount>(numAccounts);
+					RunParallel("Data Generation", pool, balances, [numAccounts](auto& balance) {
+						auto maxBalance = Importance_Total_Chain_Balance.microxem().unwrap() / numAccounts;
+						balance = Amount((static_cast<uint64_t>(std::rand()) << 32 | static_cast<uint64_t>(std::rand())) % maxBalance);
+					});
+
+					std::vector<Importance> serialImportances;
+					{
+						utils::StackLogger logger("Importance Serial (uint128_t)", utils::LogLevel::Info);
+						serialImportances = CalculateImportancesSerial(balances);
+					}
+
+					std::vector<Importance> parallelImportances;
+					{
+						utils::StackLogger logger("Importance Parallel", utils::LogLevel::Info);
+						state::CalculatePosImportances(Importance_Total_Chain_Balance, balances, parallelImportances, &pool);
+					}
+
+					if (serialImportances != parallelImportances)
+						CATAPULT_LOG(warning) << "parallel importances do not match serial importances!";
+				}
+			}
+
+			static std::vector<Importance> CalculateImportancesSerial(const std::vector<Amount>& balances) {
+				Amount activeXem;
+				for (auto balance : balances)
+					activeXem = activeXem + balance;
+
+				std::vector<Importance> importances;
+				importances.reserve(balances.size());
+				for (auto balance : balances) {
+					boost::multiprecision::uint128_t importance = Importance_Total_Chain_Balance.microxem().unwrap();
+					importance *= balance.unwrap();
+					importance /= activeXem.unwrap();
+					importance /= utils::XemUnit(utils::XemAmount(1)).microxem().unwrap();
+					importances.push_back(Importance(static_cast<Importance::ValueType>(importance)));
+				}
+
+				return importances;
+			}
+
+			template<typename TCalculateRoot>
+			static Hash256 BuildAndHashTree(
+					const char* testName,
+					const std::vector<HashBenchmarkEntry>& entries,
+					TCalculateRoot calculateRoot) {
+				tree::MemoryDataSource dataSource;
+				BenchmarkTree tree(dataSource);
+				{
+					utils::StackLogger logger("Tree Build", utils::LogLevel::Info);
+					auto numStartAllocations = g_numAllocations.load();
+					BenchmarkTree::ChangeSet changeSet;
+					for (const auto& entry : entries)
+						changeSet.set(entry.Hash, entry.Hash);
+
+					tree.applyChanges(changeSet);
+
+					auto numAllocations = g_numAllocations.load() - numStartAllocations;
+					CATAPULT_LOG(info)
+							<< numAllocations << " allocations ("
+							<< (entries.empty() ? 0 : numAllocations / entries.size()) << " allocations / set)";
+				}
+
+				utils::StackLogger logger(testName, utils::LogLevel::Info);
+				return calculateRoot(tree);
+			}
+
+			template<typename TEntry, typename TAction>
 			uint64_t RunParallel(
 					const char* testName,
 					thread::IoServiceThreadPool& pool,
-					std::vector<BenchmarkEntry>& entries,
+					std::vector<TEntry>& entries,
 					TAction action) const {
+				return RunParallelPartitioned(testName, pool, entries, [action](auto itBegin, auto itEnd) {
+					std::for_each(itBegin, itEnd, action);
+				});
+			}
+
+			template<typename TEntry, typename TPartitionAction>
+			uint64_t RunParallelPartitioned(
+					const char* testName,
+					thread::IoServiceThreadPool& pool,
+					std::vector<TEntry>& entries,
+					TPartitionAction partitionAction) const {
 				utils::StackLogger logger(testName, utils::LogLevel::Info);
 				utils::StackTimer stopwatch;
-				thread::ParallelFor(pool.service(), entries, m_numPartitions, [action](auto& entry, auto) {
-					action(entry);
-					return true;
+				thread::ParallelForPartition(pool.service(), entries, m_numPartitions, [partitionAction](
+						auto itBegin,
+						auto itEnd,
+						auto,
+						auto) {
+					partitionAction(itBegin, itEnd);
 				}).get();
 
 				auto elapsedMillis = stopwatch.millis();
@@ -118,6 +351,8 @@ namespace catapult { namespace tools { namespace benchmark {
 			uint32_t m_numPartitions;
 			uint32_t m_opsPerPartition;
 			uint32_t m_dataSize;
+			uint32_t m_numLeaves;
+			std::string m_mode;
 		};
 	}
 }}}
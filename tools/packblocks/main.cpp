@@ -0,0 +1,77 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PackedBlockStorage.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/StackLogger.h"
+#include "catapult/exceptions.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace tools { namespace packblocks {
+
+	namespace {
+		class PackBlocksTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Pack Blocks Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("source,s",
+						OptionsValue<std::string>(m_sourceDirectory)->required(),
+						"data directory containing file-based block storage");
+				optionsBuilder("destination,d",
+						OptionsValue<std::string>(m_destinationDirectory)->required(),
+						"data directory that should contain packed block storage");
+			}
+
+			int run(const Options&) override {
+				boost::filesystem::create_directories(m_destinationDirectory);
+				if (boost::filesystem::equivalent(m_sourceDirectory, m_destinationDirectory))
+					CATAPULT_THROW_INVALID_ARGUMENT("source and destination directories must be different");
+
+				io::FileBlockStorage source(m_sourceDirectory);
+				io::PackedBlockStorage destination(m_destinationDirectory);
+				CATAPULT_LOG(info)
+						<< "packing blocks from " << m_sourceDirectory << " (height " << source.chainHeight() << ") into "
+						<< m_destinationDirectory << " (height " << destination.chainHeight() << ")";
+
+				{
+					utils::StackLogger logger("packing blocks", utils::LogLevel::Info);
+					io::CopyBlocks(source, destination);
+				}
+
+				CATAPULT_LOG(info) << "packed block storage has height " << destination.chainHeight();
+				return 0;
+			}
+
+		private:
+			std::string m_sourceDirectory;
+			std::string m_destinationDirectory;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::packblocks::PackBlocksTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}